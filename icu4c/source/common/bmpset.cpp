@@ -48,6 +48,7 @@ BMPSet::BMPSet(const int32_t *parentList, int32_t parentListLength) :
     containsFFFD=containsSlow(0xfffd, list4kStarts[0xf], list4kStarts[0x10]);
 
     initBits();
+    initSuppBits();
     overrideIllegal();
 }
 
@@ -58,6 +59,8 @@ BMPSet::BMPSet(const BMPSet &otherBMPSet, const int32_t *newParentList, int32_t
     uprv_memcpy(table7FF, otherBMPSet.table7FF, sizeof(table7FF));
     uprv_memcpy(bmpBlockBits, otherBMPSet.bmpBlockBits, sizeof(bmpBlockBits));
     uprv_memcpy(list4kStarts, otherBMPSet.list4kStarts, sizeof(list4kStarts));
+    uprv_memcpy(suppBlockBits, otherBMPSet.suppBlockBits, sizeof(suppBlockBits));
+    uprv_memcpy(listPlaneStarts, otherBMPSet.listPlaneStarts, sizeof(listPlaneStarts));
 }
 
 BMPSet::~BMPSet() {
@@ -218,6 +221,112 @@ void BMPSet::initBits() {
     }
 }
 
+/*
+ * Classify each 64-block of supplementary code points as all-zero,
+ * all-one, or mixed, and set the per-plane binary search bounds.
+ * Blocks default to all-zero, so a single pass over the supplementary
+ * ranges of the list only has to mark the blocks that each range
+ * touches; like initBits() for bmpBlockBits[], this makes freezing
+ * cost proportional to the number of ranges, not to the 0x4000 blocks.
+ */
+void BMPSet::initSuppBits() {
+    uprv_memset(suppBlockBits, 0, sizeof(suppBlockBits));
+
+    /*
+     * Set the list indexes for binary searches for
+     * U+10000, U+20000, .., U+100000, U+110000.
+     */
+    listPlaneStarts[0]=list4kStarts[0x10];
+    int32_t i;
+    for(i=1; i<=0xf; ++i) {
+        listPlaneStarts[i]=findCodePoint(0x10000+(i<<16), listPlaneStarts[i-1], listLength-1);
+    }
+    listPlaneStarts[0x10]=listLength-1;
+
+    // Find the first range overlapping with the supplementary code points.
+    int32_t listIndex=list4kStarts[0x10];
+    UChar32 start, limit;
+    if(listIndex&1) {
+        // A range straddles U+10000.
+        start=0x10000;
+        limit=list[listIndex++];
+    } else {
+        if(listIndex<listLength) {
+            start=list[listIndex++];
+        } else {
+            start=0x110000;
+        }
+        if(listIndex<listLength) {
+            limit=list[listIndex++];
+        } else {
+            limit=0x110000;
+        }
+    }
+
+    UChar32 minStart=0x10000;
+    while(start<0x110000) {
+        if(limit>0x110000) {
+            limit=0x110000;
+        }
+
+        if(start<minStart) {
+            start=minStart;
+        }
+        if(start<limit) {  // Else: Another range entirely in a known mixed-value block.
+            if(start&0x3f) {
+                // Mixed-value block of 64 code points.
+                int32_t block=(start-0x10000)>>6;
+                suppBlockBits[block>>4]|=(uint32_t)2<<((block&0xf)<<1);
+                start=(start+0x40)&~0x3f;  // Round up to the next block boundary.
+                minStart=start;            // Ignore further ranges in this block.
+            }
+            if(start<limit) {
+                if(start<(limit&~0x3f)) {
+                    // All-ones blocks of 64 code points each.
+                    int32_t block=(start-0x10000)>>6;
+                    int32_t blockLimit=(limit-0x10000)>>6;
+                    while((block&0xf)!=0 && block<blockLimit) {
+                        suppBlockBits[block>>4]|=(uint32_t)1<<((block&0xf)<<1);
+                        ++block;
+                    }
+                    while((block+0x10)<=blockLimit) {
+                        // Sixteen all-ones blocks at once.
+                        suppBlockBits[block>>4]|=0x55555555;
+                        block+=0x10;
+                    }
+                    while(block<blockLimit) {
+                        suppBlockBits[block>>4]|=(uint32_t)1<<((block&0xf)<<1);
+                        ++block;
+                    }
+                }
+
+                if(limit&0x3f) {
+                    // Mixed-value block of 64 code points.
+                    int32_t block=(limit-0x10000)>>6;
+                    suppBlockBits[block>>4]|=(uint32_t)2<<((block&0xf)<<1);
+                    limit=(limit+0x40)&~0x3f;  // Round up to the next block boundary.
+                    minStart=limit;            // Ignore further ranges in this block.
+                }
+            }
+        }
+
+        if(limit==0x110000) {
+            break;
+        }
+
+        if(listIndex<listLength) {
+            start=list[listIndex++];
+        } else {
+            start=0x110000;
+        }
+        if(listIndex<listLength) {
+            limit=list[listIndex++];
+        } else {
+            limit=0x110000;
+        }
+    }
+}
+
 /*
  * Override some bits and bytes to the result of contains(FFFD)
  * for faster validity checking at runtime.
@@ -306,8 +415,21 @@ BMPSet::contains(UChar32 c) const {
             return containsSlow(c, list4kStarts[lead], list4kStarts[lead+1]);
         }
     } else if((uint32_t)c<=0x10ffff) {
-        // surrogate or supplementary code point
-        return containsSlow(c, list4kStarts[0xd], list4kStarts[0x11]);
+        if(c>=0x10000) {
+            int32_t block=(c-0x10000)>>6;
+            uint32_t twoBits=(suppBlockBits[block>>4]>>((block&0xf)<<1))&3;
+            if(twoBits<=1) {
+                // All 64 code points with the same bits 20..6
+                // are either in the set or not.
+                return (UBool)twoBits;
+            } else {
+                // Look up the code point in its plane of code points.
+                int32_t plane=(c>>16)-1;
+                return containsSlow(c, listPlaneStarts[plane], listPlaneStarts[plane+1]);
+            }
+        }
+        // surrogate code point
+        return containsSlow(c, list4kStarts[0xd], list4kStarts[0xe]);
     } else {
         // Out-of-range code points get FALSE, consistent with long-standing
         // behavior of UnicodeSet::contains(c).
@@ -315,6 +437,42 @@ BMPSet::contains(UChar32 c) const {
     }
 }
 
+/*
+ * Process eight bytes at a time: one wide load and mask detects any
+ * non-ASCII byte, and the latin1Contains[] lookups for an all-ASCII
+ * group run without a limit check or taken branch per byte.
+ * The compiler can vectorize the wide test; there are no
+ * processor-specific intrinsics in ICU.
+ */
+const uint8_t *
+BMPSet::spanASCIIBytes(const uint8_t *s, const uint8_t *limit,
+                       UBool spanCondition) const {
+    while((limit-s)>=8) {
+        uint64_t w;
+        uprv_memcpy(&w, s, 8);  // Safe unaligned read.
+        if(w&UINT64_C(0x8080808080808080)) {
+            break;
+        }
+        if( latin1Contains[s[0]]!=spanCondition || latin1Contains[s[1]]!=spanCondition ||
+            latin1Contains[s[2]]!=spanCondition || latin1Contains[s[3]]!=spanCondition ||
+            latin1Contains[s[4]]!=spanCondition || latin1Contains[s[5]]!=spanCondition ||
+            latin1Contains[s[6]]!=spanCondition || latin1Contains[s[7]]!=spanCondition) {
+            break;
+        }
+        s+=8;
+    }
+    // Find the exact span limit in the remainder, or in a group
+    // where the wide tests stopped.
+    while(s<limit) {
+        uint8_t b=*s;
+        if(!U8_IS_SINGLE(b) || latin1Contains[b]!=spanCondition) {
+            break;
+        }
+        ++s;
+    }
+    return s;
+}
+
 /*
  * Check for sufficient length for trail unit for each surrogate pair.
  * Handle single surrogates as surrogate code points as usual in ICU.
@@ -512,20 +670,11 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
     uint8_t b=*s;
     if(U8_IS_SINGLE(b)) {
         // Initial all-ASCII span.
-        if(spanCondition) {
-            do {
-                if(!latin1Contains[b] || ++s==limit) {
-                    return s;
-                }
-                b=*s;
-            } while(U8_IS_SINGLE(b));
-        } else {
-            do {
-                if(latin1Contains[b] || ++s==limit) {
-                    return s;
-                }
-                b=*s;
-            } while(U8_IS_SINGLE(b));
+        s=spanASCIIBytes(s, limit, (UBool)(spanCondition!=USET_SPAN_NOT_CONTAINED));
+        if(s==limit || U8_IS_SINGLE(*s)) {
+            // Reached the limit, or an ASCII byte that does not
+            // fulfill the span condition.
+            return s;
         }
         length=(int32_t)(limit-s);
     }
@@ -578,24 +727,14 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
         b=*s;
         if(U8_IS_SINGLE(b)) {
             // ASCII
-            if(spanCondition) {
-                do {
-                    if(!latin1Contains[b]) {
-                        return s;
-                    } else if(++s==limit) {
-                        return limit0;
-                    }
-                    b=*s;
-                } while(U8_IS_SINGLE(b));
-            } else {
-                do {
-                    if(latin1Contains[b]) {
-                        return s;
-                    } else if(++s==limit) {
-                        return limit0;
-                    }
-                    b=*s;
-                } while(U8_IS_SINGLE(b));
+            s=spanASCIIBytes(s, limit, (UBool)spanCondition);
+            if(s==limit) {
+                return limit0;
+            }
+            b=*s;
+            if(U8_IS_SINGLE(b)) {
+                // An ASCII byte that does not fulfill the span condition.
+                return s;
             }
         }
         ++s;  // Advance past the lead byte.
@@ -73,6 +73,7 @@ public:
 
 private:
     void initBits();
+    void initSuppBits();
     void overrideIllegal();
 
     /**
@@ -96,6 +97,14 @@ private:
 
     inline UBool containsSlow(UChar32 c, int32_t lo, int32_t hi) const;
 
+    /**
+     * Spans ASCII bytes, eight at a time where possible.
+     * @return The smallest pointer p in s..limit such that p==limit,
+     *         *p is a non-ASCII byte, or latin1Contains[*p]!=spanCondition.
+     */
+    const uint8_t *spanASCIIBytes(const uint8_t *s, const uint8_t *limit,
+                                  UBool spanCondition) const;
+
     /*
      * One byte 0 or 1 per Latin-1 character.
      */
@@ -146,6 +155,28 @@ private:
      */
     int32_t list4kStarts[18];
 
+    /*
+     * Two bits per 64-block of supplementary code points
+     * U+10000..U+10FFFF, packed 16 blocks per word:
+     * with block index b=(c-0x10000)>>6, the value
+     * (suppBlockBits[b>>4]>>((b&0xf)*2))&3 is
+     * 0 if no code point of the block is in the set,
+     * 1 if all 64 code points of the block are in the set, and
+     * 2 if the block is mixed and set.contains(c) must be called.
+     * This mirrors the bmpBlockBits classification so that contains()
+     * is constant-time for non-mixed blocks in planes 1-16 as well.
+     */
+    uint32_t suppBlockBits[0x400];
+
+    /*
+     * Inversion list indexes for restricted binary searches in mixed
+     * supplementary blocks, from
+     * findCodePoint(U+10000, U+20000, .., U+100000, U+110000).
+     * listPlaneStarts[p-1]..listPlaneStarts[p] bounds the search for
+     * code points in plane p.
+     */
+    int32_t listPlaneStarts[17];
+
     /*
      * The inversion list of the parent set, for the slower contains() implementation
      * for mixed BMP blocks and for supplementary code points.
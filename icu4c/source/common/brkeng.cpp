@@ -131,29 +131,45 @@ ICULanguageBreakFactory::getEngineFor(UChar32 c) {
     const LanguageBreakEngine *lbe = NULL;
     UErrorCode  status = U_ZERO_ERROR;
 
-    Mutex m(&gBreakEngineMutex);
-
-    if (fEngines == NULL) {
-        UStack  *engines = new UStack(_deleteEngine, NULL, status);
-        if (U_FAILURE(status) || engines == NULL) {
-            // Note: no way to return error code to caller.
-            delete engines;
-            return NULL;
-        }
-        fEngines = engines;
-    } else {
-        int32_t i = fEngines->size();
-        while (--i >= 0) {
-            lbe = (const LanguageBreakEngine *)(fEngines->elementAt(i));
-            if (lbe != NULL && lbe->handles(c)) {
-                return lbe;
+    {
+        Mutex m(&gBreakEngineMutex);
+
+        if (fEngines == NULL) {
+            UStack  *engines = new UStack(_deleteEngine, NULL, status);
+            if (U_FAILURE(status) || engines == NULL) {
+                // Note: no way to return error code to caller.
+                delete engines;
+                return NULL;
+            }
+            fEngines = engines;
+        } else {
+            int32_t i = fEngines->size();
+            while (--i >= 0) {
+                lbe = (const LanguageBreakEngine *)(fEngines->elementAt(i));
+                if (lbe != NULL && lbe->handles(c)) {
+                    return lbe;
+                }
             }
         }
     }
-    
-    // We didn't find an engine. Create one.
+
+    // We didn't find an engine. Create one, without holding the lock:
+    // loading a dictionary is slow, and requests for other scripts
+    // (or for already-loaded engines) should not have to wait for it.
     lbe = loadEngineFor(c);
     if (lbe != NULL) {
+        Mutex m(&gBreakEngineMutex);
+        // Another thread may have loaded an engine for the same script
+        // while this one was loading. Keep the cached one.
+        int32_t i = fEngines->size();
+        while (--i >= 0) {
+            const LanguageBreakEngine *cached =
+                    (const LanguageBreakEngine *)(fEngines->elementAt(i));
+            if (cached != NULL && cached->handles(c)) {
+                delete lbe;
+                return cached;
+            }
+        }
         fEngines->push((void *)lbe, status);
     }
     return lbe;
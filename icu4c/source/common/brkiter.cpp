@@ -280,6 +280,20 @@ U_NAMESPACE_END
 static icu::UInitOnce gInitOnceBrkiter;
 static icu::ICULocaleService* gService = NULL;
 
+/*
+ * Pool of idle break iterators for getPooledInstance()/returnPooledInstance(),
+ * for callers that open and close iterators for the same few (locale, kind)
+ * keys over and over. A NULL bi means the slot is empty.
+ */
+struct BreakIteratorPoolEntry {
+    icu::BreakIterator *bi;
+    int32_t kind;
+    char locale[ULOC_FULLNAME_CAPACITY];
+};
+static const int32_t kBrkiterPoolCapacity = 8;
+static BreakIteratorPoolEntry gBrkiterPool[kBrkiterPoolCapacity];
+static icu::UMutex gBrkiterPoolMutex;
+
 
 
 /**
@@ -294,6 +308,10 @@ static UBool U_CALLCONV breakiterator_cleanup(void) {
     }
     gInitOnceBrkiter.reset();
 #endif
+    for (int32_t i = 0; i < kBrkiterPoolCapacity; ++i) {
+        delete gBrkiterPool[i].bi;
+        gBrkiterPool[i].bi = NULL;
+    }
     return TRUE;
 }
 U_CDECL_END
@@ -397,6 +415,58 @@ BreakIterator::createInstance(const Locale& loc, int32_t kind, UErrorCode& statu
     }
 }
 
+// -------------------------------------
+
+BreakIterator*
+BreakIterator::getPooledInstance(const Locale& loc, int32_t kind, UErrorCode& status)
+{
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    umtx_lock(&gBrkiterPoolMutex);
+    for (int32_t i = 0; i < kBrkiterPoolCapacity; ++i) {
+        BreakIteratorPoolEntry &entry = gBrkiterPool[i];
+        if (entry.bi != NULL && entry.kind == kind &&
+                uprv_strcmp(entry.locale, loc.getName()) == 0) {
+            BreakIterator *result = entry.bi;
+            entry.bi = NULL;
+            umtx_unlock(&gBrkiterPoolMutex);
+            return result;
+        }
+    }
+    umtx_unlock(&gBrkiterPoolMutex);
+    return createInstance(loc, kind, status);
+}
+
+// -------------------------------------
+
+void
+BreakIterator::returnPooledInstance(BreakIterator* adoptedBi, const Locale& loc, int32_t kind)
+{
+    if (adoptedBi == NULL) {
+        return;
+    }
+    // Drop the reference to the caller's text.
+    adoptedBi->setText(UnicodeString());
+    if (uprv_strlen(loc.getName()) < ULOC_FULLNAME_CAPACITY) {
+        umtx_lock(&gBrkiterPoolMutex);
+        ucln_common_registerCleanup(UCLN_COMMON_BREAKITERATOR, breakiterator_cleanup);
+        for (int32_t i = 0; i < kBrkiterPoolCapacity; ++i) {
+            BreakIteratorPoolEntry &entry = gBrkiterPool[i];
+            if (entry.bi == NULL) {
+                entry.bi = adoptedBi;
+                entry.kind = kind;
+                uprv_strcpy(entry.locale, loc.getName());
+                umtx_unlock(&gBrkiterPoolMutex);
+                return;
+            }
+        }
+        umtx_unlock(&gBrkiterPoolMutex);
+    }
+    // No empty slot, or the locale name does not fit: give the instance up.
+    delete adoptedBi;
+}
+
 // -------------------------------------
 enum { kKeyValueLenMax = 32 };
 
@@ -11,7 +11,6 @@
 #include "unicode/utf8.h"
 #include "unicode/utf16.h"
 #include "bytesinkutil.h"
-#include "charstr.h"
 #include "cmemory.h"
 #include "uassert.h"
 
@@ -121,41 +120,20 @@ ByteSinkUtil::appendUnchanged(const uint8_t *s, const uint8_t *limit,
     return TRUE;
 }
 
-CharStringByteSink::CharStringByteSink(CharString* dest) : dest_(*dest) {
-}
-
-CharStringByteSink::~CharStringByteSink() = default;
-
 void
-CharStringByteSink::Append(const char* bytes, int32_t n) {
-    UErrorCode status = U_ZERO_ERROR;
-    dest_.append(bytes, n, status);
-    // Any errors are silently ignored.
-}
-
-char*
-CharStringByteSink::GetAppendBuffer(int32_t min_capacity,
-                                    int32_t desired_capacity_hint,
-                                    char* scratch,
-                                    int32_t scratch_capacity,
-                                    int32_t* result_capacity) {
-    if (min_capacity < 1 || scratch_capacity < min_capacity) {
-        *result_capacity = 0;
-        return nullptr;
-    }
-
-    UErrorCode status = U_ZERO_ERROR;
-    char* result = dest_.getAppendBuffer(
-            min_capacity,
-            desired_capacity_hint,
-            *result_capacity,
-            status);
-    if (U_SUCCESS(status)) {
-        return result;
+UTF8TransformChain::stageDone(const Edits &stageEdits, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) { return; }
+    if (cur_ < 0) {
+        edits_ = stageEdits;
+        cur_ = 0;
+    } else {
+        Edits merged;
+        merged.mergeAndAppend(edits_, stageEdits, errorCode);
+        if (U_FAILURE(errorCode)) { return; }
+        edits_ = std::move(merged);
+        cur_ ^= 1;
     }
-
-    *result_capacity = scratch_capacity;
-    return scratch;
+    edits_.copyErrorTo(errorCode);
 }
 
 U_NAMESPACE_END
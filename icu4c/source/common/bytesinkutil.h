@@ -7,6 +7,7 @@
 #include "unicode/utypes.h"
 #include "unicode/bytestream.h"
 #include "unicode/edits.h"
+#include "charstr.h"
 #include "cmemory.h"
 #include "uassert.h"
 
@@ -59,25 +60,88 @@ private:
                                         ByteSink &sink, uint32_t options, Edits *edits);
 };
 
-class CharStringByteSink : public ByteSink {
+// CharStringByteSink is defined in charstr.h.
+
+/**
+ * Chains UTF-8 ByteSink transforms that record change Edits
+ * (e.g., CaseMap::utf8Fold(), Normalizer2::normalizeUTF8())
+ * over a pair of reused CharString buffers,
+ * and merges the per-stage Edits into a single mapping
+ * from final output offsets back to the original input.
+ *
+ * Each stage reads input() and writes via a sink into nextOutput();
+ * stageDone() then makes that output the next stage's input
+ * and folds the stage's Edits into the cumulative mapping.
+ * The two buffers are ping-ponged, so a chain of any length materializes
+ * no per-stage strings beyond them, and reset() reuses their capacity
+ * for the next piece of text.
+ *
+ * \code
+ * UTF8TransformChain chain(src);
+ * {
+ *     CharStringByteSink sink(&chain.nextOutput());
+ *     Edits edits;
+ *     CaseMap::utf8Fold(options, chain.input(), sink, &edits, errorCode);
+ *     chain.stageDone(edits, errorCode);
+ * }
+ * {
+ *     CharStringByteSink sink(&chain.nextOutput());
+ *     Edits edits;
+ *     nfc->normalizeUTF8(0, chain.input(), sink, &edits, errorCode);
+ *     chain.stageDone(edits, errorCode);
+ * }
+ * StringPiece result = chain.result();
+ * // chain.edits() maps result offsets back to src offsets.
+ * \endcode
+ */
+class U_COMMON_API UTF8TransformChain : public UMemory {
 public:
-    CharStringByteSink(CharString* dest);
-    ~CharStringByteSink() override;
+    UTF8TransformChain(StringPiece src) : src_(src), cur_(-1) {}
+
+    UTF8TransformChain(const UTF8TransformChain &) = delete;
+    UTF8TransformChain &operator=(const UTF8TransformChain &) = delete;
+
+    /**
+     * Input for the next stage:
+     * the original text, or the last completed stage's output.
+     * Valid until the next write to nextOutput().
+     */
+    StringPiece input() const {
+        return cur_ < 0 ? src_ : buffers_[cur_].toStringPiece();
+    }
+
+    /**
+     * Output buffer for the next stage, cleared.
+     * Wrap it in a CharStringByteSink for the transform to write to.
+     */
+    CharString &nextOutput() {
+        return buffers_[cur_ < 0 ? 0 : cur_ ^ 1].clear();
+    }
 
-    CharStringByteSink() = delete;
-    CharStringByteSink(const CharStringByteSink&) = delete;
-    CharStringByteSink& operator=(const CharStringByteSink&) = delete;
+    /**
+     * Makes the output written via nextOutput() the input of the next
+     * stage and merges the stage's Edits into edits().
+     */
+    void stageDone(const Edits &stageEdits, UErrorCode &errorCode);
 
-    void Append(const char* bytes, int32_t n) override;
+    /** The last completed stage's output. Valid until the next write to nextOutput(). */
+    StringPiece result() const { return input(); }
 
-    char* GetAppendBuffer(int32_t min_capacity,
-                          int32_t desired_capacity_hint,
-                          char* scratch,
-                          int32_t scratch_capacity,
-                          int32_t* result_capacity) override;
+    /** Merged Edits, mapping result() offsets back to original input offsets. */
+    const Edits &edits() const { return edits_; }
+
+    /** Restarts the chain on new text, reusing the buffers' capacity. */
+    void reset(StringPiece src) {
+        src_ = src;
+        cur_ = -1;
+        edits_.reset();
+    }
 
 private:
-    CharString& dest_;
+    StringPiece src_;
+    CharString buffers_[2];
+    Edits edits_;
+    int32_t cur_;  // index of the buffer holding the last stage's output, or -1
 };
 
 U_NAMESPACE_END
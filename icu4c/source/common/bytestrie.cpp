@@ -241,27 +241,32 @@ BytesTrie::next(const char *s, int32_t sLength) {
                 --length;
             }
         } else {
-            for(;;) {
-                if(sLength==0) {
-                    remainingMatchLength_=length;
-                    pos_=pos;
-                    int32_t node;
-                    return (length<0 && (node=*pos)>=kMinValueLead) ?
-                            valueResult(node) : USTRINGTRIE_NO_VALUE;
+            if(length>=0) {
+                // Compare the remaining linear-match bytes in bulk;
+                // the position of a mismatch does not matter.
+                int32_t n=length+1;
+                if(n>sLength) {
+                    n=sLength;
                 }
-                inByte=*s++;
-                --sLength;
-                if(length<0) {
-                    remainingMatchLength_=length;
-                    break;
-                }
-                if(inByte!=*pos) {
+                if(uprv_memcmp(s, pos, n)!=0) {
                     stop();
                     return USTRINGTRIE_NO_MATCH;
                 }
-                ++pos;
-                --length;
+                s+=n;
+                sLength-=n;
+                pos+=n;
+                length-=n;
+            }
+            if(sLength==0) {
+                remainingMatchLength_=length;
+                pos_=pos;
+                int32_t node;
+                return (length<0 && (node=*pos)>=kMinValueLead) ?
+                        valueResult(node) : USTRINGTRIE_NO_VALUE;
             }
+            inByte=*s++;
+            --sLength;
+            remainingMatchLength_=length;
         }
         for(;;) {
             int32_t node=*pos++;
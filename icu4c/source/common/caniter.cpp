@@ -74,7 +74,8 @@ CanonicalIterator::CanonicalIterator(const UnicodeString &sourceStr, UErrorCode
     current(NULL),
     current_length(0),
     nfd(*Normalizer2::getNFDInstance(status)),
-    nfcImpl(*Normalizer2Factory::getNFCImpl(status))
+    nfcImpl(*Normalizer2Factory::getNFCImpl(status)),
+    fEquivalentsCache(NULL)
 {
     if(U_SUCCESS(status) && nfcImpl.ensureCanonIterData(status)) {
       setSource(sourceStr, status);
@@ -83,6 +84,7 @@ CanonicalIterator::CanonicalIterator(const UnicodeString &sourceStr, UErrorCode
 
 CanonicalIterator::~CanonicalIterator() {
   cleanPieces();
+  delete fEquivalentsCache;
 }
 
 void CanonicalIterator::cleanPieces() {
@@ -341,7 +343,52 @@ void U_EXPORT2 CanonicalIterator::permute(UnicodeString &source, UBool skipZeros
 // privates
 
 // we have a segment, in NFD. Find all the strings that are canonically equivalent to it.
+namespace {
+
+// Cached result of getEquivalents() for one segment.
+struct CanonicalEquivalents : public UMemory {
+    CanonicalEquivalents(UnicodeString *s, int32_t len) : strings(s), length(len) {}
+    ~CanonicalEquivalents() { delete[] strings; }
+
+    UnicodeString *strings;
+    int32_t length;
+};
+
+// Keeps the per-iterator cache from growing without bound
+// when an iterator is reused for many distinct strings.
+const int32_t CANITER_MAX_CACHED_SEGMENTS = 1000;
+
+}  // namespace
+
+U_CDECL_BEGIN
+
+static void U_CALLCONV
+deleteCanonicalEquivalents(void *obj) {
+    delete (icu::CanonicalEquivalents *)obj;
+}
+
+U_CDECL_END
+
 UnicodeString* CanonicalIterator::getEquivalents(const UnicodeString &segment, int32_t &result_len, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (fEquivalentsCache != NULL) {
+        const CanonicalEquivalents *cached =
+                (const CanonicalEquivalents *)fEquivalentsCache->get(segment);
+        if (cached != NULL) {
+            UnicodeString *finalResult = new UnicodeString[cached->length];
+            if (finalResult == 0) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+                return NULL;
+            }
+            for (int32_t j = 0; j < cached->length; ++j) {
+                finalResult[j] = cached->strings[j];
+            }
+            result_len = cached->length;
+            return finalResult;
+        }
+    }
     Hashtable result(status);
     Hashtable permutations(status);
     Hashtable basic(status);
@@ -425,6 +472,33 @@ UnicodeString* CanonicalIterator::getEquivalents(const UnicodeString &segment, i
         ne = result.nextElement(el);
     }
 
+    // Memoize for the next setSource() with the same segment.
+    // Failure to cache is not an error; worst case we recompute.
+    if (fEquivalentsCache == NULL) {
+        UErrorCode cacheStatus = U_ZERO_ERROR;
+        LocalPointer<Hashtable> cache(new Hashtable(cacheStatus), cacheStatus);
+        if (U_SUCCESS(cacheStatus)) {
+            cache->setValueDeleter(deleteCanonicalEquivalents);
+            fEquivalentsCache = cache.orphan();
+        }
+    }
+    if (fEquivalentsCache != NULL && fEquivalentsCache->count() < CANITER_MAX_CACHED_SEGMENTS) {
+        UnicodeString *copy = new UnicodeString[result_len];
+        if (copy != NULL) {
+            for (int32_t j = 0; j < result_len; ++j) {
+                copy[j] = finalResult[j];
+            }
+            UErrorCode cacheStatus = U_ZERO_ERROR;
+            LocalPointer<CanonicalEquivalents> entry(
+                    new CanonicalEquivalents(copy, result_len), cacheStatus);
+            if (U_SUCCESS(cacheStatus)) {
+                fEquivalentsCache->put(segment, entry.getAlias(), cacheStatus);
+                if (U_SUCCESS(cacheStatus)) {
+                    entry.orphan();  // owned by the cache now
+                }
+            }
+        }
+    }
 
     return finalResult;
 }
@@ -15,6 +15,7 @@
 #define CHARSTRING_H
 
 #include "unicode/utypes.h"
+#include "unicode/bytestream.h"
 #include "unicode/unistr.h"
 #include "unicode/uobject.h"
 #include "cmemory.h"
@@ -148,6 +149,37 @@ private:
     CharString &operator=(const CharString &other); // forbid copying of this class
 };
 
+/**
+ * A ByteSink that writes to a CharString.
+ *
+ * Intended for composing the ByteSink-based UTF-8 transforms
+ * (CaseMap::utf8Fold(), Normalizer2::normalizeUTF8(), both with optional
+ * Edits recording) into pipelines without materializing intermediate heap
+ * strings: each stage appends into a reusable CharString, the next stage
+ * reads that buffer via toStringPiece(), and Edits::mergeAndAppend()
+ * folds the per-stage edits into one final-to-original offset map.
+ */
+class U_COMMON_API CharStringByteSink : public ByteSink {
+public:
+    CharStringByteSink(CharString* dest);
+    ~CharStringByteSink() U_OVERRIDE;
+
+    CharStringByteSink() = delete;
+    CharStringByteSink(const CharStringByteSink&) = delete;
+    CharStringByteSink& operator=(const CharStringByteSink&) = delete;
+
+    void Append(const char* bytes, int32_t n) U_OVERRIDE;
+
+    char* GetAppendBuffer(int32_t min_capacity,
+                          int32_t desired_capacity_hint,
+                          char* scratch,
+                          int32_t scratch_capacity,
+                          int32_t* result_capacity) U_OVERRIDE;
+
+private:
+    CharString& dest_;
+};
+
 U_NAMESPACE_END
 
 #endif
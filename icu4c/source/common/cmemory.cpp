@@ -35,6 +35,23 @@ static UMemAllocFn    *pAlloc;
 static UMemReallocFn  *pRealloc;
 static UMemFreeFn     *pFree;
 
+/*
+ * Stack of thread-local heap function overrides, for request-scoped
+ * arena allocators; see uprv_pushThreadMemoryFunctions() in cmemory.h.
+ * Zero-initialized PODs, so there are no thread_local constructor guards
+ * in the allocation hot path.
+ */
+#define UPRV_THREAD_MEM_DEPTH 4
+
+struct UThreadMemFns {
+    const void     *context;
+    UMemAllocFn    *allocFn;
+    UMemReallocFn  *reallocFn;
+    UMemFreeFn     *freeFn;
+};
+static thread_local UThreadMemFns gThreadMemStack[UPRV_THREAD_MEM_DEPTH];
+static thread_local int32_t gThreadMemDepth;
+
 #if U_DEBUG && defined(UPRV_MALLOC_COUNT)
 #include <stdio.h>
 static int n=0;
@@ -52,6 +69,10 @@ uprv_malloc(size_t s) {
 #endif
 #endif
     if (s > 0) {
+        if (gThreadMemDepth > 0) {
+            const UThreadMemFns *fns = &gThreadMemStack[gThreadMemDepth - 1];
+            return (*fns->allocFn)(fns->context, s);
+        }
         if (pAlloc) {
             return (*pAlloc)(pContext, s);
         } else {
@@ -71,13 +92,13 @@ uprv_realloc(void * buffer, size_t size) {
     if (buffer == zeroMem) {
         return uprv_malloc(size);
     } else if (size == 0) {
-        if (pFree) {
-            (*pFree)(pContext, buffer);
-        } else {
-            uprv_default_free(buffer);
-        }
+        uprv_free(buffer);
         return (void *)zeroMem;
     } else {
+        if (gThreadMemDepth > 0) {
+            const UThreadMemFns *fns = &gThreadMemStack[gThreadMemDepth - 1];
+            return (*fns->reallocFn)(fns->context, buffer, size);
+        }
         if (pRealloc) {
             return (*pRealloc)(pContext, buffer, size);
         } else {
@@ -93,6 +114,11 @@ uprv_free(void *buffer) {
   fflush(stdout);
 #endif
     if (buffer != zeroMem) {
+        if (gThreadMemDepth > 0) {
+            const UThreadMemFns *fns = &gThreadMemStack[gThreadMemDepth - 1];
+            (*fns->freeFn)(fns->context, buffer);
+            return;
+        }
         if (pFree) {
             (*pFree)(pContext, buffer);
         } else {
@@ -129,6 +155,36 @@ u_setMemoryFunctions(const void *context, UMemAllocFn *a, UMemReallocFn *r, UMem
 }
 
 
+U_CAPI void U_EXPORT2
+uprv_pushThreadMemoryFunctions(const void *context, UMemAllocFn *a, UMemReallocFn *r,
+                               UMemFreeFn *f, UErrorCode *status)
+{
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    if (a==NULL || r==NULL || f==NULL) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if (gThreadMemDepth >= UPRV_THREAD_MEM_DEPTH) {
+        *status = U_UNSUPPORTED_ERROR;
+        return;
+    }
+    UThreadMemFns *fns = &gThreadMemStack[gThreadMemDepth++];
+    fns->context   = context;
+    fns->allocFn   = a;
+    fns->reallocFn = r;
+    fns->freeFn    = f;
+}
+
+U_CAPI void U_EXPORT2
+uprv_popThreadMemoryFunctions(void)
+{
+    if (gThreadMemDepth > 0) {
+        --gThreadMemDepth;
+    }
+}
+
 U_CFUNC UBool cmemory_cleanup(void) {
     pContext   = NULL;
     pAlloc     = NULL;
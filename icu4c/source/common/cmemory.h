@@ -31,6 +31,7 @@
 #include <stddef.h>
 #include <string.h>
 #include "unicode/localpointer.h"
+#include "unicode/uclean.h"
 
 #if U_DEBUG && defined(UPRV_MALLOC_COUNT)
 #include <stdio.h>
@@ -64,6 +65,35 @@ uprv_free(void *mem);
 U_CAPI void * U_EXPORT2
 uprv_calloc(size_t num, size_t size) U_MALLOC_ATTR U_ALLOC_SIZE_ATTR2(1,2);
 
+/**
+ * Installs a scoped, thread-local override for uprv_malloc/uprv_realloc/
+ * uprv_free on the calling thread, taking precedence over the global
+ * functions from u_setMemoryFunctions(). Intended for request-scoped
+ * arena allocators: push an arena before a burst of short-lived
+ * format/parse work, pop it afterwards, and release the arena in one step.
+ *
+ * While the override is active it receives ALL ICU allocations and frees
+ * on the thread, including frees of memory that was allocated before the
+ * push. An arena free function must therefore tolerate pointers it did not
+ * allocate (typically by making free a no-op), and memory handed out by
+ * the arena must not outlive it: do not create long-lived ICU objects, and
+ * do not trigger lazy initialization of ICU caches, while an arena that
+ * will be discarded is active.
+ *
+ * Overrides nest up to a small fixed depth; the status is set to
+ * U_UNSUPPORTED_ERROR when the depth is exceeded.
+ */
+U_CAPI void U_EXPORT2
+uprv_pushThreadMemoryFunctions(const void *context, UMemAllocFn *a, UMemReallocFn *r,
+                               UMemFreeFn *f, UErrorCode *status);
+
+/**
+ * Removes the most recently pushed thread-local override on the calling
+ * thread, restoring the previous override or the global functions.
+ */
+U_CAPI void U_EXPORT2
+uprv_popThreadMemoryFunctions(void);
+
 /**
  * This should align the memory properly on any machine.
  * This is very useful for the safeClone functions.
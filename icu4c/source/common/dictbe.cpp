@@ -1283,13 +1283,15 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
                              // Note: lengths is filled with code point lengths
                              //       The NULL parameter is the ignored code unit lengths.
 
-        // if there are no single character matches found in the dictionary 
-        // starting with this character, treat character as a 1-character word 
+        UChar32 cp = inString.char32At(ix);
+
+        // if there are no single character matches found in the dictionary
+        // starting with this character, treat character as a 1-character word
         // with the highest value possible, i.e. the least likely to occur.
         // Exclude Korean characters from this treatment, as they should be left
         // together by default.
         if ((count == 0 || lengths.elementAti(0) != 1) &&
-                !fHangulWordSet.contains(inString.char32At(ix))) {
+                !fHangulWordSet.contains(cp)) {
             values.setElementAt(maxSnlp, count);   // 255
             lengths.setElementAt(1, count++);
         }
@@ -1309,7 +1311,7 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
         // characters is considered a candidate word with a default cost
         // specified in the katakanaCost table according to its length.
 
-        bool is_katakana = isKatakana(inString.char32At(ix));
+        bool is_katakana = isKatakana(cp);
         int32_t katakanaRunLength = 1;
         if (!is_prev_katakana && is_katakana) {
             int32_t j = inString.moveIndex32(ix, 1);
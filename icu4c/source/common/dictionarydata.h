@@ -65,6 +65,10 @@ public:
  * 
  * All implementations of this interface must be thread-safe if they are to be used inside of the
  * dictionary-based break iteration code.
+ * The matchers shipped with ICU hold no mutable state and operate on
+ * immutable (memory-mapped) dictionary data, so one matcher instance is
+ * safe for any number of concurrent readers; matches() only writes through
+ * its output parameters and the caller-owned UText.
  */
 class U_COMMON_API DictionaryMatcher : public UMemory {
 public:
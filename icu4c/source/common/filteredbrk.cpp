@@ -14,6 +14,7 @@
 
 #include "unicode/filteredbrk.h"
 #include "unicode/ucharstriebuilder.h"
+#include "unicode/uniset.h"
 #include "unicode/ures.h"
 
 #include "uresimp.h" // ures_getByKeyWithFallback
@@ -137,14 +138,17 @@ static const UChar   kFULLSTOP = 0x002E; // '.'
  */
 class SimpleFilteredSentenceBreakData : public UMemory {
 public:
-  SimpleFilteredSentenceBreakData(UCharsTrie *forwards, UCharsTrie *backwards ) 
-      : fForwardsPartialTrie(forwards), fBackwardsTrie(backwards), refcount(1) { }
+  SimpleFilteredSentenceBreakData(UCharsTrie *forwards, UCharsTrie *backwards, UnicodeSet *lastChars )
+      : fForwardsPartialTrie(forwards), fBackwardsTrie(backwards), fLastCharSet(lastChars), refcount(1) { }
   SimpleFilteredSentenceBreakData *incr() { refcount++;  return this; }
   SimpleFilteredSentenceBreakData *decr() { if((--refcount) <= 0) delete this; return 0; }
   virtual ~SimpleFilteredSentenceBreakData();
 
   LocalPointer<UCharsTrie>    fForwardsPartialTrie; //  Has ".a" for "a.M."
   LocalPointer<UCharsTrie>    fBackwardsTrie; //  i.e. ".srM" for Mrs.
+  LocalPointer<UnicodeSet>    fLastCharSet; //  frozen set of the final code point
+                                            //  of every suppression; gates the
+                                            //  backwards trie probe.
   int32_t                     refcount;
 };
 
@@ -155,7 +159,7 @@ SimpleFilteredSentenceBreakData::~SimpleFilteredSentenceBreakData() {}
  */
 class SimpleFilteredSentenceBreakIterator : public BreakIterator {
 public:
-  SimpleFilteredSentenceBreakIterator(BreakIterator *adopt, UCharsTrie *forwards, UCharsTrie *backwards, UErrorCode &status);
+  SimpleFilteredSentenceBreakIterator(BreakIterator *adopt, UCharsTrie *forwards, UCharsTrie *backwards, UnicodeSet *lastChars, UErrorCode &status);
   SimpleFilteredSentenceBreakIterator(const SimpleFilteredSentenceBreakIterator& other);
   virtual ~SimpleFilteredSentenceBreakIterator();
 private:
@@ -239,9 +243,9 @@ SimpleFilteredSentenceBreakIterator::SimpleFilteredSentenceBreakIterator(const S
 }
 
 
-SimpleFilteredSentenceBreakIterator::SimpleFilteredSentenceBreakIterator(BreakIterator *adopt, UCharsTrie *forwards, UCharsTrie *backwards, UErrorCode &status) :
+SimpleFilteredSentenceBreakIterator::SimpleFilteredSentenceBreakIterator(BreakIterator *adopt, UCharsTrie *forwards, UCharsTrie *backwards, UnicodeSet *lastChars, UErrorCode &status) :
   BreakIterator(adopt->getLocale(ULOC_VALID_LOCALE,status),adopt->getLocale(ULOC_ACTUAL_LOCALE,status)),
-  fData(new SimpleFilteredSentenceBreakData(forwards, backwards)),
+  fData(new SimpleFilteredSentenceBreakData(forwards, backwards, lastChars)),
   fDelegate(adopt)
 {
   // all set..
@@ -275,6 +279,18 @@ SimpleFilteredSentenceBreakIterator::breakExceptionAt(int32_t n) {
       //if(debug2) u_printf(" -> : |%C| \n", (UChar)uch);
     }
 
+    // Quick check before walking the trie: no suppression can match here
+    // unless the character preceding the boundary is the final code point
+    // of some suppression string. Most candidate boundaries fail this
+    // set probe and never pay for the trie machinery.
+    if(fData->fLastCharSet.isValid()) {
+      if((uch=utext_previous32(fText.getAlias()))==U_SENTINEL ||
+         !fData->fLastCharSet->contains(uch)) {
+        return kNoExceptionHere;
+      }
+      utext_next32(fText.getAlias());
+    }
+
     UStringTrieResult r = USTRINGTRIE_INTERMEDIATE_VALUE;
 
     while((uch=utext_previous32(fText.getAlias()))!=U_SENTINEL  &&   // more to consume backwards and..
@@ -581,6 +597,10 @@ SimpleFilteredBreakIteratorBuilder::build(BreakIterator* adoptBreakIterator, UEr
 
   LocalPointer<UCharsTrie>    backwardsTrie; //  i.e. ".srM" for Mrs.
   LocalPointer<UCharsTrie>    forwardsPartialTrie; //  Has ".a" for "a.M."
+  LocalPointer<UnicodeSet>    lastCharSet(new UnicodeSet(), status); // final code points of suppressions
+  if(U_FAILURE(status)) {
+    return NULL;
+  }
 
   int n=0;
   for ( int32_t i = 0;
@@ -590,6 +610,9 @@ SimpleFilteredBreakIteratorBuilder::build(BreakIterator* adoptBreakIterator, UEr
     if(abbr) {
       FB_TRACE("build",abbr,TRUE,i);
       ustrs[n] = *abbr; // copy by value
+      if(ustrs[n].length()>0) {
+        lastCharSet->add(ustrs[n].char32At(ustrs[n].length()-1));
+      }
       FB_TRACE("ustrs[n]",&ustrs[n],TRUE,i);
     } else {
       FB_TRACE("build",abbr,FALSE,i);
@@ -674,7 +697,9 @@ SimpleFilteredBreakIteratorBuilder::build(BreakIterator* adoptBreakIterator, UEr
     }
   }
 
-  return new SimpleFilteredSentenceBreakIterator(adopt.orphan(), forwardsPartialTrie.orphan(), backwardsTrie.orphan(), status);
+  lastCharSet->freeze();   // constant-time contains() from here on
+
+  return new SimpleFilteredSentenceBreakIterator(adopt.orphan(), forwardsPartialTrie.orphan(), backwardsTrie.orphan(), lastCharSet.orphan(), status);
 }
 
 
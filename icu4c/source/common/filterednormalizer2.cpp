@@ -27,11 +27,14 @@
 #include "unicode/unistr.h"
 #include "unicode/unorm.h"
 #include "cpputils.h"
+#include "norm2allmodes.h"
 
 U_NAMESPACE_BEGIN
 
 FilteredNormalizer2::~FilteredNormalizer2() {}
 
+FrozenFilteredNormalizer2::~FrozenFilteredNormalizer2() {}
+
 UnicodeString &
 FilteredNormalizer2::normalize(const UnicodeString &src,
                                UnicodeString &dest,
@@ -60,6 +60,7 @@ struct UPlugData {
   char name[UPLUG_NAME_MAX];   /**< name of plugin */
   UPlugLevel  level; /**< level of plugin */
   UBool   awaitingLoad; /**< TRUE if the plugin is awaiting a load call */
+  UBool   deferred; /**< TRUE if the library open is deferred until uplug_loadDeferredPlugs() */
   UBool   dontUnload; /**< TRUE if plugin must stay resident (leak plugin and lib) */
   UErrorCode pluginStatus; /**< status code of plugin */
 };
@@ -348,6 +349,7 @@ static UPlugData *uplug_allocateEmptyPlug(UErrorCode *status)
   plug->name[0]=0;
   plug->level = UPLUG_LEVEL_UNKNOWN; /* initialize to null state */
   plug->awaitingLoad = TRUE;
+  plug->deferred = FALSE;
   plug->dontUnload = FALSE;
   plug->pluginStatus = U_ZERO_ERROR;
   plug->libName[0] = 0;
@@ -411,6 +413,12 @@ static void uplug_deallocatePlug(UPlugData *plug, UErrorCode *status) {
 
 static void uplug_doUnloadPlug(UPlugData *plugToRemove, UErrorCode *status) {
   if(plugToRemove != NULL) {
+    if(plugToRemove->deferred && plugToRemove->entrypoint == NULL) {
+      /* Deferred plugin whose library was never opened - nothing to unload or close. */
+      pluginCount = uplug_removeEntryAt(pluginList, pluginCount, sizeof(plugToRemove[0]),
+                                        uplug_pluginNumber(plugToRemove));
+      return;
+    }
     uplug_unloadPlug(plugToRemove, status);
     uplug_deallocatePlug(plugToRemove, status);
   }
@@ -614,8 +622,58 @@ uplug_initPlugFromLibrary(const char *libName, const char *sym, const char *conf
   return plug;
 }
 
+/**
+ * Record a plugin from the config file without opening its library.
+ * The dlopen and the QUERY/LOAD calls happen later, in
+ * uplug_loadDeferredPlugs().
+ */
+static UPlugData*
+uplug_initDeferredPlug(const char *libName, const char *sym, const char *config, UErrorCode *status) {
+  UPlugData *plug = uplug_allocateEmptyPlug(status);
+  if(U_FAILURE(*status)) return NULL;
+
+  uprv_strncpy(plug->libName, libName, UPLUG_NAME_MAX);
+  uprv_strncpy(plug->sym, sym, UPLUG_NAME_MAX);
+  if(config!=NULL) {
+    uprv_strncpy(plug->config, config, UPLUG_NAME_MAX);
+  }
+  plug->deferred = TRUE;
+  /* level stays UPLUG_LEVEL_UNKNOWN until the library is opened and queried. */
+  return plug;
+}
+
+/**
+ * Open the library of a deferred plugin and query its level.
+ * The counterpart of uplug_initPlugFromLibrary(), working in place on an
+ * already-recorded plugin.
+ */
+static void
+uplug_resolveDeferredPlug(UPlugData *plug, UErrorCode *status) {
+  void *lib = NULL;
+  if(U_FAILURE(*status)) { return; }
+  lib = uplug_openLibrary(plug->libName, status);
+  if(lib!=NULL && U_SUCCESS(*status)) {
+    plug->entrypoint = (UPlugEntrypoint*)uprv_dlsym_func(lib, plug->sym, status);
+    if(plug->entrypoint!=NULL && U_SUCCESS(*status)) {
+      plug->lib = lib; /* plug takes ownership of library */
+      uplug_queryPlug(plug, status);
+      return;
+    }
+    {
+      UErrorCode subStatus = U_ZERO_ERROR;
+      uplug_closeLibrary(lib, &subStatus); /* don't care here */
+    }
+    uprv_strncpy(plug->name, "ERROR: Could not load entrypoint", UPLUG_NAME_MAX);
+  } else {
+    uprv_strncpy(plug->name, "ERROR: could not load library", UPLUG_NAME_MAX);
+  }
+  plug->pluginStatus = (*status==U_ZERO_ERROR)?U_MISSING_RESOURCE_ERROR:*status;
+  plug->awaitingLoad = FALSE; /* Won't load. */
+  plug->dontUnload = TRUE; /* cannot unload. */
+}
+
 U_CAPI UPlugData* U_EXPORT2
-uplug_loadPlugFromLibrary(const char *libName, const char *sym, const char *config, UErrorCode *status) { 
+uplug_loadPlugFromLibrary(const char *libName, const char *sym, const char *config, UErrorCode *status) {
   UPlugData *plug = NULL;
   if(U_FAILURE(*status)) { return NULL; }
   plug = uplug_initPlugFromLibrary(libName, sym, config, status);
@@ -687,7 +745,10 @@ static void uplug_loadWaitingPlugs(UErrorCode *status) {
     UPlugData *pluginToLoad = &pluginList[i];
         
     if(pluginToLoad->awaitingLoad) {
-      if(pluginToLoad->level == UPLUG_LEVEL_INVALID) { 
+      if(pluginToLoad->deferred) {
+        continue; /* library not opened yet - waits for uplug_loadDeferredPlugs(). */
+      }
+      if(pluginToLoad->level == UPLUG_LEVEL_INVALID) {
         pluginToLoad->pluginStatus = U_PLUGIN_DIDNT_SET_LEVEL;
       } else if(pluginToLoad->level == UPLUG_LEVEL_UNKNOWN) {
         pluginToLoad->pluginStatus = U_INTERNAL_PROGRAM_ERROR;
@@ -803,11 +864,19 @@ uplug_init(UErrorCode *status) {
       char linebuf[1024];
       char *p, *libName=NULL, *symName=NULL, *config=NULL;
       int32_t line = 0;
-            
-            
+      UBool deferMode = FALSE;
+
       while(fgets(linebuf,1023,f)) {
         line++;
 
+        if(uprv_strncmp(linebuf, "#!deferred", 10) == 0) {
+          /* Directive: don't dlopen the remaining entries during u_init().
+             They are recorded here and opened, queried and loaded by
+             uplug_loadDeferredPlugs(). Older ICU versions parse the
+             directive as a comment and load the entries eagerly. */
+          deferMode = TRUE;
+          continue;
+        }
         if(!*linebuf || *linebuf=='#') {
           continue;
         } else {
@@ -851,9 +920,14 @@ uplug_init(UErrorCode *status) {
           }
                 
           /* OK, we're good. */
-          { 
+          {
             UErrorCode subStatus = U_ZERO_ERROR;
-            UPlugData *plug = uplug_initPlugFromLibrary(libName, symName, config, &subStatus);
+            UPlugData *plug;
+            if(deferMode) {
+              plug = uplug_initDeferredPlug(libName, symName, config, &subStatus);
+            } else {
+              plug = uplug_initPlugFromLibrary(libName, symName, config, &subStatus);
+            }
             if(U_FAILURE(subStatus) && U_SUCCESS(*status)) {
               *status = subStatus;
             }
@@ -879,6 +953,33 @@ uplug_init(UErrorCode *status) {
   ucln_registerCleanup(UCLN_UPLUG, uplug_cleanup);
 }
 
+U_CAPI void U_EXPORT2
+uplug_loadDeferredPlugs(UErrorCode *status) {
+#if !U_ENABLE_DYLOAD
+  (void)status; /* unused */
+#else
+  int32_t i;
+
+  if(U_FAILURE(*status)) return;
+
+  for(i=0;i<pluginCount;i++) {
+    UPlugData *plug = &pluginList[i];
+    if(plug->deferred && plug->awaitingLoad) {
+      UErrorCode subStatus = U_ZERO_ERROR;
+      /* Some operating systems don't want
+         DL operations from multiple threads - see uplug_openLibrary().
+         Call this function from one thread at a time. */
+      uplug_resolveDeferredPlug(plug, &subStatus);
+      if(U_FAILURE(subStatus) && U_SUCCESS(*status)) {
+        *status = subStatus;
+      }
+    }
+    plug->deferred = FALSE;
+  }
+  uplug_loadWaitingPlugs(status);
+#endif /* U_ENABLE_DYLOAD */
+}
+
 #endif
 
 
@@ -24,8 +24,10 @@
 #include "unicode/uloc.h"
 #include "unicode/ures.h"
 #include "cmemory.h"
+#include "cstring.h"
 #include "ucln_cmn.h"
 #include "uassert.h"
+#include "uhash.h"
 #include "umutex.h"
 #include "uresimp.h"
 
@@ -104,11 +106,24 @@ static char** _installedLocales = NULL;
 static int32_t _installedLocalesCount = 0;
 static icu::UInitOnce _installedLocalesInitOnce;
 
+/*
+ * Hash set of the installed locale names, for O(1) membership tests via
+ * uloc_isAvailable(). The keys alias the strings in _installedLocales
+ * (which point into the resource data), so the set owns no memory of
+ * its own. Built once together with _installedLocales; NULL if building
+ * it failed, in which case lookups fall back to a linear scan.
+ */
+static UHashtable* _installedLocalesSet = NULL;
+
 /* ### Get available **************************************************/
 
 static UBool U_CALLCONV uloc_cleanup(void) {
     char ** temp;
 
+    if (_installedLocalesSet) {
+        uhash_close(_installedLocalesSet);
+        _installedLocalesSet = NULL;
+    }
     if (_installedLocales) {
         temp = _installedLocales;
         _installedLocales = NULL;
@@ -149,6 +164,27 @@ static void U_CALLCONV loadInstalledLocales() {
             }
             _installedLocales[i] = NULL;
             _installedLocalesCount = localeCount;
+
+            /* Build the membership set; on failure leave it NULL. */
+            UErrorCode setStatus = U_ZERO_ERROR;
+            _installedLocalesSet = uhash_open(
+                    uhash_hashChars, uhash_compareChars, NULL, &setStatus);
+            if (U_SUCCESS(setStatus)) {
+                for (i = 0; i < localeCount; i++) {
+                    uhash_put(
+                        _installedLocalesSet,
+                        _installedLocales[i],
+                        _installedLocales[i],
+                        &setStatus);
+                }
+                if (U_FAILURE(setStatus)) {
+                    uhash_close(_installedLocalesSet);
+                    _installedLocalesSet = NULL;
+                }
+            } else {
+                _installedLocalesSet = NULL;
+            }
+
             ucln_common_registerCleanup(UCLN_COMMON_ULOC, uloc_cleanup);
         }
     }
@@ -177,3 +213,24 @@ uloc_countAvailable()
     return _installedLocalesCount;
 }
 
+U_CAPI UBool U_EXPORT2
+uloc_isAvailable(const char* localeID)
+{
+    int32_t i;
+
+    if (localeID == NULL) {
+        return FALSE;
+    }
+    _load_installedLocales();
+    if (_installedLocalesSet != NULL) {
+        return (UBool)(uhash_get(_installedLocalesSet, localeID) != NULL);
+    }
+    /* The set could not be built: fall back to a linear scan. */
+    for (i = 0; i < _installedLocalesCount; i++) {
+        if (uprv_strcmp(localeID, _installedLocales[i]) == 0) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
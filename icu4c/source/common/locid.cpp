@@ -1340,6 +1340,7 @@ Locale::getKeywordValue(StringPiece keywordName, ByteSink& sink, UErrorCode& sta
     for (;;) {
         if (scratch.allocateInsteadAndReset(scratch_capacity) == nullptr) {
             status = U_MEMORY_ALLOCATION_ERROR;
+            sink.Flush();  // discard an uncommitted append buffer
             return;
         }
 
@@ -1366,6 +1367,7 @@ Locale::getKeywordValue(StringPiece keywordName, ByteSink& sink, UErrorCode& sta
     }
 
     if (U_FAILURE(status)) {
+        sink.Flush();  // discard the uncommitted append buffer
         return;
     }
 
@@ -28,9 +28,52 @@
 #include "unicode/uscript.h"
 #include "cmemory.h"
 #include "cstring.h"
+#include "uassert.h"
+#include "ucln_cmn.h"
+#include "uhash.h"
 #include "ulocimp.h"
+#include "umutex.h"
 #include "ustr_imp.h"
 
+/*
+ * Memo cache for uloc_addLikelySubtags(), keyed by the canonicalized input
+ * locale ID. The maximization of a given ID never changes within a process
+ * (the likelySubtags resource is immutable), so each distinct inbound ID
+ * pays the resource lookups and tag assembly only once. Both keys and
+ * values are owned (uprv_malloc'ed) NUL-terminated strings.
+ */
+static UHashtable *gLikelySubtagsCache = NULL;
+static icu::UInitOnce gLikelySubtagsCacheInitOnce = U_INITONCE_INITIALIZER;
+static icu::UMutex gLikelySubtagsCacheMutex = U_MUTEX_INITIALIZER;
+
+/* Keep the cache from growing without bound on synthetic inputs. */
+#define ULOC_LIKELY_CACHE_MAX_ENTRIES 1000
+
+U_CDECL_BEGIN
+
+static UBool U_CALLCONV likely_subtags_cleanup(void) {
+    if (gLikelySubtagsCache != NULL) {
+        uhash_close(gLikelySubtagsCache);
+        gLikelySubtagsCache = NULL;
+    }
+    gLikelySubtagsCacheInitOnce.reset();
+    return TRUE;
+}
+
+static void U_CALLCONV likely_subtags_cache_init(UErrorCode &status) {
+    U_ASSERT(gLikelySubtagsCache == NULL);
+    ucln_common_registerCleanup(UCLN_COMMON_LIKELY_SUBTAGS, likely_subtags_cleanup);
+    gLikelySubtagsCache = uhash_open(uhash_hashChars, uhash_compareChars, NULL, &status);
+    if (U_FAILURE(status)) {
+        gLikelySubtagsCache = NULL;
+        return;
+    }
+    uhash_setKeyDeleter(gLikelySubtagsCache, uprv_free);
+    uhash_setValueDeleter(gLikelySubtagsCache, uprv_free);
+}
+
+U_CDECL_END
+
 /**
  * This function looks for the localeID in the likelySubtags resource.
  *
@@ -1245,12 +1288,61 @@ uloc_addLikelySubtags(const char*    localeID,
         return -1;
     }
     else {
-        return _uloc_addLikelySubtags(
+        int32_t resultLength;
+        UErrorCode cacheStatus = U_ZERO_ERROR;
+        umtx_initOnce(gLikelySubtagsCacheInitOnce, &likely_subtags_cache_init, cacheStatus);
+
+        if (U_SUCCESS(cacheStatus) && gLikelySubtagsCache != NULL &&
+                maximizedLocaleID != NULL && maximizedLocaleIDCapacity > 0) {
+            const char* cached;
+            umtx_lock(&gLikelySubtagsCacheMutex);
+            cached = (const char*)uhash_get(gLikelySubtagsCache, localeBuffer);
+            umtx_unlock(&gLikelySubtagsCacheMutex);
+            if (cached != NULL) {
+                /* Entries are immutable once inserted: safe to read unlocked. */
+                int32_t cachedLength = (int32_t)uprv_strlen(cached);
+                uprv_memcpy(
+                    maximizedLocaleID,
+                    cached,
+                    cachedLength <= maximizedLocaleIDCapacity ?
+                        cachedLength : maximizedLocaleIDCapacity);
+                return u_terminateChars(
+                            maximizedLocaleID,
+                            maximizedLocaleIDCapacity,
+                            cachedLength,
+                            err);
+            }
+        }
+
+        resultLength = _uloc_addLikelySubtags(
                     localeBuffer,
                     maximizedLocaleID,
                     maximizedLocaleIDCapacity,
                     err);
-    }    
+
+        /*
+         * Cache only complete, NUL-terminated results (*err must be exactly
+         * U_ZERO_ERROR: no overflow and no not-terminated warning).
+         */
+        if (*err == U_ZERO_ERROR && resultLength > 0 && gLikelySubtagsCache != NULL) {
+            umtx_lock(&gLikelySubtagsCacheMutex);
+            if (uhash_count(gLikelySubtagsCache) < ULOC_LIKELY_CACHE_MAX_ENTRIES &&
+                    uhash_get(gLikelySubtagsCache, localeBuffer) == NULL) {
+                char* key = uprv_strdup(localeBuffer);
+                char* value = uprv_strdup(maximizedLocaleID);
+                if (key != NULL && value != NULL) {
+                    UErrorCode putStatus = U_ZERO_ERROR;
+                    /* On failure, uhash_put() frees key and value via the deleters. */
+                    uhash_put(gLikelySubtagsCache, key, value, &putStatus);
+                } else {
+                    uprv_free(key);
+                    uprv_free(value);
+                }
+            }
+            umtx_unlock(&gLikelySubtagsCacheMutex);
+        }
+        return resultLength;
+    }
 }
 
 U_CAPI int32_t U_EXPORT2
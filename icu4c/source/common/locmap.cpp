@@ -30,8 +30,11 @@
 #include "locmap.h"
 #include "cstring.h"
 #include "cmemory.h"
+#include "umutex.h"
 #include "unicode/uloc.h"
 
+U_NAMESPACE_USE
+
 #if U_PLATFORM_HAS_WIN32_API && UCONFIG_USE_WINDOWS_LCID_MAPPING_API
 #include <windows.h>
 #include <winnls.h> // LCIDToLocaleName and LocaleNameToLCID
@@ -944,6 +947,79 @@ static const ILcidPosixMap gPosixIDmap[] = {
 
 static const uint32_t gLocaleCount = UPRV_LENGTHOF(gPosixIDmap);
 
+/*
+ * gPosixIDmap is ordered by POSIX name, not by language LCID, so LCID
+ * lookups cannot binary search it directly.  gLangIndex is a permutation
+ * of the map indexes sorted by the language LCID of each subtable (the
+ * hostID of its first element), built once on first use, so that
+ * uprv_convertToPosix can binary search instead of scanning the whole map.
+ */
+static uint16_t gLangIndex[UPRV_LENGTHOF(gPosixIDmap)];
+static UInitOnce gLangIndexInitOnce = U_INITONCE_INITIALIZER;
+
+/*
+ * One-entry memo of the most recent successful language lookup,
+ * (localeIndex << 16) | langID, or -1 when empty.  A single atomic word,
+ * so readers either see a complete previous result or fall through to
+ * the binary search.  LCID conversions cluster heavily on one language
+ * per process, which makes even this tiny cache effective.
+ */
+static u_atomic_int32_t gLastLangLookup = ATOMIC_INT32_T_INITIALIZER(-1);
+
+static void U_CALLCONV
+initLangIndex() {
+    /* Insertion sort; the table is small and this runs once per process.
+       The strict comparison keeps subtables with the same language LCID
+       in table order, matching the former first-match linear scan. */
+    uint32_t i, j;
+    for (i = 0; i < gLocaleCount; i++) {
+        j = i;
+        while (j > 0 &&
+               gPosixIDmap[gLangIndex[j - 1]].regionMaps->hostID >
+               gPosixIDmap[i].regionMaps->hostID) {
+            gLangIndex[j] = gLangIndex[j - 1];
+            j--;
+        }
+        gLangIndex[j] = (uint16_t)i;
+    }
+}
+
+/*
+ * Returns the index of the first subtable in gPosixIDmap for the language
+ * LCID, or -1 if the language is not in the map.
+ */
+static int32_t
+findLanguageIndex(uint16_t langID) {
+    int32_t cached = umtx_loadAcquire(gLastLangLookup);
+    if (cached >= 0 && (uint16_t)(cached & 0xffff) == langID) {
+        return cached >> 16;
+    }
+    umtx_initOnce(gLangIndexInitOnce, &initLangIndex);
+    int32_t lo = 0;
+    int32_t hi = (int32_t)gLocaleCount - 1;
+    int32_t result = -1;
+    while (lo <= hi) {
+        int32_t mid = (lo + hi) / 2;
+        uint32_t midLangID = gPosixIDmap[gLangIndex[mid]].regionMaps->hostID;
+        if (midLangID < langID) {
+            lo = mid + 1;
+        } else if (midLangID > langID) {
+            hi = mid - 1;
+        } else {
+            /* Take the first matching subtable, like the former linear scan. */
+            while (mid > 0 && gPosixIDmap[gLangIndex[mid - 1]].regionMaps->hostID == langID) {
+                mid--;
+            }
+            result = gLangIndex[mid];
+            break;
+        }
+    }
+    if (result >= 0) {
+        umtx_storeRelease(gLastLangLookup, (result << 16) | langID);
+    }
+    return result;
+}
+
 /**
  * Do not call this function. It is called by hostID.
  * The function is not private because this struct must stay as a C struct,
@@ -1049,7 +1125,7 @@ U_CAPI int32_t
 uprv_convertToPosix(uint32_t hostid, char *posixID, int32_t posixIDCapacity, UErrorCode* status)
 {
     uint16_t langID;
-    uint32_t localeIndex;
+    int32_t localeIndex;
     UBool bLookup = TRUE;
     const char *pPosixID = NULL;
 
@@ -1110,11 +1186,9 @@ uprv_convertToPosix(uint32_t hostid, char *posixID, int32_t posixIDCapacity, UEr
         const char *pCandidate = NULL;
         langID = LANGUAGE_LCID(hostid);
 
-        for (localeIndex = 0; localeIndex < gLocaleCount; localeIndex++) {
-            if (langID == gPosixIDmap[localeIndex].regionMaps->hostID) {
-                pCandidate = getPosixID(&gPosixIDmap[localeIndex], hostid);
-                break;
-            }
+        localeIndex = findLanguageIndex(langID);
+        if (localeIndex >= 0) {
+            pCandidate = getPosixID(&gPosixIDmap[localeIndex], hostid);
         }
 
         /* On Windows, when locale name has a variant, we still look up the hardcoded table.
@@ -21,6 +21,7 @@
 #include "unicode/edits.h"
 #include "unicode/normalizer2.h"
 #include "unicode/stringoptions.h"
+#include "unicode/uniset.h"
 #include "unicode/unistr.h"
 #include "cpputils.h"
 #include "normalizer2impl.h"
@@ -198,6 +199,29 @@ private:
         impl.decompose(src, limit, &buffer, errorCode);
     }
     using Normalizer2WithImpl::normalize;  // Avoid warning about hiding base class function.
+
+    void
+    normalizeUTF8(uint32_t options, StringPiece src, ByteSink &sink,
+                  Edits *edits, UErrorCode &errorCode) const U_OVERRIDE {
+        if (U_FAILURE(errorCode)) {
+            return;
+        }
+        if (edits != nullptr && (options & U_EDITS_NO_RESET) == 0) {
+            edits->reset();
+        }
+        const uint8_t *s = reinterpret_cast<const uint8_t *>(src.data());
+        impl.decomposeUTF8(options, s, s + src.length(), &sink, edits, errorCode);
+        sink.Flush();
+    }
+    virtual UBool
+    isNormalizedUTF8(StringPiece sp, UErrorCode &errorCode) const U_OVERRIDE {
+        if (U_FAILURE(errorCode)) {
+            return FALSE;
+        }
+        const uint8_t *s = reinterpret_cast<const uint8_t *>(sp.data());
+        return impl.decomposeUTF8(0, s, s + sp.length(), nullptr, nullptr, errorCode);
+    }
+
     virtual void
     normalizeAndAppend(const UChar *src, const UChar *limit, UBool doNormalize,
                        UnicodeString &safeMiddle,
@@ -363,6 +387,34 @@ struct Norm2AllModes : public UMemory {
     ComposeNormalizer2 fcc;
 };
 
+/**
+ * FilteredNormalizer2 that owns a frozen copy of its filter set.
+ * Freezing compiles the set's span lookup structures
+ * (BMPSet and string span tables) once at construction,
+ * so that the per-call set.span()/spanUTF8() in the base class
+ * runs on the fast frozen path rather than a binary search.
+ * Use for long-lived filtered normalizers that are built once
+ * and then queried many times.
+ */
+class FrozenFilteredNormalizer2 : public FilteredNormalizer2 {
+public:
+    FrozenFilteredNormalizer2(const Normalizer2 &n2, const UnicodeSet &filterSet,
+                              UErrorCode &errorCode)
+            // The base class constructor only stores the reference.
+            : FilteredNormalizer2(n2, ownedSet),
+              ownedSet(filterSet) {
+        if (U_SUCCESS(errorCode) && ownedSet.isBogus()) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        ownedSet.freeze();
+    }
+    virtual ~FrozenFilteredNormalizer2();
+
+private:
+    UnicodeSet ownedSet;
+};
+
 U_NAMESPACE_END
 
 #endif  // !UCONFIG_NO_NORMALIZATION
@@ -46,6 +46,22 @@ U_NAMESPACE_BEGIN
 
 namespace {
 
+/**
+ * Tests whether the next four UTF-16 code units all have no bits set
+ * outside of the given lane mask, with one 64-bit load.
+ * With mask 0xff80... this tests for all-ASCII,
+ * with mask 0xfe00... for all units below U+0200;
+ * such units are below the normalization data's minimum
+ * "no/maybe" code points and need no trie lookup at all.
+ * The caller guarantees that at least four units are readable.
+ */
+inline UBool allUnitsBelowMask(const UChar *s, uint64_t laneMask) {
+    uint64_t block;
+    uprv_memcpy(&block, s, sizeof(block));
+    return (block & laneMask) == 0;
+}
+
+
 /**
  * UTF-8 lead byte for minNoMaybeCP.
  * Can be lower than the actual lead byte for c.
@@ -424,6 +440,7 @@ struct CanonIterData : public UMemory {
 
 Normalizer2Impl::~Normalizer2Impl() {
     delete fCanonIterData;
+    uprv_free(fCompPairTable);
 }
 
 void
@@ -603,9 +620,20 @@ Normalizer2Impl::decompose(const UChar *src, const UChar *limit,
     const UChar *prevBoundary=src;
     uint8_t prevCC=0;
 
+    // Lane mask for the block-wise skip of code units below minNoCP.
+    // All norm data has minDecompNoCP>=0x80 (=0xC0 for nfc/nfkc),
+    // so blocks of ASCII can always be skipped in bulk.
+    uint64_t laneMask = minNoCP>=0x200 ? UINT64_C(0xfe00fe00fe00fe00) :
+            minNoCP>=0x80 ? UINT64_C(0xff80ff80ff80ff80) : 0;
     for(;;) {
         // count code units below the minimum or with irrelevant data for the quick check
-        for(prevSrc=src; src!=limit;) {
+        prevSrc=src;
+        if(laneMask!=0) {
+            while((limit-src)>=4 && allUnitsBelowMask(src, laneMask)) {
+                src+=4;
+            }
+        }
+        for(; src!=limit;) {
             if( (c=*src)<minNoCP ||
                 isMostDecompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))
             ) {
@@ -733,7 +761,7 @@ UBool Normalizer2Impl::decompose(UChar32 c, uint16_t norm16,
 
 const uint8_t *
 Normalizer2Impl::decomposeShort(const uint8_t *src, const uint8_t *limit,
-                                UBool stopAtCompBoundary, UBool onlyContiguous,
+                                StopAt stopAt, UBool onlyContiguous,
                                 ReorderingBuffer &buffer, UErrorCode &errorCode) const {
     if (U_FAILURE(errorCode)) {
         return nullptr;
@@ -742,11 +770,14 @@ Normalizer2Impl::decomposeShort(const uint8_t *src, const uint8_t *limit,
         const uint8_t *prevSrc = src;
         uint16_t norm16;
         UCPTRIE_FAST_U8_NEXT(normTrie, UCPTRIE_16, src, limit, norm16);
+        if (stopAt == STOP_AT_DECOMP_BOUNDARY && norm16HasDecompBoundaryBefore(norm16)) {
+            return prevSrc;
+        }
         // Get the decomposition and the lead and trail cc's.
         UChar32 c = U_SENTINEL;
         if (norm16 >= limitNoNo) {
             if (isMaybeOrNonZeroCC(norm16)) {
-                // No boundaries around this character.
+                // No comp boundaries around this character.
                 c = codePointFromValidUTF8(prevSrc, src);
                 if (!buffer.append(c, getCCFromYesOrMaybe(norm16), errorCode)) {
                     return nullptr;
@@ -754,13 +785,13 @@ Normalizer2Impl::decomposeShort(const uint8_t *src, const uint8_t *limit,
                 continue;
             }
             // Maps to an isCompYesAndZeroCC.
-            if (stopAtCompBoundary) {
+            if (stopAt == STOP_AT_COMP_BOUNDARY) {
                 return prevSrc;
             }
             c = codePointFromValidUTF8(prevSrc, src);
             c = mapAlgorithmic(c, norm16);
             norm16 = getRawNorm16(c);
-        } else if (stopAtCompBoundary && norm16 < minNoNoCompNoMaybeCC) {
+        } else if (stopAt == STOP_AT_COMP_BOUNDARY && norm16 < minNoNoCompNoMaybeCC) {
             return prevSrc;
         }
         // norm16!=INERT guarantees that [prevSrc, src[ is valid UTF-8.
@@ -802,7 +833,7 @@ Normalizer2Impl::decomposeShort(const uint8_t *src, const uint8_t *limit,
                 return nullptr;
             }
         }
-        if (stopAtCompBoundary && norm16HasCompBoundaryAfter(norm16, onlyContiguous)) {
+        if (stopAt == STOP_AT_COMP_BOUNDARY && norm16HasCompBoundaryAfter(norm16, onlyContiguous)) {
             return src;
         }
     }
@@ -1082,6 +1113,51 @@ void Normalizer2Impl::addComposites(const uint16_t *list, UnicodeSet &set) const
  * a composition may contain at most one more code unit than the original starter,
  * while the combining mark that is removed has at least one code unit.
  */
+void U_CALLCONV
+Normalizer2Impl::initCompPairTable(Normalizer2Impl *impl, UErrorCode &errorCode) {
+    impl->buildCompPairTable(errorCode);
+}
+
+void Normalizer2Impl::buildCompPairTable(UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return; }
+    U_ASSERT(fCompPairTable == NULL);
+    int32_t *table = (int32_t *)uprv_malloc(
+        COMP_PAIR_STARTER_COUNT * COMP_PAIR_TRAIL_COUNT * 4);
+    if(table == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int32_t i = 0;
+    for(UChar32 a = COMP_PAIR_STARTER_START;
+            a < (COMP_PAIR_STARTER_START + COMP_PAIR_STARTER_COUNT); ++a) {
+        // Mirrors how recompose() finds the compositions list for a starter:
+        // a character from NFD text, or a composite written by an earlier combination.
+        uint16_t norm16 = getNorm16(a);
+        const uint16_t *list;
+        if(isDecompYes(norm16)) {
+            list = getCompositionsListForDecompYes(norm16);  // NULL if no compositions
+        } else if(norm16 < minYesNoMappingsOnly) {
+            list = getCompositionsListForComposite(norm16);
+        } else {
+            list = NULL;
+        }
+        for(UChar32 b = COMP_PAIR_TRAIL_START;
+                b < (COMP_PAIR_TRAIL_START + COMP_PAIR_TRAIL_COUNT); ++b) {
+            table[i++] = list != NULL ? combine(list, b) : -1;
+        }
+    }
+    fCompPairTable = table;
+}
+
+const int32_t *Normalizer2Impl::getCompPairTable() const {
+    // Logically const: Synchronized instantiation.
+    Normalizer2Impl *me = const_cast<Normalizer2Impl *>(this);
+    UErrorCode errorCode = U_ZERO_ERROR;
+    umtx_initOnce(me->fCompPairTableInitOnce, &initCompPairTable, me, errorCode);
+    // If the table could not be built, callers keep using the compositions lists.
+    return fCompPairTable;
+}
+
 void Normalizer2Impl::recompose(ReorderingBuffer &buffer, int32_t recomposeStartIndex,
                                 UBool onlyContiguous) const {
     UChar *p=buffer.getStart()+recomposeStartIndex;
@@ -1090,6 +1166,7 @@ void Normalizer2Impl::recompose(ReorderingBuffer &buffer, int32_t recomposeStart
         return;
     }
 
+    const int32_t *pairTable=getCompPairTable();
     UChar *starter, *pRemove, *q, *r;
     const uint16_t *compositionsList;
     UChar32 c, compositeAndFwd;
@@ -1152,7 +1229,9 @@ void Normalizer2Impl::recompose(ReorderingBuffer &buffer, int32_t recomposeStart
                 }
                 compositionsList=NULL;
                 continue;
-            } else if((compositeAndFwd=combine(compositionsList, c))>=0) {
+            } else if((compositeAndFwd=combinePair(pairTable, compositionsList,
+                                                   starterIsSupplementary ? U_SENTINEL : *starter,
+                                                   c))>=0) {
                 // The starter and the combining mark (c) do combine.
                 UChar32 composite=compositeAndFwd>>1;
 
@@ -1326,12 +1405,21 @@ Normalizer2Impl::compose(const UChar *src, const UChar *limit,
         }
     }
 
+    // Lane mask for the block-wise skip of code units below minNoMaybeCP
+    // (>=0x300 for nfc, so blocks of Latin text can be skipped in bulk).
+    uint64_t laneMask = minNoMaybeCP>=0x200 ? UINT64_C(0xfe00fe00fe00fe00) :
+            minNoMaybeCP>=0x80 ? UINT64_C(0xff80ff80ff80ff80) : 0;
     for (;;) {
         // Fast path: Scan over a sequence of characters below the minimum "no or maybe" code point,
         // or with (compYes && ccc==0) properties.
         const UChar *prevSrc;
         UChar32 c = 0;
         uint16_t norm16 = 0;
+        if(laneMask!=0) {
+            while((limit-src)>=4 && allUnitsBelowMask(src, laneMask)) {
+                src+=4;
+            }
+        }
         for (;;) {
             if (src == limit) {
                 if (prevBoundary != limit && doCompose) {
@@ -1590,12 +1678,20 @@ Normalizer2Impl::composeQuickCheck(const UChar *src, const UChar *limit,
         }
     }
 
+    // Same block-wise skip as in compose().
+    uint64_t laneMask = minNoMaybeCP>=0x200 ? UINT64_C(0xfe00fe00fe00fe00) :
+            minNoMaybeCP>=0x80 ? UINT64_C(0xff80ff80ff80ff80) : 0;
     for(;;) {
         // Fast path: Scan over a sequence of characters below the minimum "no or maybe" code point,
         // or with (compYes && ccc==0) properties.
         const UChar *prevSrc;
         UChar32 c = 0;
         uint16_t norm16 = 0;
+        if(laneMask!=0) {
+            while((limit-src)>=4 && allUnitsBelowMask(src, laneMask)) {
+                src+=4;
+            }
+        }
         for (;;) {
             if(src==limit) {
                 return src;
@@ -1729,6 +1825,96 @@ void Normalizer2Impl::composeAndAppend(const UChar *src, const UChar *limit,
     }
 }
 
+UBool
+Normalizer2Impl::decomposeUTF8(uint32_t options,
+                               const uint8_t *src, const uint8_t *limit,
+                               ByteSink *sink, Edits *edits, UErrorCode &errorCode) const {
+    U_ASSERT(limit != nullptr);
+    UnicodeString s16;
+    uint8_t minNoLead = leadByteForCP(minDecompNoCP);
+
+    const uint8_t *prevBoundary = src;
+    // ccc of the last character before src if the fast path did not skip over it,
+    // else 0.
+    uint8_t prevCC = 0;
+
+    for (;;) {
+        // Fast path: Scan over a sequence of characters below the minimum "no" code point,
+        // or with (decompYes && ccc==0) properties.
+        const uint8_t *fastStart = src;
+        const uint8_t *prevSrc;
+        uint16_t norm16 = 0;
+        for (;;) {
+            if (src == limit) {
+                if (prevBoundary != limit && sink != nullptr) {
+                    ByteSinkUtil::appendUnchanged(prevBoundary, limit,
+                                                  *sink, options, edits, errorCode);
+                }
+                return TRUE;
+            }
+            if (*src < minNoLead) {
+                ++src;
+            } else {
+                prevSrc = src;
+                UCPTRIE_FAST_U8_NEXT(normTrie, UCPTRIE_16, src, limit, norm16);
+                if (!isMostDecompYesAndZeroCC(norm16)) {
+                    break;
+                }
+            }
+        }
+        // The character at [prevSrc..src[ decomposes and/or has ccc!=0.
+        if (prevSrc != fastStart) {
+            // The fast path skipped at least one ccc==0 character:
+            // A decomposition boundary precedes the current character,
+            // and everything before it is unchanged output.
+            if (prevBoundary != prevSrc && sink != nullptr &&
+                    !ByteSinkUtil::appendUnchanged(prevBoundary, prevSrc,
+                                                   *sink, options, edits, errorCode)) {
+                break;
+            }
+            prevBoundary = prevSrc;
+            prevCC = 0;
+        }
+
+        // Medium-fast path: Combining marks that do not decompose and
+        // occur in canonical order pass through unchanged.
+        if (isMaybeOrNonZeroCC(norm16)) {
+            uint8_t cc = getCCFromYesOrMaybe(norm16);
+            if (cc == 0 || prevCC <= cc) {
+                prevCC = cc;
+                continue;
+            }
+        }
+        if (sink == nullptr) {
+            return FALSE;
+        }
+
+        // Slow path: Decompose and reorder from the last boundary until the next one.
+        ReorderingBuffer buffer(*this, s16, errorCode);
+        if (U_FAILURE(errorCode)) {
+            break;
+        }
+        decomposeShort(prevBoundary, src, STOP_AT_LIMIT, FALSE /* onlyContiguous */,
+                       buffer, errorCode);
+        src = decomposeShort(src, limit, STOP_AT_DECOMP_BOUNDARY, FALSE /* onlyContiguous */,
+                             buffer, errorCode);
+        if (U_FAILURE(errorCode)) {
+            break;
+        }
+        if ((src - prevBoundary) > INT32_MAX) {
+            errorCode = U_INDEX_OUTOFBOUNDS_ERROR;
+            break;
+        }
+        if (!ByteSinkUtil::appendChange(prevBoundary, src, buffer.getStart(), buffer.length(),
+                                        *sink, edits, errorCode)) {
+            break;
+        }
+        prevBoundary = src;
+        prevCC = 0;
+    }
+    return TRUE;
+}
+
 UBool
 Normalizer2Impl::composeUTF8(uint32_t options, UBool onlyContiguous,
                              const uint8_t *src, const uint8_t *limit,
@@ -1954,10 +2140,10 @@ Normalizer2Impl::composeUTF8(uint32_t options, UBool onlyContiguous,
             break;
         }
         // We know there is not a boundary here.
-        decomposeShort(prevSrc, src, FALSE /* !stopAtCompBoundary */, onlyContiguous,
+        decomposeShort(prevSrc, src, STOP_AT_LIMIT, onlyContiguous,
                        buffer, errorCode);
         // Decompose until the next boundary.
-        src = decomposeShort(src, limit, TRUE /* stopAtCompBoundary */, onlyContiguous,
+        src = decomposeShort(src, limit, STOP_AT_COMP_BOUNDARY, onlyContiguous,
                              buffer, errorCode);
         if (U_FAILURE(errorCode)) {
             break;
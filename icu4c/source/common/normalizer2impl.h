@@ -245,8 +245,9 @@ private:
  */
 class U_COMMON_API Normalizer2Impl : public UObject {
 public:
-    Normalizer2Impl() : normTrie(NULL), fCanonIterData(NULL) {
+    Normalizer2Impl() : normTrie(NULL), fCanonIterData(NULL), fCompPairTable(NULL) {
         fCanonIterDataInitOnce.reset();
+        fCompPairTableInitOnce.reset();
     }
     virtual ~Normalizer2Impl();
 
@@ -513,6 +514,11 @@ public:
                       const uint8_t *src, const uint8_t *limit,
                       ByteSink *sink, icu::Edits *edits, UErrorCode &errorCode) const;
 
+    /** sink==nullptr: isNormalized() */
+    UBool decomposeUTF8(uint32_t options,
+                        const uint8_t *src, const uint8_t *limit,
+                        ByteSink *sink, icu::Edits *edits, UErrorCode &errorCode) const;
+
     const UChar *makeFCD(const UChar *src, const UChar *limit,
                          ReorderingBuffer *buffer, UErrorCode &errorCode) const;
     void makeFCDAndAppend(const UChar *src, const UChar *limit,
@@ -657,8 +663,10 @@ private:
     UBool decompose(UChar32 c, uint16_t norm16,
                     ReorderingBuffer &buffer, UErrorCode &errorCode) const;
 
+    enum StopAt { STOP_AT_LIMIT, STOP_AT_COMP_BOUNDARY, STOP_AT_DECOMP_BOUNDARY };
+
     const uint8_t *decomposeShort(const uint8_t *src, const uint8_t *limit,
-                                  UBool stopAtCompBoundary, UBool onlyContiguous,
+                                  StopAt stopAt, UBool onlyContiguous,
                                   ReorderingBuffer &buffer, UErrorCode &errorCode) const;
 
     static int32_t combine(const uint16_t *list, UChar32 trail);
@@ -666,6 +674,46 @@ private:
     void recompose(ReorderingBuffer &buffer, int32_t recomposeStartIndex,
                    UBool onlyContiguous) const;
 
+    /**
+     * Bounds of the direct-mapped composition pair table:
+     * starters U+0041..U+01FF (Latin, including the precomposed vowels
+     * that Vietnamese text recomposes onto) crossed with
+     * combining marks U+0300..U+033F.
+     * Each entry is the compositeAndFwd value that combine() would return
+     * for the pair, or -1 if the pair does not compose.
+     */
+    enum {
+        COMP_PAIR_STARTER_START=0x41,
+        COMP_PAIR_STARTER_COUNT=0x200-COMP_PAIR_STARTER_START,
+        COMP_PAIR_TRAIL_START=0x300,
+        COMP_PAIR_TRAIL_COUNT=0x340-COMP_PAIR_TRAIL_START
+    };
+
+    /**
+     * Returns the composition pair table, building it on first use.
+     * Returns NULL if it could not be built; callers then use
+     * the composition lists as before.
+     */
+    const int32_t *getCompPairTable() const;
+    void buildCompPairTable(UErrorCode &errorCode);
+    static void U_CALLCONV initCompPairTable(Normalizer2Impl *impl, UErrorCode &errorCode);
+
+    /**
+     * Same result as combine(list, b) where list is the compositions list
+     * for a, but looks the frequent Latin+diacritic pairs up in the
+     * flat pair table instead of searching the list.
+     */
+    int32_t combinePair(const int32_t *pairTable, const uint16_t *list,
+                        UChar32 a, UChar32 b) const {
+        if (pairTable != NULL &&
+                (uint32_t)(a - COMP_PAIR_STARTER_START) < COMP_PAIR_STARTER_COUNT &&
+                (uint32_t)(b - COMP_PAIR_TRAIL_START) < COMP_PAIR_TRAIL_COUNT) {
+            return pairTable[(a - COMP_PAIR_STARTER_START) * COMP_PAIR_TRAIL_COUNT +
+                             (b - COMP_PAIR_TRAIL_START)];
+        }
+        return combine(list, b);
+    }
+
     UBool hasCompBoundaryBefore(UChar32 c, uint16_t norm16) const {
         return c<minCompNoMaybeCP || norm16HasCompBoundaryBefore(norm16);
     }
@@ -725,6 +773,9 @@ private:
 
     UInitOnce       fCanonIterDataInitOnce;
     CanonIterData  *fCanonIterData;
+
+    UInitOnce       fCompPairTableInitOnce;
+    int32_t        *fCompPairTable;  // owned; NULL if not built (yet)
 };
 
 // bits in canonIterData
@@ -0,0 +1,92 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+* normalizer2stream.cpp
+*
+* created on: 2018nov20
+*/
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_NORMALIZATION
+
+#include "unicode/normalizer2.h"
+#include "unicode/unistr.h"
+#include "unicode/utext.h"
+#include "unicode/utf16.h"
+#include "cmemory.h"
+#include "normalizer2stream.h"
+
+U_NAMESPACE_BEGIN
+
+UnicodeString &
+StreamingNormalizer::normalizeChunk(const UnicodeString &chunk,
+                                    UnicodeString &dest, UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return dest; }
+    if(pending.isEmpty()) {
+        pending.fastCopyFrom(chunk);
+    } else {
+        pending.append(chunk);
+    }
+    // Find the last normalization boundary.
+    // Text before such a boundary normalizes independently of what follows.
+    int32_t split = pending.length();
+    while(split > 0) {
+        UChar32 c = pending.char32At(split - 1);
+        split -= U16_LENGTH(c);
+        if(norm2.hasBoundaryBefore(c)) { break; }
+    }
+    if(split > 0) {
+        UnicodeString head = pending.tempSubStringBetween(0, split);
+        UnicodeString normalized = norm2.normalize(head, errorCode);
+        dest.append(normalized);
+        pending.remove(0, split);
+    }
+    // Otherwise keep accumulating: the chunk contains no boundary.
+    return dest;
+}
+
+UnicodeString &
+StreamingNormalizer::finish(UnicodeString &dest, UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return dest; }
+    if(!pending.isEmpty()) {
+        UnicodeString normalized = norm2.normalize(pending, errorCode);
+        dest.append(normalized);
+        pending.remove();
+    }
+    return dest;
+}
+
+void
+StreamingNormalizer::normalize(const Normalizer2 &n2, UText *text,
+                               UnicodeString &dest, UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return; }
+    StreamingNormalizer stream(n2);
+    UChar buffer[4096];
+    int32_t length = 0;
+    UChar32 c;
+    while((c = UTEXT_NEXT32(text)) >= 0) {
+        UBool isError = FALSE;
+        U16_APPEND(buffer, length, UPRV_LENGTHOF(buffer), c, isError);
+        if(isError || length >= UPRV_LENGTHOF(buffer) - 1) {
+            // Flush before the buffer can overflow on a surrogate pair.
+            UnicodeString chunk(FALSE, buffer, length);
+            stream.normalizeChunk(chunk, dest, errorCode);
+            length = 0;
+            if(isError) {
+                U16_APPEND_UNSAFE(buffer, length, c);
+            }
+            if(U_FAILURE(errorCode)) { return; }
+        }
+    }
+    if(length > 0) {
+        UnicodeString chunk(FALSE, buffer, length);
+        stream.normalizeChunk(chunk, dest, errorCode);
+    }
+    stream.finish(dest, errorCode);
+}
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_NORMALIZATION
@@ -0,0 +1,89 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+* normalizer2stream.h
+*
+* created on: 2018nov20
+*/
+
+#ifndef __NORMALIZER2STREAM_H__
+#define __NORMALIZER2STREAM_H__
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_NORMALIZATION
+
+#include "unicode/normalizer2.h"
+#include "unicode/unistr.h"
+#include "unicode/uobject.h"
+#include "unicode/utext.h"
+
+U_NAMESPACE_BEGIN
+
+/**
+ * Incremental wrapper around a Normalizer2 instance,
+ * for normalizing text that arrives in chunks
+ * (for example, from a UText over a memory-mapped file)
+ * without materializing the whole input or output.
+ *
+ * Between chunks, only the trailing substring after the last
+ * normalization boundary is carried over, so memory use is
+ * proportional to the chunk size plus the longest
+ * boundary-free run in the text, not to the text length.
+ *
+ * Not thread-safe: each instance holds per-stream state.
+ * @internal
+ */
+class U_COMMON_API StreamingNormalizer : public UMemory {
+public:
+    /**
+     * Constructs a streaming wrapper for the given normalizer,
+     * which must remain valid for the lifetime of this object.
+     */
+    StreamingNormalizer(const Normalizer2 &n2) : norm2(n2) {}
+
+    /**
+     * Feeds the next chunk of input text.
+     * Normalizes the carried-over tail plus the chunk up to the last
+     * normalization boundary and appends the result to dest;
+     * the remainder is carried over into the next call.
+     * @return dest
+     */
+    UnicodeString &normalizeChunk(const UnicodeString &chunk,
+                                  UnicodeString &dest, UErrorCode &errorCode);
+
+    /**
+     * Normalizes and appends the carried-over tail, if any,
+     * and resets this object for reuse with new input.
+     * Must be called after the last chunk.
+     * @return dest
+     */
+    UnicodeString &finish(UnicodeString &dest, UErrorCode &errorCode);
+
+    /**
+     * Discards any carried-over text.
+     */
+    void reset() { pending.remove(); }
+
+    /**
+     * Convenience function:
+     * Normalizes the whole text from its current iteration position
+     * in fixed-size chunks, appending to dest.
+     * Uses O(chunk) working memory regardless of the text length.
+     */
+    static void normalize(const Normalizer2 &n2, UText *text,
+                          UnicodeString &dest, UErrorCode &errorCode);
+
+private:
+    StreamingNormalizer(const StreamingNormalizer &other);  // forbid copying
+    void operator=(const StreamingNormalizer &other);  // forbid copying
+
+    const Normalizer2 &norm2;
+    UnicodeString pending;
+};
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_NORMALIZATION
+#endif  // __NORMALIZER2STREAM_H__
@@ -226,9 +226,29 @@ RuleBasedBreakIterator::operator=(const RuleBasedBreakIterator& that) {
 
     if (fLanguageBreakEngines != NULL) {
         delete fLanguageBreakEngines;
-        fLanguageBreakEngines = NULL;   // Just rebuild for now
+        fLanguageBreakEngines = NULL;
+    }
+    // The dictionary engines in "that"'s stack are owned by the process-global
+    // factory; the per-iterator stack only caches pointers to them, so the
+    // pointers can be copied directly. The UnhandledEngine is owned by its
+    // iterator and is recreated lazily instead.
+    if (that.fLanguageBreakEngines != NULL) {
+        UErrorCode engineStatus = U_ZERO_ERROR;
+        fLanguageBreakEngines = new UStack(engineStatus);
+        if (fLanguageBreakEngines != NULL && U_SUCCESS(engineStatus)) {
+            for (int32_t i = 0; i < that.fLanguageBreakEngines->size(); ++i) {
+                void *lbe = that.fLanguageBreakEngines->elementAt(i);
+                if (lbe != NULL && lbe != that.fUnhandledBreakEngine) {
+                    fLanguageBreakEngines->push(lbe, engineStatus);
+                }
+            }
+        }
+        if (U_FAILURE(engineStatus)) {
+            // Rebuild on demand, as before this was cloned.
+            delete fLanguageBreakEngines;
+            fLanguageBreakEngines = NULL;
+        }
     }
-    // TODO: clone fLanguageBreakEngines from "that"
     UErrorCode status = U_ZERO_ERROR;
     utext_clone(&fText, &that.fText, FALSE, TRUE, &status);
 
@@ -692,18 +712,6 @@ int32_t RuleBasedBreakIterator::current(void) const {
 // implementation
 //=======================================================================
 
-//
-// RBBIRunMode  -  the state machine runs an extra iteration at the beginning and end
-//                 of user text.  A variable with this enum type keeps track of where we
-//                 are.  The state machine only fetches user input while in the RUN mode.
-//
-enum RBBIRunMode {
-    RBBI_START,     // state machine processing is before first char of input
-    RBBI_RUN,       // state machine processing is in the user text
-    RBBI_END        // state machine processing is after end of user text.
-};
-
-
 // Map from look-ahead break states (corresponds to rules) to boundary positions.
 // Allows multiple lookahead break rules to be in flight at the same time.
 //
@@ -759,7 +767,6 @@ struct LookAheadResults {
 int32_t RuleBasedBreakIterator::handleNext() {
     int32_t             state;
     uint16_t            category        = 0;
-    RBBIRunMode         mode;
 
     RBBIStateTableRow  *row;
     UChar32             c;
@@ -798,35 +805,45 @@ int32_t RuleBasedBreakIterator::handleNext() {
             (tableData + tableRowLen * state);
 
 
-    mode     = RBBI_RUN;
+    // If the rules require it, run one state transition with the {bof}
+    //   pseudo-category before the first real input character, without
+    //   advancing the input position. Doing it here, ahead of the main
+    //   loop, keeps the per-character loop free of begin-of-input checks.
     if (statetable->fFlags & RBBI_BOF_REQUIRED) {
         category = 2;
-        mode     = RBBI_START;
+        state = row->fNextState[category];
+        row = (RBBIStateTableRow *)
+            (tableData + tableRowLen * state);
+        if (row->fAccepting == -1) {
+            // Match found; for the {bof} transition the result position
+            //   stays at the initial position.
+            fRuleStatusIndex = row->fTagIdx;
+        } else if (row->fAccepting > 0) {
+            // Lookahead match is completed.
+            int32_t lookaheadResult = lookAheadMatches.getPosition(row->fAccepting);
+            if (lookaheadResult >= 0) {
+                fRuleStatusIndex = row->fTagIdx;
+                fPosition = lookaheadResult;
+                return lookaheadResult;
+            }
+        }
+        if (row->fLookAhead != 0) {
+            // At the position of a '/' in a look-ahead match. Record it.
+            lookAheadMatches.setPosition(row->fLookAhead,
+                                         (int32_t)UTEXT_GETNATIVEINDEX(&fText));
+        }
     }
 
-
     // loop until we reach the end of the text or transition to state 0
     //
-    for (;;) {
+    UBool atEnd = FALSE;    // true during the final {eof} loop iteration
+    while (state != STOP_STATE) {
         if (c == U_SENTINEL) {
             // Reached end of input string.
-            if (mode == RBBI_END) {
-                // We have already run the loop one last time with the
-                //   character set to the psueudo {eof} value.  Now it is time
-                //   to unconditionally bail out.
-                break;
-            }
             // Run the loop one last time with the fake end-of-input character category.
-            mode = RBBI_END;
+            atEnd = TRUE;
             category = 1;
-        }
-
-        //
-        // Get the char category.  An incoming category of 1 or 2 means that
-        //      we are preset for doing the beginning or end of input, and
-        //      that we shouldn't get a category from an actual text input character.
-        //
-        if (mode == RBBI_RUN) {
+        } else {
             // look up the current character's character category, which tells us
             // which column in the state table to look at.
             // Note:  the 16 in UTRIE_GET16 refers to the size of the data being returned,
@@ -871,47 +888,32 @@ int32_t RuleBasedBreakIterator::handleNext() {
 
         if (row->fAccepting == -1) {
             // Match found, common case.
-            if (mode != RBBI_START) {
-                result = (int32_t)UTEXT_GETNATIVEINDEX(&fText);
-            }
+            result = (int32_t)UTEXT_GETNATIVEINDEX(&fText);
             fRuleStatusIndex = row->fTagIdx;   // Remember the break status (tag) values.
-        }
-
-        int16_t completedRule = row->fAccepting;
-        if (completedRule > 0) {
+        } else if (row->fAccepting > 0) {
             // Lookahead match is completed.
-            int32_t lookaheadResult = lookAheadMatches.getPosition(completedRule);
+            int32_t lookaheadResult = lookAheadMatches.getPosition(row->fAccepting);
             if (lookaheadResult >= 0) {
                 fRuleStatusIndex = row->fTagIdx;
                 fPosition = lookaheadResult;
                 return lookaheadResult;
             }
         }
-        int16_t rule = row->fLookAhead;
-        if (rule != 0) {
+        if (row->fLookAhead != 0) {
             // At the position of a '/' in a look-ahead match. Record it.
             int32_t  pos = (int32_t)UTEXT_GETNATIVEINDEX(&fText);
-            lookAheadMatches.setPosition(rule, pos);
+            lookAheadMatches.setPosition(row->fLookAhead, pos);
         }
 
-        if (state == STOP_STATE) {
-            // This is the normal exit from the lookup state machine.
+        if (state == STOP_STATE || atEnd) {
+            // STOP_STATE is the normal exit from the lookup state machine.
             // We have advanced through the string until it is certain that no
             //   longer match is possible, no matter what characters follow.
             break;
         }
 
         // Advance to the next character.
-        // If this is a beginning-of-input loop iteration, don't advance
-        //    the input position.  The next iteration will be processing the
-        //    first real input character.
-        if (mode == RBBI_RUN) {
-            c = UTEXT_NEXT32(&fText);
-        } else {
-            if (mode == RBBI_START) {
-                mode = RBBI_RUN;
-            }
-        }
+        c = UTEXT_NEXT32(&fText);
     }
 
     // The state machine is done.  Check whether it found a match...
@@ -1062,6 +1064,93 @@ int32_t RuleBasedBreakIterator::getRuleStatusVec(
     return numVals;
 }
 
+//-------------------------------------------------------------------------------
+//
+//  getBoundaries()   Find all boundaries of the text in one call, without
+//                    going through the iteration protocol and the break cache.
+//
+//-------------------------------------------------------------------------------
+int32_t RuleBasedBreakIterator::getBoundaries(
+        UText *ut, int32_t *boundaries, int32_t capacity, UErrorCode &status) {
+    return getBoundaries(ut, boundaries, NULL, capacity, status);
+}
+
+int32_t RuleBasedBreakIterator::getBoundaries(
+        UText *ut, int32_t *boundaries, int32_t *statusValues,
+        int32_t capacity, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (capacity < 0 || (capacity > 0 && boundaries == NULL)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    setText(ut, status);
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+
+    // The start of the text is always a boundary.
+    int32_t count = 0;
+    if (count < capacity) {
+        boundaries[count] = 0;
+        if (statusValues != NULL) {
+            statusValues[count] = 0;
+        }
+    }
+    ++count;
+
+    // Run the state machine straight through the text. Segments that contain
+    // dictionary characters are still subdivided through the dictionary
+    // cache, the same way BreakCache::populateFollowing() does it, but no
+    // break cache entries are maintained.
+    int32_t from = 0;
+    int32_t fromRuleStatusIdx = 0;
+    for (;;) {
+        int32_t pos;
+        int32_t ruleStatusIdx;
+        if (!fDictionaryCache->following(from, &pos, &ruleStatusIdx)) {
+            fPosition = from;
+            pos = handleNext();
+            if (pos == UBRK_DONE) {
+                break;
+            }
+            ruleStatusIdx = fRuleStatusIndex;
+            if (fDictionaryCharCount > 0) {
+                // The text segment obtained from the rules includes dictionary
+                // characters; subdivide it.
+                fDictionaryCache->populateDictionary(from, pos, fromRuleStatusIdx, ruleStatusIdx);
+                // Falls back to the rule boundary if the dictionary did not
+                // subdivide the segment; following() leaves pos unchanged then.
+                fDictionaryCache->following(from, &pos, &ruleStatusIdx);
+            }
+        }
+        if (count < capacity) {
+            boundaries[count] = pos;
+            if (statusValues != NULL) {
+                // The primary (largest) status value, as getRuleStatus()
+                // would report it at this boundary.
+                int32_t vIdx = ruleStatusIdx + fData->fRuleStatusTable[ruleStatusIdx];
+                statusValues[count] = fData->fRuleStatusTable[vIdx];
+            }
+        }
+        ++count;
+        from = pos;
+        fromRuleStatusIdx = ruleStatusIdx;
+    }
+
+    // Leave the iterator freshly positioned at the start of the text.
+    fDictionaryCache->reset();
+    fBreakCache->reset();
+    fDone = FALSE;
+    this->first();
+
+    if (count > capacity) {
+        status = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return count;
+}
+
 
 
 //-------------------------------------------------------------------------------
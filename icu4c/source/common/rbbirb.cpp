@@ -27,6 +27,8 @@
 
 #include "cmemory.h"
 #include "cstring.h"
+#include "ucln_cmn.h"
+#include "umutex.h"
 #include "rbbirb.h"
 #include "rbbinode.h"
 #include "rbbiscan.h"
@@ -207,6 +209,93 @@ RBBIDataHeader *RBBIRuleBuilder::flattenData() {
 }
 
 
+//----------------------------------------------------------------------------------------
+//
+//   Cache of recently compiled rule sets.
+//
+//   Compiling rule source costs tens of milliseconds, while opening an
+//   iterator from already-compiled tables costs microseconds. Processes
+//   that repeatedly create iterators from the same custom rule source hit
+//   this cache and skip the compiler entirely. Cross-process reuse is
+//   available through getBinaryRules() and the pre-compiled-rules
+//   constructor, which use the same binary format that genbrk writes.
+//
+//----------------------------------------------------------------------------------------
+U_NAMESPACE_END
+
+struct RBBICompiledRulesCacheEntry {
+    UChar               *fRules;         // rule source, owned (uprv_malloc)
+    int32_t              fRulesLength;
+    icu::RBBIDataHeader *fData;          // compiled image, owned (uprv_malloc)
+};
+
+static const int32_t kRBBIRulesCacheSize = 4;
+static RBBICompiledRulesCacheEntry gRBBIRulesCache[kRBBIRulesCacheSize];
+static int32_t gRBBIRulesCacheNextSlot = 0;   // round-robin replacement
+static icu::UMutex gRBBIRulesCacheMutex;
+
+U_CDECL_BEGIN
+static UBool U_CALLCONV rbbirb_cleanup(void) {
+    for (int32_t i = 0; i < kRBBIRulesCacheSize; i++) {
+        uprv_free(gRBBIRulesCache[i].fRules);
+        gRBBIRulesCache[i].fRules = NULL;
+        gRBBIRulesCache[i].fRulesLength = 0;
+        uprv_free(gRBBIRulesCache[i].fData);
+        gRBBIRulesCache[i].fData = NULL;
+    }
+    gRBBIRulesCacheNextSlot = 0;
+    return TRUE;
+}
+U_CDECL_END
+
+U_NAMESPACE_BEGIN
+
+//  Returns a caller-owned copy of the compiled image for this rule source,
+//  or NULL if it has not been compiled since the cache was last cleared.
+static RBBIDataHeader *rbbiRulesCacheGet(const UnicodeString &rules) {
+    RBBIDataHeader *result = NULL;
+    umtx_lock(&gRBBIRulesCacheMutex);
+    for (int32_t i = 0; i < kRBBIRulesCacheSize; i++) {
+        const RBBICompiledRulesCacheEntry &entry = gRBBIRulesCache[i];
+        if (entry.fData != NULL &&
+                rules.compare(entry.fRules, entry.fRulesLength) == 0) {
+            result = (RBBIDataHeader *)uprv_malloc(entry.fData->fLength);
+            if (result != NULL) {
+                uprv_memcpy(result, entry.fData, entry.fData->fLength);
+            }
+            break;
+        }
+    }
+    umtx_unlock(&gRBBIRulesCacheMutex);
+    return result;
+}
+
+//  Remembers copies of the rule source and its compiled image.
+//  Failure to cache is not an error; the caller's build result is unaffected.
+static void rbbiRulesCachePut(const UnicodeString &rules, const RBBIDataHeader *data) {
+    int32_t rulesLength = rules.length();
+    UChar *rulesCopy = (UChar *)uprv_malloc(rulesLength * sizeof(UChar));
+    RBBIDataHeader *dataCopy = (RBBIDataHeader *)uprv_malloc(data->fLength);
+    if (rulesCopy == NULL || dataCopy == NULL) {
+        uprv_free(rulesCopy);
+        uprv_free(dataCopy);
+        return;
+    }
+    rules.extract(0, rulesLength, rulesCopy);
+    uprv_memcpy(dataCopy, data, data->fLength);
+
+    umtx_lock(&gRBBIRulesCacheMutex);
+    ucln_common_registerCleanup(UCLN_COMMON_RBBIRULES, rbbirb_cleanup);
+    RBBICompiledRulesCacheEntry &entry = gRBBIRulesCache[gRBBIRulesCacheNextSlot];
+    gRBBIRulesCacheNextSlot = (gRBBIRulesCacheNextSlot + 1) % kRBBIRulesCacheSize;
+    uprv_free(entry.fRules);
+    uprv_free(entry.fData);
+    entry.fRules = rulesCopy;
+    entry.fRulesLength = rulesLength;
+    entry.fData = dataCopy;
+    umtx_unlock(&gRBBIRulesCacheMutex);
+}
+
 //----------------------------------------------------------------------------------------
 //
 //  createRuleBasedBreakIterator    construct from source rules that are passed in
@@ -218,6 +307,27 @@ RBBIRuleBuilder::createRuleBasedBreakIterator( const UnicodeString    &rules,
                                     UParseError      *parseError,
                                     UErrorCode       &status)
 {
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+
+    //
+    // Check whether these rules were compiled recently; if so, open the
+    // iterator directly from the cached tables.
+    //
+    RBBIDataHeader *cachedData = rbbiRulesCacheGet(rules);
+    if (cachedData != NULL) {
+        RuleBasedBreakIterator *This = new RuleBasedBreakIterator(cachedData, status);
+        if (U_FAILURE(status)) {
+            delete This;
+            This = NULL;
+        }
+        else if(This == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+        }
+        return This;
+    }
+
     //
     // Read the input rules, generate a parse tree, symbol table,
     // and list of all Unicode Sets referenced by the rules.
@@ -233,6 +343,8 @@ RBBIRuleBuilder::createRuleBasedBreakIterator( const UnicodeString    &rules,
         return nullptr;
     }
 
+    rbbiRulesCachePut(rules, data);
+
     //
     //  Create a break iterator from the compiled rules.
     //     (Identical to creation from stored pre-compiled rules)
@@ -95,6 +95,26 @@ public:
      */
     UBool getKeyAndValue(int32_t i, const char *&key, ResourceValue &value) const;
 
+    /**
+     * Bulk-extracts all of the keys and string values of this table resource
+     * in one traversal. The dest strings are set as read-only aliases into the
+     * resource data, like ResourceValue::getUnicodeString(); no string contents
+     * are copied.
+     *
+     * @param value A value object from the same resource bundle as this table;
+     *     only used for implementation access to the resource data.
+     * @param keys Output-only array of capacity key pointers; may be NULL if
+     *     only the strings are wanted.
+     * @param dest Output-only array of capacity strings.
+     * @return The number of items in the table resource.
+     *     If greater than capacity, then an overflow error is set.
+     *
+     * Sets U_RESOURCE_TYPE_MISMATCH if any of the table items is not a string.
+     */
+    int32_t getKeysAndStrings(const ResourceValue &value,
+                              const char **keys, UnicodeString *dest, int32_t capacity,
+                              UErrorCode &errorCode) const;
+
 private:
     const uint16_t *keys16;
     const int32_t *keys32;
@@ -333,8 +333,6 @@ U_CDECL_END
 ******************************************************************
 */
 
-static UMutex lock = U_MUTEX_INITIALIZER;
-
 ICUService::ICUService()
 : name()
 , timestamp(0)
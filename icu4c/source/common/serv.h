@@ -31,6 +31,7 @@ U_NAMESPACE_END
 #include "unicode/umisc.h"
 
 #include "hash.h"
+#include "umutex.h"
 #include "uvector.h"
 #include "servnotf.h"
 
@@ -557,6 +558,14 @@ class U_COMMON_API ICUService : public ICUNotifier {
      */
     DNCache* dnCache;
 
+    /**
+     * Lock protecting the factory list and the caches.
+     * One lock per service instance, so that lookups in one service
+     * (e.g. collators) do not contend with lookups in another
+     * (e.g. break iterators).
+     */
+    mutable UMutex lock;
+
     /**
      * Constructor.
      */
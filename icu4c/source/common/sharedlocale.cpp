@@ -0,0 +1,49 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+******************************************************************************
+* sharedlocale.cpp
+*/
+
+#include "unicode/utypes.h"
+#include "sharedlocale.h"
+#include "unifiedcache.h"
+
+U_NAMESPACE_BEGIN
+
+SharedLocale::~SharedLocale() {
+    delete ptr;
+}
+
+template<> U_COMMON_API
+const SharedLocale *LocaleCacheKey<SharedLocale>::createObject(
+        const void * /*unusedCreationContext*/, UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    Locale *locale = fLoc.clone();
+    if (locale == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    SharedLocale *shared = new SharedLocale(locale);
+    if (shared == NULL) {
+        delete locale;
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    shared->addRef();
+    return shared;
+}
+
+const SharedLocale *
+SharedLocale::getShared(const char *localeName, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    const SharedLocale *shared = NULL;
+    UnifiedCache::getByLocale(Locale(localeName), shared, status);
+    return shared;
+}
+
+U_NAMESPACE_END
@@ -0,0 +1,47 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+******************************************************************************
+* sharedlocale.h
+*/
+
+#ifndef __SHARED_LOCALE_H__
+#define __SHARED_LOCALE_H__
+
+#include "unicode/utypes.h"
+#include "unicode/locid.h"
+#include "sharedobject.h"
+
+U_NAMESPACE_BEGIN
+
+/**
+ * A reference-counted, immutable Locale interned in the unified cache.
+ * Callers that construct the same locale over and over (for example, per
+ * request from protocol headers) can hold one shared canonical instance
+ * instead of re-running Locale::init() and copying the object around.
+ */
+class U_COMMON_API SharedLocale : public SharedObject {
+public:
+    SharedLocale(Locale *locToAdopt) : ptr(locToAdopt) { }
+    virtual ~SharedLocale();
+    const Locale *get() const { return ptr; }
+    const Locale *operator->() const { return ptr; }
+    const Locale &operator*() const { return *ptr; }
+
+    /**
+     * Returns the shared instance for localeName, interning a canonicalized
+     * copy in the unified cache on first use. On success the returned
+     * instance has an extra reference; the caller must call removeRef()
+     * when done with it. Returns NULL on failure.
+     */
+    static const SharedLocale *getShared(const char *localeName, UErrorCode &status);
+
+private:
+    Locale *ptr;
+    SharedLocale(const SharedLocale &);
+    SharedLocale &operator=(const SharedLocale &);
+};
+
+U_NAMESPACE_END
+
+#endif
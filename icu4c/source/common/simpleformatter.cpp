@@ -11,6 +11,7 @@
 #include "unicode/utypes.h"
 #include "unicode/simpleformatter.h"
 #include "unicode/unistr.h"
+#include "unicode/ustring.h"
 #include "uassert.h"
 
 U_NAMESPACE_BEGIN
@@ -272,6 +273,10 @@ UnicodeString &SimpleFormatter::format(
     for (int32_t i = 0; i < offsetsLength; i++) {
         offsets[i] = -1;
     }
+    // First pass: validate the values and compute the final result length,
+    // so that the result buffer needs to be grown at most once.
+    int32_t resultLength = result.length();
+    int32_t finalLength = resultLength;
     for (int32_t i = 1; i < compiledPatternLength;) {
         int32_t n = compiledPattern[i++];
         if (n < ARG_NUM_LIMIT) {
@@ -285,29 +290,58 @@ UnicodeString &SimpleFormatter::format(
                     errorCode = U_ILLEGAL_ARGUMENT_ERROR;
                     return result;
                 }
+                if (i != 2) {
+                    // Non-initial result-as-value: resultCopy is inserted.
+                    // (The initial one stays in place and is already counted.)
+                    finalLength += resultCopy->length();
+                }
+            } else {
+                finalLength += value->length();
+            }
+        } else {
+            int32_t length = n - ARG_NUM_LIMIT;
+            finalLength += length;
+            i += length;
+        }
+    }
+    // Second pass: copy the literal segments and values directly into the
+    // reserved buffer, rather than one UnicodeString::append() per segment.
+    UChar *buffer = result.getBuffer(finalLength);
+    if (buffer == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return result;
+    }
+    int32_t length = resultLength;
+    for (int32_t i = 1; i < compiledPatternLength;) {
+        int32_t n = compiledPattern[i++];
+        if (n < ARG_NUM_LIMIT) {
+            const UnicodeString *value;
+            if (values[n] == &result) {
                 if (i == 2) {
                     // We are appending to result which is also the first value object.
                     if (n < offsetsLength) {
                         offsets[n] = 0;
                     }
-                } else {
-                    if (n < offsetsLength) {
-                        offsets[n] = result.length();
-                    }
-                    result.append(*resultCopy);
+                    continue;
                 }
+                value = resultCopy;
             } else {
-                if (n < offsetsLength) {
-                    offsets[n] = result.length();
-                }
-                result.append(*value);
+                value = values[n];
+            }
+            if (n < offsetsLength) {
+                offsets[n] = length;
             }
+            u_memcpy(buffer + length, value->getBuffer(), value->length());
+            length += value->length();
         } else {
-            int32_t length = n - ARG_NUM_LIMIT;
-            result.append(compiledPattern + i, length);
-            i += length;
+            int32_t segmentLength = n - ARG_NUM_LIMIT;
+            u_memcpy(buffer + length, compiledPattern + i, segmentLength);
+            length += segmentLength;
+            i += segmentLength;
         }
     }
+    U_ASSERT(length == finalLength);
+    result.releaseBuffer(length);
     return result;
 }
 
@@ -182,6 +182,82 @@ ubidi_openSized(int32_t maxLength, int32_t maxRunCount, UErrorCode *pErrorCode)
     }
 }
 
+U_CAPI void U_EXPORT2
+ubidi_reserve(UBiDi *pBiDi, int32_t maxLength, int32_t maxRunCount,
+              UErrorCode *pErrorCode) {
+    RETURN_VOID_IF_NULL_OR_FAILING_ERRCODE(pErrorCode);
+    if(pBiDi==NULL || maxLength<0 || maxRunCount<0) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    /* grow (never shrink) the arrays, always allowing allocation */
+    if(maxLength>0) {
+        if( !getInitialDirPropsMemory(pBiDi, maxLength) ||
+            !getInitialLevelsMemory(pBiDi, maxLength)
+        ) {
+            *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+    }
+    if(maxRunCount>1) {
+        if(!getInitialRunsMemory(pBiDi, maxRunCount)) {
+            *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+    }
+    /*
+     * Reserved capacity is a floor, not a ceiling: unlike strict
+     * preallocation via ubidi_openSized(), larger texts must still
+     * succeed by growing on demand.
+     */
+    pBiDi->mayAllocateText=TRUE;
+    pBiDi->mayAllocateRuns=TRUE;
+}
+
+U_CAPI int32_t U_EXPORT2
+ubidi_splitParagraphs(const UChar *text, int32_t length,
+                      int32_t *paraLimits, int32_t paraLimitsCapacity,
+                      UErrorCode *pErrorCode) {
+    int32_t i, count, lastLimit;
+
+    RETURN_IF_NULL_OR_FAILING_ERRCODE(pErrorCode, 0);
+    if( text==NULL || length<0 ||
+        (paraLimits==NULL && paraLimitsCapacity>0) || paraLimitsCapacity<0
+    ) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    /*
+     * Match the paragraph determination of ubidi_setPara()/getDirProps():
+     * every B-class code unit ends a paragraph, CR LF counts as a single
+     * separator, and all block separators are BMP code units, so a
+     * UChar-wise scan is sufficient.
+     */
+    count=0;
+    lastLimit=0;
+    for(i=0; i<length;) {
+        UChar c=text[i++];
+        if(u_charDirection(c)==U_BLOCK_SEPARATOR) {
+            if(c==CR && i<length && text[i]==LF) {
+                ++i;    /* CR LF is one separator */
+            }
+            if(count<paraLimitsCapacity) {
+                paraLimits[count]=i;
+            }
+            ++count;
+            lastLimit=i;
+        }
+    }
+    if(count==0 || lastLimit<length) {
+        /* trailing text without a separator forms the last paragraph */
+        if(count<paraLimitsCapacity) {
+            paraLimits[count]=length;
+        }
+        ++count;
+    }
+    return count;
+}
+
 /*
  * We are allowed to allocate memory if memory==NULL or
  * mayAllocate==TRUE for each array that we need.
@@ -517,6 +593,25 @@ getDirProps(UBiDi *pBiDi) {
                 state=LOOKING_FOR_PDI;
             }
             lastStrong=L;
+            /*
+             * Burst over any directly following ASCII letters: they are
+             * always strong L, and now that the strong-L state
+             * transitions above have run, further L characters change
+             * nothing but lastStrong, so both the property lookup and
+             * the state machine can be skipped for the whole run.
+             * This is the dominant case for mostly-LTR text; the L flag
+             * is already set. Skipped with a custom class callback,
+             * which may classify any character differently.
+             */
+            if(pBiDi->fnClassCallback==NULL) {
+                while(i<originalLength) {
+                    UChar c=text[i];
+                    if((uint32_t)(c-0x41)>=26 && (uint32_t)(c-0x61)>=26) {
+                        break;
+                    }
+                    dirProps[i++]=L;
+                }
+            }
             continue;
         }
         if(dirProp==R || dirProp==AL) {
@@ -387,6 +387,34 @@ ubidi_getVisualRun(UBiDi *pBiDi, int32_t runIndex,
     return (UBiDiDirection)GET_ODD_BIT(start);
 }
 
+U_CAPI void U_EXPORT2
+ubidi_emitReordered(UBiDi *pBiDi, UBiDiRunSink *sink, const void *context,
+                    UErrorCode *pErrorCode) {
+    int32_t runIndex, runCount, visualStart;
+
+    RETURN_VOID_IF_NULL_OR_FAILING_ERRCODE(pErrorCode);
+    if(sink==NULL) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    /* ubidi_countRuns() checks for VALID_PARA_OR_LINE and resolves the runs */
+    runCount=ubidi_countRuns(pBiDi, pErrorCode);
+    if(U_FAILURE(*pErrorCode)) {
+        return;
+    }
+    visualStart=0;
+    for(runIndex=0; runIndex<runCount; ++runIndex) {
+        const Run *run=&pBiDi->runs[runIndex];
+        if(!sink(context,
+                 GET_INDEX(run->logicalStart),
+                 run->visualLimit-visualStart,
+                 (UBiDiDirection)GET_ODD_BIT(run->logicalStart))) {
+            break;
+        }
+        visualStart=run->visualLimit;
+    }
+}
+
 /* in trivial cases there is only one trivial run; called by ubidi_getRuns() */
 static void
 getSingleRun(UBiDi *pBiDi, UBiDiLevel level) {
@@ -78,6 +78,11 @@ typedef struct {
 struct UBiDiTransform {
     UBiDi                   *pBidi;             /* pointer to a UBiDi object */
     const ReorderingScheme  *pActiveScheme;     /* effective reordering scheme */
+    const ReorderingScheme  *pCachedScheme;     /* scheme resolved on the previous call */
+    UBiDiLevel              cachedInLevel;      /* resolved parameters the cached scheme */
+    UBiDiLevel              cachedOutLevel;     /*   was found for; a call with the same */
+    UBiDiOrder              cachedInOrder;      /*   parameters reuses it without a new  */
+    UBiDiOrder              cachedOutOrder;     /*   scheme lookup                       */
     UChar                   *src;               /* input text */
     UChar                   *dest;              /* output text */
     uint32_t                srcLength;          /* input text length - not really needed as we are zero-terminated and can u_strlen */
@@ -468,10 +473,25 @@ ubiditransform_transform(UBiDiTransform *pBiDiTransform,
        to the 1st paragraph */
     resolveBaseDirection(src, srcLength, &inParaLevel, &outParaLevel);
 
-    pBiDiTransform->pActiveScheme = findMatchingScheme(inParaLevel, outParaLevel,
-            inOrder, outOrder);
-    if (pBiDiTransform->pActiveScheme == NULL) {
-        goto cleanup;
+    /* A reused transform object usually runs the same conversion on every
+       call; reuse the scheme resolved last time when the parameters match. */
+    if (pBiDiTransform->pCachedScheme != NULL
+            && inParaLevel == pBiDiTransform->cachedInLevel
+            && outParaLevel == pBiDiTransform->cachedOutLevel
+            && inOrder == pBiDiTransform->cachedInOrder
+            && outOrder == pBiDiTransform->cachedOutOrder) {
+        pBiDiTransform->pActiveScheme = pBiDiTransform->pCachedScheme;
+    } else {
+        pBiDiTransform->pActiveScheme = findMatchingScheme(inParaLevel, outParaLevel,
+                inOrder, outOrder);
+        if (pBiDiTransform->pActiveScheme == NULL) {
+            goto cleanup;
+        }
+        pBiDiTransform->pCachedScheme = pBiDiTransform->pActiveScheme;
+        pBiDiTransform->cachedInLevel = inParaLevel;
+        pBiDiTransform->cachedOutLevel = outParaLevel;
+        pBiDiTransform->cachedInOrder = inOrder;
+        pBiDiTransform->cachedOutOrder = outOrder;
     }
     pBiDiTransform->reorderingOptions = doMirroring ? UBIDI_DO_MIRRORING
             : UBIDI_REORDER_DEFAULT;
@@ -492,6 +512,14 @@ ubiditransform_transform(UBiDiTransform *pBiDiTransform,
             goto cleanup;
         }
     }
+    /* Pre-size the persistent UBiDi to the working buffer capacity so that
+       the ubidi_setPara() calls below never allocate on a reused object;
+       the reserved capacity is a floor, longer texts still grow on demand. */
+    ubidi_reserve(pBiDiTransform->pBidi, (int32_t)pBiDiTransform->srcSize, 0,
+            pErrorCode);
+    if (U_FAILURE(*pErrorCode)) {
+        goto cleanup;
+    }
     pBiDiTransform->dest = dest;
     pBiDiTransform->destSize = destSize;
     pBiDiTransform->pDestLength = &destLength;
@@ -96,6 +96,40 @@ BreakIterator *ustrcase_getTitleBreakIterator(
         const Locale *locale, const char *locID, uint32_t options, BreakIterator *iter,
         LocalPointer<BreakIterator> &ownedIter, UErrorCode &errorCode);
 
+/**
+ * Reusable titlecasing object.
+ * Resolves the case locale and creates the titlecasing break iterator
+ * once in the constructor, so that repeated toTitle() calls
+ * (e.g., per product name in a service) skip that per-call setup
+ * which otherwise dominates CaseMap::toTitle() for short strings.
+ *
+ * Like UCaseMap, an instance holds mutable iterator state and
+ * must not be used concurrently from multiple threads.
+ * @internal
+ */
+class U_COMMON_API TitleCaseMap : public UMemory {
+public:
+    /**
+     * @param locale case mapping & break iterator locale
+     * @param options titlecasing options, see CaseMap::toTitle()
+     */
+    TitleCaseMap(const char *locale, uint32_t options, UErrorCode &errorCode);
+    ~TitleCaseMap();
+
+    /** Same semantics and parameters as CaseMap::toTitle() without the setup. */
+    int32_t toTitle(const UChar *src, int32_t srcLength,
+                    UChar *dest, int32_t destCapacity, Edits *edits,
+                    UErrorCode &errorCode) const;
+
+private:
+    TitleCaseMap(const TitleCaseMap &other);  // forbid copying
+    void operator=(const TitleCaseMap &other);  // forbid copying
+
+    BreakIterator *iter;  // owned
+    int32_t caseLocale;
+    uint32_t options;
+};
+
 #endif
 
 U_NAMESPACE_END
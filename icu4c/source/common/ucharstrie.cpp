@@ -211,27 +211,32 @@ UCharsTrie::next(ConstChar16Ptr ptr, int32_t sLength) {
                 --length;
             }
         } else {
-            for(;;) {
-                if(sLength==0) {
-                    remainingMatchLength_=length;
-                    pos_=pos;
-                    int32_t node;
-                    return (length<0 && (node=*pos)>=kMinValueLead) ?
-                            valueResult(node) : USTRINGTRIE_NO_VALUE;
+            if(length>=0) {
+                // Compare the remaining linear-match units in bulk;
+                // the position of a mismatch does not matter.
+                int32_t n=length+1;
+                if(n>sLength) {
+                    n=sLength;
                 }
-                uchar=*s++;
-                --sLength;
-                if(length<0) {
-                    remainingMatchLength_=length;
-                    break;
-                }
-                if(uchar!=*pos) {
+                if(uprv_memcmp(s, pos, n*sizeof(UChar))!=0) {
                     stop();
                     return USTRINGTRIE_NO_MATCH;
                 }
-                ++pos;
-                --length;
+                s+=n;
+                sLength-=n;
+                pos+=n;
+                length-=n;
+            }
+            if(sLength==0) {
+                remainingMatchLength_=length;
+                pos_=pos;
+                int32_t node;
+                return (length<0 && (node=*pos)>=kMinValueLead) ?
+                        valueResult(node) : USTRINGTRIE_NO_VALUE;
             }
+            uchar=*s++;
+            --sLength;
+            remainingMatchLength_=length;
         }
         int32_t node=*pos++;
         for(;;) {
@@ -46,6 +46,11 @@
  * has its cache flushed.  This will prevent any memory leaks due to
  * reference counting.
  *
+ * The teardown order is deterministic: u_cleanup() runs the library
+ * cleanup functions in the order of ECleanupLibraryType, with the common
+ * library last, and within each library the registered functions run in
+ * the order of that library's cleanup enum.
+ *
  * Please see common/ucln_cmn.{h,c} and i18n/ucln_in.{h,c} for examples.
  */
 
@@ -14,10 +14,11 @@
 *   created by: George Rhoten
 */
 
+#include <atomic>
+
 #include "unicode/utypes.h"
 #include "unicode/uclean.h"
 #include "cmemory.h"
-#include "mutex.h"
 #include "uassert.h"
 #include "ucln.h"
 #include "ucln_cmn.h"
@@ -28,8 +29,16 @@
 #define UCLN_TYPE_IS_COMMON
 #include "ucln_imp.h"
 
-static cleanupFunc *gCommonCleanupFunctions[UCLN_COMMON_COUNT];
-static cleanupFunc *gLibCleanupFunctions[UCLN_COMMON];
+/*
+ * The registration slots are atomic so that registering a cleanup function,
+ * which happens inside lazy one-time initialization on first-use paths,
+ * does not need to take the global mutex. Formerly the registration
+ * functions locked the global mutex purely as a memory barrier
+ * (see ticket 10295); a release store gives the same guarantee without
+ * contending with other users of that mutex.
+ */
+static std::atomic<cleanupFunc *> gCommonCleanupFunctions[UCLN_COMMON_COUNT];
+static std::atomic<cleanupFunc *> gLibCleanupFunctions[UCLN_COMMON];
 
 
 /************************************************
@@ -52,12 +61,12 @@ u_cleanup(void)
 /*#endif*/
 }
 
-U_CAPI void U_EXPORT2 ucln_cleanupOne(ECleanupLibraryType libType) 
+U_CAPI void U_EXPORT2 ucln_cleanupOne(ECleanupLibraryType libType)
 {
-    if (gLibCleanupFunctions[libType])
+    cleanupFunc *func = gLibCleanupFunctions[libType].exchange(NULL, std::memory_order_acquire);
+    if (func != NULL)
     {
-        gLibCleanupFunctions[libType]();
-        gLibCleanupFunctions[libType] = NULL;
+        func();
     }
 }
 
@@ -68,18 +77,13 @@ ucln_common_registerCleanup(ECleanupCommonType type,
     U_ASSERT(UCLN_COMMON_START < type && type < UCLN_COMMON_COUNT);
     if (UCLN_COMMON_START < type && type < UCLN_COMMON_COUNT)
     {
-        icu::Mutex m;     // See ticket 10295 for discussion.
-        gCommonCleanupFunctions[type] = func;
+        gCommonCleanupFunctions[type].store(func, std::memory_order_release);
     }
 #if !UCLN_NO_AUTO_CLEANUP && (defined(UCLN_AUTO_ATEXIT) || defined(UCLN_AUTO_LOCAL))
     ucln_registerAutomaticCleanup();
 #endif
 }
 
-// Note: ucln_registerCleanup() is called with the ICU global mutex locked.
-//       Be aware if adding anything to the function.
-//       See ticket 10295 for discussion.
-
 U_CAPI void U_EXPORT2
 ucln_registerCleanup(ECleanupLibraryType type,
                      cleanupFunc *func)
@@ -87,7 +91,7 @@ ucln_registerCleanup(ECleanupLibraryType type,
     U_ASSERT(UCLN_START < type && type < UCLN_COMMON);
     if (UCLN_START < type && type < UCLN_COMMON)
     {
-        gLibCleanupFunctions[type] = func;
+        gLibCleanupFunctions[type].store(func, std::memory_order_release);
     }
 }
 
@@ -100,10 +104,10 @@ U_CFUNC UBool ucln_lib_cleanup(void) {
     }
 
     for (commonFunc++; commonFunc<UCLN_COMMON_COUNT; commonFunc++) {
-        if (gCommonCleanupFunctions[commonFunc])
+        cleanupFunc *func = gCommonCleanupFunctions[commonFunc].exchange(NULL, std::memory_order_acquire);
+        if (func != NULL)
         {
-            gCommonCleanupFunctions[commonFunc]();
-            gCommonCleanupFunctions[commonFunc] = NULL;
+            func();
         }
     }
 #if !UCLN_NO_AUTO_CLEANUP && (defined(UCLN_AUTO_ATEXIT) || defined(UCLN_AUTO_LOCAL))
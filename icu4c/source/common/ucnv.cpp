@@ -858,6 +858,35 @@ _fromUnicodeWithCallback(UConverterFromUnicodeArgs *pArgs, UErrorCode *err) {
         }
     }
 
+    /*
+     * Fast path for trusted input (",trusted" converter option):
+     * as long as the conversion function stays on the clean-input path,
+     * skip the offset and replay bookkeeping below and call it directly.
+     * On an error, a replay request or a flush retry, fall through into
+     * the full error-handling machinery with the partially updated pArgs.
+     */
+    if( (cnv->options&UCNV_OPTION_TRUSTED)!=0 &&
+        offsets==NULL && cnv->preFromULength==0 && U_SUCCESS(*err)
+    ) {
+        do {
+            fromUnicode(pArgs, err);
+        } while(U_SUCCESS(*err) &&
+                pArgs->source<pArgs->sourceLimit && cnv->preFromULength==0);
+        if( U_SUCCESS(*err) && cnv->preFromULength==0 &&
+            (!pArgs->flush ||
+             (pArgs->source==pArgs->sourceLimit && cnv->fromUChar32==0))
+        ) {
+            if(pArgs->flush) {
+                /* reset the converter without calling the callback function */
+                _reset(cnv, UCNV_RESET_FROM_UNICODE, FALSE);
+            }
+            return;
+        }
+        /* resync the local pointers for the regular conversion loop */
+        s=pArgs->source;
+        t=pArgs->target;
+    }
+
     if(cnv->preFromULength>=0) {
         /* normal mode */
         realSource=NULL;
@@ -1263,6 +1292,7 @@ ucnv_fromUnicode(UConverter *cnv,
 
     *source=args.source;
     *target=args.target;
+    utrace_addCounter(UTRACE_COUNTER_CONVERTER_FROM_UNICODE_BYTES, (int64_t)(*target-t));
 }
 
 /* ucnv_toUnicode() --------------------------------------------------------- */
@@ -1303,6 +1333,35 @@ _toUnicodeWithCallback(UConverterToUnicodeArgs *pArgs, UErrorCode *err) {
         }
     }
 
+    /*
+     * Fast path for trusted input (",trusted" converter option):
+     * as long as the conversion function stays on the clean-input path,
+     * skip the offset and replay bookkeeping below and call it directly.
+     * On an error, a replay request or a flush retry, fall through into
+     * the full error-handling machinery with the partially updated pArgs.
+     */
+    if( (cnv->options&UCNV_OPTION_TRUSTED)!=0 &&
+        offsets==NULL && cnv->preToULength==0 && U_SUCCESS(*err)
+    ) {
+        do {
+            toUnicode(pArgs, err);
+        } while(U_SUCCESS(*err) &&
+                pArgs->source<pArgs->sourceLimit && cnv->preToULength==0);
+        if( U_SUCCESS(*err) && cnv->preToULength==0 &&
+            (!pArgs->flush ||
+             (pArgs->source==pArgs->sourceLimit && cnv->toULength==0))
+        ) {
+            if(pArgs->flush) {
+                /* reset the converter without calling the callback function */
+                _reset(cnv, UCNV_RESET_TO_UNICODE, FALSE);
+            }
+            return;
+        }
+        /* resync the local pointers for the regular conversion loop */
+        s=pArgs->source;
+        t=pArgs->target;
+    }
+
     if(cnv->preToULength>=0) {
         /* normal mode */
         realSource=NULL;
@@ -1709,6 +1768,7 @@ ucnv_toUnicode(UConverter *cnv,
 
     *source=args.source;
     *target=args.target;
+    utrace_addCounter(UTRACE_COUNTER_CONVERTER_TO_UNICODE_BYTES, (int64_t)(*source-s));
 }
 
 /* ucnv_to/fromUChars() ----------------------------------------------------- */
@@ -292,6 +292,7 @@ ucnv_data_unFlattenClone(UConverterLoadArgs *pArgs, UDataMemory *pData, UErrorCo
     const uint8_t *raw = (const uint8_t *)udata_getMemory(pData);
     const UConverterStaticData *source = (const UConverterStaticData *) raw;
     UConverterSharedData *data;
+    void *raw_data;
     UConverterType type = (UConverterType)source->conversionType;
 
     if(U_FAILURE(*status))
@@ -307,14 +308,26 @@ ucnv_data_unFlattenClone(UConverterLoadArgs *pArgs, UDataMemory *pData, UErrorCo
         return NULL;
     }
 
-    data = (UConverterSharedData *)uprv_malloc(sizeof(UConverterSharedData));
-    if(data == NULL) {
+    raw_data = uprv_malloc(sizeof(UConverterSharedData));
+    if(raw_data == NULL) {
         *status = U_MEMORY_ALLOCATION_ERROR;
         return NULL;
     }
 
-    /* copy initial values from the static structure for this type */
-    uprv_memcpy(data, converterData[type], sizeof(UConverterSharedData));
+    /*
+     * Copy initial values from the static structure for this type.
+     * The struct embeds a UConverterMBCSTable with a UInitOnce and must
+     * not be memcpy'd; the all-zero state equals the static entry's own
+     * initializer (including the reset UInitOnce), so zero the new block
+     * and set the handful of non-zero members explicitly.
+     */
+    uprv_memset(raw_data, 0, sizeof(UConverterSharedData));
+    data = (UConverterSharedData *)raw_data;
+    data->structSize = converterData[type]->structSize;
+    data->referenceCounter = converterData[type]->referenceCounter;
+    data->isReferenceCounted = converterData[type]->isReferenceCounted;
+    data->impl = converterData[type]->impl;
+    data->toUnicodeStatus = converterData[type]->toUnicodeStatus;
 
     data->staticData = source;
 
@@ -689,6 +702,9 @@ parseConverterOptions(const char *inName,
         } else if(uprv_strncmp(inName, "swaplfnl", 8)==0) {
             inName+=8;
             pArgs->options=(pPieces->options|=UCNV_OPTION_SWAP_LFNL);
+        } else if(uprv_strncmp(inName, "trusted", 7)==0) {
+            inName+=7;
+            pArgs->options=(pPieces->options|=UCNV_OPTION_TRUSTED);
         /* add processing for new options here with another } else if(uprv_strncmp(inName, "option-name=", XX)==0) { */
         } else {
             /* ignore any other options until we define some */
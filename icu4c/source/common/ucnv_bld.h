@@ -43,6 +43,12 @@
 /* converter options bits */
 #define UCNV_OPTION_VERSION     0xf
 #define UCNV_OPTION_SWAP_LFNL   0x10
+/*
+ * The input is trusted to be well-formed: skip the offset and replay
+ * bookkeeping in the conversion loop while no error occurs.
+ * Selected with the ",trusted" converter name option.
+ */
+#define UCNV_OPTION_TRUSTED     0x20
 
 #define UCNV_GET_VERSION(cnv) ((cnv)->options&UCNV_OPTION_VERSION)
 
@@ -0,0 +1,221 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+* ucnv_bulk.cpp
+*
+* created on: 2018nov20
+*/
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_CONVERSION
+
+#include "unicode/ucnv.h"
+#include "unicode/utf8.h"
+#include "cmemory.h"
+#include "cstring.h"
+#include "ucnv_bulk.h"
+#include "ustr_imp.h"
+
+U_CFUNC UBool
+ucnv_bulkIsSplittable(const UConverter *cnv) {
+    switch(ucnv_getType(cnv)) {
+    case UCNV_SBCS:
+    case UCNV_DBCS:         /* fixed two bytes per character */
+    case UCNV_LATIN_1:
+    case UCNV_US_ASCII:
+    case UCNV_UTF8:         /* trail bytes are self-marking */
+    case UCNV_CESU8:
+    case UCNV_UTF16_BigEndian:
+    case UCNV_UTF16_LittleEndian:
+    case UCNV_UTF32_BigEndian:
+    case UCNV_UTF32_LittleEndian:
+        return TRUE;
+    default:
+        /*
+         * Stateful (ISO-2022, SCSU, HZ, ...), non-synchronizing (general
+         * MBCS, BOCU-1, ...) or BOM-detecting (UTF-16/32) charsets:
+         * a chunk cannot be converted without the bytes before it.
+         */
+        return FALSE;
+    }
+}
+
+/*
+ * Moves pos backward onto the nearest character-sequence boundary.
+ * pos is an offset from the start of the stream, so that alignment
+ * for the fixed-width charsets is simply alignment of pos itself.
+ */
+static int32_t
+previousCharBoundary(UConverterType type, const uint8_t *s, int32_t pos) {
+    switch(type) {
+    case UCNV_UTF8:
+    case UCNV_CESU8:
+        while(pos>0 && U8_IS_TRAIL(s[pos])) { --pos; }
+        return pos;
+    case UCNV_UTF16_BigEndian:
+        pos&=~1;
+        if(pos>=2 && (s[pos-2]&0xfc)==0xd8) {
+            pos-=2;  /* do not cut a surrogate pair */
+        }
+        return pos;
+    case UCNV_UTF16_LittleEndian:
+        pos&=~1;
+        if(pos>=2 && (s[pos-1]&0xfc)==0xd8) {
+            pos-=2;  /* do not cut a surrogate pair */
+        }
+        return pos;
+    case UCNV_UTF32_BigEndian:
+    case UCNV_UTF32_LittleEndian:
+        return pos&~3;
+    case UCNV_DBCS:
+        return pos&~1;
+    default:
+        /* single-byte charsets: every position is a boundary */
+        return pos;
+    }
+}
+
+/* Returns the exclusive end of the chunk that starts at pos. */
+static int32_t
+nextChunkLimit(UConverterType type, const uint8_t *s, int32_t length,
+               int32_t pos, int32_t chunkSize) {
+    int32_t next;
+
+    if((length-pos)<=chunkSize) {
+        return length;
+    }
+    next=previousCharBoundary(type, s, pos+chunkSize);
+    if(next<=pos) {
+        /* chunkSize is smaller than one character sequence; take one character */
+        next=pos+1;
+        while(next<length && previousCharBoundary(type, s, next)!=next) {
+            ++next;
+        }
+    }
+    return next;
+}
+
+U_CFUNC int32_t
+ucnv_bulkSplitChunks(const UConverter *cnv,
+                     const char *src, int32_t length, int32_t chunkSize,
+                     int32_t *boundaries, int32_t boundariesCapacity,
+                     UErrorCode *pErrorCode) {
+    UConverterType type;
+    int32_t count, pos;
+
+    /* check arguments */
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if( cnv==NULL ||
+        length<0 || (length!=0 && src==NULL) || chunkSize<=0 ||
+        boundariesCapacity<0 || (boundariesCapacity>0 && boundaries==NULL)
+    ) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if(!ucnv_bulkIsSplittable(cnv)) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+
+    type=ucnv_getType(cnv);
+    count=0;
+    pos=0;
+    while(pos<length) {
+        pos=nextChunkLimit(type, (const uint8_t *)src, length, pos, chunkSize);
+        if(count<boundariesCapacity) {
+            boundaries[count]=pos;
+        }
+        ++count;
+    }
+    if(count>boundariesCapacity) {
+        *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+    }
+    return count;
+}
+
+U_CFUNC int32_t
+ucnv_bulkToUChars(UConverter *cnv,
+                  UChar *dest, int32_t destCapacity,
+                  const char *src, int32_t srcLength, int32_t chunkSize,
+                  UErrorCode *pErrorCode) {
+    UChar *originalDest, *destLimit;
+    int32_t destLength;
+
+    /* check arguments */
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if( cnv==NULL ||
+        destCapacity<0 || (destCapacity>0 && dest==NULL) ||
+        srcLength<-1 || (srcLength!=0 && src==NULL) || chunkSize<=0
+    ) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+
+    /* initialize */
+    originalDest=dest;
+    if(srcLength==-1) {
+        srcLength=(int32_t)uprv_strlen(src);
+    }
+    destLength=0;
+    if(srcLength>0) {
+        UConverterType type=ucnv_getType(cnv);
+        UBool splittable=ucnv_bulkIsSplittable(cnv);
+        UBool counting=FALSE;
+        int32_t pos=0;
+
+        destLimit=dest+destCapacity;
+
+        while(pos<srcLength) {
+            int32_t limit= splittable ?
+                nextChunkLimit(type, (const uint8_t *)src, srcLength, pos, chunkSize) :
+                srcLength;
+            const char *s=src+pos;
+            const char *sLimit=src+limit;
+
+            /*
+             * Each chunk is converted from the initial converter state,
+             * exactly like an independent conversion on a worker thread.
+             */
+            ucnv_resetToUnicode(cnv);
+            if(!counting) {
+                UChar *t=dest;
+
+                ucnv_toUnicode(cnv, &t, destLimit, &s, sLimit, 0, TRUE, pErrorCode);
+                destLength+=(int32_t)(t-dest);
+                dest=t;
+                if(*pErrorCode==U_BUFFER_OVERFLOW_ERROR) {
+                    counting=TRUE;
+                } else if(U_FAILURE(*pErrorCode)) {
+                    break;
+                }
+            }
+            if(counting) {
+                /* if an overflow occurs, then get the preflighting length */
+                UChar buffer[1024];
+
+                do {
+                    UChar *t=buffer;
+
+                    *pErrorCode=U_ZERO_ERROR;
+                    ucnv_toUnicode(cnv, &t, buffer+UPRV_LENGTHOF(buffer),
+                                   &s, sLimit, 0, TRUE, pErrorCode);
+                    destLength+=(int32_t)(t-buffer);
+                } while(*pErrorCode==U_BUFFER_OVERFLOW_ERROR);
+                if(U_FAILURE(*pErrorCode)) {
+                    break;
+                }
+            }
+            pos=limit;
+        }
+    }
+
+    return u_terminateUChars(originalDest, destCapacity, destLength, pErrorCode);
+}
+
+#endif  /* !UCONFIG_NO_CONVERSION */
@@ -0,0 +1,77 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+* ucnv_bulk.h
+*
+* created on: 2018nov20
+*/
+
+#ifndef __UCNV_BULK_H__
+#define __UCNV_BULK_H__
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_CONVERSION
+
+#include "unicode/ucnv.h"
+
+/*
+ * Helpers for bulk (file-sized) conversions.
+ *
+ * For charsets whose byte sequences are self-synchronizing or fixed-width,
+ * an input stream can be cut into chunks at character-sequence boundaries
+ * and each chunk converted by itself, with a separate UConverter, in any
+ * order. Callers that own worker threads can use this to convert large
+ * payloads in parallel: split the input with ucnv_bulkSplitChunks(), hand
+ * each chunk to a worker with its own converter (see UConverterPool in
+ * ucnv_pool.h), and concatenate the per-chunk output in chunk order.
+ *
+ * ICU itself does not create threads; ucnv_bulkToUChars() below is the
+ * sequential reference driver for the same chunking.
+ */
+
+/**
+ * Returns TRUE if the converter's charset can be split into independently
+ * convertible chunks: single-byte and other fixed-width charsets, and
+ * self-synchronizing multi-byte ones like UTF-8. Returns FALSE for
+ * stateful or non-synchronizing charsets (ISO-2022, SCSU, general MBCS,
+ * BOM-detecting Unicode charsets, ...), for which only whole-stream
+ * conversion is safe.
+ * @internal
+ */
+U_CFUNC UBool
+ucnv_bulkIsSplittable(const UConverter *cnv);
+
+/**
+ * Splits length bytes of input into chunks of roughly chunkSize bytes,
+ * moving each cut backward onto the nearest character-sequence boundary
+ * for the converter's charset. Writes the exclusive end of each chunk to
+ * boundaries[]; the last boundary equals length. Returns the number of
+ * chunks, or the required capacity with U_BUFFER_OVERFLOW_ERROR if
+ * boundariesCapacity is too small.
+ * Fails with U_ILLEGAL_ARGUMENT_ERROR if the charset is not splittable.
+ * @internal
+ */
+U_CFUNC int32_t
+ucnv_bulkSplitChunks(const UConverter *cnv,
+                     const char *src, int32_t length, int32_t chunkSize,
+                     int32_t *boundaries, int32_t boundariesCapacity,
+                     UErrorCode *pErrorCode);
+
+/**
+ * Converts the whole input to UTF-16 chunk by chunk, like ucnv_toUChars()
+ * with the usual preflighting semantics. Falls back to a single chunk for
+ * charsets that are not splittable. Each chunk is converted with the
+ * converter in its initial state, which is exactly what a parallel caller
+ * does on its worker threads.
+ * @internal
+ */
+U_CFUNC int32_t
+ucnv_bulkToUChars(UConverter *cnv,
+                  UChar *dest, int32_t destCapacity,
+                  const char *src, int32_t srcLength, int32_t chunkSize,
+                  UErrorCode *pErrorCode);
+
+#endif  /* !UCONFIG_NO_CONVERSION */
+#endif  /* __UCNV_BULK_H__ */
@@ -45,6 +45,7 @@
 #include "ucnv_io.h"
 #include "uenumimp.h"
 #include "ucln_cmn.h"
+#include "uhash.h"
 
 /* Format of cnvalias.icu -----------------------------------------------------
  *
@@ -198,6 +199,17 @@ static const UConverterAliasOptions defaultTableOptions = {
 };
 static UConverterAlias gMainTable;
 
+/*
+ * Hash over the sorted alias list, from the stripped alias name to
+ * (aliasList index)+1, so that every lookup is one hash and one string
+ * compare instead of a binary search with fuzzy name comparisons.
+ * Built once in initAliasData(); NULL if it could not be built, in
+ * which case findConverter() falls back to the binary search.
+ */
+static UHashtable *gAliasHash = NULL;
+
+static void initAliasHash(void);
+
 #define GET_STRING(idx) (const char *)(gMainTable.stringTable + (idx))
 #define GET_NORMALIZED_STRING(idx) (const char *)(gMainTable.normalizedStringTable + (idx))
 
@@ -218,6 +230,10 @@ isAcceptable(void * /*context*/,
 
 static UBool U_CALLCONV ucnv_io_cleanup(void)
 {
+    if (gAliasHash) {
+        uhash_close(gAliasHash);
+        gAliasHash = NULL;
+    }
     if (gAliasData) {
         udata_close(gAliasData);
         gAliasData = NULL;
@@ -306,6 +322,8 @@ static void U_CALLCONV initAliasData(UErrorCode &errCode) {
     currOffset += gMainTable.stringTableSize;
     gMainTable.normalizedStringTable = ((gMainTable.optionTable->stringNormalizationType == UCNV_IO_UNNORMALIZED)
         ? gMainTable.stringTable : (table + currOffset));
+
+    initAliasHash();
 }
 
 
@@ -544,6 +562,81 @@ ucnv_compareNames(const char *name1, const char *name2) {
     }
 }
 
+/*
+ * Build gAliasHash from the sorted alias list. Keys are the stripped
+ * alias names: pointers into the mapped normalized string table when the
+ * data file carries one, otherwise heap copies owned by the hash.
+ * On any failure the hash is abandoned; lookups then use the binary
+ * search only. Called once from initAliasData().
+ */
+static void
+initAliasHash(void) {
+    UErrorCode errorCode = U_ZERO_ERROR;
+    UHashtable *hash;
+    uint32_t i;
+    int isUnnormalized = (gMainTable.optionTable->stringNormalizationType == UCNV_IO_UNNORMALIZED);
+
+    hash = uhash_openSize(uhash_hashChars, uhash_compareChars, NULL,
+                          (int32_t)gMainTable.untaggedConvArraySize, &errorCode);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (isUnnormalized) {
+        uhash_setKeyDeleter(hash, uprv_free);
+    }
+    for (i = 0; i < gMainTable.untaggedConvArraySize; ++i) {
+        char *key;
+        if (isUnnormalized) {
+            const char *name = GET_STRING(gMainTable.aliasList[i]);
+            char strippedName[UCNV_MAX_CONVERTER_NAME_LENGTH];
+            if (uprv_strlen(name) >= UCNV_MAX_CONVERTER_NAME_LENGTH) {
+                /* the hash must cover every alias or not be used at all */
+                uhash_close(hash);
+                return;
+            }
+            ucnv_io_stripForCompare(strippedName, name);
+            key = uprv_strdup(strippedName);
+            if (key == NULL) {
+                uhash_close(hash);
+                return;
+            }
+        } else {
+            key = (char *)GET_NORMALIZED_STRING(gMainTable.aliasList[i]);
+        }
+        /* store i+1 so that 0 remains the "not found" result of uhash_geti() */
+        uhash_puti(hash, key, (int32_t)(i + 1), &errorCode);
+        if (U_FAILURE(errorCode)) {
+            uhash_close(hash);
+            return;
+        }
+    }
+    gAliasHash = hash;
+}
+
+/*
+ * deliver the mapping for the alias at aliasList/untaggedConvArray
+ * index mid, with the ambiguity warning and option information
+ */
+static inline uint32_t
+foundConverter(uint32_t mid, UBool *containsOption, UErrorCode *pErrorCode) {
+    /* Since the gencnval tool folds duplicates into one entry,
+     * this alias in gAliasList is unique, but different standards
+     * may map an alias to different converters.
+     */
+    if (gMainTable.untaggedConvArray[mid] & UCNV_AMBIGUOUS_ALIAS_MAP_BIT) {
+        *pErrorCode = U_AMBIGUOUS_ALIAS_WARNING;
+    }
+    /* State whether the canonical converter name contains an option.
+    This information is contained in this list in order to maintain backward & forward compatibility. */
+    if (containsOption) {
+        UBool containsCnvOptionInfo = (UBool)gMainTable.optionTable->containsCnvOptionInfo;
+        *containsOption = (UBool)((containsCnvOptionInfo
+            && ((gMainTable.untaggedConvArray[mid] & UCNV_CONTAINS_OPTION_BIT) != 0))
+            || !containsCnvOptionInfo);
+    }
+    return gMainTable.untaggedConvArray[mid] & UCNV_CONVERTER_INDEX_MASK;
+}
+
 /*
  * search for an alias
  * return the converter number index for gConverterList
@@ -554,6 +647,7 @@ findConverter(const char *alias, UBool *containsOption, UErrorCode *pErrorCode)
     uint32_t lastMid;
     int result;
     int isUnnormalized = (gMainTable.optionTable->stringNormalizationType == UCNV_IO_UNNORMALIZED);
+    UBool isStripped = FALSE;
     char strippedName[UCNV_MAX_CONVERTER_NAME_LENGTH];
 
     if (!isUnnormalized) {
@@ -565,6 +659,21 @@ findConverter(const char *alias, UBool *containsOption, UErrorCode *pErrorCode)
         /* Lower case and remove ignoreable characters. */
         ucnv_io_stripForCompare(strippedName, alias);
         alias = strippedName;
+        isStripped = TRUE;
+    } else if (gAliasHash != NULL &&
+               uprv_strlen(alias) < UCNV_MAX_CONVERTER_NAME_LENGTH) {
+        ucnv_io_stripForCompare(strippedName, alias);
+        alias = strippedName;
+        isStripped = TRUE;
+    }
+
+    /* one hash and one compare instead of the binary search below */
+    if (gAliasHash != NULL && isStripped) {
+        int32_t value = uhash_geti(gAliasHash, alias);
+        if (value == 0) {
+            return UINT32_MAX;
+        }
+        return foundConverter((uint32_t)(value - 1), containsOption, pErrorCode);
     }
 
     /* do a binary search for the alias */
@@ -591,22 +700,7 @@ findConverter(const char *alias, UBool *containsOption, UErrorCode *pErrorCode)
         } else if (result > 0) {
             start = mid;
         } else {
-            /* Since the gencnval tool folds duplicates into one entry,
-             * this alias in gAliasList is unique, but different standards
-             * may map an alias to different converters.
-             */
-            if (gMainTable.untaggedConvArray[mid] & UCNV_AMBIGUOUS_ALIAS_MAP_BIT) {
-                *pErrorCode = U_AMBIGUOUS_ALIAS_WARNING;
-            }
-            /* State whether the canonical converter name contains an option.
-            This information is contained in this list in order to maintain backward & forward compatibility. */
-            if (containsOption) {
-                UBool containsCnvOptionInfo = (UBool)gMainTable.optionTable->containsCnvOptionInfo;
-                *containsOption = (UBool)((containsCnvOptionInfo
-                    && ((gMainTable.untaggedConvArray[mid] & UCNV_CONTAINS_OPTION_BIT) != 0))
-                    || !containsCnvOptionInfo);
-            }
-            return gMainTable.untaggedConvArray[mid] & UCNV_CONVERTER_INDEX_MASK;
+            return foundConverter(mid, containsOption, pErrorCode);
         }
     }
 
@@ -828,7 +922,8 @@ static const UEnumeration gEnumAliases = {
     ucnv_io_countStandardAliases,
     uenum_unextDefault,
     ucnv_io_nextStandardAliases,
-    ucnv_io_resetStandardAliases
+    ucnv_io_resetStandardAliases,
+    NULL  /* drain */
 };
 
 U_CAPI UEnumeration * U_EXPORT2
@@ -1057,7 +1152,8 @@ static const UEnumeration gEnumAllConverters = {
     ucnv_io_countAllConverters,
     uenum_unextDefault,
     ucnv_io_nextAllConverters,
-    ucnv_io_resetAllConverters
+    ucnv_io_resetAllConverters,
+    NULL  /* drain */
 };
 
 U_CAPI UEnumeration * U_EXPORT2
@@ -0,0 +1,102 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+* ucnv_pool.cpp
+*
+* created on: 2018nov20
+*/
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_CONVERSION
+
+#include "unicode/ucnv.h"
+#include "cmemory.h"
+#include "ucnv_pool.h"
+#include "umutex.h"
+
+U_NAMESPACE_BEGIN
+
+UConverterPool *
+UConverterPool::create(const char *converterName, int32_t capacity,
+                       UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return NULL;
+    }
+    if (capacity < 1) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    LocalPointer<UConverterPool> pool(new UConverterPool(capacity), errorCode);
+    if (U_FAILURE(errorCode)) {
+        return NULL;
+    }
+    pool->master = ucnv_open(converterName, &errorCode);
+    if (U_FAILURE(errorCode)) {
+        return NULL;
+    }
+    pool->idle = (UConverter **)uprv_malloc(capacity * sizeof(UConverter *));
+    if (pool->idle == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    return pool.orphan();
+}
+
+UConverterPool::~UConverterPool() {
+    for (int32_t i = 0; i < idleCount; ++i) {
+        ucnv_close(idle[i]);
+    }
+    uprv_free(idle);
+    ucnv_close(master);
+}
+
+UConverter *
+UConverterPool::checkout(UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return NULL;
+    }
+    UConverter *cnv = NULL;
+    umtx_lock(&mutex);
+    if (idleCount > 0) {
+        cnv = idle[--idleCount];
+    }
+    umtx_unlock(&mutex);
+    if (cnv != NULL) {
+        return cnv;
+    }
+    // The free list is empty: clone the master converter.
+    // ucnv_safeClone() copies the already-loaded shared data and
+    // does not go through the converter cache lookup.
+    cnv = ucnv_safeClone(master, NULL, NULL, &errorCode);
+    if (errorCode == U_SAFECLONE_ALLOCATED_WARNING) {
+        // Expected: we passed no stack buffer.
+        errorCode = U_ZERO_ERROR;
+    }
+    return cnv;
+}
+
+void
+UConverterPool::checkin(UConverter *cnv) {
+    if (cnv == NULL) {
+        return;
+    }
+    // Reset outside the critical section so that the next checkout
+    // gets a converter in its initial state.
+    ucnv_reset(cnv);
+    umtx_lock(&mutex);
+    if (idleCount < capacity) {
+        idle[idleCount++] = cnv;
+        cnv = NULL;
+    }
+    umtx_unlock(&mutex);
+    if (cnv != NULL) {
+        // The pool is full.
+        ucnv_close(cnv);
+    }
+}
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_CONVERSION
@@ -0,0 +1,90 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+* ucnv_pool.h
+*
+* created on: 2018nov20
+*/
+
+#ifndef __UCNV_POOL_H__
+#define __UCNV_POOL_H__
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_CONVERSION
+
+#include "unicode/ucnv.h"
+#include "unicode/uobject.h"
+#include "umutex.h"
+
+U_NAMESPACE_BEGIN
+
+/**
+ * Pool of open converters for one charset, for worker threads that
+ * open and close the same converter over and over.
+ *
+ * ucnv_open() goes through the global converter cache and its mutex on
+ * every call, which does not scale with many threads. A pool pays that
+ * cost once, when it is created: checkout() hands out an already-open
+ * converter from the pool's free list, or clones the pool's master
+ * converter with ucnv_safeClone() when the list is empty, without ever
+ * touching the converter cache.
+ *
+ * The free list is guarded by a mutex private to the pool, so pools
+ * for different charsets (or different pipelines) do not contend with
+ * each other, and the critical section is a few pointer operations.
+ *
+ * Checked-out converters are owned by the caller until they are
+ * returned with checkin(); a converter may also be closed with
+ * ucnv_close() instead of being returned. The pool itself must stay
+ * open while any of its converters are checked out.
+ *
+ * All methods are thread-safe unless noted otherwise.
+ * @internal
+ */
+class U_COMMON_API UConverterPool : public UMemory {
+public:
+    /**
+     * Creates a pool for the given charset.
+     * Opens one master converter (one trip through the converter
+     * cache) and retains up to capacity idle converters for reuse.
+     * Returns NULL if U_FAILURE(errorCode).
+     */
+    static UConverterPool *create(const char *converterName, int32_t capacity,
+                                  UErrorCode &errorCode);
+
+    /** Closes all idle converters and the master converter. */
+    ~UConverterPool();
+
+    /**
+     * Returns a converter for this pool's charset, in its initial
+     * reset state. The caller must return it with checkin() or close
+     * it with ucnv_close().
+     * Returns NULL if U_FAILURE(errorCode).
+     */
+    UConverter *checkout(UErrorCode &errorCode);
+
+    /**
+     * Returns a checked-out converter to the pool.
+     * Resets the converter; closes it if the pool is already full.
+     * checkin(NULL) is a no-op.
+     */
+    void checkin(UConverter *cnv);
+
+private:
+    UConverterPool(int32_t cap) : master(NULL), idle(NULL), idleCount(0), capacity(cap) {}
+    UConverterPool(const UConverterPool &other);  // forbid copying
+    void operator=(const UConverterPool &other);  // forbid copying
+
+    UMutex mutex;  // guards idle[] and idleCount
+    UConverter *master;
+    UConverter **idle;
+    int32_t idleCount;
+    int32_t capacity;
+};
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_CONVERSION
+#endif  // __UCNV_POOL_H__
@@ -422,6 +422,105 @@ ucnv_Latin1FromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
     pFromUArgs->target=(char *)target;
 }
 
+/* Convert Latin-1 to UTF-8. The inverse of ucnv_Latin1FromUTF8(). */
+static void U_CALLCONV
+ucnv_Latin1ToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                  UConverterToUnicodeArgs *pToUArgs,
+                  UErrorCode *pErrorCode) {
+    const uint8_t *source, *sourceLimit;
+    uint8_t *target;
+    int32_t targetCapacity;
+
+    uint8_t b;
+
+    /* set up the local pointers */
+    source=(const uint8_t *)pToUArgs->source;
+    sourceLimit=(const uint8_t *)pToUArgs->sourceLimit;
+    target=(uint8_t *)pFromUArgs->target;
+    targetCapacity=(int32_t)(pFromUArgs->targetLimit-pFromUArgs->target);
+
+    /*
+     * Latin-1 is stateless and maps every byte,
+     * so there are no partial input sequences and
+     * no unmappable characters to handle.
+     *
+     * An ASCII byte stays a single byte; 0x80..0xff become two bytes.
+     */
+
+    /* unroll the loop with the most common case */
+    if(targetCapacity>=16) {
+        int32_t count, loops;
+        uint8_t oredChars;
+
+        count=(int32_t)(sourceLimit-source);
+        if(count>targetCapacity) {
+            count=targetCapacity;
+        }
+        loops=count>>4;
+        if((count=loops)>0) {
+            do {
+                oredChars=*target++=*source++;
+                oredChars|=*target++=*source++;
+                oredChars|=*target++=*source++;
+                oredChars|=*target++=*source++;
+                oredChars|=*target++=*source++;
+                oredChars|=*target++=*source++;
+                oredChars|=*target++=*source++;
+                oredChars|=*target++=*source++;
+                oredChars|=*target++=*source++;
+                oredChars|=*target++=*source++;
+                oredChars|=*target++=*source++;
+                oredChars|=*target++=*source++;
+                oredChars|=*target++=*source++;
+                oredChars|=*target++=*source++;
+                oredChars|=*target++=*source++;
+                oredChars|=*target++=*source++;
+
+                /* were all 16 entries really ASCII? */
+                if(oredChars>0x7f) {
+                    /* no, return to the first of these 16 */
+                    source-=16;
+                    target-=16;
+                    break;
+                }
+            } while(--count>0);
+            count=loops-count;
+            targetCapacity-=16*count;
+        }
+    }
+
+    /* conversion loop */
+    while(source<sourceLimit) {
+        if(targetCapacity<=0) {
+            /* target is full */
+            *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+            break;
+        }
+        b=*source;
+        if(b<=0x7f) {
+            *target++=b;
+            --targetCapacity;
+        } else if(targetCapacity>=2) {
+            /* 0x80..0xff: write a two-byte sequence */
+            *target++=(uint8_t)(0xc0|(b>>6));
+            *target++=(uint8_t)(0x80|(b&0x3f));
+            targetCapacity-=2;
+        } else {
+            /*
+             * Room for only part of the two-byte sequence:
+             * let the standard converter handle the overflow buffering.
+             */
+            *pErrorCode=U_USING_DEFAULT_WARNING;
+            break;
+        }
+        ++source;
+    }
+
+    /* write back the updated pointers */
+    pToUArgs->source=(const char *)source;
+    pFromUArgs->target=(char *)target;
+}
+
 static void U_CALLCONV
 _Latin1GetUnicodeSet(const UConverter *cnv,
                      const USetAdder *sa,
@@ -457,7 +556,7 @@ static const UConverterImpl _Latin1Impl={
     NULL,
     _Latin1GetUnicodeSet,
 
-    NULL,
+    ucnv_Latin1ToUTF8,
     ucnv_Latin1FromUTF8
 };
 
@@ -736,7 +835,12 @@ static const UConverterImpl _ASCIIImpl={
     NULL,
     _ASCIIGetUnicodeSet,
 
-    NULL,
+    /*
+     * US-ASCII to UTF-8 is the same validate-and-copy operation as
+     * UTF-8 to US-ASCII (cf. _UTF8Impl, which also registers one
+     * function for both directions).
+     */
+    ucnv_ASCIIFromUTF8,
     ucnv_ASCIIFromUTF8
 };
 
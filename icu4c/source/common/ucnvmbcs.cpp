@@ -431,6 +431,9 @@ ucnv_DBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
                   UConverterToUnicodeArgs *pToUArgs,
                   UErrorCode *pErrorCode);
 
+static void
+ucnv_MBCSEnsureFromUData(UConverterMBCSTable *mbcsTable, UErrorCode *pErrorCode);
+
 static const UConverterImpl _SBCSUTF8Impl={
     UCNV_MBCS,
 
@@ -865,6 +868,13 @@ ucnv_MBCSGetFilteredUnicodeSetForUnicode(const UConverterSharedData *sharedData,
 
     /* enumerate the from-Unicode trie table */
     mbcsTable=&sharedData->mbcs;
+
+    /* the fromUnicode data may not have been reconstituted yet */
+    ucnv_MBCSEnsureFromUData((UConverterMBCSTable *)mbcsTable, pErrorCode);
+    if(U_FAILURE(*pErrorCode)) {
+        return;
+    }
+
     table=mbcsTable->fromUnicodeTable;
     if(mbcsTable->unicodeMask&UCNV_HAS_SUPPLEMENTARY) {
         maxStage1=0x440;
@@ -1271,6 +1281,12 @@ _EBCDICSwapLFNL(UConverterSharedData *sharedData, UErrorCode *pErrorCode) {
 
     mbcsTable=&sharedData->mbcs;
 
+    /* the fromUnicode data may not have been reconstituted yet */
+    ucnv_MBCSEnsureFromUData(mbcsTable, pErrorCode);
+    if(U_FAILURE(*pErrorCode)) {
+        return FALSE;
+    }
+
     table=mbcsTable->fromUnicodeTable;
     bytes=mbcsTable->fromUnicodeBytes;
     results=(const uint16_t *)bytes;
@@ -1549,6 +1565,29 @@ reconstituteData(UConverterMBCSTable *mbcsTable,
     ucnv_MBCSEnumToUnicode(mbcsTable, writeStage3Roundtrip, mbcsTable, pErrorCode);
 }
 
+static void U_CALLCONV
+initReconstitutedData(UConverterMBCSTable *mbcsTable, UErrorCode &errorCode) {
+    reconstituteData(mbcsTable,
+                     mbcsTable->fromUStage1Length, mbcsTable->fromUStage2Length,
+                     mbcsTable->fromUFullStage2Length, &errorCode);
+}
+
+/*
+ * Makes sure that the fromUnicode data is available, reconstituting it on
+ * first use if it was omitted from the .cnv file (MBCS_OPT_NO_FROM_U).
+ * No-op for files that store their fromUnicode data; those tables are used
+ * in place from the mapped file.
+ * Thread-safe; rewrites the table pointers under the UInitOnce so that all
+ * readers that come through here see the final tables.
+ */
+static void
+ucnv_MBCSEnsureFromUData(UConverterMBCSTable *mbcsTable, UErrorCode *pErrorCode) {
+    if(mbcsTable->fromUFullStage2Length!=0) {
+        icu::umtx_initOnce(mbcsTable->reconstituteInitOnce,
+                           &initReconstitutedData, mbcsTable, *pErrorCode);
+    }
+}
+
 /* MBCS setup functions ----------------------------------------------------- */
 
 static void U_CALLCONV
@@ -1643,8 +1682,56 @@ ucnv_MBCSLoad(UConverterSharedData *sharedData,
             return;
         }
 
-        /* copy the base table data */
-        uprv_memcpy(mbcsTable, &baseSharedData->mbcs, sizeof(UConverterMBCSTable));
+        /*
+         * Reconstitute the base table's fromUnicode data now if it was
+         * omitted from its file, so that the copy below gets the final
+         * table pointers.
+         */
+        ucnv_MBCSEnsureFromUData(&baseSharedData->mbcs, pErrorCode);
+        if(U_FAILURE(*pErrorCode)) {
+            ucnv_unload(baseSharedData);
+            return;
+        }
+
+        /*
+         * Copy the base table data member by member; the struct contains a
+         * UInitOnce and must not be memcpy'd. The base table's fromUnicode
+         * data is final after ucnv_MBCSEnsureFromUData() above, so the
+         * extension table keeps its UInitOnce in the initial state and
+         * clears the reconstitution lengths: it never reconstitutes again.
+         */
+        {
+            const UConverterMBCSTable &baseMBCS=baseSharedData->mbcs;
+
+            mbcsTable->countStates=baseMBCS.countStates;
+            mbcsTable->dbcsOnlyState=baseMBCS.dbcsOnlyState;
+            mbcsTable->stateTableOwned=baseMBCS.stateTableOwned;
+            mbcsTable->countToUFallbacks=baseMBCS.countToUFallbacks;
+            mbcsTable->stateTable=baseMBCS.stateTable;
+            mbcsTable->swapLFNLStateTable=baseMBCS.swapLFNLStateTable;
+            mbcsTable->unicodeCodeUnits=baseMBCS.unicodeCodeUnits;
+            mbcsTable->toUFallbacks=baseMBCS.toUFallbacks;
+
+            mbcsTable->fromUnicodeTable=baseMBCS.fromUnicodeTable;
+            mbcsTable->mbcsIndex=baseMBCS.mbcsIndex;
+            uprv_memcpy(mbcsTable->sbcsIndex, baseMBCS.sbcsIndex, sizeof(mbcsTable->sbcsIndex));
+            mbcsTable->fromUnicodeBytes=baseMBCS.fromUnicodeBytes;
+            mbcsTable->swapLFNLFromUnicodeBytes=baseMBCS.swapLFNLFromUnicodeBytes;
+            mbcsTable->fromUBytesLength=baseMBCS.fromUBytesLength;
+            mbcsTable->outputType=baseMBCS.outputType;
+            mbcsTable->unicodeMask=baseMBCS.unicodeMask;
+            mbcsTable->utf8Friendly=baseMBCS.utf8Friendly;
+            mbcsTable->maxFastUChar=baseMBCS.maxFastUChar;
+
+            mbcsTable->asciiRoundtrips=baseMBCS.asciiRoundtrips;
+
+            mbcsTable->reconstitutedData=baseMBCS.reconstitutedData;
+            mbcsTable->fromUStage1Length=0;
+            mbcsTable->fromUStage2Length=0;
+            mbcsTable->fromUFullStage2Length=0;
+
+            mbcsTable->swapLFNLName=baseMBCS.swapLFNLName;
+        }
 
         /* overwrite values with relevant ones for the extension converter */
         mbcsTable->baseSharedData=baseSharedData;
@@ -1852,7 +1939,15 @@ ucnv_MBCSLoad(UConverterSharedData *sharedData,
             uint32_t stage2Length=
                 (header->offsetFromUBytes-header->offsetFromUTable)/4-
                 stage1Length/2;
-            reconstituteData(mbcsTable, stage1Length, stage2Length, header->fullStage2Length, pErrorCode);
+            /*
+             * Defer reconstituting the omitted fromUnicode data until its
+             * first use (see ucnv_MBCSEnsureFromUData()): toUnicode-only
+             * use of the converter then works entirely from the mapped
+             * file, without the per-process unpack time and heap copy.
+             */
+            mbcsTable->fromUStage1Length=stage1Length;
+            mbcsTable->fromUStage2Length=stage2Length;
+            mbcsTable->fromUFullStage2Length=header->fullStage2Length;
         }
     }
 
@@ -4097,6 +4192,12 @@ ucnv_MBCSFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
 
     cnv=pArgs->converter;
 
+    /* the fromUnicode data may not have been reconstituted yet */
+    ucnv_MBCSEnsureFromUData(&cnv->sharedData->mbcs, pErrorCode);
+    if(U_FAILURE(*pErrorCode)) {
+        return;
+    }
+
     if(cnv->preFromUFirstCP>=0) {
         /*
          * pass sourceIndex=-1 because we continue from an earlier buffer
@@ -4846,6 +4947,13 @@ ucnv_MBCSFromUChar32(UConverterSharedData *sharedData,
 
     /* BMP-only codepages are stored without stage 1 entries for supplementary code points */
     if(c<=0xffff || (sharedData->mbcs.unicodeMask&UCNV_HAS_SUPPLEMENTARY)) {
+        /* the fromUnicode data may not have been reconstituted yet */
+        UErrorCode errorCode=U_ZERO_ERROR;
+        ucnv_MBCSEnsureFromUData(&sharedData->mbcs, &errorCode);
+        if(U_FAILURE(errorCode)) {
+            return 0;  /* =unassigned */
+        }
+
         table=sharedData->mbcs.fromUnicodeTable;
 
         /* convert the Unicode code point in c into codepage bytes (same as in _MBCSFromUnicodeWithOffsets) */
@@ -5348,6 +5456,12 @@ ucnv_DBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
     target=(uint8_t *)pFromUArgs->target;
     targetCapacity=(int32_t)(pFromUArgs->targetLimit-pFromUArgs->target);
 
+    /* the fromUnicode data may not have been reconstituted yet */
+    ucnv_MBCSEnsureFromUData(&cnv->sharedData->mbcs, pErrorCode);
+    if(U_FAILURE(*pErrorCode)) {
+        return;
+    }
+
     table=cnv->sharedData->mbcs.fromUnicodeTable;
     mbcsIndex=cnv->sharedData->mbcs.mbcsIndex;
     if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
@@ -27,6 +27,10 @@
 #include "ucnv_cnv.h"
 #include "ucnv_ext.h"
 
+#ifdef __cplusplus
+#include "umutex.h"
+#endif
+
 /**
  * ICU conversion (.cnv) data file structure, following the usual UDataInfo
  * header.
@@ -394,6 +398,24 @@ typedef struct UConverterMBCSTable {
     /* reconstituted data that was omitted from the .cnv file */
     uint8_t *reconstitutedData;
 
+    /*
+     * Lazy reconstitution (MBCS_OPT_NO_FROM_U):
+     * The lengths are stored at load time (fromUFullStage2Length!=0
+     * only for files with omitted fromUnicode data) and the data is
+     * built on first fromUnicode use, so that toUnicode-only use of a
+     * converter keeps working directly from the mapped file.
+     */
+#ifdef __cplusplus
+    icu::UInitOnce reconstituteInitOnce;
+#else
+    /* C view with the same layout; only C++ code (ucnvmbcs.cpp) uses it. */
+    struct {
+        int32_t fState;
+        UErrorCode fErrCode;
+    } reconstituteInitOnce;
+#endif
+    uint32_t fromUStage1Length, fromUStage2Length, fromUFullStage2Length;
+
     /* converter name for swaplfnl */
     char *swapLFNLName;
 
@@ -402,6 +424,12 @@ typedef struct UConverterMBCSTable {
     const int32_t *extIndexes;
 } UConverterMBCSTable;
 
+#ifdef __cplusplus
+#   define UCNV_MBCS_INITONCE_INITIALIZER U_INITONCE_INITIALIZER
+#else
+#   define UCNV_MBCS_INITONCE_INITIALIZER {0, U_ZERO_ERROR}
+#endif
+
 #define UCNV_MBCS_TABLE_INITIALIZER { \
     /* toUnicode */ \
     0, 0, 0, \
@@ -429,6 +457,10 @@ typedef struct UConverterMBCSTable {
     /* reconstituted data that was omitted from the .cnv file */ \
     NULL, \
      \
+    /* lazy reconstitution */ \
+    UCNV_MBCS_INITONCE_INITIALIZER, \
+    0, 0, 0, \
+     \
     /* converter name for swaplfnl */ \
     NULL, \
      \
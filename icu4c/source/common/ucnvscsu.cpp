@@ -1080,6 +1080,18 @@ loop:
                     *offsets++=sourceIndex;
                 }
                 --targetCapacity;
+                /* pass a whole run of ASCII graphic characters through */
+                while(targetCapacity>0 && source<sourceLimit &&
+                      ((c=*source)-0x20)<=0x5f
+                ) {
+                    ++source;
+                    *target++=(uint8_t)c;
+                    if(offsets!=NULL) {
+                        *offsets++=nextSourceIndex;
+                    }
+                    ++nextSourceIndex;
+                    --targetCapacity;
+                }
             } else if(c<0x20) {
                 if((1UL<<c)&0x2601 /* binary 0010 0110 0000 0001, check for b==0xd || b==0xa || b==9 || b==0 */) {
                     /* CR/LF/TAB/NUL */
@@ -1101,6 +1113,18 @@ loop:
                     *offsets++=sourceIndex;
                 }
                 --targetCapacity;
+                /* write a whole run in the same dynamic window */
+                while(targetCapacity>0 && source<sourceLimit &&
+                      (delta=(uint32_t)*source-currentOffset)<=0x7f
+                ) {
+                    ++source;
+                    *target++=(uint8_t)(delta|0x80);
+                    if(offsets!=NULL) {
+                        *offsets++=nextSourceIndex;
+                    }
+                    ++nextSourceIndex;
+                    --targetCapacity;
+                }
             } else if(U16_IS_SURROGATE(c)) {
                 if(U16_IS_SURROGATE_LEAD(c)) {
 getTrailSingle:
@@ -1260,6 +1284,20 @@ getTrailSingle:
                         *offsets++=sourceIndex;
                     }
                     targetCapacity-=2;
+                    /* write a whole run of uncompressible characters */
+                    while(targetCapacity>=2 && source<sourceLimit &&
+                          (uint32_t)((c=*source)-0x3400)<(0xd800-0x3400)
+                    ) {
+                        ++source;
+                        *target++=(uint8_t)(c>>8);
+                        *target++=(uint8_t)c;
+                        if(offsets!=NULL) {
+                            *offsets++=nextSourceIndex;
+                            *offsets++=nextSourceIndex;
+                        }
+                        ++nextSourceIndex;
+                        targetCapacity-=2;
+                    }
                 } else {
                     length=2;
                     goto outputBytes;
@@ -1576,6 +1614,14 @@ loop:
                 /* pass US-ASCII graphic character through */
                 *target++=(uint8_t)c;
                 --targetCapacity;
+                /* pass a whole run of ASCII graphic characters through */
+                while(targetCapacity>0 && source<sourceLimit &&
+                      ((c=*source)-0x20)<=0x5f
+                ) {
+                    ++source;
+                    *target++=(uint8_t)c;
+                    --targetCapacity;
+                }
             } else if(c<0x20) {
                 if((1UL<<c)&0x2601 /* binary 0010 0110 0000 0001, check for b==0xd || b==0xa || b==9 || b==0 */) {
                     /* CR/LF/TAB/NUL */
@@ -1591,6 +1637,14 @@ loop:
                 /* use the current dynamic window */
                 *target++=(uint8_t)(delta|0x80);
                 --targetCapacity;
+                /* write a whole run in the same dynamic window */
+                while(targetCapacity>0 && source<sourceLimit &&
+                      (delta=(uint32_t)*source-currentOffset)<=0x7f
+                ) {
+                    ++source;
+                    *target++=(uint8_t)(delta|0x80);
+                    --targetCapacity;
+                }
             } else if(U16_IS_SURROGATE(c)) {
                 if(U16_IS_SURROGATE_LEAD(c)) {
 getTrailSingle:
@@ -1737,6 +1791,15 @@ getTrailSingle:
                     *target++=(uint8_t)(c>>8);
                     *target++=(uint8_t)c;
                     targetCapacity-=2;
+                    /* write a whole run of uncompressible characters */
+                    while(targetCapacity>=2 && source<sourceLimit &&
+                          (uint32_t)((c=*source)-0x3400)<(0xd800-0x3400)
+                    ) {
+                        ++source;
+                        *target++=(uint8_t)(c>>8);
+                        *target++=(uint8_t)c;
+                        targetCapacity-=2;
+                    }
                 } else {
                     length=2;
                     goto outputBytes;
@@ -659,7 +659,8 @@ static const UEnumeration defaultEncodings = {
     ucnvsel_count_encodings,
     uenum_unextDefault,
     ucnvsel_next_encoding, 
-    ucnvsel_reset_iterator
+    ucnvsel_reset_iterator,
+    NULL  /* drain */
 };
 
 
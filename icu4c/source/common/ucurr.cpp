@@ -33,6 +33,7 @@
 #include "uinvchar.h"
 #include "uresimp.h"
 #include "ulist.h"
+#include "uarrsort.h"
 #include "uresimp.h"
 #include "ureslocs.h"
 #include "ulocimp.h"
@@ -296,6 +297,111 @@ myUCharsToChars(char* resultOfLen4, const UChar* currency) {
     return resultOfLen4;
 }
 
+/*
+ * Flat, immutable copy of the CurrencyMeta table, loaded once on first
+ * use so that the per-query path does no resource traversal and takes
+ * no locks beyond the one-time umtx_initOnce(). Each entry carries the
+ * four metadata integers for one ISO code; entries are sorted by code
+ * for binary search. The DEFAULT entry is kept separately.
+ */
+struct CurrencyMetaEntry {
+    char code[8];       /* ISO-4217 alpha code, NUL terminated */
+    int32_t data[4];    /* digits, rounding, cashDigits, cashRounding */
+};
+
+U_CDECL_BEGIN
+static UBool U_CALLCONV currency_cleanup(void);
+U_CDECL_END
+
+static CurrencyMetaEntry* gMetaEntries = NULL;
+static int32_t gMetaEntryCount = 0;
+static int32_t gMetaDefault[4];
+static UBool gMetaHasDefault = FALSE;
+static UErrorCode gMetaLoadStatus = U_ZERO_ERROR;
+static icu::UInitOnce gMetaInitOnce = U_INITONCE_INITIALIZER;
+
+static UBool U_CALLCONV
+currencyMeta_cleanup(void) {
+    uprv_free(gMetaEntries);
+    gMetaEntries = NULL;
+    gMetaEntryCount = 0;
+    gMetaHasDefault = FALSE;
+    gMetaLoadStatus = U_ZERO_ERROR;
+    gMetaInitOnce.reset();
+    return TRUE;
+}
+
+static int32_t U_CALLCONV
+compareMetaEntries(const void* /*context*/, const void* left, const void* right) {
+    return (int32_t)uprv_strcmp(
+            ((const CurrencyMetaEntry*)left)->code,
+            ((const CurrencyMetaEntry*)right)->code);
+}
+
+static void U_CALLCONV
+loadCurrencyMetaData() {
+    UErrorCode& ec = gMetaLoadStatus;
+
+    // Get CurrencyMeta resource out of root locale file.  [This may
+    // move out of the root locale file later; if it does, update this
+    // code.]
+    UResourceBundle* currencyData = ures_openDirect(U_ICUDATA_CURR, CURRENCY_DATA, &ec);
+    UResourceBundle* currencyMeta = ures_getByKey(currencyData, CURRENCY_META, currencyData, &ec);
+    if (U_FAILURE(ec)) {
+        ures_close(currencyMeta);
+        return;
+    }
+
+    int32_t count = ures_getSize(currencyMeta);
+    gMetaEntries = (CurrencyMetaEntry*)uprv_malloc(count * sizeof(CurrencyMetaEntry));
+    if (gMetaEntries == NULL) {
+        ec = U_MEMORY_ALLOCATION_ERROR;
+        ures_close(currencyMeta);
+        return;
+    }
+
+    UResourceBundle* entry = NULL;
+    ures_resetIterator(currencyMeta);
+    while (ures_hasNext(currencyMeta)) {
+        UErrorCode ec2 = U_ZERO_ERROR; // local error code: soft failure
+        entry = ures_getNextResource(currencyMeta, entry, &ec2);
+        if (U_FAILURE(ec2)) {
+            break;
+        }
+        const char* key = ures_getKey(entry);
+        int32_t len;
+        const int32_t* data = ures_getIntVector(entry, &len, &ec2);
+        if (U_FAILURE(ec2) || len != 4 || key == NULL ||
+                uprv_strlen(key) >= sizeof(gMetaEntries[0].code)) {
+            continue;
+        }
+        if (uprv_strcmp(key, DEFAULT_META) == 0) {
+            uprv_memcpy(gMetaDefault, data, sizeof(gMetaDefault));
+            gMetaHasDefault = TRUE;
+            continue;
+        }
+        uprv_strcpy(gMetaEntries[gMetaEntryCount].code, key);
+        uprv_memcpy(gMetaEntries[gMetaEntryCount].data, data, sizeof(gMetaEntries[0].data));
+        ++gMetaEntryCount;
+    }
+    ures_close(entry);
+    ures_close(currencyMeta);
+
+    if (!gMetaHasDefault) {
+        // Config/build error; the table is unusable without a default.
+        ec = U_INVALID_FORMAT_ERROR;
+        uprv_free(gMetaEntries);
+        gMetaEntries = NULL;
+        gMetaEntryCount = 0;
+        return;
+    }
+
+    uprv_sortArray(gMetaEntries, gMetaEntryCount, (int32_t)sizeof(CurrencyMetaEntry),
+                   compareMetaEntries, NULL, FALSE, &ec);
+
+    ucln_common_registerCleanup(UCLN_COMMON_CURRENCY, currency_cleanup);
+}
+
 /**
  * Internal function to look up currency data.  Result is an array of
  * four integers.  The first is the fraction digits.  The second is the
@@ -314,48 +420,31 @@ _findMetaData(const UChar* currency, UErrorCode& ec) {
         return LAST_RESORT_DATA;
     }
 
-    // Get CurrencyMeta resource out of root locale file.  [This may
-    // move out of the root locale file later; if it does, update this
-    // code.]
-    UResourceBundle* currencyData = ures_openDirect(U_ICUDATA_CURR, CURRENCY_DATA, &ec);
-    UResourceBundle* currencyMeta = ures_getByKey(currencyData, CURRENCY_META, currencyData, &ec);
-
-    if (U_FAILURE(ec)) {
-        ures_close(currencyMeta);
+    umtx_initOnce(gMetaInitOnce, &loadCurrencyMetaData);
+    if (U_FAILURE(gMetaLoadStatus)) {
         // Config/build error; return hard-coded defaults
+        ec = gMetaLoadStatus;
         return LAST_RESORT_DATA;
     }
 
-    // Look up our currency, or if that's not available, then DEFAULT
+    // Binary-search our currency in the flat table,
+    // or if it is not there, then use DEFAULT.
     char buf[ISO_CURRENCY_CODE_LENGTH+1];
-    UErrorCode ec2 = U_ZERO_ERROR; // local error code: soft failure
-    UResourceBundle* rb = ures_getByKey(currencyMeta, myUCharsToChars(buf, currency), NULL, &ec2);
-      if (U_FAILURE(ec2)) {
-        ures_close(rb);
-        rb = ures_getByKey(currencyMeta,DEFAULT_META, NULL, &ec);
-        if (U_FAILURE(ec)) {
-            ures_close(currencyMeta);
-            ures_close(rb);
-            // Config/build error; return hard-coded defaults
-            return LAST_RESORT_DATA;
-        }
-    }
-
-    int32_t len;
-    const int32_t *data = ures_getIntVector(rb, &len, &ec);
-    if (U_FAILURE(ec) || len != 4) {
-        // Config/build error; return hard-coded defaults
-        if (U_SUCCESS(ec)) {
-            ec = U_INVALID_FORMAT_ERROR;
+    myUCharsToChars(buf, currency);
+    int32_t lo = 0;
+    int32_t hi = gMetaEntryCount - 1;
+    while (lo <= hi) {
+        int32_t mid = (lo + hi) / 2;
+        int32_t cmp = uprv_strcmp(buf, gMetaEntries[mid].code);
+        if (cmp == 0) {
+            return gMetaEntries[mid].data;
+        } else if (cmp < 0) {
+            hi = mid - 1;
+        } else {
+            lo = mid + 1;
         }
-        ures_close(currencyMeta);
-        ures_close(rb);
-        return LAST_RESORT_DATA;
     }
-
-    ures_close(currencyMeta);
-    ures_close(rb);
-    return data;
+    return gMetaDefault;
 }
 
 // -------------------------------------
@@ -534,6 +623,7 @@ static UBool U_CALLCONV currency_cleanup(void) {
      * There might be some cached currency data or isoCodes data.
      */
     currency_cache_cleanup();
+    currencyMeta_cleanup();
     isoCodes_cleanup();
     currSymbolsEquiv_cleanup();
 
@@ -2179,7 +2269,8 @@ static const UEnumeration gEnumCurrencyList = {
     ucurr_countCurrencyList,
     uenum_unextDefault,
     ucurr_nextCurrencyList,
-    ucurr_resetCurrencyList
+    ucurr_resetCurrencyList,
+    NULL  /* drain */
 };
 U_CDECL_END
 
@@ -2560,7 +2651,8 @@ static const UEnumeration defaultKeywordValues = {
     ulist_count_keyword_values,
     uenum_unextDefault,
     ulist_next_keyword_value, 
-    ulist_reset_keyword_values_iterator
+    ulist_reset_keyword_values_iterator,
+    NULL  /* drain */
 };
 
 U_CAPI UEnumeration *U_EXPORT2 ucurr_getKeywordValuesForLocale(const char *key, const char *locale, UBool commonlyUsed, UErrorCode* status) {
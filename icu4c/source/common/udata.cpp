@@ -117,6 +117,10 @@ static UDataFileAccess  gDataFileAccess = UDATA_DEFAULT_ACCESS;  // Access not s
 static UDataFileAccess  gDataFileAccess = UDATA_NO_FILES;        // Windows UWP looks in one spot explicitly
 #endif
 
+static UBool gTrustedData = FALSE;  // See udata_setTrustedData(). Modifying is
+                                    // documented as thread-unsafe, like
+                                    // gDataFileAccess above.
+
 static UBool U_CALLCONV
 udata_cleanup(void)
 {
@@ -1293,8 +1297,24 @@ doOpenChoice(const char *path, const char *type, const char *name,
     /* End of dealing with a null basename */
     dataPath = u_getDataDirectory();
 
+    /****    Trusted common package fast path  */
+    UBool trustedICUData = (UBool)(gTrustedData && isICUData);
+    if (trustedICUData) {
+        /* The sealed common package is authoritative for ICU data: go
+         * straight to its table of contents and skip the time zone override
+         * directory, individual-file probing, and the per-item acceptance
+         * callback. On a miss, fall through to the "data not found"
+         * handling below without touching the file system. */
+        retVal = doLoadFromCommonData(isICUData,
+                            pkgName.data(), dataPath, tocEntryPathSuffix, tocEntryName.data(),
+                            path, type, name, NULL, NULL, &subErrorCode, pErrorCode);
+        if((retVal != NULL) || U_FAILURE(*pErrorCode)) {
+            return retVal;
+        }
+    }
+
     /****    Time zone individual files override  */
-    if (isICUData && isTimeZoneFile(name, type)) {
+    if (!trustedICUData && isICUData && isTimeZoneFile(name, type)) {
         const char *tzFilesDir = u_getTimeZoneFilesDirectory(pErrorCode);
         if (tzFilesDir[0] != 0) {
 #ifdef UDATA_DEBUG
@@ -1309,7 +1329,7 @@ doOpenChoice(const char *path, const char *type, const char *name,
     }
 
     /****    COMMON PACKAGE  - only if packages are first. */
-    if(gDataFileAccess == UDATA_PACKAGES_FIRST) {
+    if(!trustedICUData && gDataFileAccess == UDATA_PACKAGES_FIRST) {
 #ifdef UDATA_DEBUG
         fprintf(stderr, "Trying packages (UDATA_PACKAGES_FIRST)\n");
 #endif
@@ -1323,8 +1343,9 @@ doOpenChoice(const char *path, const char *type, const char *name,
     }
 
     /****    INDIVIDUAL FILES  */
-    if((gDataFileAccess==UDATA_PACKAGES_FIRST) ||
-       (gDataFileAccess==UDATA_FILES_FIRST)) {
+    if(!trustedICUData &&
+       ((gDataFileAccess==UDATA_PACKAGES_FIRST) ||
+        (gDataFileAccess==UDATA_FILES_FIRST))) {
 #ifdef UDATA_DEBUG
         fprintf(stderr, "Trying individual files\n");
 #endif
@@ -1339,8 +1360,9 @@ doOpenChoice(const char *path, const char *type, const char *name,
     }
 
     /****    COMMON PACKAGE  */
-    if((gDataFileAccess==UDATA_ONLY_PACKAGES) || 
-       (gDataFileAccess==UDATA_FILES_FIRST)) {
+    if(!trustedICUData &&
+       ((gDataFileAccess==UDATA_ONLY_PACKAGES) ||
+        (gDataFileAccess==UDATA_FILES_FIRST))) {
 #ifdef UDATA_DEBUG
         fprintf(stderr, "Trying packages (UDATA_ONLY_PACKAGES || UDATA_FILES_FIRST)\n");
 #endif
@@ -1355,7 +1377,7 @@ doOpenChoice(const char *path, const char *type, const char *name,
     /* Load from DLL.  If we haven't attempted package load, we also haven't had any chance to
         try a DLL (static or setCommonData/etc)  load.
          If we ever have a "UDATA_ONLY_FILES", add it to the or list here.  */  
-    if(gDataFileAccess==UDATA_NO_FILES) {
+    if(!trustedICUData && gDataFileAccess==UDATA_NO_FILES) {
 #ifdef UDATA_DEBUG
         fprintf(stderr, "Trying common data (UDATA_NO_FILES)\n");
 #endif
@@ -1451,3 +1473,12 @@ U_CAPI void U_EXPORT2 udata_setFileAccess(UDataFileAccess access, UErrorCode * /
     // Note: this function is documented as not thread safe.
     gDataFileAccess = access;
 }
+
+U_CAPI void U_EXPORT2 udata_setTrustedData(UBool isTrusted, UErrorCode *status)
+{
+    if (status == NULL || U_FAILURE(*status)) {
+        return;
+    }
+    // Note: this function is documented as not thread safe.
+    gTrustedData = isTrusted;
+}
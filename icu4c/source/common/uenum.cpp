@@ -175,6 +175,46 @@ uenum_next(UEnumeration* en,
     }
 }
 
+U_CAPI int32_t U_EXPORT2
+uenum_drain(UEnumeration* en,
+            const char** dest, int32_t destCapacity,
+            char* arena, int32_t arenaCapacity,
+            UErrorCode* status)
+{
+    int32_t n = 0;
+    int32_t arenaLength = 0;
+    if (!en || U_FAILURE(*status)) {
+        return 0;
+    }
+    if (destCapacity < 0 || (dest == NULL && destCapacity != 0) ||
+            arenaCapacity < 0 || (arena == NULL && arenaCapacity != 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if (en->drain != NULL) {
+        return en->drain(en, dest, destCapacity, arena, arenaCapacity, status);
+    }
+    if (en->next == NULL) {
+        *status = U_UNSUPPORTED_ERROR;
+        return 0;
+    }
+    for (;;) {
+        int32_t length = 0;
+        const char *s = en->next(en, &length, status);
+        if (s == NULL || U_FAILURE(*status)) {
+            break;
+        }
+        if (n >= destCapacity || (arenaCapacity - arenaLength) < (length + 1)) {
+            *status = U_BUFFER_OVERFLOW_ERROR;
+            break;
+        }
+        uprv_memcpy(arena + arenaLength, s, length + 1);
+        dest[n++] = arena + arenaLength;
+        arenaLength += length + 1;
+    }
+    return n;
+}
+
 U_CAPI void U_EXPORT2
 uenum_reset(UEnumeration* en, UErrorCode* status)
 {
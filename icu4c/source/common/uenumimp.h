@@ -94,16 +94,38 @@ UEnumNext(UEnumeration* en,
 /**
  * Function type declaration for uenum_reset().
  *
- * This function should reset the enumeration 
+ * This function should reset the enumeration
  * object
  *
- * @param en enumeration 
+ * @param en enumeration
  * @param status pointer to UErrorCode variable
  */
-typedef void U_CALLCONV 
-UEnumReset(UEnumeration* en, 
+typedef void U_CALLCONV
+UEnumReset(UEnumeration* en,
             UErrorCode* status);
 
+/**
+ * Function type declaration for uenum_drain().
+ *
+ * This function should copy all remaining elements into the
+ * caller's arrays in one call, without one next call per element.
+ * It may be NULL; uenum_drain() then falls back to a loop over
+ * the next function.
+ *
+ * @param en enumeration
+ * @param dest receives one pointer per element, into the arena
+ * @param destCapacity number of dest slots
+ * @param arena receives the NUL-terminated element strings
+ * @param arenaCapacity number of arena bytes
+ * @param status pointer to UErrorCode variable
+ * @return the number of elements drained
+ */
+typedef int32_t U_CALLCONV
+UEnumDrain(UEnumeration* en,
+           const char** dest, int32_t destCapacity,
+           char* arena, int32_t arenaCapacity,
+           UErrorCode* status);
+
 
 struct UEnumeration {
     /* baseContext. For the base class only. Don't touch! */
@@ -126,6 +148,9 @@ struct UEnumeration {
     UEnumNext  *next;
     /* called from uenum_reset */
     UEnumReset *reset;
+    /* called from uenum_drain; may be NULL.
+       Positional initializers of older pseudo-vtables leave this NULL. */
+    UEnumDrain *drain;
 };
 
 U_CDECL_END
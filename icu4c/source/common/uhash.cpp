@@ -338,14 +338,28 @@ _uhash_find(const UHashtable *hash, UHashTok key,
     int32_t jump = 0; /* lazy evaluate */
     int32_t tableHash;
     UHashElement *elements = hash->elements;
+    int32_t length = hash->length;
+    UKeyComparator *keyComparator = hash->keyComparator;
 
     hashcode &= 0x7FFFFFFF; /* must be positive */
-    startIndex = theIndex = (hashcode ^ 0x4000000) % hash->length;
+    startIndex = theIndex = (hashcode ^ 0x4000000) % length;
 
     do {
         tableHash = elements[theIndex].hashcode;
         if (tableHash == hashcode) {          /* quick check */
-            if ((*hash->keyComparator)(key, elements[theIndex].key)) {
+            UBool match;
+            /* Devirtualize the comparison for the most common key types.
+             * The direct calls can be inlined; the indirect call cannot,
+             * and cache lookups funnel every probe through here.
+             */
+            if (keyComparator == uhash_compareChars) {
+                match = uhash_compareChars(key, elements[theIndex].key);
+            } else if (keyComparator == uhash_compareLong) {
+                match = uhash_compareLong(key, elements[theIndex].key);
+            } else {
+                match = (*keyComparator)(key, elements[theIndex].key);
+            }
+            if (match) {
                 return &(elements[theIndex]);
             }
         } else if (!IS_EMPTY_OR_DELETED(tableHash)) {
@@ -363,9 +377,15 @@ _uhash_find(const UHashtable *hash, UHashTok key,
              * length.  As long as the length is prime, then any value
              * 1..length-1 will be relatively prime to it.
              */
-            jump = (hashcode % (hash->length - 1)) + 1;
+            jump = (hashcode % (length - 1)) + 1;
+        }
+        /* 0 < jump < length, so a compare-and-subtract replaces the
+         * integer division that a modulo would cost on every probe.
+         */
+        theIndex += jump;
+        if (theIndex >= length) {
+            theIndex -= length;
         }
-        theIndex = (theIndex + jump) % hash->length;
     } while (theIndex != startIndex);
 
     if (firstDeleted >= 0) {
@@ -16,7 +16,10 @@
 
 #include "unicode/utypes.h"
 #include "unicode/icuplug.h"
+#include "unicode/ubrk.h"
 #include "unicode/uclean.h"
+#include "unicode/ucnv.h"
+#include "unicode/unorm2.h"
 #include "cmemory.h"
 #include "icuplugimp.h"
 #include "ucln_cmn.h"
@@ -72,3 +75,45 @@ u_init(UErrorCode *status) {
     umtx_initOnce(gICUInitOnce, &initData, *status);
     UTRACE_EXIT_STATUS(*status);
 }
+
+/*
+ * Eager preloading, so that the first real request does not pay for
+ * demand-loading the data. Each item below lands in the respective
+ * subsystem's own cache (converter cache, Normalizer2 singletons,
+ * udata cache for break data); the objects opened here can be closed
+ * again immediately.
+ */
+U_CAPI void U_EXPORT2
+u_initFull(uint32_t flags, UErrorCode *status) {
+    u_init(status);
+    if (status == NULL || U_FAILURE(*status)) {
+        return;
+    }
+
+#if !UCONFIG_NO_CONVERSION
+    if (flags & UINIT_CONVERTERS) {
+        UConverter *cnv = ucnv_open(NULL, status);
+        ucnv_close(cnv);
+    }
+#endif
+
+#if !UCONFIG_NO_NORMALIZATION
+    if (U_SUCCESS(*status) && (flags & UINIT_NORMALIZATION)) {
+        unorm2_getNFCInstance(status);
+        unorm2_getNFDInstance(status);
+        unorm2_getNFKCInstance(status);
+    }
+#endif
+
+#if !UCONFIG_NO_BREAK_ITERATION
+    if (U_SUCCESS(*status) && (flags & UINIT_BREAK_ITERATION)) {
+        static const UBreakIteratorType kTypes[] = {
+            UBRK_CHARACTER, UBRK_WORD, UBRK_LINE, UBRK_SENTENCE
+        };
+        int32_t i;
+        for (i = 0; i < UPRV_LENGTHOF(kTypes) && U_SUCCESS(*status); ++i) {
+            ubrk_close(ubrk_open(kTypes[i], NULL, NULL, 0, status));
+        }
+    }
+#endif
+}
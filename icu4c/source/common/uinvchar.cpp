@@ -191,6 +191,23 @@ u_charsToUChars(const char *cs, UChar *us, int32_t length) {
      * For EBCDIC systems, this works for characters with codes from
      * codepages 37 and 1047 or compatible.
      */
+#if U_CHARSET_FAMILY==U_ASCII_FAMILY
+    /* The conversion is a plain widening copy; process blocks of eight
+       with no per-character branches so that compilers vectorize it. */
+    while(length>=8) {
+        us[0]=(UChar)(uint8_t)cs[0];
+        us[1]=(UChar)(uint8_t)cs[1];
+        us[2]=(UChar)(uint8_t)cs[2];
+        us[3]=(UChar)(uint8_t)cs[3];
+        us[4]=(UChar)(uint8_t)cs[4];
+        us[5]=(UChar)(uint8_t)cs[5];
+        us[6]=(UChar)(uint8_t)cs[6];
+        us[7]=(UChar)(uint8_t)cs[7];
+        cs+=8;
+        us+=8;
+        length-=8;
+    }
+#endif
     while(length>0) {
         c=(uint8_t)(*cs++);
         u=(UChar)CHAR_TO_UCHAR(c);
@@ -204,6 +221,27 @@ U_CAPI void U_EXPORT2
 u_UCharsToChars(const UChar *us, char *cs, int32_t length) {
     UChar u;
 
+    /* Narrow-copy blocks of eight after validating the whole block, so that
+       the common all-invariant case has no per-character branches and
+       vectorizes. A block with a variant character falls through to the
+       per-character loop, which hits the assertion on that character. */
+    while(length>=8 &&
+            UCHAR_IS_INVARIANT(us[0]) && UCHAR_IS_INVARIANT(us[1]) &&
+            UCHAR_IS_INVARIANT(us[2]) && UCHAR_IS_INVARIANT(us[3]) &&
+            UCHAR_IS_INVARIANT(us[4]) && UCHAR_IS_INVARIANT(us[5]) &&
+            UCHAR_IS_INVARIANT(us[6]) && UCHAR_IS_INVARIANT(us[7])) {
+        cs[0]=(char)UCHAR_TO_CHAR(us[0]);
+        cs[1]=(char)UCHAR_TO_CHAR(us[1]);
+        cs[2]=(char)UCHAR_TO_CHAR(us[2]);
+        cs[3]=(char)UCHAR_TO_CHAR(us[3]);
+        cs[4]=(char)UCHAR_TO_CHAR(us[4]);
+        cs[5]=(char)UCHAR_TO_CHAR(us[5]);
+        cs[6]=(char)UCHAR_TO_CHAR(us[6]);
+        cs[7]=(char)UCHAR_TO_CHAR(us[7]);
+        us+=8;
+        cs+=8;
+        length-=8;
+    }
     while(length>0) {
         u=*us++;
         if(!UCHAR_IS_INVARIANT(u)) {
@@ -262,6 +300,19 @@ U_CAPI UBool U_EXPORT2
 uprv_isInvariantUString(const UChar *s, int32_t length) {
     UChar c;
 
+    /* Test counted strings in blocks of eight without per-character
+       branches; NUL is invariant, so the conjunction matches the
+       per-character loop below. */
+    while(length>=8) {
+        if(!(UCHAR_IS_INVARIANT(s[0]) && UCHAR_IS_INVARIANT(s[1]) &&
+                UCHAR_IS_INVARIANT(s[2]) && UCHAR_IS_INVARIANT(s[3]) &&
+                UCHAR_IS_INVARIANT(s[4]) && UCHAR_IS_INVARIANT(s[5]) &&
+                UCHAR_IS_INVARIANT(s[6]) && UCHAR_IS_INVARIANT(s[7]))) {
+            return FALSE;
+        }
+        s+=8;
+        length-=8;
+    }
     for(;;) {
         if(length<0) {
             /* NUL-terminated */
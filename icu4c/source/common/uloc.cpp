@@ -1581,7 +1581,8 @@ static const UEnumeration gKeywordsEnum = {
     uloc_kw_countKeywords,
     uenum_unextDefault,
     uloc_kw_nextKeyword,
-    uloc_kw_resetKeywords
+    uloc_kw_resetKeywords,
+    NULL  /* drain */
 };
 
 U_CAPI UEnumeration* U_EXPORT2
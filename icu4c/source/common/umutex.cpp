@@ -89,6 +89,54 @@ umtx_condSignal(UConditionVar *cond) {
 }
 
 
+/*************************************************************************************************
+ *
+ *  USharedMutex - reader-writer lock.
+ *
+ *************************************************************************************************/
+
+U_CAPI void U_EXPORT2
+umtx_lockRead(USharedMutex *mutex) {
+    std::unique_lock<std::mutex> lock(mutex->fMutex);
+    // Waiting writers block new readers, so that a steady stream of
+    // readers cannot starve a writer.
+    while (mutex->fWriter || mutex->fWritersWaiting > 0) {
+        mutex->fCond.wait(lock);
+    }
+    ++mutex->fReaders;
+}
+
+U_CAPI void U_EXPORT2
+umtx_unlockRead(USharedMutex *mutex) {
+    std::unique_lock<std::mutex> lock(mutex->fMutex);
+    U_ASSERT(mutex->fReaders > 0);
+    if (--mutex->fReaders == 0 && mutex->fWritersWaiting > 0) {
+        mutex->fCond.notify_all();
+    }
+}
+
+U_CAPI void U_EXPORT2
+umtx_lockWrite(USharedMutex *mutex) {
+    std::unique_lock<std::mutex> lock(mutex->fMutex);
+    ++mutex->fWritersWaiting;
+    while (mutex->fWriter || mutex->fReaders > 0) {
+        mutex->fCond.wait(lock);
+    }
+    --mutex->fWritersWaiting;
+    mutex->fWriter = TRUE;
+}
+
+U_CAPI void U_EXPORT2
+umtx_unlockWrite(USharedMutex *mutex) {
+    {
+        std::unique_lock<std::mutex> lock(mutex->fMutex);
+        U_ASSERT(mutex->fWriter);
+        mutex->fWriter = FALSE;
+    }
+    mutex->fCond.notify_all();
+}
+
+
 /*************************************************************************************************
  *
  *  UInitOnce Implementation
@@ -209,8 +209,32 @@ struct UConditionVar : public icu::UMemory {
     std::condition_variable_any fCV;
 };
 
+/*
+ * USharedMutex - a reader-writer mutex for read-mostly data structures
+ * such as the zone metadata caches. Any number of readers may hold the
+ * lock concurrently; a writer gets exclusive access and takes priority
+ * over newly arriving readers, so that writers cannot starve.
+ *
+ * Standard C++11 has no shared mutex (std::shared_mutex is C++17), so
+ * this is built from std::mutex and std::condition_variable.
+ * For internal ICU use only.
+ */
+struct USharedMutex : public icu::UMemory {
+    USharedMutex() = default;
+    ~USharedMutex() = default;
+    USharedMutex(const USharedMutex &other) = delete;
+    USharedMutex &operator =(const USharedMutex &other) = delete;
+
+    std::mutex              fMutex = {};          // Note: struct - public members - because
+    std::condition_variable fCond = {};           //       access is from plain C style
+    int32_t                 fReaders = 0;         //       functions (umtx_lockRead(), etc.)
+    int32_t                 fWritersWaiting = 0;
+    UBool                   fWriter = FALSE;
+};
+
 #define U_MUTEX_INITIALIZER {}
 #define U_CONDITION_INITIALIZER {}
+#define U_SHARED_MUTEX_INITIALIZER {}
 
 // Implementation notes for UConditionVar:
 //
@@ -261,6 +285,26 @@ U_INTERNAL void U_EXPORT2 umtx_condBroadcast(UConditionVar *cond);
  */
 U_INTERNAL void U_EXPORT2 umtx_condSignal(UConditionVar *cond);
 
+/* Acquire a shared mutex for reading. Any number of threads may hold
+ * the read lock concurrently, as long as no writer holds or is waiting
+ * for the write lock.
+ * @param mutex the shared mutex. Must not be NULL.
+ */
+U_INTERNAL void U_EXPORT2 umtx_lockRead(USharedMutex *mutex);
+
+/* Release a shared mutex previously acquired with umtx_lockRead(). */
+U_INTERNAL void U_EXPORT2 umtx_unlockRead(USharedMutex *mutex);
+
+/* Acquire a shared mutex for writing. The calling thread gets exclusive
+ * access; it waits until all current readers have released the lock.
+ * Recursive locks are an error and will deadlock.
+ * @param mutex the shared mutex. Must not be NULL.
+ */
+U_INTERNAL void U_EXPORT2 umtx_lockWrite(USharedMutex *mutex);
+
+/* Release a shared mutex previously acquired with umtx_lockWrite(). */
+U_INTERNAL void U_EXPORT2 umtx_unlockWrite(USharedMutex *mutex);
+
 
 U_NAMESPACE_END
 
@@ -27,6 +27,7 @@
 #include "umutex.h"
 #include "cmemory.h"
 #include "cstring.h"
+#include "uarrsort.h"
 #include "ucln_cmn.h"
 #include "udataswp.h"
 #include "uprops.h"
@@ -118,6 +119,32 @@ static int32_t gMaxNameLength=0;
  */
 static uint32_t gNameSet[8]={ 0 };
 
+/*
+ * Index over the tokenized name groups for u_charFromName():
+ * one entry per named character, sorted by a hash of the name, so that
+ * a name->code lookup binary searches the hashes and verifies the few
+ * candidates against the stored names instead of enumerating and
+ * decompressing all names on every call.
+ * Built lazily per name choice on first u_charFromName() use;
+ * the data file itself carries no inverse index.
+ */
+typedef struct {
+    uint32_t nameHash;
+    UChar32 code;
+} NameIndexEntry;
+
+typedef struct {
+    NameIndexEntry *entries;
+    int32_t count;
+    int32_t capacity;
+} NameIndex;
+
+static NameIndex gNameIndex[U_CHAR_NAME_CHOICE_COUNT];
+static icu::UInitOnce gNameIndexInitOnce[U_CHAR_NAME_CHOICE_COUNT] = {
+    U_INITONCE_INITIALIZER, U_INITONCE_INITIALIZER,
+    U_INITONCE_INITIALIZER, U_INITONCE_INITIALIZER
+};
+
 #define U_NONCHARACTER_CODE_POINT U_CHAR_CATEGORY_COUNT
 #define U_LEAD_SURROGATE U_CHAR_CATEGORY_COUNT + 1
 #define U_TRAIL_SURROGATE U_CHAR_CATEGORY_COUNT + 2
@@ -164,6 +191,8 @@ static const char * const charCatNames[U_CHAR_EXTENDED_CATEGORY_COUNT] = {
 
 static UBool U_CALLCONV unames_cleanup(void)
 {
+    int32_t i;
+
     if(uCharNamesData) {
         udata_close(uCharNamesData);
         uCharNamesData = NULL;
@@ -173,6 +202,12 @@ static UBool U_CALLCONV unames_cleanup(void)
     }
     gCharNamesInitOnce.reset();
     gMaxNameLength=0;
+    for(i=0; i<U_CHAR_NAME_CHOICE_COUNT; ++i) {
+        uprv_free(gNameIndex[i].entries);
+        gNameIndex[i].entries=NULL;
+        gNameIndex[i].count=gNameIndex[i].capacity=0;
+        gNameIndexInitOnce[i].reset();
+    }
     return TRUE;
 }
 
@@ -769,6 +804,69 @@ enumNames(UCharNames *names,
     return TRUE;
 }
 
+/* name index for u_charFromName() ------------------------------------------ */
+
+static uint32_t
+hashCharName(const char *name) {
+    uint32_t hash=0;
+    while(*name!=0) {
+        hash=hash*37u+(uint8_t)*name++;
+    }
+    return hash;
+}
+
+static UBool U_CALLCONV
+appendNameIndexEntry(void *context, UChar32 code, UCharNameChoice /*nameChoice*/,
+                     const char *name, int32_t /*length*/) {
+    NameIndex *nameIndex=(NameIndex *)context;
+    if(name[0]=='<') {
+        /* synthetic extended names are parsed directly by u_charFromName() */
+        return TRUE;
+    }
+    if(nameIndex->count==nameIndex->capacity) {
+        int32_t newCapacity= nameIndex->capacity==0 ? 0x4000 : 2*nameIndex->capacity;
+        NameIndexEntry *entries=(NameIndexEntry *)uprv_realloc(
+            nameIndex->entries, newCapacity*sizeof(NameIndexEntry));
+        if(entries==NULL) {
+            nameIndex->count=-1;  /* signal allocation failure, stop enumerating */
+            return FALSE;
+        }
+        nameIndex->entries=entries;
+        nameIndex->capacity=newCapacity;
+    }
+    nameIndex->entries[nameIndex->count].nameHash=hashCharName(name);
+    nameIndex->entries[nameIndex->count].code=code;
+    ++nameIndex->count;
+    return TRUE;
+}
+
+static int32_t U_CALLCONV
+compareNameIndexEntries(const void * /*context*/, const void *left, const void *right) {
+    const NameIndexEntry *l=(const NameIndexEntry *)left;
+    const NameIndexEntry *r=(const NameIndexEntry *)right;
+    if(l->nameHash!=r->nameHash) {
+        return l->nameHash<r->nameHash ? -1 : 1;
+    }
+    return l->code-r->code;
+}
+
+static void U_CALLCONV
+buildNameIndex(UCharNameChoice nameChoice, UErrorCode &errorCode) {
+    NameIndex *nameIndex=&gNameIndex[nameChoice];
+    nameIndex->entries=NULL;
+    nameIndex->count=nameIndex->capacity=0;
+    enumNames(uCharNames, 0, UCHAR_MAX_VALUE+1, appendNameIndexEntry, nameIndex, nameChoice);
+    if(nameIndex->count<0) {
+        uprv_free(nameIndex->entries);
+        nameIndex->entries=NULL;
+        nameIndex->count=nameIndex->capacity=0;
+        errorCode=U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    uprv_sortArray(nameIndex->entries, nameIndex->count, (int32_t)sizeof(NameIndexEntry),
+                   compareNameIndexEntries, NULL, FALSE, &errorCode);
+}
+
 static uint16_t
 writeFactorSuffix(const uint16_t *factors, uint16_t count,
                   const char *s, /* suffix elements */
@@ -1623,6 +1721,38 @@ u_charFromName(UCharNameChoice nameChoice,
     /* normal character name */
     findName.otherName=upper;
     findName.code=error;
+    {
+        UErrorCode indexErrorCode=U_ZERO_ERROR;
+        umtx_initOnce(gNameIndexInitOnce[nameChoice], &buildNameIndex, nameChoice, indexErrorCode);
+        if(U_SUCCESS(indexErrorCode)) {
+            /* binary search the name hash, then verify the candidates
+               against the stored names */
+            const NameIndex *nameIndex=&gNameIndex[nameChoice];
+            uint32_t hash=hashCharName(upper);
+            int32_t lo=0, hi=nameIndex->count;
+            while(lo<hi) {
+                int32_t mid=(lo+hi)/2;
+                if(nameIndex->entries[mid].nameHash<hash) {
+                    lo=mid+1;
+                } else {
+                    hi=mid;
+                }
+            }
+            while(lo<nameIndex->count && nameIndex->entries[lo].nameHash==hash) {
+                UChar32 c=nameIndex->entries[lo].code;
+                enumNames(uCharNames, c, c+1, DO_FIND_NAME, &findName, nameChoice);
+                if(findName.code!=error) {
+                    break;
+                }
+                ++lo;
+            }
+            if (findName.code == error) {
+                *pErrorCode = U_ILLEGAL_CHAR_FOUND;
+            }
+            return findName.code;
+        }
+    }
+    /* the index could not be allocated; search by enumeration */
     enumNames(uCharNames, 0, UCHAR_MAX_VALUE + 1, DO_FIND_NAME, &findName, nameChoice);
     if (findName.code == error) {
          *pErrorCode = U_ILLEGAL_CHAR_FOUND;
@@ -587,6 +587,26 @@ public:
      *  @internal
      */
     const char *getLocaleID(ULocDataLocaleType type, UErrorCode& status) const;
+
+    /**
+     * Returns a break iterator of the given kind (a UBreakIteratorType value)
+     * for the locale, reusing an idle instance from a small global pool when
+     * one matches, and building a new one via createInstance() otherwise.
+     * The caller owns the iterator until it is handed back with
+     * returnPooledInstance() (or deleted). A reused iterator keeps no text
+     * from its previous lease, but the caller must set its text before use.
+     * @internal
+     */
+    static BreakIterator* U_EXPORT2 getPooledInstance(const Locale& where, int32_t kind, UErrorCode& status);
+
+    /**
+     * Returns a leased break iterator to the pool for later reuse under the
+     * same (locale, kind) key that it was leased with.
+     * Deletes the iterator if the pool is already full.
+     * returnPooledInstance(NULL, ...) is a no-op.
+     * @internal
+     */
+    static void U_EXPORT2 returnPooledInstance(BreakIterator* adoptedBi, const Locale& where, int32_t kind);
 #endif  /* U_HIDE_INTERNAL_API */
 
     /**
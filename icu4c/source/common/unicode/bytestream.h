@@ -250,15 +250,85 @@ class StringByteSink : public ByteSink {
       dest->reserve(dest->length() + initialAppendCapacity);
     }
   }
+  /**
+   * Destructor. Discards an uncommitted append buffer, restoring the
+   * string to the bytes that were actually appended, for example when
+   * the writer returned on an error without committing.
+   * @draft ICU 63
+   */
+  ~StringByteSink() { DiscardAppendBuffer(); }
   /**
    * Append "bytes[0,n-1]" to this.
    * @param data the pointer to the bytes
    * @param n the number of bytes; must be non-negative
    * @stable ICU 4.2
    */
-  virtual void Append(const char* data, int32_t n) { dest_->append(data, n); }
+  virtual void Append(const char* data, int32_t n) {
+    if (appendBufferCapacity_ > 0 && n >= 0 && n <= appendBufferCapacity_ &&
+        data == dest_->data() + (dest_->length() - appendBufferCapacity_)) {
+      // The caller wrote directly into the buffer returned from
+      // GetAppendBuffer(); keep the written prefix, without copying.
+      dest_->resize(dest_->length() - appendBufferCapacity_ + n);
+      appendBufferCapacity_ = 0;
+    } else {
+      DiscardAppendBuffer();
+      dest_->append(data, n);
+    }
+  }
+  /**
+   * Returns a writable buffer for appending and writes the buffer's capacity to
+   * *result_capacity. Guarantees *result_capacity>=min_capacity.
+   * Returns a span at the end of the string itself, so that bytes written
+   * there and committed via Append() are not copied again.
+   * For details see the base class documentation.
+   *
+   * Note: This virtual override cannot be hidden via U_HIDE_DRAFT_API.
+   * @param min_capacity required minimum capacity of the returned buffer;
+   *                     must be non-negative
+   * @param desired_capacity_hint desired capacity of the returned buffer;
+   *                              must be non-negative
+   * @param scratch default caller-owned buffer
+   * @param scratch_capacity capacity of the scratch buffer
+   * @param result_capacity pointer to an integer which will be set to the
+   *                        capacity of the returned buffer
+   * @return a buffer with *result_capacity>=min_capacity
+   * @draft ICU 63
+   */
+  virtual char* GetAppendBuffer(int32_t min_capacity,
+                                int32_t desired_capacity_hint,
+                                char* /*scratch*/, int32_t /*scratch_capacity*/,
+                                int32_t* result_capacity) {
+    if (min_capacity < 1) {
+      *result_capacity = 0;
+      return NULL;
+    }
+    DiscardAppendBuffer();
+    int32_t capacity =
+        desired_capacity_hint > min_capacity ? desired_capacity_hint : min_capacity;
+    int32_t length = (int32_t)dest_->length();
+    dest_->resize(length + capacity);
+    appendBufferCapacity_ = capacity;
+    *result_capacity = capacity;
+    return &(*dest_)[length];
+  }
+  /**
+   * Discards an unused append buffer, restoring the string to the
+   * bytes that were actually appended.
+   *
+   * Note: This virtual override cannot be hidden via U_HIDE_DRAFT_API.
+   * @draft ICU 63
+   */
+  virtual void Flush() { DiscardAppendBuffer(); }
  private:
+  void DiscardAppendBuffer() {
+    if (appendBufferCapacity_ > 0) {
+      dest_->resize(dest_->length() - appendBufferCapacity_);
+      appendBufferCapacity_ = 0;
+    }
+  }
+
   StringClass* dest_;
+  int32_t appendBufferCapacity_ = 0;
 
   StringByteSink() = delete;
   StringByteSink(const StringByteSink &) = delete;
@@ -183,6 +183,11 @@ private:
     const Normalizer2 &nfd;
     const Normalizer2Impl &nfcImpl;
 
+    // Memoizes getEquivalents() results across setSource() calls,
+    // keyed by segment, since real text repeats the same mark clusters.
+    // Lazily created; bounded; owned.
+    Hashtable *fEquivalentsCache;
+
     // we have a segment, in NFD. Find all the strings that are canonically equivalent to it.
     UnicodeString *getEquivalents(const UnicodeString &segment, int32_t &result_len, UErrorCode &status); //private String[] getEquivalents(String segment)
 
@@ -372,7 +372,7 @@ U_INTERNAL UPlugData* U_EXPORT2
 uplug_loadPlugFromLibrary(const char *libName, const char *sym, const char *config, UErrorCode *status);
 
 /**
- * Remove a plugin. 
+ * Remove a plugin.
  * Will request the plugin to be unloaded, and close the library if needed
  * @param plug plugin handle to close
  * @param status error result
@@ -380,6 +380,25 @@ uplug_loadPlugFromLibrary(const char *libName, const char *sym, const char *conf
  */
 U_INTERNAL void U_EXPORT2
 uplug_removePlug(UPlugData *plug, UErrorCode *status);
+
+/**
+ * Load the plugins whose loading was deferred during u_init().
+ * Plugin file entries below a line consisting of the directive
+ * "#!deferred" are recorded during u_init() but their libraries are not
+ * opened, so unused plugins cost no dlopen time at startup. (Older ICU
+ * versions parse the directive as a comment and load such entries
+ * eagerly.) Call this function when the deferred plugins are actually
+ * needed; it opens, queries and loads them. Since ICU is already
+ * initialized at that point, UPLUG_LEVEL_LOW plugins cannot be deferred -
+ * they fail with U_PLUGIN_TOO_HIGH, just like low level plugins loaded
+ * late by other means.
+ * Not thread safe - do not call concurrently with itself or with other
+ * functions that add or remove plugins.
+ * @param status error result
+ * @internal ICU 63 Technology Preview (for application use)
+ */
+U_INTERNAL void U_EXPORT2
+uplug_loadDeferredPlugs(UErrorCode *status);
 #endif  /* U_HIDE_INTERNAL_API */
 
 #endif /* UCONFIG_ENABLE_PLUGINS */
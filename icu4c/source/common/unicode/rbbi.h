@@ -510,6 +510,60 @@ public:
     */
     virtual int32_t getRuleStatusVec(int32_t *fillInVec, int32_t capacity, UErrorCode &status);
 
+#ifndef U_HIDE_INTERNAL_API
+    /**
+     * Finds all boundaries of the given text in one call, storing them into
+     * an array provided by the caller. The boundaries include the start of
+     * the text (position 0) and its end. The state machine runs straight
+     * through the text without per-boundary iteration calls or break cache
+     * maintenance, which is substantially faster than the next() protocol
+     * when all boundaries are wanted anyway.
+     * <p>
+     * The iterator adopts the text like setText(ut, status) and is left
+     * positioned at its start.
+     * If the capacity of the output array is insufficient to hold the data,
+     * the output will be truncated to the available length, and a
+     * U_BUFFER_OVERFLOW_ERROR will be signaled.
+     *
+     * @param ut         the text whose boundaries are to be found.
+     * @param boundaries an array to be filled in with the boundary positions.
+     * @param capacity   the length of the supplied array. A length of zero
+     *                   causes the function to return the number of
+     *                   boundaries, in the normal way, without attempting
+     *                   to store any positions.
+     * @param status     receives error codes.
+     * @return           The total number of boundaries in the text.
+     * @internal
+     */
+    int32_t getBoundaries(UText *ut, int32_t *boundaries, int32_t capacity, UErrorCode &status);
+
+    /**
+     * Like getBoundaries(), but additionally stores the primary rule status
+     * value of each boundary, the same value getRuleStatus() would report
+     * after iterating to it. For a line break iterator this distinguishes
+     * mandatory breaks from optional break opportunities
+     * (see ULineBreakTag in ubrk.h), letting layout code interleave
+     * measurement with a single boundary pass instead of alternating
+     * between following() and getRuleStatus().
+     *
+     * @param ut           the text whose boundaries are to be found.
+     * @param boundaries   an array to be filled in with the boundary positions.
+     * @param statusValues an array to be filled in with the primary rule
+     *                     status value of each boundary, or NULL if the
+     *                     status values are not wanted. Must have the same
+     *                     capacity as the boundaries array.
+     * @param capacity     the length of the supplied arrays. A length of
+     *                     zero causes the function to return the number of
+     *                     boundaries, in the normal way, without attempting
+     *                     to store anything.
+     * @param status       receives error codes.
+     * @return             The total number of boundaries in the text.
+     * @internal
+     */
+    int32_t getBoundaries(UText *ut, int32_t *boundaries, int32_t *statusValues,
+                          int32_t capacity, UErrorCode &status);
+#endif  /* U_HIDE_INTERNAL_API */
+
     /**
      * Returns a unique class ID POLYMORPHICALLY.  Pure virtual override.
      * This method is to implement a simple version of RTTI, since not all
@@ -536,6 +536,38 @@ ubidi_open(void);
 U_STABLE UBiDi * U_EXPORT2
 ubidi_openSized(int32_t maxLength, int32_t maxRunCount, UErrorCode *pErrorCode);
 
+#ifndef U_HIDE_INTERNAL_API
+/**
+ * Grow the internal buffers of an open <code>UBiDi</code> object so that
+ * subsequent <code>ubidi_setPara()</code> calls with texts up to
+ * <code>maxLength</code> characters and <code>maxRunCount</code> runs
+ * perform no memory allocation.
+ *
+ * Unlike preallocation via <code>ubidi_openSized()</code>, which makes
+ * longer texts fail, an object reserved with this function still grows
+ * on demand when the hints are exceeded; the hints are a floor, not a
+ * ceiling. Buffers are never shrunk. Intended for callers that reuse
+ * one <code>UBiDi</code> object per worker thread across many
+ * paragraphs.
+ *
+ * @param pBiDi is the paragraph <code>UBiDi</code> object.
+ *
+ * @param maxLength is the text length to preallocate for, or 0 to leave
+ *        the text buffers unchanged.
+ *
+ * @param maxRunCount is the number of same-level runs to preallocate
+ *        for, or 0 to leave the runs buffer unchanged.
+ *
+ * @param pErrorCode must be a valid pointer to an error code value.
+ *
+ * @see ubidi_openSized
+ * @internal
+ */
+U_INTERNAL void U_EXPORT2
+ubidi_reserve(UBiDi *pBiDi, int32_t maxLength, int32_t maxRunCount,
+              UErrorCode *pErrorCode);
+#endif  /* U_HIDE_INTERNAL_API */
+
 /**
  * <code>ubidi_close()</code> must be called to free the memory
  * associated with a UBiDi object.<p>
@@ -1458,6 +1490,51 @@ ubidi_getParagraphByIndex(const UBiDi *pBiDi, int32_t paraIndex,
                           int32_t *pParaStart, int32_t *pParaLimit,
                           UBiDiLevel *pParaLevel, UErrorCode *pErrorCode);
 
+#ifndef U_HIDE_INTERNAL_API
+/**
+ * Split plain text into Bidi paragraphs without running the Bidi
+ * algorithm.
+ *
+ * Paragraph boundaries follow the same rules as
+ * <code>ubidi_setPara()</code>: a paragraph ends after each block
+ * separator (Bidi class B), with CR LF counting as a single separator,
+ * and any trailing text without a separator forms the last paragraph.
+ * Because the Unicode Bidi Algorithm never looks across a block
+ * separator, each [start..limit[ range returned here can be passed to
+ * <code>ubidi_setPara()</code> on an independent <code>UBiDi</code>
+ * object, on any thread, and the concatenated results equal a single
+ * whole-text call.
+ *
+ * @param text is the text to split. It must be valid for the whole
+ *        length.
+ *
+ * @param length is the length of the text, which must be &gt;=0.
+ *
+ * @param paraLimits will receive the limit offset of each paragraph,
+ *        including its block separator. Up to
+ *        <code>paraLimitsCapacity</code> limits are written; the start
+ *        of paragraph i is <code>paraLimits[i-1]</code> (0 for i==0).
+ *        This pointer can be <code>NULL</code> if only the count is
+ *        needed.
+ *
+ * @param paraLimitsCapacity is the number of limits that can be written
+ *        to <code>paraLimits</code>.
+ *
+ * @param pErrorCode must be a valid pointer to an error code value.
+ *
+ * @return The total number of paragraphs in the text, which may exceed
+ *         <code>paraLimitsCapacity</code>.
+ *
+ * @see ubidi_setPara
+ * @see ubidi_countParagraphs
+ * @internal
+ */
+U_INTERNAL int32_t U_EXPORT2
+ubidi_splitParagraphs(const UChar *text, int32_t length,
+                      int32_t *paraLimits, int32_t paraLimitsCapacity,
+                      UErrorCode *pErrorCode);
+#endif  /* U_HIDE_INTERNAL_API */
+
 /**
  * Get the level for one character.
  *
@@ -1603,6 +1680,62 @@ U_STABLE UBiDiDirection U_EXPORT2
 ubidi_getVisualRun(UBiDi *pBiDi, int32_t runIndex,
                    int32_t *pLogicalStart, int32_t *pLength);
 
+#ifndef U_HIDE_INTERNAL_API
+/**
+ * Callback type for <code>ubidi_emitReordered()</code>.
+ * Receives one visual run as a logical range of the original text.
+ *
+ * @param context the caller's context pointer, passed through
+ *        unchanged.
+ *
+ * @param logicalStart the first logical character index of the run.
+ *
+ * @param length the number of characters (at least one) in the run.
+ *
+ * @param direction the directionality of the run,
+ *        <code>UBIDI_LTR==0</code> or <code>UBIDI_RTL==1</code>.
+ *
+ * @return <code>TRUE</code> to continue with the next run,
+ *         <code>FALSE</code> to stop.
+ *
+ * @internal
+ */
+typedef UBool U_CALLCONV
+UBiDiRunSink(const void *context,
+             int32_t logicalStart, int32_t length,
+             UBiDiDirection direction);
+
+/**
+ * Emit the visual runs of a paragraph or line, in visual order, to a
+ * callback as (logical range, direction) spans, without writing any
+ * destination text.
+ *
+ * This is the zero-copy counterpart of
+ * <code>ubidi_writeReordered()</code> for callers such as renderers
+ * that consume spans of the original text directly and apply
+ * shaping/mirroring themselves. It is equivalent to iterating
+ * <code>ubidi_getVisualRun()</code> over all runs, but resolves the
+ * runs once and makes no per-run validity checks.
+ *
+ * @param pBiDi is the paragraph or line <code>UBiDi</code> object.
+ *
+ * @param sink is called once per visual run, left-to-right in visual
+ *        order, until all runs are emitted or it returns
+ *        <code>FALSE</code>.
+ *
+ * @param context is passed through to the sink unchanged.
+ *
+ * @param pErrorCode must be a valid pointer to an error code value.
+ *
+ * @see ubidi_getVisualRun
+ * @see ubidi_writeReordered
+ * @internal
+ */
+U_INTERNAL void U_EXPORT2
+ubidi_emitReordered(UBiDi *pBiDi, UBiDiRunSink *sink, const void *context,
+                    UErrorCode *pErrorCode);
+#endif  /* U_HIDE_INTERNAL_API */
+
 /**
  * Get the visual position from a logical text position.
  * If such a mapping is used many times on the same
@@ -2707,6 +2707,33 @@ u_isUWhiteSpace(UChar32 c);
 U_STABLE int32_t U_EXPORT2
 u_getIntPropertyValue(UChar32 c, UProperty which);
 
+#ifndef U_HIDE_INTERNAL_API
+/**
+ * Get the property values for an enumerated or integer Unicode property
+ * for an array of code points.
+ * Writes u_getIntPropertyValue(cps[i], which) to values[i] for each i.
+ *
+ * Bulk version of u_getIntPropertyValue() for analysis loops:
+ * the property dispatch and validation are done once per call rather
+ * than per code point, and runs of identical code points are looked
+ * up only once, which benefits sorted or clustered input.
+ *
+ * @param which UProperty selector constant; see u_getIntPropertyValue().
+ * @param cps array of length code points
+ * @param length number of code points; must be non-negative
+ * @param values output array of length property values
+ * @param pErrorCode in/out error code;
+ *        U_ILLEGAL_ARGUMENT_ERROR if length<0 or an array pointer is NULL
+ * @see u_getIntPropertyValue
+ * @internal
+ */
+U_INTERNAL void U_EXPORT2
+u_getIntPropertyValues(UProperty which,
+                       const UChar32 *cps, int32_t length,
+                       int32_t *values,
+                       UErrorCode *pErrorCode);
+#endif  /* U_HIDE_INTERNAL_API */
+
 /**
  * Get the minimum value for an enumerated/integer/binary Unicode property.
  * Can be used together with u_getIntPropertyMaxValue
@@ -49,9 +49,42 @@
  *
  * @stable ICU 2.6
  */  
-U_STABLE void U_EXPORT2 
+U_STABLE void U_EXPORT2
 u_init(UErrorCode *status);
 
+#ifndef U_HIDE_INTERNAL_API
+/**
+ * Bit flags for u_initFull(), selecting which subsystems to preload.
+ * @internal
+ */
+typedef enum UInitFlags {
+    /** Open the default converter. @internal */
+    UINIT_CONVERTERS = 1,
+    /** Load the NFC/NFD/NFKC normalization data. @internal */
+    UINIT_NORMALIZATION = 2,
+    /** Load the break iterator data for the default locale. @internal */
+    UINIT_BREAK_ITERATION = 4,
+    /** All of the above. @internal */
+    UINIT_ALL = 7
+} UInitFlags;
+
+/**
+ * Performs u_init() and then eagerly loads the data for the selected
+ * subsystems, so that the cost of demand-loading does not land on the
+ * first real request. The loaded items stay in ICU's own caches.
+ *
+ * ICU does not create threads; to overlap the preloading with other
+ * process startup work, call this function from a worker thread of
+ * your own. It is safe to call concurrently with other ICU use.
+ *
+ * @param flags  A combination of UInitFlags values.
+ * @param status An ICU UErrorCode parameter. It must not be <code>NULL</code>.
+ * @internal
+ */
+U_INTERNAL void U_EXPORT2
+u_initFull(uint32_t flags, UErrorCode *status);
+#endif  /* U_HIDE_INTERNAL_API */
+
 #ifndef U_HIDE_SYSTEM_API
 /**
  * Clean up the system resources, such as allocated memory or open files,
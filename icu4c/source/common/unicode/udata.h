@@ -432,6 +432,27 @@ typedef enum UDataFileAccess {
 U_STABLE void U_EXPORT2
 udata_setFileAccess(UDataFileAccess access, UErrorCode *status);
 
+#ifndef U_HIDE_INTERNAL_API
+/**
+ * Declares the common ICU data package trusted: the caller asserts that the
+ * mapped icudt file is known-good (for example, sealed into an immutable
+ * container image), so ICU data opens go straight to the common package's
+ * table of contents and skip the per-item file system probing (time zone
+ * override directory and individual data files) as well as the per-item
+ * acceptance callback for ICU's own data. Application data loaded by path
+ * is not affected.
+ *
+ * Like udata_setFileAccess(), this must be called before any ICU data is
+ * loaded and is not multithread safe; calling it at u_init() time is
+ * recommended.
+ * @param isTrusted TRUE to enable the trusted fast path.
+ * @param status Error code.
+ * @internal
+ */
+U_INTERNAL void U_EXPORT2
+udata_setTrustedData(UBool isTrusted, UErrorCode *status);
+#endif  /* U_HIDE_INTERNAL_API */
+
 U_CDECL_END
 
 #endif
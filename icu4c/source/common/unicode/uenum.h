@@ -147,6 +147,41 @@ uenum_next(UEnumeration* en,
            int32_t* resultLength,
            UErrorCode* status);
 
+#ifndef U_HIDE_INTERNAL_API
+/**
+ * Copies all remaining elements into the caller's arrays in one call,
+ * rather than one uenum_next() call per element.
+ * Each element string is copied NUL-terminated into the arena, and a
+ * pointer to its copy is stored in dest. Unlike uenum_next() results,
+ * the copies stay valid after further calls on, or closing of, the
+ * enumeration.
+ *
+ * Array-backed enumerations (e.g. uenum_openCharStringsEnumeration())
+ * drain natively; others fall back to an internal loop over
+ * uenum_next(), which still saves the per-element API calls.
+ *
+ * If dest or the arena is too small, the status is set to
+ * U_BUFFER_OVERFLOW_ERROR and the elements copied so far are returned;
+ * the enumeration position is then unspecified. Callers should size the
+ * arrays from uenum_count() and an upper bound on the string lengths,
+ * or uenum_reset() and retry with larger arrays after an overflow.
+ *
+ * @param en the iterator object
+ * @param dest receives one pointer per element, pointing into the arena
+ * @param destCapacity number of dest slots
+ * @param arena receives the NUL-terminated element strings
+ * @param arenaCapacity number of arena bytes
+ * @param status the error code
+ * @return the number of elements copied to dest
+ * @internal
+ */
+U_INTERNAL int32_t U_EXPORT2
+uenum_drain(UEnumeration* en,
+            const char** dest, int32_t destCapacity,
+            char* arena, int32_t arenaCapacity,
+            UErrorCode* status);
+#endif  /* U_HIDE_INTERNAL_API */
+
 /**
  * Resets the iterator to the current list of service IDs.  This
  * re-establishes sync with the service and rewinds the iterator
@@ -762,6 +762,22 @@ uloc_getAvailable(int32_t n);
  */
 U_STABLE int32_t U_EXPORT2 uloc_countAvailable(void);
 
+#ifndef U_HIDE_INTERNAL_API
+/**
+ * Determines whether the specified locale ID has installed resource data,
+ * i.e. whether it is in the set that uloc_getAvailable() enumerates.
+ * This is a constant-time hash probe; no list is scanned and no
+ * enumeration object is allocated. The locale ID must be in ICU format
+ * ("en_US"), as produced by uloc_getName().
+ *
+ * @param localeID the locale ID to look up
+ * @return TRUE if the locale is in the available-locales list
+ * @internal
+ */
+U_INTERNAL UBool U_EXPORT2
+uloc_isAvailable(const char *localeID);
+#endif  /* U_HIDE_INTERNAL_API */
+
 /**
  *
  * Gets a list of all available 2-letter language codes defined in ISO 639,
@@ -2853,6 +2853,39 @@ public:
    */
   void releaseBuffer(int32_t newLength=-1);
 
+#ifndef U_HIDE_INTERNAL_API
+  /**
+   * Transfers ownership of this string's buffer to the caller, avoiding a
+   * copy when handing the text off to another string type.
+   *
+   * This succeeds only if the string owns a writable, unshared heap
+   * buffer (no stack buffer, no alias, no other string sharing the
+   * buffer, no "open" getBuffer(minCapacity)). On success, the buffer
+   * pointer is returned, length and capacity are set to the string's
+   * length and buffer capacity (with a terminating NUL written if
+   * capacity allows), and this string is reset to the empty string.
+   * Otherwise returns nullptr and leaves the string unchanged; the caller
+   * must then copy the contents, for example with extract().
+   *
+   * The returned buffer must be released with releaseStolenBuffer(),
+   * not with free() or uprv_free(): the characters are offset inside the
+   * underlying allocation.
+   *
+   * @param length receives the length of the text in the buffer
+   * @param capacity receives the buffer capacity, in char16_ts
+   * @return the detached buffer, or nullptr if the buffer cannot be detached
+   * @internal
+   */
+  char16_t *stealBuffer(int32_t &length, int32_t &capacity);
+
+  /**
+   * Releases a buffer obtained from stealBuffer().
+   * Does nothing if buffer is nullptr.
+   * @internal
+   */
+  static void releaseStolenBuffer(char16_t *buffer);
+#endif  // U_HIDE_INTERNAL_API
+
   /**
    * Get a read-only pointer to the internal buffer.
    * This can be called at any time on a valid UnicodeString.
@@ -201,6 +201,26 @@ U_STABLE UStringPrepProfile* U_EXPORT2
 usprep_openByType(UStringPrepProfileType type,
 				  UErrorCode* status);
 
+#ifndef U_HIDE_INTERNAL_API
+/**
+ * Returns a shared ("frozen") profile for the specified profile type.
+ * The profile is loaded on the first call for its type and retained until
+ * ICU cleanup; subsequent calls return the same pointer without taking
+ * a lock. The profile data is immutable, so the returned profile can be
+ * used concurrently from any number of threads.
+ *
+ * @param type      The profile type
+ * @param status    ICU error code in/out parameter. Must not be NULL.
+ *                  Must fulfill U_SUCCESS before the function call.
+ * @return          Pointer to a shared UStringPrepProfile which is owned
+ *                  by ICU. Do not call usprep_close() on it.
+ * @internal
+ */
+U_INTERNAL const UStringPrepProfile* U_EXPORT2
+usprep_getFrozenByType(UStringPrepProfileType type,
+                       UErrorCode* status);
+#endif  /* U_HIDE_INTERNAL_API */
+
 /**
  * Closes the profile
  * @param profile The profile to close
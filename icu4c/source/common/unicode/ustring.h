@@ -1291,13 +1291,64 @@ u_strToUTF8(char *dest,
  * @see u_strFromUTF8Lenient
  */
 U_STABLE UChar* U_EXPORT2
-u_strFromUTF8(UChar *dest,             
+u_strFromUTF8(UChar *dest,
               int32_t destCapacity,
               int32_t *pDestLength,
-              const char *src, 
+              const char *src,
               int32_t srcLength,
               UErrorCode *pErrorCode);
 
+#ifndef U_HIDE_INTERNAL_API
+/**
+ * Convert a UTF-16 string to UTF-8 without threading a UErrorCode.
+ * Same conversion as u_strToUTF8(), with the status folded into the
+ * return value so that callers in tight loops do not load, check and
+ * branch on an error code location per call.
+ *
+ * As with pre-flighting, the returned length may exceed destCapacity;
+ * that is the buffer-overflow indication. The result is NUL-terminated
+ * if it fits with the terminator; there is no warning code for an
+ * exactly-full buffer, so callers that need the terminator must check
+ * the returned length against destCapacity themselves.
+ *
+ * @param dest          A buffer for the result string.
+ * @param destCapacity  The size of the buffer (number of chars). If it is 0, then
+ *                      dest may be NULL and only the length is returned (pre-flighting).
+ * @param src           The original source string
+ * @param srcLength     The length of the original string. If -1, then src must be zero-terminated.
+ * @return The length of the result in chars (which may exceed destCapacity),
+ *         or the negated UErrorCode (e.g. -U_INVALID_CHAR_FOUND) on error.
+ * @internal
+ * @see u_strToUTF8
+ */
+U_INTERNAL int32_t U_EXPORT2
+u_strToUTF8Fast(char *dest,
+                int32_t destCapacity,
+                const UChar *src,
+                int32_t srcLength);
+
+/**
+ * Convert a UTF-8 string to UTF-16 without threading a UErrorCode.
+ * Same conversion as u_strFromUTF8(); the counterpart of
+ * u_strToUTF8Fast(), with the same return value convention.
+ *
+ * @param dest          A buffer for the result string.
+ * @param destCapacity  The size of the buffer (number of UChars). If it is 0, then
+ *                      dest may be NULL and only the length is returned (pre-flighting).
+ * @param src           The original source string
+ * @param srcLength     The length of the original string. If -1, then src must be zero-terminated.
+ * @return The length of the result in UChars (which may exceed destCapacity),
+ *         or the negated UErrorCode (e.g. -U_INVALID_CHAR_FOUND) on error.
+ * @internal
+ * @see u_strFromUTF8
+ */
+U_INTERNAL int32_t U_EXPORT2
+u_strFromUTF8Fast(UChar *dest,
+                  int32_t destCapacity,
+                  const char *src,
+                  int32_t srcLength);
+#endif  /* U_HIDE_INTERNAL_API */
+
 /**
  * Convert a UTF-16 string to UTF-8.
  *
@@ -161,6 +161,26 @@ utf8_prevCharSafeBody(const uint8_t *s, int32_t start, int32_t *pi, UChar32 c, U
 U_STABLE int32_t U_EXPORT2
 utf8_back1SafeBody(const uint8_t *s, int32_t start, int32_t i);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Returns the length in bytes of the longest prefix of s that is
+ * well-formed UTF-8, without converting or copying the text.
+ *
+ * If the result equals length then the whole string is valid UTF-8.
+ * Otherwise the byte at the returned index starts an ill-formed or
+ * truncated sequence. (A truncated but so-far-valid sequence at the
+ * very end of the string is not part of the valid span.)
+ *
+ * @param s the UTF-8 string
+ * @param length the string length, or -1 if NUL-terminated
+ *               (the valid span then ends at most at the NUL)
+ * @return the number of valid-UTF-8 prefix bytes
+ * @draft ICU 63
+ */
+U_CAPI int32_t U_EXPORT2
+utf8_spanValid(const char *s, int32_t length);
+#endif  // U_HIDE_DRAFT_API
+
 /* single-code point definitions -------------------------------------------- */
 
 /**
@@ -126,6 +126,55 @@ utrace_setLevel(int32_t traceLevel);
 U_STABLE int32_t U_EXPORT2
 utrace_getLevel(void);
 
+#ifndef U_HIDE_INTERNAL_API
+/**
+ * Always-on counters for a few hot paths.
+ * Unlike the entry/exit tracing above, these are single relaxed atomic
+ * additions with no level check and no callback,
+ * cheap enough to stay enabled in production.
+ * @internal
+ */
+typedef enum UTraceCounter {
+    /** Collator compare calls. @internal */
+    UTRACE_COUNTER_COLLATION_COMPARE,
+    /** Bytes written by ucnv_fromUnicode(). @internal */
+    UTRACE_COUNTER_CONVERTER_FROM_UNICODE_BYTES,
+    /** Bytes consumed by ucnv_toUnicode(). @internal */
+    UTRACE_COUNTER_CONVERTER_TO_UNICODE_BYTES,
+    /** Unified cache queries answered from the cache. @internal */
+    UTRACE_COUNTER_UNIFIED_CACHE_HIT,
+    /** Unified cache queries that had to create the value. @internal */
+    UTRACE_COUNTER_UNIFIED_CACHE_MISS,
+    /** Resource bundle opens. @internal */
+    UTRACE_COUNTER_RES_BUNDLE_OPEN,
+    /** Number of counters. @internal */
+    UTRACE_COUNTER_COUNT
+} UTraceCounter;
+
+/**
+ * Adds delta to a counter. Called by ICU implementation code.
+ * @internal
+ */
+U_INTERNAL void U_EXPORT2
+utrace_addCounter(UTraceCounter counter, int64_t delta);
+
+/**
+ * Copies a snapshot of the counters into the caller's array,
+ * up to capacity values.
+ * @return the total number of counters (UTRACE_COUNTER_COUNT)
+ * @internal
+ */
+U_INTERNAL int32_t U_EXPORT2
+utrace_getCounters(int64_t *counters, int32_t capacity);
+
+/**
+ * Resets all counters to zero.
+ * @internal
+ */
+U_INTERNAL void U_EXPORT2
+utrace_resetCounters(void);
+#endif  /* U_HIDE_INTERNAL_API */
+
 /* Trace function pointers types  ----------------------------- */
 
 /**
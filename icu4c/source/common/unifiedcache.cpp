@@ -15,7 +15,9 @@
 #include <algorithm>      // For std::max()
 
 #include "mutex.h"
+#include "putilimp.h"
 #include "uassert.h"
+#include "unicode/utrace.h"
 #include "uhash.h"
 #include "ucln_cmn.h"
 #include "umutex.h"
@@ -28,6 +30,7 @@ static icu::UInitOnce gCacheInitOnce = U_INITONCE_INITIALIZER;
 static const int32_t MAX_EVICT_ITERATIONS = 10;
 static const int32_t DEFAULT_MAX_UNUSED = 1000;
 static const int32_t DEFAULT_PERCENTAGE_OF_IN_USE = 100;
+static const int32_t DEFAULT_MIN_EVICTION_IDLE_TIME = 0;
 
 
 U_CDECL_BEGIN
@@ -98,6 +101,7 @@ UnifiedCache::UnifiedCache(UErrorCode &status) :
         fNumValuesInUse(0),
         fMaxUnused(DEFAULT_MAX_UNUSED),
         fMaxPercentageOfInUse(DEFAULT_PERCENTAGE_OF_IN_USE),
+        fMinEvictionIdleTime(DEFAULT_MIN_EVICTION_IDLE_TIME),
         fAutoEvictedCount(0),
         fNoValue(nullptr) {
     if (U_FAILURE(status)) {
@@ -137,6 +141,19 @@ void UnifiedCache::setEvictionPolicy(
     fMaxPercentageOfInUse = percentageOfInUseItems;
 }
 
+void UnifiedCache::setEvictionIdleTime(
+        int32_t minIdleMillis, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (minIdleMillis < 0) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    Mutex lock(&gCacheMutex);
+    fMinEvictionIdleTime = minIdleMillis;
+}
+
 int32_t UnifiedCache::unusedCount() const {
     Mutex lock(&gCacheMutex);
     return uhash_count(fHashtable) - fNumValuesInUse;
@@ -275,11 +292,15 @@ void UnifiedCache::_runEvictionSlice() const {
     if (maxItemsToEvict <= 0) {
         return;
     }
+    UDate now = fMinEvictionIdleTime > 0 ? uprv_getUTCtime() : 0;
     for (int32_t i = 0; i < MAX_EVICT_ITERATIONS; ++i) {
         const UHashElement *element = _nextElement();
         if (element == nullptr) {
             break;
         }
+        if (fMinEvictionIdleTime > 0 && _isRecentlyUsed(element, now)) {
+            continue;
+        }
         if (_isEvictable(element)) {
             const SharedObject *sharedObject =
                     (const SharedObject *) element->value.pointer;
@@ -307,6 +328,9 @@ void UnifiedCache::_putNew(
         return;
     }
     keyToAdopt->fCreationStatus = creationStatus;
+    if (fMinEvictionIdleTime > 0) {
+        keyToAdopt->fLastAccess = uprv_getUTCtime();
+    }
     if (value->softRefCount == 0) {
         _registerMaster(keyToAdopt, value);
     }
@@ -362,6 +386,7 @@ UBool UnifiedCache::_poll(
     // fetch out the contents and return them.
     if (element != NULL) {
          _fetch(element, value, status);
+        utrace_addCounter(UTRACE_COUNTER_UNIFIED_CACHE_HIT, 1);
         return TRUE;
     }
 
@@ -369,6 +394,7 @@ UBool UnifiedCache::_poll(
     // Insert an inProgress place holder value.
     // Our caller will create the final value and update the hash table.
     _putNew(key, fNoValue, U_ZERO_ERROR, status);
+    utrace_addCounter(UTRACE_COUNTER_UNIFIED_CACHE_MISS, 1);
     return FALSE;
 }
 
@@ -436,6 +462,9 @@ void UnifiedCache::_fetch(
         UErrorCode &status) const {
     const CacheKeyBase *theKey = (const CacheKeyBase *) element->key.pointer;
     status = theKey->fCreationStatus;
+    if (fMinEvictionIdleTime > 0) {
+        theKey->fLastAccess = uprv_getUTCtime();
+    }
 
     // Since we have the cache lock, calling regular SharedObject add/removeRef
     // could cause us to deadlock on ourselves since they may need to lock
@@ -476,6 +505,11 @@ UBool UnifiedCache::_isEvictable(const UHashElement *element) const
     return (!theKey->fIsMaster || (theValue->softRefCount == 1 && theValue->noHardReferences()));
 }
 
+UBool UnifiedCache::_isRecentlyUsed(const UHashElement *element, UDate now) const {
+    const CacheKeyBase *theKey = (const CacheKeyBase *) element->key.pointer;
+    return (now - theKey->fLastAccess) < fMinEvictionIdleTime;
+}
+
 void UnifiedCache::removeSoftRef(const SharedObject *value) const {
     U_ASSERT(value->cachePtr == this);
     U_ASSERT(value->softRefCount > 0);
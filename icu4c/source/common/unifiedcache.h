@@ -34,13 +34,14 @@ class UnifiedCache;
  */
 class U_COMMON_API CacheKeyBase : public UObject {
  public:
-   CacheKeyBase() : fCreationStatus(U_ZERO_ERROR), fIsMaster(FALSE) {}
+   CacheKeyBase() : fCreationStatus(U_ZERO_ERROR), fIsMaster(FALSE), fLastAccess(0) {}
 
    /**
     * Copy constructor. Needed to support cloning.
     */
-   CacheKeyBase(const CacheKeyBase &other) 
-           : UObject(other), fCreationStatus(other.fCreationStatus), fIsMaster(FALSE) { }
+   CacheKeyBase(const CacheKeyBase &other)
+           : UObject(other), fCreationStatus(other.fCreationStatus), fIsMaster(FALSE),
+             fLastAccess(0) { }
    virtual ~CacheKeyBase();
 
    /**
@@ -89,6 +90,10 @@ class U_COMMON_API CacheKeyBase : public UObject {
  private:
    mutable UErrorCode fCreationStatus;
    mutable UBool fIsMaster;
+   // Time this entry was last fetched from the cache; updated only when a
+   // minimum eviction idle time is configured. See
+   // UnifiedCache::setEvictionIdleTime().
+   mutable UDate fLastAccess;
    friend class UnifiedCache;
 };
 
@@ -327,6 +332,25 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
    void setEvictionPolicy(
            int32_t count, int32_t percentageOfInUseItems, UErrorCode &status);
 
+   /**
+    * Sets the minimum time, in milliseconds, that an entry must go unfetched
+    * before the auto evictor may remove it. This keeps a burst of lookups
+    * for new keys (e.g. one tenant's exotic locales) from pushing the
+    * still-hot entries of other clients out of the cache: recently fetched
+    * entries are skipped by eviction slices even when the cache is over its
+    * unused-entry limits.
+    *
+    * The default is 0, which preserves the historical behavior: any unused
+    * entry is eligible for eviction immediately, and no per-access
+    * timestamping is done. An explicit flush() ignores this setting.
+    *
+    * Like setEvictionPolicy, this method is thread-safe but designed to be
+    * called at application startup.
+    *
+    * If minIdleMillis is negative, sets status to U_ILLEGAL_ARGUMENT_ERROR.
+    */
+   void setEvictionIdleTime(int32_t minIdleMillis, UErrorCode &status);
+
 
    /**
     * Returns how many entries have been auto evicted during the lifetime
@@ -351,6 +375,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
    mutable int32_t fNumValuesInUse;
    int32_t fMaxUnused;
    int32_t fMaxPercentageOfInUse;
+   int32_t fMinEvictionIdleTime;
    mutable int64_t fAutoEvictedCount;
    SharedObject *fNoValue;
    
@@ -549,6 +574,14 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     * On entry, gCacheMutex must be held.
     */
    UBool _isEvictable(const UHashElement *element) const;
+
+   /**
+    * Determine if the given hash entry was fetched within the configured
+    * minimum eviction idle time. Only called when such a minimum is
+    * configured; see setEvictionIdleTime().
+    * On entry, gCacheMutex must be held; now is the current UTC time.
+    */
+   UBool _isRecentlyUsed(const UHashElement *element, UDate now) const;
 };
 
 U_NAMESPACE_END
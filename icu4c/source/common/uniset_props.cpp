@@ -43,6 +43,7 @@
 #include "mutex.h"
 #include "umutex.h"
 #include "uassert.h"
+#include "uhash.h"
 #include "hash.h"
 
 U_NAMESPACE_USE
@@ -95,6 +96,17 @@ static UBool U_CALLCONV uset_cleanup();
 static UnicodeSet *uni32Singleton;
 static icu::UInitOnce uni32InitOnce = U_INITONCE_INITIALIZER;
 
+/*
+ * Process-level cache of property sets, keyed by the loose-matching
+ * normalization of "property=value" (UnicodeString* -> UnicodeSet*).
+ * Rule-driven code tends to construct the same few dozen property sets
+ * over and over; a hit replaces resource and trie enumeration with a
+ * hash probe and a set copy. Guarded by gPropertySetCacheMutex,
+ * created on first insertion, emptied by uset_cleanup().
+ */
+static UHashtable *gPropertySetCache = NULL;
+static icu::UMutex gPropertySetCacheMutex = U_MUTEX_INITIALIZER;
+
 /**
  * Cleanup function for UnicodeSet
  */
@@ -102,6 +114,10 @@ static UBool U_CALLCONV uset_cleanup(void) {
     delete uni32Singleton;
     uni32Singleton = NULL;
     uni32InitOnce.reset();
+    if (gPropertySetCache != NULL) {
+        uhash_close(gPropertySetCache);
+        gPropertySetCache = NULL;
+    }
     return TRUE;
 }
 
@@ -130,6 +146,82 @@ uniset_getUnicode32Instance(UErrorCode &errorCode) {
     return uni32Singleton;
 }
 
+// Property set cache ------------------------------------------------------ ***
+
+// Keep the cache from growing without bound if an application keeps
+// constructing sets from many distinct property patterns.
+constexpr int32_t PROPERTY_SET_CACHE_LIMIT = 200;
+
+/**
+ * Appends the loose-matching normalization of a property or value name
+ * to the cache key: same folding as uprv_comparePropertyNames(), so
+ * "GC = Lu" and "gc=lu" share one cache entry.
+ */
+void appendLooseName(const UnicodeString &name, UnicodeString &key) {
+    for (int32_t i = 0; i < name.length(); ++i) {
+        UChar c = name.charAt(i);
+        if (c == 0x20 || c == 0x2D /*'-'*/ || c == 0x5F /*'_'*/ ||
+                c == 9 || c == 0xB || c == 0xC || c == 0xD || c == 0x85) {
+            continue;  // ignored by property name loose matching
+        }
+        if (0x41 <= c && c <= 0x5A) {
+            c += 0x20;  // ASCII lowercase
+        }
+        key.append(c);
+    }
+}
+
+/**
+ * Copies the cached set for the property pattern into dest, if present.
+ */
+UBool copyFromPropertySetCache(const UnicodeString &key, UnicodeSet &dest) {
+    UBool found = FALSE;
+    umtx_lock(&gPropertySetCacheMutex);
+    if (gPropertySetCache != NULL) {
+        const UnicodeSet *cached = (const UnicodeSet *)uhash_get(gPropertySetCache, &key);
+        if (cached != NULL) {
+            dest = *cached;
+            found = TRUE;
+        }
+    }
+    umtx_unlock(&gPropertySetCacheMutex);
+    return found;
+}
+
+/**
+ * Stores a copy of a successfully computed property set under the key.
+ * Failures just leave the cache unchanged; the set was computed anyway.
+ */
+void storeInPropertySetCache(const UnicodeString &key, const UnicodeSet &set) {
+    UErrorCode errorCode = U_ZERO_ERROR;
+    umtx_lock(&gPropertySetCacheMutex);
+    if (gPropertySetCache == NULL) {
+        gPropertySetCache = uhash_open(uhash_hashUnicodeString, uhash_compareUnicodeString,
+                                       NULL, &errorCode);
+        if (U_FAILURE(errorCode)) {
+            gPropertySetCache = NULL;
+        } else {
+            uhash_setKeyDeleter(gPropertySetCache, uprv_deleteUObject);
+            uhash_setValueDeleter(gPropertySetCache, uprv_deleteUObject);
+            ucln_common_registerCleanup(UCLN_COMMON_USET, uset_cleanup);
+        }
+    }
+    if (gPropertySetCache != NULL &&
+            uhash_count(gPropertySetCache) < PROPERTY_SET_CACHE_LIMIT &&
+            uhash_get(gPropertySetCache, &key) == NULL) {
+        UnicodeString *cacheKey = new UnicodeString(key);
+        UnicodeSet *cacheSet = (UnicodeSet *)set.clone();
+        if (cacheKey == NULL || cacheSet == NULL) {
+            delete cacheKey;
+            delete cacheSet;
+        } else {
+            // uhash_put() adopts key and value, and deletes them itself on failure
+            uhash_put(gPropertySetCache, cacheKey, cacheSet, &errorCode);
+        }
+    }
+    umtx_unlock(&gPropertySetCacheMutex);
+}
+
 // helper functions for matching of pattern syntax pieces ------------------ ***
 // these functions are parallel to the PERL_OPEN etc. strings above
 
@@ -1126,7 +1218,32 @@ UnicodeSet& UnicodeSet::applyPropertyPattern(const UnicodeString& pattern,
         }
     }
 
-    applyPropertyAlias(propName, valueName, ec);
+    if (isFrozen()) {
+        // applyPropertyAlias() is a no-op on a frozen set
+        applyPropertyAlias(propName, valueName, ec);
+    } else {
+        UnicodeString key;
+        appendLooseName(propName, key);
+        // Character name matching (UAX #44-LM2, u_charFromName()) keeps
+        // some medial hyphens significant, so the loose key would
+        // conflate e.g. \N{TIBETAN LETTER A} and \N{TIBETAN LETTER -A}.
+        // Leave name lookups uncached.
+        UBool cacheable =
+            key != UNICODE_STRING_SIMPLE("na") &&
+            key != UNICODE_STRING_SIMPLE("name") &&
+            key != UNICODE_STRING_SIMPLE("na1") &&
+            key != UNICODE_STRING_SIMPLE("unicode1name");
+        key.append(EQUALS);
+        appendLooseName(valueName, key);
+        if (!cacheable) {
+            applyPropertyAlias(propName, valueName, ec);
+        } else if (!copyFromPropertySetCache(key, *this)) {
+            applyPropertyAlias(propName, valueName, ec);
+            if (U_SUCCESS(ec) && !isBogus()) {
+                storeInPropertySetCache(key, *this);
+            }
+        }
+    }
 
     if (U_SUCCESS(ec)) {
         if (invert) {
@@ -140,6 +140,34 @@ UnicodeString::releaseArray() {
   }
 }
 
+char16_t *
+UnicodeString::stealBuffer(int32_t &length, int32_t &capacity) {
+  // Only a writable, unshared, ref-counted heap buffer can be handed off.
+  if((fUnion.fFields.fLengthAndFlags &
+          (kIsBogus|kUsingStackBuffer|kBufferIsReadonly|kOpenGetBuffer|kRefCounted)) != kRefCounted ||
+      refCount() != 1) {
+    return nullptr;
+  }
+  char16_t *array = getArrayStart();
+  length = this->length();
+  capacity = getCapacity();
+  if(length < capacity) {
+    array[length] = 0;
+  }
+  // Detach the array without releasing it, and reset to the empty string.
+  setToEmpty();
+  return array;
+}
+
+void
+UnicodeString::releaseStolenBuffer(char16_t *buffer) {
+  if(buffer != nullptr) {
+    // The reference counter precedes the characters in the allocation;
+    // see UnicodeString::allocate() and releaseArray().
+    uprv_free((int32_t *)buffer - 1);
+  }
+}
+
 
 
 //========================================
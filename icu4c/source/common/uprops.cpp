@@ -501,6 +501,39 @@ u_getIntPropertyValue(UChar32 c, UProperty which) {
     return 0;  // undefined
 }
 
+U_CAPI void U_EXPORT2
+u_getIntPropertyValues(UProperty which,
+                       const UChar32 *cps, int32_t length,
+                       int32_t *values,
+                       UErrorCode *pErrorCode) {
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return;
+    }
+    if(length<0 || (length>0 && (cps==NULL || values==NULL))) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if(which<UCHAR_INT_START || UCHAR_INT_LIMIT<=which) {
+        // Binary and mask properties: keep the per-code point dispatch.
+        for(int32_t i=0; i<length; ++i) {
+            values[i]=u_getIntPropertyValue(cps[i], which);
+        }
+        return;
+    }
+    // Resolve the property once for the whole array.
+    const IntProperty &prop=intProps[which-UCHAR_INT_START];
+    UChar32 prevCp=U_SENTINEL;
+    int32_t prevValue=0;
+    for(int32_t i=0; i<length; ++i) {
+        UChar32 c=cps[i];
+        if(c!=prevCp) {
+            prevValue=prop.getValue(prop, c, which);
+            prevCp=c;
+        }
+        values[i]=prevValue;
+    }
+}
+
 U_CAPI int32_t U_EXPORT2
 u_getIntPropertyMinValue(UProperty /*which*/) {
     return 0; /* all binary/enum/int properties have a minimum value of 0 */
@@ -519,6 +552,148 @@ u_getIntPropertyMaxValue(UProperty which) {
     return -1;  // undefined
 }
 
+/*
+ * Returns the index just past the extended grapheme cluster that starts at
+ * index i (i<length). Applies the UAX #29 rules directly to the
+ * Grapheme_Cluster_Break and Extended_Pictographic properties, producing
+ * the same segmentation as the character break iterator.
+ */
+static int32_t
+graphemeClusterLimit(const UChar *s, int32_t i, int32_t length) {
+    UChar32 c;
+    U16_NEXT(s, i, length, c);
+    int32_t gcb=u_getIntPropertyValue(c, UCHAR_GRAPHEME_CLUSTER_BREAK);
+    /* GB3, GB4: CR LF stays together; other controls combine with nothing. */
+    if(gcb==U_GCB_CR) {
+        if(i<length && s[i]==0xa) {
+            ++i;
+        }
+        return i;
+    }
+    if(gcb==U_GCB_CONTROL || gcb==U_GCB_LF) {
+        return i;
+    }
+    /* GB9b: consume Prepend* and restart from the first non-Prepend. */
+    while(gcb==U_GCB_PREPEND && i<length) {
+        int32_t next=i;
+        UChar32 c2;
+        U16_NEXT(s, next, length, c2);
+        int32_t gcb2=u_getIntPropertyValue(c2, UCHAR_GRAPHEME_CLUSTER_BREAK);
+        if(gcb2==U_GCB_CONTROL || gcb2==U_GCB_CR || gcb2==U_GCB_LF) {
+            return i;  /* GB5 takes precedence */
+        }
+        i=next;
+        c=c2;
+        gcb=gcb2;
+    }
+    /*
+     * extPictChain: the text consumed so far ends with
+     * Extended_Pictographic Extend* (the left context of GB11).
+     * zwjLinked: the last consumed character is a ZWJ that was preceded
+     * by such a chain.
+     * riPairOpen: the cluster is a Regional_Indicator whose pair partner
+     * has not been consumed yet (GB12/GB13).
+     */
+    UBool extPictChain=u_hasBinaryProperty(c, UCHAR_EXTENDED_PICTOGRAPHIC);
+    UBool zwjLinked=FALSE;
+    UBool riPairOpen=(UBool)(gcb==U_GCB_REGIONAL_INDICATOR);
+    int32_t prevGcb=gcb;
+    while(i<length) {
+        int32_t next=i;
+        UChar32 c2;
+        U16_NEXT(s, next, length, c2);
+        int32_t gcb2=u_getIntPropertyValue(c2, UCHAR_GRAPHEME_CLUSTER_BREAK);
+        if(gcb2==U_GCB_EXTEND || gcb2==U_GCB_ZWJ || gcb2==U_GCB_SPACING_MARK) {
+            /* GB9, GB9a */
+        } else if(prevGcb==U_GCB_L &&
+                  (gcb2==U_GCB_L || gcb2==U_GCB_V || gcb2==U_GCB_LV || gcb2==U_GCB_LVT)) {
+            /* GB6 */
+        } else if((prevGcb==U_GCB_LV || prevGcb==U_GCB_V) &&
+                  (gcb2==U_GCB_V || gcb2==U_GCB_T)) {
+            /* GB7 */
+        } else if((prevGcb==U_GCB_LVT || prevGcb==U_GCB_T) && gcb2==U_GCB_T) {
+            /* GB8 */
+        } else if(zwjLinked && u_hasBinaryProperty(c2, UCHAR_EXTENDED_PICTOGRAPHIC)) {
+            /* GB11 */
+        } else if(riPairOpen && gcb2==U_GCB_REGIONAL_INDICATOR) {
+            riPairOpen=FALSE;  /* GB12, GB13 */
+        } else {
+            break;
+        }
+        zwjLinked=(UBool)(gcb2==U_GCB_ZWJ && extPictChain);
+        if(u_hasBinaryProperty(c2, UCHAR_EXTENDED_PICTOGRAPHIC)) {
+            extPictChain=TRUE;
+        } else if(!(gcb2==U_GCB_EXTEND && extPictChain)) {
+            extPictChain=FALSE;
+        }
+        i=next;
+        prevGcb=gcb2;
+    }
+    return i;
+}
+
+U_CAPI int32_t U_EXPORT2
+u_countGraphemes(const UChar *s, int32_t length, UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if(length<-1 || (s==NULL && length!=0)) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if(length==-1) {
+        length=u_strlen(s);
+    }
+    int32_t count=0;
+    int32_t i=0;
+    while(i<length) {
+        /*
+         * ASCII shortcut: an ASCII character followed by another ASCII
+         * character is always a complete cluster, except for CR LF.
+         * (A non-ASCII successor could be a combining mark.)
+         */
+        while((i+1)<length && s[i]<0x80 && s[i+1]<0x80 &&
+              !(s[i]==0xd && s[i+1]==0xa)) {
+            ++i;
+            ++count;
+        }
+        if(i<length) {
+            i=graphemeClusterLimit(s, i, length);
+            ++count;
+        }
+    }
+    return count;
+}
+
+U_CAPI int32_t U_EXPORT2
+u_graphemeOffset(const UChar *s, int32_t length, int32_t graphemeIndex,
+                 UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if(length<-1 || (s==NULL && length!=0) || graphemeIndex<0) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if(length==-1) {
+        length=u_strlen(s);
+    }
+    int32_t i=0;
+    while(graphemeIndex>0 && i<length) {
+        /* Same ASCII shortcut as in u_countGraphemes(). */
+        while(graphemeIndex>0 && (i+1)<length && s[i]<0x80 && s[i+1]<0x80 &&
+              !(s[i]==0xd && s[i+1]==0xa)) {
+            ++i;
+            --graphemeIndex;
+        }
+        if(graphemeIndex>0 && i<length) {
+            i=graphemeClusterLimit(s, i, length);
+            --graphemeIndex;
+        }
+    }
+    return i;
+}
+
 U_CFUNC UPropertySource U_EXPORT2
 uprops_getSource(UProperty which) {
     if(which<UCHAR_BINARY_START) {
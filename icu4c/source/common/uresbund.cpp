@@ -38,6 +38,7 @@
 #include "umutex.h"
 #include "putilimp.h"
 #include "uassert.h"
+#include "unicode/utrace.h"
 
 using namespace icu;
 
@@ -74,8 +75,63 @@ static UBool U_CALLCONV compareEntries(const UHashTok p1, const UHashTok p2) {
 }
 
 
+/*
+ * Cache of fully resolved fallback chains, keyed by the original
+ * (path, locale ID, open type) triple of an entryOpen() call. A hit turns
+ * a repeat open into one hash probe plus reference count increments,
+ * instead of re-deriving and probing every parent locale name. The cache
+ * holds one reference to each chain (through its head entry);
+ * ures_flushCache() drops the whole chain cache before reclaiming unused
+ * data entries, so the chains never pin entries across an explicit flush.
+ */
+typedef struct UResChainCacheEntry {
+    char *fName;       /* original, un-chopped locale ID */
+    char *fPath;       /* may be NULL, like UResourceDataEntry::fPath */
+    int32_t fOpenType; /* UResOpenType */
+    /* default locale at resolve time; the chain of a
+       URES_OPEN_LOCALE_DEFAULT_ROOT open may depend on it */
+    char fDefaultLocale[ULOC_FULLNAME_CAPACITY];
+    UResourceDataEntry *fResult;
+    UErrorCode fWarning; /* fallback/default warning to report on a hit */
+} UResChainCacheEntry;
+
+static UHashtable *gChainCache = NULL;
+
+/* INTERNAL: hashes a chain cache entry */
+static int32_t U_CALLCONV hashChainEntry(const UHashTok parm) {
+    UResChainCacheEntry *b = (UResChainCacheEntry *)parm.pointer;
+    UHashTok namekey, pathkey;
+    namekey.pointer = b->fName;
+    pathkey.pointer = b->fPath;
+    return uhash_hashChars(namekey)+37u*uhash_hashChars(pathkey)+b->fOpenType;
+}
+
+/* INTERNAL: compares two chain cache entries */
+static UBool U_CALLCONV compareChainEntries(const UHashTok p1, const UHashTok p2) {
+    UResChainCacheEntry *b1 = (UResChainCacheEntry *)p1.pointer;
+    UResChainCacheEntry *b2 = (UResChainCacheEntry *)p2.pointer;
+    UHashTok name1, name2, path1, path2;
+    name1.pointer = b1->fName;
+    name2.pointer = b2->fName;
+    path1.pointer = b1->fPath;
+    path2.pointer = b2->fPath;
+    return (UBool)(b1->fOpenType == b2->fOpenType &&
+        uhash_compareChars(name1, name2) &&
+        uhash_compareChars(path1, path2));
+}
+
+static void freeChainEntry(UResChainCacheEntry *e) {
+    if(e->fName != NULL) {
+        uprv_free(e->fName);
+    }
+    if(e->fPath != NULL) {
+        uprv_free(e->fPath);
+    }
+    uprv_free(e);
+}
+
 /**
- *  Internal function, gets parts of locale name according 
+ *  Internal function, gets parts of locale name according
  *  to the position of '_' character
  */
 static UBool chopLocale(char *name) {
@@ -90,16 +146,106 @@ static UBool chopLocale(char *name) {
 }
 
 /**
- *  Internal function
+ *  Internal function. The caller must already hold a reference to the
+ *  entry (and therefore to its whole parent chain), which keeps the chain
+ *  alive, so the counts can be bumped without taking resbMutex.
  */
 static void entryIncrease(UResourceDataEntry *entry) {
-    umtx_lock(&resbMutex);
-    entry->fCountExisting++;
+    umtx_atomic_inc(&entry->fCountExisting);
     while(entry->fParent != NULL) {
       entry = entry->fParent;
-      entry->fCountExisting++;
+      umtx_atomic_inc(&entry->fCountExisting);
+    }
+}
+
+static void entryCloseInt(UResourceDataEntry *resB);
+
+/**
+ * INTERNAL: probes the chain cache for a previously resolved fallback
+ * chain. A stale entry (the default locale changed since it was resolved)
+ * is dropped so the caller re-resolves.
+ *   CAUTION: resbMutex must be locked when calling this function.
+ */
+static UResourceDataEntry *chainCacheGet(const char *path, const char *name,
+                                         int32_t openType, UErrorCode *warning) {
+    UResChainCacheEntry find;
+    UResChainCacheEntry *res;
+
+    if(gChainCache == NULL) {
+        return NULL;
+    }
+    find.fName = (char *)name;
+    find.fPath = (char *)path;
+    find.fOpenType = openType;
+    res = (UResChainCacheEntry *)uhash_get(gChainCache, &find);
+    if(res == NULL) {
+        return NULL;
+    }
+    if(uprv_strcmp(res->fDefaultLocale, uloc_getDefault()) != 0) {
+        uhash_remove(gChainCache, res);
+        entryCloseInt(res->fResult);
+        freeChainEntry(res);
+        return NULL;
+    }
+    *warning = res->fWarning;
+    return res->fResult;
+}
+
+/**
+ * INTERNAL: records a resolved fallback chain; failure to cache is not an
+ * error, the next open simply resolves again.
+ *   CAUTION: resbMutex must be locked when calling this function.
+ */
+static void chainCachePut(const char *path, const char *name, int32_t openType,
+                          UResourceDataEntry *result, UErrorCode warning) {
+    UResChainCacheEntry *e;
+    UErrorCode cacheStatus = U_ZERO_ERROR;
+    const char *defaultLoc = uloc_getDefault();
+
+    if(gChainCache == NULL || uprv_strlen(defaultLoc) >= ULOC_FULLNAME_CAPACITY) {
+        return;
+    }
+    e = (UResChainCacheEntry *)uprv_malloc(sizeof(UResChainCacheEntry));
+    if(e == NULL) {
+        return;
+    }
+    uprv_memset(e, 0, sizeof(UResChainCacheEntry));
+    e->fName = uprv_strdup(name);
+    e->fPath = (path == NULL) ? NULL : uprv_strdup(path);
+    e->fOpenType = openType;
+    e->fResult = result;
+    e->fWarning = warning;
+    uprv_strcpy(e->fDefaultLocale, defaultLoc);
+    if(e->fName == NULL || (path != NULL && e->fPath == NULL)) {
+        freeChainEntry(e);
+        return;
+    }
+    uhash_put(gChainCache, e, e, &cacheStatus);
+    if(U_FAILURE(cacheStatus)) {
+        freeChainEntry(e);
+        return;
+    }
+    /* the cache holds its own reference to the whole chain */
+    entryIncrease(result);
+}
+
+/**
+ * INTERNAL: releases every chain cache entry and its chain reference.
+ *   CAUTION: resbMutex must be locked when calling this function.
+ */
+static void chainCacheFlush(void) {
+    const UHashElement *e;
+    int32_t pos = UHASH_FIRST;
+
+    if(gChainCache == NULL) {
+        return;
+    }
+    while ((e = uhash_nextElement(gChainCache, &pos)) != NULL) {
+        UResChainCacheEntry *ce = (UResChainCacheEntry *)e->value.pointer;
+        uhash_removeElement(gChainCache, e);
+        entryCloseInt(ce->fResult);
+        freeChainEntry(ce);
     }
-    umtx_unlock(&resbMutex);
 }
 
 /**
@@ -187,6 +333,10 @@ static int32_t ures_flushCache()
         return 0;
     }
 
+    /* Release the resolved-chain cache first so its references do not pin
+       otherwise unused entries. */
+    chainCacheFlush();
+
     do {
         deletedMore = FALSE;
         /*creates an enumeration to iterate through every element in the table */
@@ -241,7 +391,7 @@ U_CAPI UBool U_EXPORT2 ures_dumpCacheContents(void) {
       resB = (UResourceDataEntry *) e->value.pointer;
       fprintf(stderr,"%s:%d: RB Cache: Entry @0x%p, refcount %d, name %s:%s.  Pool 0x%p, alias 0x%p, parent 0x%p\n",
               __FILE__, __LINE__,
-              (void*)resB, resB->fCountExisting,
+              (void*)resB, (int32_t)resB->fCountExisting,
               resB->fName?resB->fName:"NULL",
               resB->fPath?resB->fPath:"NULL",
               (void*)resB->fPool,
@@ -265,6 +415,10 @@ static UBool U_CALLCONV ures_cleanup(void)
         uhash_close(cache);
         cache = NULL;
     }
+    if (gChainCache != NULL) {
+        uhash_close(gChainCache);
+        gChainCache = NULL;
+    }
     gCacheInitOnce.reset();
     return TRUE;
 }
@@ -273,6 +427,15 @@ static UBool U_CALLCONV ures_cleanup(void)
 static void U_CALLCONV createCache(UErrorCode &status) {
     U_ASSERT(cache == NULL);
     cache = uhash_open(hashEntry, compareEntries, NULL, &status);
+    /* The chain cache is an optimization; if it cannot be created the
+       open path just resolves every time. */
+    if (U_SUCCESS(status)) {
+        UErrorCode chainStatus = U_ZERO_ERROR;
+        gChainCache = uhash_open(hashChainEntry, compareChainEntries, NULL, &chainStatus);
+        if (U_FAILURE(chainStatus)) {
+            gChainCache = NULL;
+        }
+    }
     ucln_common_registerCleanup(UCLN_COMMON_URES, ures_cleanup);
 }
      
@@ -347,7 +510,17 @@ static UResourceDataEntry *init_entry(const char *localeID, const char *path, UE
             return NULL;
         }
 
-        uprv_memset(r, 0, sizeof(UResourceDataEntry));
+        /* fCountExisting is atomic; initialize the members individually
+           instead of memset-ing the non-trivially-copyable entry. */
+        r->fName = NULL;
+        r->fPath = NULL;
+        r->fParent = NULL;
+        r->fAlias = NULL;
+        r->fPool = NULL;
+        uprv_memset(&r->fData, 0, sizeof(ResourceData));
+        r->fNameBuffer[0] = 0;
+        r->fCountExisting = 0;
+        r->fBogus = U_ZERO_ERROR;
         /*r->fHashKey = hashValue;*/
 
         setEntryName(r, name, status);
@@ -648,6 +821,20 @@ static UResourceDataEntry *entryOpen(const char* path, const char* localeID,
     uprv_strncpy(name, localeID, sizeof(name) - 1);
     name[sizeof(name) - 1] = 0;
 
+    /* Fast path: if this exact open was resolved before, reuse the cached
+       chain; only the reference counts need updating. */
+    umtx_lock(&resbMutex);
+    r = chainCacheGet(path, localeID, (int32_t)openType, &intStatus);
+    umtx_unlock(&resbMutex);
+    if(r != NULL) {
+        entryIncrease(r);
+        if(intStatus != U_ZERO_ERROR) {
+            *status = intStatus;
+        }
+        return r;
+    }
+    intStatus = U_ZERO_ERROR;
+
     if ( usingUSRData ) {
         if ( path == NULL ) {
             uprv_strcpy(usrDataPath, U_USRDATA_NAME);
@@ -757,6 +944,10 @@ static UResourceDataEntry *entryOpen(const char* path, const char* localeID,
             t1->fParent->fCountExisting++;
             t1 = t1->fParent;
         }
+
+        if(r != NULL && U_SUCCESS(*status)) {
+            chainCachePut(path, localeID, (int32_t)openType, r, intStatus);
+        }
     } /* umtx_lock */
 finishUnlock:
     umtx_unlock(&resbMutex);
@@ -828,15 +1019,19 @@ entryOpenDirect(const char* path, const char* localeID, UErrorCode* status) {
 
 /**
  * Functions to create and destroy resource bundles.
- *     CAUTION:  resbMutex must be locked when calling this function.
+ *     The reference counts are atomic, so no lock is needed: the caller's
+ *     reference keeps the chain alive, and entries whose count drops to
+ *     zero are only reclaimed later by ures_flushCache() under resbMutex.
  */
 /* INTERNAL: */
 static void entryCloseInt(UResourceDataEntry *resB) {
     UResourceDataEntry *p = resB;
 
     while(resB != NULL) {
+        /* Read the parent link before giving up our reference; afterwards
+           the entry may be reclaimed by a concurrent ures_flushCache(). */
         p = resB->fParent;
-        resB->fCountExisting--;
+        umtx_atomic_dec(&resB->fCountExisting);
 
         /* Entries are left in the cache. TODO: add ures_flushCache() to force a flush
          of the cache. */
@@ -865,9 +1060,7 @@ static void entryCloseInt(UResourceDataEntry *resB) {
  */
 
 static void entryClose(UResourceDataEntry *resB) {
-  umtx_lock(&resbMutex);
   entryCloseInt(resB);
-  umtx_unlock(&resbMutex);
 }
 
 /*
@@ -2245,6 +2438,8 @@ ures_openWithType(UResourceBundle *r, const char* path, const char* localeID,
         return NULL;
     }
 
+    utrace_addCounter(UTRACE_COUNTER_RES_BUNDLE_OPEN, 1);
+
     UResourceDataEntry *entry;
     if(openType != URES_OPEN_DIRECT) {
         /* first "canonicalize" the locale ID */
@@ -2491,7 +2686,8 @@ static const UEnumeration gLocalesEnum = {
         ures_loc_countLocales,
         uenum_unextDefault,
         ures_loc_nextLocale,
-        ures_loc_resetLocales
+        ures_loc_resetLocales,
+        NULL  /* drain */
 };
 
 
@@ -835,6 +835,48 @@ UBool icu::ResourceTable::getKeyAndValue(int32_t i,
     return FALSE;
 }
 
+int32_t icu::ResourceTable::getKeysAndStrings(const icu::ResourceValue &value,
+                                              const char **keys,
+                                              icu::UnicodeString *dest, int32_t capacity,
+                                              UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) {
+        return 0;
+    }
+    if(dest == NULL ? capacity != 0 : capacity < 0) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if(length > capacity) {
+        errorCode = U_BUFFER_OVERFLOW_ERROR;
+        return length;
+    }
+    const ResourceData *pResData =
+            static_cast<const icu::ResourceDataValue &>(value).pResData;
+    for(int32_t i = 0; i < length; ++i) {
+        Resource res;
+        if (items16 != NULL) {
+            res = makeResourceFrom16(pResData, items16[i]);
+        } else {
+            res = items32[i];
+        }
+        int32_t sLength;
+        const UChar *s = res_getString(pResData, res, &sLength);
+        if(s == NULL) {
+            errorCode = U_RESOURCE_TYPE_MISMATCH;
+            return 0;
+        }
+        dest[i].setTo(TRUE, s, sLength);
+        if(keys != NULL) {
+            if (keys16 != NULL) {
+                keys[i] = RES_GET_KEY16(pResData, keys16[i]);
+            } else {
+                keys[i] = RES_GET_KEY32(pResData, keys32[i]);
+            }
+        }
+    }
+    return length;
+}
+
 U_CAPI Resource U_EXPORT2
 res_getArrayItem(const ResourceData *pResData, Resource array, int32_t indexR) {
     uint32_t offset=RES_GET_OFFSET(array);
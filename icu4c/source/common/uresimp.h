@@ -15,6 +15,10 @@
 
 #include "uresdata.h"
 
+#ifdef __cplusplus
+#include "umutex.h"
+#endif
+
 #define kRootLocaleName         "root"
 #define kPoolBundleName         "pool"
 
@@ -52,7 +56,15 @@ struct UResourceDataEntry {
     UResourceDataEntry *fPool;
     ResourceData fData; /* data for low level access */
     char fNameBuffer[3]; /* A small buffer of free space for fName. The free space is due to struct padding. */
-    uint32_t fCountExisting; /* how much is this resource used */
+#ifdef __cplusplus
+    /* Atomic so that reference count updates on already-loaded entries
+       (entryIncrease()/entryClose() in uresbund.cpp) need not take the
+       global resbMutex. Only uresbund.cpp touches this field; the C view
+       below only keeps the struct layout identical for C includers. */
+    icu::u_atomic_int32_t fCountExisting; /* how much is this resource used */
+#else
+    int32_t fCountExisting; /* how much is this resource used */
+#endif
     UErrorCode fBogus;
     /* int32_t fHashKey;*/ /* for faster access in the hashtable */
 };
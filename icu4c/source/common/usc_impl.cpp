@@ -15,12 +15,17 @@
 ******************************************************************************
 */
 
+#include "unicode/uchar.h"
 #include "unicode/uscript.h"
+#include "unicode/utf16.h"
 #include "usc_impl.h"
 #include "cmemory.h"
 
 #define PAREN_STACK_DEPTH 32
 
+/* number of code points classified per batched script property lookup */
+#define SCRIPT_BATCH 32
+
 #define MOD(sp) ((sp) % PAREN_STACK_DEPTH)
 #define LIMIT_INC(sp) (((sp) < PAREN_STACK_DEPTH)? (sp) + 1 : PAREN_STACK_DEPTH)
 #define INC(sp,count) (MOD((sp) + (count)))
@@ -188,6 +193,28 @@ sameScript(UScriptCode scriptOne, UScriptCode scriptTwo)
     return scriptOne <= USCRIPT_INHERITED || scriptTwo <= USCRIPT_INHERITED || scriptOne == scriptTwo;
 }
 
+/*
+ * Cheap over-approximate test for membership in pairedChars[]: returns
+ * FALSE only for characters that are certainly not paired punctuation,
+ * so that the binary search in getPairIndex() can be skipped for the
+ * vast majority of characters.
+ */
+static UBool
+maybePairedChar(UChar32 ch)
+{
+    if (ch < 0x28 || ch > 0x301b) {
+        return FALSE;
+    }
+    if (ch <= 0x7d) {
+        return ch == 0x28 || ch == 0x29 || ch == 0x3c || ch == 0x3e ||
+               ch == 0x5b || ch == 0x5d || ch == 0x7b || ch == 0x7d;
+    }
+    if (ch < 0x2018) {
+        return ch == 0xab || ch == 0xbb;
+    }
+    return ch <= 0x203a || ch >= 0x3008;
+}
+
 U_CAPI UScriptRun * U_EXPORT2
 uscript_openRun(const UChar *src, int32_t length, UErrorCode *pErrorCode)
 {
@@ -291,7 +318,7 @@ uscript_nextRun(UScriptRun *scriptRun, int32_t *pRunStart, int32_t *pRunLimit, U
         }
 
         sc = uscript_getScript(ch, &error);
-        pairIndex = getPairIndex(ch);
+        pairIndex = maybePairedChar(ch) ? getPairIndex(ch) : -1;
 
         /*
          * Paired character handling:
@@ -331,6 +358,59 @@ uscript_nextRun(UScriptRun *scriptRun, int32_t *pRunStart, int32_t *pRunLimit, U
             if (pairIndex >= 0 && (pairIndex & 1) != 0) {
                 pop(scriptRun);
             }
+
+            /*
+             * Fast forward: once the run's script is strong, consume
+             * directly following characters that cannot change the
+             * iterator state - same or Common/Inherited script and no
+             * paired punctuation - classifying them in blocks with one
+             * batched property lookup instead of one dispatch per
+             * character. Runs are typically long, so this is the bulk
+             * of the text.
+             */
+            if (scriptRun->scriptCode > USCRIPT_INHERITED) {
+                const UChar *text = scriptRun->textArray;
+                int32_t textLimit = scriptRun->textLength;
+                int32_t idx = scriptRun->scriptLimit + 1;
+                UBool stopped = FALSE;
+
+                while (idx < textLimit && !stopped) {
+                    UChar32 cps[SCRIPT_BATCH];
+                    int32_t nexts[SCRIPT_BATCH];
+                    int32_t scripts[SCRIPT_BATCH];
+                    int32_t n = 0, j = idx, k;
+
+                    while (j < textLimit && n < SCRIPT_BATCH) {
+                        UChar32 c;
+                        U16_NEXT(text, j, textLimit, c);
+                        if (maybePairedChar(c)) {
+                            stopped = TRUE;
+                            break;
+                        }
+                        cps[n] = c;
+                        nexts[n] = j;
+                        n += 1;
+                    }
+                    if (n == 0) {
+                        break;
+                    }
+                    u_getIntPropertyValues(UCHAR_SCRIPT, cps, n, scripts, &error);
+                    if (U_FAILURE(error)) {
+                        error = U_ZERO_ERROR;
+                        break;
+                    }
+                    for (k = 0; k < n; k += 1) {
+                        UScriptCode s = (UScriptCode) scripts[k];
+                        if (s != scriptRun->scriptCode && s > USCRIPT_INHERITED) {
+                            stopped = TRUE;
+                            break;
+                        }
+                        idx = nexts[k];
+                    }
+                }
+                /* the loop increment then moves to the first unconsumed unit */
+                scriptRun->scriptLimit = idx - 1;
+            }
         } else {
             /*
              * if the run broke on a surrogate pair,
@@ -69,6 +69,10 @@
 #define OLD_TAIL_CHAR      0x200B
 #define LAM_CHAR           0x0644
 #define SPACE_CHAR         0x0020
+/* stack buffer size for the internal scratch copies; strings shorter
+   than this shape without any heap allocation */
+#define USHAPE_LOCAL_BUFFER_SIZE 300
+
 #define SHADDA_CHAR        0xFE7C
 #define TATWEEL_CHAR       0x0640
 #define SHADDA_TATWEEL_CHAR  0xFE7D
@@ -732,6 +736,7 @@ handleGeneratedSpaces(UChar *dest, int32_t sourceLength,
 
     int32_t i = 0, j = 0;
     int32_t count = 0;
+    UChar stackbuffer[USHAPE_LOCAL_BUFFER_SIZE];
     UChar *tempbuffer=NULL;
 
     int lamAlefOption = 0;
@@ -747,11 +752,15 @@ handleGeneratedSpaces(UChar *dest, int32_t sourceLength,
         }
     }
 
-    tempbuffer = (UChar *)uprv_malloc((sourceLength+1)*U_SIZEOF_UCHAR);
-    /* Test for NULL */
-    if(tempbuffer == NULL) {
-        *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
-        return 0;
+    if(sourceLength < USHAPE_LOCAL_BUFFER_SIZE) {
+        tempbuffer = stackbuffer;
+    } else {
+        tempbuffer = (UChar *)uprv_malloc((sourceLength+1)*U_SIZEOF_UCHAR);
+        /* Test for NULL */
+        if(tempbuffer == NULL) {
+            *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+            return 0;
+        }
     }
 
 
@@ -882,7 +891,7 @@ handleGeneratedSpaces(UChar *dest, int32_t sourceLength,
     }
 
 
-    if(tempbuffer){
+    if(tempbuffer != stackbuffer){
         uprv_free(tempbuffer);
     }
 
@@ -903,14 +912,19 @@ static int32_t
 expandCompositCharAtBegin(UChar *dest, int32_t sourceLength, int32_t destSize,UErrorCode *pErrorCode) {
     int32_t      i = 0,j = 0;
     int32_t      countl = 0;
+    UChar    stackbuffer[USHAPE_LOCAL_BUFFER_SIZE];
     UChar    *tempbuffer=NULL;
 
-    tempbuffer = (UChar *)uprv_malloc((sourceLength+1)*U_SIZEOF_UCHAR);
+    if(sourceLength < USHAPE_LOCAL_BUFFER_SIZE) {
+        tempbuffer = stackbuffer;
+    } else {
+        tempbuffer = (UChar *)uprv_malloc((sourceLength+1)*U_SIZEOF_UCHAR);
 
-    /* Test for NULL */
-    if(tempbuffer == NULL) {
-        *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
-        return 0;
+        /* Test for NULL */
+        if(tempbuffer == NULL) {
+            *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+            return 0;
+        }
     }
 
         uprv_memset(tempbuffer, 0, (sourceLength+1)*U_SIZEOF_UCHAR);
@@ -943,7 +957,9 @@ expandCompositCharAtBegin(UChar *dest, int32_t sourceLength, int32_t destSize,UE
         }
         u_memcpy(dest, tempbuffer, sourceLength);
 
-        uprv_free(tempbuffer);
+        if(tempbuffer != stackbuffer) {
+            uprv_free(tempbuffer);
+        }
 
         destSize = sourceLength;
         return destSize;
@@ -966,13 +982,18 @@ expandCompositCharAtEnd(UChar *dest, int32_t sourceLength, int32_t destSize,UErr
     int32_t      countr = 0;
     int32_t  inpsize = sourceLength;
 
+    UChar    stackbuffer[USHAPE_LOCAL_BUFFER_SIZE];
     UChar    *tempbuffer=NULL;
-    tempbuffer = (UChar *)uprv_malloc((sourceLength+1)*U_SIZEOF_UCHAR);
+    if(sourceLength < USHAPE_LOCAL_BUFFER_SIZE) {
+        tempbuffer = stackbuffer;
+    } else {
+        tempbuffer = (UChar *)uprv_malloc((sourceLength+1)*U_SIZEOF_UCHAR);
 
-    /* Test for NULL */
-    if(tempbuffer == NULL) {
-        *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
-         return 0;
+        /* Test for NULL */
+        if(tempbuffer == NULL) {
+            *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+            return 0;
+        }
     }
 
     uprv_memset(tempbuffer, 0, (sourceLength+1)*U_SIZEOF_UCHAR);
@@ -1011,7 +1032,9 @@ expandCompositCharAtEnd(UChar *dest, int32_t sourceLength, int32_t destSize,UErr
     }
     u_memcpy(dest, tempbuffer, sourceLength);
 
-    uprv_free(tempbuffer);
+    if(tempbuffer != stackbuffer) {
+        uprv_free(tempbuffer);
+    }
 
     destSize = sourceLength;
     return destSize;
@@ -1086,6 +1109,7 @@ expandCompositChar(UChar *dest, int32_t sourceLength,
 
     int32_t      i = 0,j = 0;
 
+    UChar    stackbuffer[USHAPE_LOCAL_BUFFER_SIZE];
     UChar    *tempbuffer=NULL;
     int yehHamzaOption = 0;
     int seenTailOption = 0;
@@ -1154,12 +1178,16 @@ expandCompositChar(UChar *dest, int32_t sourceLength,
     if (shapingMode == 1){
         if ( (options&U_SHAPE_LAMALEF_MASK) == U_SHAPE_LAMALEF_RESIZE){
             destSize = calculateSize(dest,sourceLength,destSize,options);
-            tempbuffer = (UChar *)uprv_malloc((destSize+1)*U_SIZEOF_UCHAR);
+            if(destSize < USHAPE_LOCAL_BUFFER_SIZE) {
+                tempbuffer = stackbuffer;
+            } else {
+                tempbuffer = (UChar *)uprv_malloc((destSize+1)*U_SIZEOF_UCHAR);
 
-            /* Test for NULL */
-            if(tempbuffer == NULL) {
-                *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
-                return 0;
+                /* Test for NULL */
+                if(tempbuffer == NULL) {
+                    *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+                    return 0;
+                }
             }
 
             uprv_memset(tempbuffer, 0, (destSize+1)*U_SIZEOF_UCHAR);
@@ -1181,7 +1209,7 @@ expandCompositChar(UChar *dest, int32_t sourceLength,
         }
     }
 
-    if(tempbuffer) {
+    if(tempbuffer != NULL && tempbuffer != stackbuffer) {
         uprv_free(tempbuffer);
     }
     return destSize;
@@ -1494,6 +1522,7 @@ u_shapeArabic(const UChar *source, int32_t sourceLength,
 
     if((options&U_SHAPE_LETTERS_MASK)!=U_SHAPE_LETTERS_NOOP) {
         UChar buffer[300];
+        UChar sourcebuffer[USHAPE_LOCAL_BUFFER_SIZE];
         UChar *tempbuffer, *tempsource = NULL;
         int32_t outputSize, spacesCountl=0, spacesCountr=0;
 
@@ -1510,10 +1539,14 @@ u_shapeArabic(const UChar *source, int32_t sourceLength,
             UChar prev = 0;
             UChar prevLink, currLink = 0;
             int newSourceLength = 0;
-            tempsource = (UChar *)uprv_malloc(2*sourceLength*U_SIZEOF_UCHAR);
-            if(tempsource == NULL) {
-                *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
-                return 0;
+            if(2*sourceLength <= UPRV_LENGTHOF(sourcebuffer)) {
+                tempsource = sourcebuffer;
+            } else {
+                tempsource = (UChar *)uprv_malloc(2*sourceLength*U_SIZEOF_UCHAR);
+                if(tempsource == NULL) {
+                    *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+                    return 0;
+                }
             }
 
             while ((i+=step) != end) {
@@ -1545,7 +1578,7 @@ u_shapeArabic(const UChar *source, int32_t sourceLength,
 
         if(outputSize>destCapacity) {
             *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
-                if (tempsource != NULL) uprv_free(tempsource);
+                if (tempsource != NULL && tempsource != sourcebuffer) uprv_free(tempsource);
             return outputSize;
         }
 
@@ -1567,12 +1600,12 @@ u_shapeArabic(const UChar *source, int32_t sourceLength,
             /*Test for NULL*/
             if(tempbuffer == NULL) {
                 *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
-                if (tempsource != NULL) uprv_free(tempsource);
+                if (tempsource != NULL && tempsource != sourcebuffer) uprv_free(tempsource);
                 return 0;
             }
         }
         u_memcpy(tempbuffer, source, sourceLength);
-        if (tempsource != NULL){
+        if (tempsource != NULL && tempsource != sourcebuffer){
             uprv_free(tempsource);
         }
 
@@ -73,6 +73,14 @@ static const char * const PROFILE_NAMES[] = {
     "rfc4518ci",    /* USPREP_RFC4518_LDAP_CI */
 };
 
+/*
+Shared ("frozen") profiles returned by usprep_getFrozenByType().
+Each one holds a reference until usprep_cleanup() so that repeated
+lookups need only the UInitOnce fast path, not the cache mutex.
+*/
+static UStringPrepProfile *gFrozenProfiles[UPRV_LENGTHOF(PROFILE_NAMES)] = { NULL };
+static icu::UInitOnce gFrozenProfileInitOnce[UPRV_LENGTHOF(PROFILE_NAMES)] = {};
+
 static UBool U_CALLCONV
 isSPrepAcceptable(void * /* context */,
              const char * /* type */, 
@@ -194,6 +202,14 @@ usprep_flushCache(){
 */
 
 static UBool U_CALLCONV usprep_cleanup(void){
+    int32_t i;
+    for(i = 0; i < UPRV_LENGTHOF(gFrozenProfiles); i++) {
+        if (gFrozenProfiles[i] != NULL) {
+            usprep_close(gFrozenProfiles[i]);
+            gFrozenProfiles[i] = NULL;
+        }
+        gFrozenProfileInitOnce[i].reset();
+    }
     if (SHARED_DATA_HASHTABLE != NULL) {
         usprep_internal_flushCache(TRUE);
         if (SHARED_DATA_HASHTABLE != NULL && uhash_count(SHARED_DATA_HASHTABLE) == 0) {
@@ -416,6 +432,27 @@ usprep_openByType(UStringPrepProfileType type,
     return usprep_open(NULL, PROFILE_NAMES[index], status);
 }
 
+static void U_CALLCONV
+initFrozenProfile(int32_t index, UErrorCode &status) {
+    /* The reference acquired here is released in usprep_cleanup(). */
+    gFrozenProfiles[index] = usprep_open(NULL, PROFILE_NAMES[index], &status);
+}
+
+U_CAPI const UStringPrepProfile* U_EXPORT2
+usprep_getFrozenByType(UStringPrepProfileType type,
+                       UErrorCode* status) {
+    if(status == NULL || U_FAILURE(*status)){
+        return NULL;
+    }
+    int32_t index = (int32_t)type;
+    if (index < 0 || index >= UPRV_LENGTHOF(PROFILE_NAMES)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    umtx_initOnce(gFrozenProfileInitOnce[index], &initFrozenProfile, index, *status);
+    return gFrozenProfiles[index];
+}
+
 U_CAPI void U_EXPORT2
 usprep_close(UStringPrepProfile* profile){
     if(profile==NULL){
@@ -698,7 +735,13 @@ usprep_prepare(   const UStringPrepProfile* profile,
         if(U_FAILURE(*status)){
             return 0;
         }
-        fn2.normalize(s1, s2, *status);
+        if(fn2.isNormalized(s1, *status)){
+            // The mapped string is usually already normalized
+            // (for example, when it is all ASCII); skip the second buffer.
+            s2.fastCopyFrom(s1);
+        }else{
+            fn2.normalize(s1, s2, *status);
+        }
     }else{
         s2.fastCopyFrom(s1);
     }
@@ -30,27 +30,32 @@
 #include "ustr_cnv.h"
 #include "ucnv_bld.h"
 
-/* mutexed access to a shared default converter ----------------------------- */
+/* mutexed access to a pool of shared default converters -------------------- */
 
-static UConverter *gDefaultConverter = NULL;
+/* A single cached converter forces concurrent users into ucnv_open; a few
+   slots let several threads check converters in and out without reopening. */
+#define DEFAULT_CONVERTER_POOL_SIZE 4
+
+static UConverter *gDefaultConverters[DEFAULT_CONVERTER_POOL_SIZE] = { NULL };
+static int32_t gDefaultConverterCount = 0;
 
 U_CAPI UConverter* U_EXPORT2
 u_getDefaultConverter(UErrorCode *status)
 {
     UConverter *converter = NULL;
     
-    if (gDefaultConverter != NULL) {
+    if (gDefaultConverterCount > 0) {
         icu::umtx_lock(NULL);
         
         /* need to check to make sure it wasn't taken out from under us */
-        if (gDefaultConverter != NULL) {
-            converter = gDefaultConverter;
-            gDefaultConverter = NULL;
+        if (gDefaultConverterCount > 0) {
+            converter = gDefaultConverters[--gDefaultConverterCount];
+            gDefaultConverters[gDefaultConverterCount] = NULL;
         }
         icu::umtx_unlock(NULL);
     }
 
-    /* if the cache was empty, create a converter */
+    /* if the pool was empty, create a converter */
     if(converter == NULL) {
         converter = ucnv_open(NULL, status);
         if(U_FAILURE(*status)) {
@@ -65,14 +70,15 @@ u_getDefaultConverter(UErrorCode *status)
 U_CAPI void U_EXPORT2
 u_releaseDefaultConverter(UConverter *converter)
 {
-    if(gDefaultConverter == NULL) {
-        if (converter != NULL) {
-            ucnv_reset(converter);
-        }
+    if(converter == NULL) {
+        return;
+    }
+    if(gDefaultConverterCount < DEFAULT_CONVERTER_POOL_SIZE) {
+        ucnv_reset(converter);
         ucnv_enableCleanup();
         icu::umtx_lock(NULL);
-        if(gDefaultConverter == NULL) {
-            gDefaultConverter = converter;
+        if(gDefaultConverterCount < DEFAULT_CONVERTER_POOL_SIZE) {
+            gDefaultConverters[gDefaultConverterCount++] = converter;
             converter = NULL;
         }
         icu::umtx_unlock(NULL);
@@ -86,22 +92,23 @@ u_releaseDefaultConverter(UConverter *converter)
 U_CAPI void U_EXPORT2
 u_flushDefaultConverter()
 {
-    UConverter *converter = NULL;
+    UConverter *converters[DEFAULT_CONVERTER_POOL_SIZE];
+    int32_t count = 0;
     
-    if (gDefaultConverter != NULL) {
+    if (gDefaultConverterCount > 0) {
         icu::umtx_lock(NULL);
         
-        /* need to check to make sure it wasn't taken out from under us */
-        if (gDefaultConverter != NULL) {
-            converter = gDefaultConverter;
-            gDefaultConverter = NULL;
+        /* need to check to make sure they weren't taken out from under us */
+        while (gDefaultConverterCount > 0) {
+            converters[count++] = gDefaultConverters[--gDefaultConverterCount];
+            gDefaultConverters[gDefaultConverterCount] = NULL;
         }
         icu::umtx_unlock(NULL);
     }
 
-    /* if the cache was populated, flush it */
-    if(converter != NULL) {
-         ucnv_close(converter);
+    /* if the pool was populated, flush it */
+    while (count > 0) {
+         ucnv_close(converters[--count]);
     }
 }
 
@@ -37,7 +37,69 @@ uprv_strCompare(const UChar *s1, int32_t length1,
                 const UChar *s2, int32_t length2,
                 UBool strncmpStyle, UBool codePointOrder);
 
-U_CAPI int32_t U_EXPORT2 
+/**
+ * Case-folds a batch of strings into one caller-provided buffer.
+ * Equivalent to calling u_strFoldCase() on each string, but validates
+ * arguments and loads the case mapping data only once, and writes no
+ * NUL terminators, which makes it suitable for per-token calls in
+ * tight loops (e.g., search indexing).
+ *
+ * The folded strings are appended to dest back to back;
+ * offsets[i] takes the start of folded string i in dest and
+ * offsets[count] takes the total length.
+ *
+ * If the buffer is too small, then U_BUFFER_OVERFLOW_ERROR is set and
+ * offsets[count] takes the required capacity (preflighting).
+ *
+ * @param strings array of count string pointers, none NULL
+ * @param lengths array of count string lengths, each >=0
+ * @param count number of strings
+ * @param options case folding options, see u_strFoldCase()
+ * @param dest destination buffer, can be NULL if destCapacity==0
+ * @param destCapacity number of UChars available at dest
+ * @param offsets output array of count+1 offsets into dest
+ * @param pErrorCode ICU error code
+ * @return the total length of the folded output
+ */
+U_CFUNC int32_t U_EXPORT2
+ustrcase_foldBatch(const UChar * const *strings, const int32_t *lengths, int32_t count,
+                   uint32_t options,
+                   UChar *dest, int32_t destCapacity, int32_t *offsets,
+                   UErrorCode *pErrorCode);
+
+/**
+ * Counts the extended grapheme clusters in a string, applying the
+ * UAX #29 rules directly to the Grapheme_Cluster_Break and
+ * Extended_Pictographic properties.
+ * Produces the same cluster segmentation as the character break iterator
+ * but constructs no object and performs no locale lookup,
+ * which makes it suitable for per-keystroke cursor math on short strings.
+ *
+ * @param s the string, can be NULL if length==0
+ * @param length string length, or -1 if NUL-terminated
+ * @param pErrorCode ICU error code
+ * @return number of grapheme clusters in the string
+ */
+U_CAPI int32_t U_EXPORT2
+u_countGraphemes(const UChar *s, int32_t length, UErrorCode *pErrorCode);
+
+/**
+ * Returns the UChar offset of the start of grapheme cluster
+ * graphemeIndex (0-based), under the same rules as u_countGraphemes().
+ * Returns the string length if the string has graphemeIndex
+ * or fewer clusters.
+ *
+ * @param s the string, can be NULL if length==0
+ * @param length string length, or -1 if NUL-terminated
+ * @param graphemeIndex index of the cluster to locate, >=0
+ * @param pErrorCode ICU error code
+ * @return UChar offset of the cluster start, pinned to the string length
+ */
+U_CAPI int32_t U_EXPORT2
+u_graphemeOffset(const UChar *s, int32_t length, int32_t graphemeIndex,
+                 UErrorCode *pErrorCode);
+
+U_CAPI int32_t U_EXPORT2
 ustr_hashUCharsN(const UChar *str, int32_t length);
 
 U_CAPI int32_t U_EXPORT2 
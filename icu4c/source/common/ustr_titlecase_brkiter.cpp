@@ -163,6 +163,36 @@ BreakIterator *ustrcase_getTitleBreakIterator(
     return iter;
 }
 
+TitleCaseMap::TitleCaseMap(const char *locale, uint32_t opts, UErrorCode &errorCode) :
+        iter(nullptr), caseLocale(ustrcase_getCaseLocale(locale)), options(opts) {
+    LocalPointer<BreakIterator> ownedIter;
+    ustrcase_getTitleBreakIterator(nullptr, locale, opts, nullptr, ownedIter, errorCode);
+    if (U_FAILURE(errorCode)) { return; }
+    iter = ownedIter.orphan();
+}
+
+TitleCaseMap::~TitleCaseMap() {
+    delete iter;
+}
+
+int32_t TitleCaseMap::toTitle(
+        const UChar *src, int32_t srcLength,
+        UChar *dest, int32_t destCapacity, Edits *edits,
+        UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) { return 0; }
+    if (iter == nullptr) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    UnicodeString s(srcLength<0, src, srcLength);
+    iter->setText(s);
+    return ustrcase_map(
+        caseLocale, options, iter,
+        dest, destCapacity,
+        src, srcLength,
+        ustrcase_internalToTitle, edits, errorCode);
+}
+
 int32_t CaseMap::toTitle(
         const char *locale, uint32_t options, BreakIterator *iter,
         const UChar *src, int32_t srcLength,
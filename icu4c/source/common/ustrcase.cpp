@@ -195,6 +195,27 @@ utf16_caseContextIterator(void *context, int8_t dir) {
     return U_SENTINEL;
 }
 
+/**
+ * Tests with one 64-bit load whether the next four UTF-16 code units
+ * are all ASCII with none in [rangeFirst..rangeLast]
+ * (the cased letters, which are the only ASCII characters with
+ * non-zero entries in the LatinCase tables).
+ * Such a block maps to itself and can be skipped in bulk.
+ * The caller guarantees that at least four units are readable.
+ */
+inline UBool noAsciiCasedInBlock(const UChar *s, UChar rangeFirst, UChar rangeLast) {
+    uint64_t block;
+    uprv_memcpy(&block, s, sizeof(block));
+    if(block & UINT64_C(0xff80ff80ff80ff80)) {
+        return FALSE;  // non-ASCII present
+    }
+    // Per-lane range check: bit 15 of (lane+offset) is set iff lane>=bound.
+    // Lanes are <0x80, so the additions do not carry across lanes.
+    uint64_t ge = block + (UINT64_C(0x8000) - rangeFirst) * UINT64_C(0x0001000100010001);
+    uint64_t gt = block + (UINT64_C(0x7fff) - rangeLast) * UINT64_C(0x0001000100010001);
+    return (ge & ~gt & UINT64_C(0x8000800080008000)) == 0;
+}
+
 /**
  * caseLocale >= 0: Lowercases [srcStart..srcLimit[ but takes context [0..srcLength[ into account.
  * caseLocale < 0: Case-folds [srcStart..srcLimit[.
@@ -220,6 +241,11 @@ int32_t toLower(int32_t caseLocale, uint32_t options,
         // fast path for simple cases
         UChar lead = 0;
         while (srcIndex < srcLimit) {
+            if ((srcLimit - srcIndex) >= 4 &&
+                    noAsciiCasedInBlock(src + srcIndex, u'A', u'Z')) {
+                srcIndex += 4;
+                continue;
+            }
             lead = src[srcIndex];
             int32_t delta;
             if (lead < LatinCase::LONG_S) {
@@ -315,6 +341,11 @@ int32_t toUpper(int32_t caseLocale, uint32_t options,
         // fast path for simple cases
         UChar lead = 0;
         while (srcIndex < srcLength) {
+            if ((srcLength - srcIndex) >= 4 &&
+                    noAsciiCasedInBlock(src + srcIndex, u'a', u'z')) {
+                srcIndex += 4;
+                continue;
+            }
             lead = src[srcIndex];
             int32_t delta;
             if (lead < LatinCase::LONG_S) {
@@ -1330,6 +1361,54 @@ ustrcase_mapWithOverlap(int32_t caseLocale, uint32_t options, UCASEMAP_BREAK_ITE
     return u_terminateUChars(dest, destCapacity, destLength, &errorCode);
 }
 
+U_CFUNC int32_t U_EXPORT2
+ustrcase_foldBatch(const UChar * const *strings, const int32_t *lengths, int32_t count,
+                   uint32_t options,
+                   UChar *dest, int32_t destCapacity, int32_t *offsets,
+                   UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if( count<0 || (count>0 && (strings==NULL || lengths==NULL)) || offsets==NULL ||
+        destCapacity<0 ||
+        (dest==NULL && destCapacity>0)
+    ) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    int32_t total=0;
+    for(int32_t i=0; i<count; ++i) {
+        const UChar *src=strings[i];
+        int32_t srcLength=lengths[i];
+        if(src==NULL || srcLength<0) {
+            *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+            return 0;
+        }
+        offsets[i]=total;
+        // toLower() preflights: it returns the needed length even when
+        // (the rest of) the buffer is too small.
+        int32_t length=toLower(
+            -1, options,
+            total<destCapacity ? dest+total : NULL,
+            total<destCapacity ? destCapacity-total : 0,
+            src, NULL, 0, srcLength,
+            NULL, *pErrorCode);
+        if(U_FAILURE(*pErrorCode)) {
+            return 0;
+        }
+        if(length>INT32_MAX-total) {
+            *pErrorCode=U_INDEX_OUTOFBOUNDS_ERROR;
+            return 0;
+        }
+        total+=length;
+    }
+    offsets[count]=total;
+    if(total>destCapacity) {
+        *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+    }
+    return total;
+}
+
 /* public API functions */
 
 U_CAPI int32_t U_EXPORT2
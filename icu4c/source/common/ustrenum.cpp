@@ -249,7 +249,8 @@ static const UEnumeration USTRENUM_VT = {
     ustrenum_count,
     ustrenum_unext,
     ustrenum_next,
-    ustrenum_reset
+    ustrenum_reset,
+    NULL  /* drain */
 };
 
 U_CDECL_END
@@ -334,6 +335,30 @@ ucharstrenum_reset(UEnumeration* en,
     ((UCharStringEnumeration*)en)->index = 0;
 }
 
+static int32_t U_CALLCONV
+ucharstrenum_drain(UEnumeration* en,
+                   const char** dest, int32_t destCapacity,
+                   char* arena, int32_t arenaCapacity,
+                   UErrorCode* ec) {
+    UCharStringEnumeration *e = (UCharStringEnumeration*) en;
+    const char **strings = (const char**)e->uenum.context;
+    int32_t n = 0;
+    int32_t arenaLength = 0;
+    while (e->index < e->count) {
+        const char *s = strings[e->index];
+        int32_t length = (int32_t)uprv_strlen(s);
+        if (n >= destCapacity || (arenaCapacity - arenaLength) < (length + 1)) {
+            *ec = U_BUFFER_OVERFLOW_ERROR;
+            break;
+        }
+        uprv_memcpy(arena + arenaLength, s, length + 1);
+        dest[n++] = arena + arenaLength;
+        arenaLength += length + 1;
+        ++e->index;
+    }
+    return n;
+}
+
 static const UEnumeration UCHARSTRENUM_VT = {
     NULL,
     NULL, // store StringEnumeration pointer here
@@ -341,7 +366,8 @@ static const UEnumeration UCHARSTRENUM_VT = {
     ucharstrenum_count,
     uenum_unextDefault,
     ucharstrenum_next,
-    ucharstrenum_reset
+    ucharstrenum_reset,
+    ucharstrenum_drain
 };
 
 static const UEnumeration UCHARSTRENUM_U_VT = {
@@ -351,7 +377,8 @@ static const UEnumeration UCHARSTRENUM_U_VT = {
     ucharstrenum_count,
     ucharstrenum_unext,
     uenum_nextDefault,
-    ucharstrenum_reset
+    ucharstrenum_reset,
+    NULL  /* drain */
 };
 
 U_CDECL_END
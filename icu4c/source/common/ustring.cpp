@@ -52,6 +52,30 @@ isMatchAtCPBoundary(const UChar *start, const UChar *match, const UChar *matchLi
     return TRUE;
 }
 
+/*
+ * Find a code unit in a counted buffer, exact code unit match.
+ * Surrogate correctness is up to the callers.
+ * Tests blocks of eight with a single branch per block (bitwise |,
+ * no short-circuiting) so that compilers vectorize the comparisons.
+ */
+static inline const UChar *
+findCodeUnit(const UChar *s, const UChar *limit, UChar c) {
+    while((limit-s)>=8) {
+        if((s[0]==c) | (s[1]==c) | (s[2]==c) | (s[3]==c) |
+                (s[4]==c) | (s[5]==c) | (s[6]==c) | (s[7]==c)) {
+            break;
+        }
+        s+=8;
+    }
+    while(s!=limit) {
+        if(*s==c) {
+            return s;
+        }
+        ++s;
+    }
+    return NULL;
+}
+
 U_CAPI UChar * U_EXPORT2
 u_strFindFirst(const UChar *s, int32_t length,
                const UChar *sub, int32_t subLength) {
@@ -162,26 +186,28 @@ u_strFindFirst(const UChar *s, int32_t length,
         /* the substring must start before preLimit */
         preLimit=limit-subLength;
 
-        while(s!=preLimit) {
-            c=*s++;
-            if(c==cs) {
-                /* found first substring UChar, compare rest */
-                p=s;
-                q=sub;
-                for(;;) {
-                    if(q==subLimit) {
-                        if(isMatchAtCPBoundary(start, s-1, p, limit)) {
-                            return (UChar *)(s-1); /* well-formed match */
-                        } else {
-                            break; /* no match because surrogate pair is split */
-                        }
-                    }
-                    if(*p!=*q) {
-                        break; /* no match */
+        for(;;) {
+            s=findCodeUnit(s, preLimit, cs);
+            if(s==NULL) {
+                break; /* first substring UChar does not occur before preLimit */
+            }
+            ++s;
+            /* found first substring UChar, compare rest */
+            p=s;
+            q=sub;
+            for(;;) {
+                if(q==subLimit) {
+                    if(isMatchAtCPBoundary(start, s-1, p, limit)) {
+                        return (UChar *)(s-1); /* well-formed match */
+                    } else {
+                        break; /* no match because surrogate pair is split */
                     }
-                    ++p;
-                    ++q;
                 }
+                if(*p!=*q) {
+                    break; /* no match */
+                }
+                ++p;
+                ++q;
             }
         }
     }
@@ -245,14 +271,8 @@ u_memchr(const UChar *s, UChar c, int32_t count) {
         /* make sure to not find half of a surrogate pair */
         return u_strFindFirst(s, count, &c, 1);
     } else {
-        /* trivial search for a BMP code point */
-        const UChar *limit=s+count;
-        do {
-            if(*s==c) {
-                return (UChar *)s;
-            }
-        } while(++s!=limit);
-        return NULL;
+        /* search for a BMP code point */
+        return (UChar *)findCodeUnit(s, s+count, c);
     }
 }
 
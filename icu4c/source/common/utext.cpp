@@ -853,7 +853,11 @@ U_CDECL_END
 //     The longest illegal byte sequence treated as a single error (and converted to U+FFFD)
 //     is a three-byte sequence (truncated four-byte sequence).
 //
-enum { UTF8_TEXT_CHUNK_SIZE=32 };
+//     Larger chunks mean fewer trips through the function-pointer access path
+//     for iteration-heavy clients (break iteration, regex); 64 is the largest
+//     power of two that respects the limit above.
+//
+enum { UTF8_TEXT_CHUNK_SIZE=64 };
 
 //
 // UTF8Buf  Two of these structs will be set up in the UText's extra allocated space.
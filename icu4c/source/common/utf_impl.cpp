@@ -27,6 +27,8 @@
 #include "unicode/utypes.h"
 #include "unicode/utf.h"
 #include "unicode/utf8.h"
+#include "cmemory.h"
+#include "cstring.h"
 #include "uassert.h"
 
 /*
@@ -327,3 +329,42 @@ utf8_back1SafeBody(const uint8_t *s, int32_t start, int32_t i) {
     }
     return orig_i;
 }
+
+U_CAPI int32_t U_EXPORT2
+utf8_spanValid(const char *s, int32_t length) {
+    const uint8_t *p=(const uint8_t *)s;
+    int32_t i=0, prev;
+    UChar32 c;
+    if(s==NULL) {
+        return 0;
+    }
+    if(length<0) {
+        length=(int32_t)uprv_strlen(s);
+    }
+    while(i<length) {
+        /* skip runs of ASCII, one machine word at a time */
+        while((length-i)>=8) {
+            uint64_t block;
+            uprv_memcpy(&block, p+i, 8);
+            if(block&UINT64_C(0x8080808080808080)) {
+                break;
+            }
+            i+=8;
+        }
+        if(i==length) {
+            break;
+        }
+        c=p[i];
+        if(U8_IS_SINGLE(c)) {
+            ++i;
+            continue;
+        }
+        prev=i;
+        U8_NEXT(p, i, length, c);
+        if(c<0) {
+            /* ill-formed or truncated sequence: the valid span ends before it */
+            return prev;
+        }
+    }
+    return i;
+}
@@ -11,6 +11,8 @@
 *   indentation:4
 */
 
+#include <atomic>
+
 #include "unicode/utrace.h"
 #include "utracimp.h"
 #include "cstring.h"
@@ -428,8 +430,37 @@ utrace_getLevel() {
     return utrace_level;
 }
 
+/*
+ * Hot-path counters. Plain relaxed atomics so that incrementing them from
+ * implementation code costs a single uncontended add; readers get a
+ * point-in-time snapshot, which is all that production sampling needs.
+ */
+static std::atomic<int64_t> gTraceCounters[UTRACE_COUNTER_COUNT];
+
+U_CAPI void U_EXPORT2
+utrace_addCounter(UTraceCounter counter, int64_t delta) {
+    gTraceCounters[counter].fetch_add(delta, std::memory_order_relaxed);
+}
+
+U_CAPI int32_t U_EXPORT2
+utrace_getCounters(int64_t *counters, int32_t capacity) {
+    int32_t i;
+    for (i = 0; i < UTRACE_COUNTER_COUNT && i < capacity; ++i) {
+        counters[i] = gTraceCounters[i].load(std::memory_order_relaxed);
+    }
+    return UTRACE_COUNTER_COUNT;
+}
+
+U_CAPI void U_EXPORT2
+utrace_resetCounters() {
+    int32_t i;
+    for (i = 0; i < UTRACE_COUNTER_COUNT; ++i) {
+        gTraceCounters[i].store(0, std::memory_order_relaxed);
+    }
+}
+
 
-U_CFUNC UBool 
+U_CFUNC UBool
 utrace_cleanup() {
     pTraceEntryFunc = NULL;
     pTraceExitFunc  = NULL;
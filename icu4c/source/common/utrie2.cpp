@@ -634,6 +634,60 @@ utrie2_enumForLeadSurrogate(const UTrie2 *trie, UChar32 lead,
     enumEitherTrie(trie, lead, lead+0x400, enumValue, enumRange, context);
 }
 
+/* getRange ----------------------------------------------------------------- */
+
+/*
+ * Context for utrie2_getRange(): forwards trie values through the caller's
+ * enumValue function and captures the first enumerated range that reaches
+ * the requested start code point.
+ */
+typedef struct GetRangeContext {
+    const void *context;
+    UTrie2EnumValue *enumValue;
+    UChar32 start;
+    UChar32 end;
+    uint32_t value;
+} GetRangeContext;
+
+static uint32_t U_CALLCONV
+getRangeEnumValue(const void *context, uint32_t value) {
+    const GetRangeContext *grx=(const GetRangeContext *)context;
+    return grx->enumValue(grx->context, value);
+}
+
+static UBool U_CALLCONV
+getRangeEnumRange(const void *context, UChar32 /*start*/, UChar32 end, uint32_t value) {
+    GetRangeContext *grx=(GetRangeContext *)context;
+    if(end>=grx->start) {
+        /* This maximal range contains the start code point. */
+        grx->end=end;
+        grx->value=value;
+        return FALSE;  /* stop the enumeration */
+    }
+    return TRUE;
+}
+
+U_CAPI UChar32 U_EXPORT2
+utrie2_getRange(const UTrie2 *trie, UChar32 start,
+                UTrie2EnumValue *enumValue, const void *context, uint32_t *pValue) {
+    GetRangeContext grx;
+    if((uint32_t)start>0x10ffff) {
+        return U_SENTINEL;
+    }
+    grx.context=context;
+    grx.enumValue=enumValue;
+    grx.start=start;
+    grx.end=U_SENTINEL;
+    grx.value=trie->errorValue;
+    /* enumEitherTrie() requires a start that is a multiple of the data block length. */
+    enumEitherTrie(trie, start&~(UTRIE2_DATA_BLOCK_LENGTH-1), 0x110000,
+                   enumValue!=NULL ? getRangeEnumValue : NULL, getRangeEnumRange, &grx);
+    if(pValue!=NULL) {
+        *pValue=grx.value;
+    }
+    return grx.end;
+}
+
 /* C++ convenience wrappers ------------------------------------------------- */
 
 U_NAMESPACE_BEGIN
@@ -194,6 +194,33 @@ U_CAPI void U_EXPORT2
 utrie2_enum(const UTrie2 *trie,
             UTrie2EnumValue *enumValue, UTrie2EnumRange *enumRange, const void *context);
 
+/**
+ * Returns the last code point such that all code points from start to there
+ * have the same (transformed) value, and writes that value to *pValue.
+ * Can be used to efficiently iterate over all same-value ranges in a trie
+ * without a callback per range, amortizing the index lookups over whole
+ * data blocks rather than paying them per code point.
+ *
+ * For each entry in the trie, the value to be delivered is passed through
+ * the UTrie2EnumValue function.
+ * The value is unchanged if that function pointer is NULL.
+ *
+ * Like utrie2_enum(), values for lead surrogate code points
+ * (not code units) are delivered.
+ *
+ * @param trie a pointer to the trie
+ * @param start range start
+ * @param enumValue a pointer to a function that may transform the trie entry value,
+ *                  or NULL if the values from the trie are to be used directly
+ * @param context an opaque pointer that is passed on to the enumValue function
+ * @param pValue if not NULL, receives the value that every code point
+ *               start..end has
+ * @return the range end code point, or -1 if start is not a valid code point
+ */
+U_CAPI UChar32 U_EXPORT2
+utrie2_getRange(const UTrie2 *trie, UChar32 start,
+                UTrie2EnumValue *enumValue, const void *context, uint32_t *pValue);
+
 /* Building a trie ---------------------------------------------------------- */
 
 /**
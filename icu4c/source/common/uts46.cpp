@@ -298,6 +298,41 @@ static const int8_t asciiData[128]={
      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1, -1, -1, -1, -1
 };
 
+// SWAR (SIMD-within-a-register) helpers for the ASCII fastpath:
+// Test a block of characters for being all lowercase ASCII letters or digits.
+// Such characters are copied verbatim and need none of the per-character
+// handling in the fastpath loop (no mapping, and no hyphen/dot/label logic).
+//
+// For a lane value already known to be <=0x7f, the high lane bit of
+// lane+(laneMax-k) is set if and only if lane>k, and the addition
+// cannot carry into the next lane.
+
+static inline UBool
+isSimpleLDHBlock(const char *s) {
+    uint64_t w;  // eight bytes
+    uprv_memcpy(&w, s, 8);
+    if(w&UINT64_C(0x8080808080808080)) {
+        return FALSE;  // non-ASCII byte
+    }
+    // 0x7f-0x2f=0x50 etc.: thresholds for 0x30..0x39 and 0x61..0x7a.
+    uint64_t isDigit=(w+UINT64_C(0x5050505050505050))&~(w+UINT64_C(0x4646464646464646));
+    uint64_t isLower=(w+UINT64_C(0x1f1f1f1f1f1f1f1f))&~(w+UINT64_C(0x0505050505050505));
+    return ((isDigit|isLower)&UINT64_C(0x8080808080808080))==UINT64_C(0x8080808080808080);
+}
+
+static inline UBool
+isSimpleLDHBlock(const UChar *s) {
+    uint64_t w;  // four UChars
+    uprv_memcpy(&w, s, 8);
+    if(w&UINT64_C(0xff80ff80ff80ff80)) {
+        return FALSE;  // non-ASCII unit
+    }
+    // 0x7fff-0x2f=0x7fd0 etc.: thresholds for 0x30..0x39 and 0x61..0x7a.
+    uint64_t isDigit=(w+UINT64_C(0x7fd07fd07fd07fd0))&~(w+UINT64_C(0x7fc67fc67fc67fc6));
+    uint64_t isLower=(w+UINT64_C(0x7f9f7f9f7f9f7f9f))&~(w+UINT64_C(0x7f857f857f857f85));
+    return ((isDigit|isLower)&UINT64_C(0x8000800080008000))==UINT64_C(0x8000800080008000);
+}
+
 UnicodeString &
 UTS46::process(const UnicodeString &src,
                UBool isLabel, UBool toASCII,
@@ -334,6 +369,11 @@ UTS46::process(const UnicodeString &src,
     int32_t labelStart=0;
     int32_t i;
     for(i=0;; ++i) {
+        while((i+4)<=srcLength && isSimpleLDHBlock(srcArray+i)) {
+            // Copy a block of lowercase letters and digits verbatim.
+            uprv_memcpy(destArray+i, srcArray+i, 8);
+            i+=4;
+        }
         if(i==srcLength) {
             if(toASCII) {
                 if((i-labelStart)>63) {
@@ -434,6 +474,11 @@ UTS46::processUTF8(StringPiece src,
         UBool disallowNonLDHDot=(options&UIDNA_USE_STD3_RULES)!=0;
         int32_t i;
         for(i=0;; ++i) {
+            while((i+8)<=srcLength && isSimpleLDHBlock(srcArray+i)) {
+                // Copy a block of lowercase letters and digits verbatim.
+                uprv_memcpy(destArray+i, srcArray+i, 8);
+                i+=8;
+            }
             if(i==srcLength) {
                 if(toASCII) {
                     if((i-labelStart)>63) {
@@ -57,6 +57,12 @@ void UVector32::_init(int32_t initialCapacity, UErrorCode &status) {
     if (initialCapacity > (int32_t)(INT32_MAX / sizeof(int32_t))) {
         initialCapacity = uprv_min(DEFAULT_CAPACITY, maxCapacity);
     }
+    if (initialCapacity <= STACK_CAPACITY) {
+        // Small initial capacity: use the inline storage, no allocation.
+        elements = stackElements;
+        capacity = STACK_CAPACITY;
+        return;
+    }
     elements = (int32_t *)uprv_malloc(sizeof(int32_t)*initialCapacity);
     if (elements == 0) {
         status = U_MEMORY_ALLOCATION_ERROR;
@@ -66,7 +72,9 @@ void UVector32::_init(int32_t initialCapacity, UErrorCode &status) {
 }
 
 UVector32::~UVector32() {
-    uprv_free(elements);
+    if (elements != stackElements) {
+        uprv_free(elements);
+    }
     elements = 0;
 }
 
@@ -228,7 +236,16 @@ UBool UVector32::expandCapacity(int32_t minimumCapacity, UErrorCode &status) {
         status = U_ILLEGAL_ARGUMENT_ERROR;
         return FALSE;
     }
-    int32_t* newElems = (int32_t *)uprv_realloc(elements, sizeof(int32_t)*newCap);
+    int32_t* newElems;
+    if (elements == stackElements) {
+        // Graduate from the inline storage to a heap buffer.
+        newElems = (int32_t *)uprv_malloc(sizeof(int32_t)*newCap);
+        if (newElems != NULL) {
+            uprv_memcpy(newElems, elements, sizeof(int32_t)*count);
+        }
+    } else {
+        newElems = (int32_t *)uprv_realloc(elements, sizeof(int32_t)*newCap);
+    }
     if (newElems == NULL) {
         // We keep the original contents on the memory failure on realloc.
         status = U_MEMORY_ALLOCATION_ERROR;
@@ -256,6 +273,11 @@ void UVector32::setMaxCapacity(int32_t limit) {
     
     // New maximum capacity is smaller than the current size.
     // Realloc the storage to the new, smaller size.
+    if (elements == stackElements) {
+        // The inline storage cannot shrink; just keep it.
+        // expandCapacity() enforces maxCapacity on any future growth.
+        return;
+    }
     int32_t* newElems = (int32_t *)uprv_realloc(elements, sizeof(int32_t)*maxCapacity);
     if (newElems == NULL) {
         // Realloc to smaller failed.
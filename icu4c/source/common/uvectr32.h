@@ -60,14 +60,25 @@ U_NAMESPACE_BEGIN
  */
 class U_COMMON_API UVector32 : public UObject {
 private:
+    enum {
+        /**
+         * Number of elements of inline storage. Vectors start out in
+         * stackElements, so the default-capacity constructor does not
+         * allocate; the heap is used only once a vector outgrows it.
+         */
+        STACK_CAPACITY = 8
+    };
+
     int32_t   count;
 
     int32_t   capacity;
-    
+
     int32_t   maxCapacity;   // Limit beyond which capacity is not permitted to grow.
 
     int32_t*  elements;
 
+    int32_t   stackElements[STACK_CAPACITY];
+
 public:
     UVector32(UErrorCode &status);
 
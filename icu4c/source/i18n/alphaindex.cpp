@@ -25,6 +25,7 @@
 
 #include "cmemory.h"
 #include "cstring.h"
+#include "uarrsort.h"
 #include "uassert.h"
 #include "uvector.h"
 #include "uvectr64.h"
@@ -51,8 +52,6 @@ UBool isOneLabelBetterThanOther(const Normalizer2 &nfkdNormalizer,
 static int32_t U_CALLCONV
 collatorComparator(const void *context, const void *left, const void *right);
 
-static int32_t U_CALLCONV
-recordCompareFn(const void *context, const void *left, const void *right);
 
 //  UVector<Record *> support function, delete a Record.
 static void U_CALLCONV
@@ -625,6 +624,52 @@ BucketList *AlphabeticIndex::createBucketList(UErrorCode &errorCode) const {
     return bl;
 }
 
+namespace {
+
+/** A record together with its precomputed sort key, for initBuckets(). */
+struct KeyedRecord {
+    const uint8_t *key;
+    int32_t keyLength;
+    AlphabeticIndex::Record *record;
+};
+
+/** Byte-wise sort key comparison; keys include their terminators. */
+int32_t compareKeys(const uint8_t *left, int32_t leftLength,
+                    const uint8_t *right, int32_t rightLength) {
+    int32_t minLength = leftLength <= rightLength ? leftLength : rightLength;
+    int32_t diff = uprv_memcmp(left, right, minLength);
+    if (diff != 0) { return diff; }
+    return leftLength - rightLength;
+}
+
+int32_t U_CALLCONV
+keyedRecordCompareFn(const void * /*context*/, const void *left, const void *right) {
+    const KeyedRecord *leftRec = static_cast<const KeyedRecord *>(left);
+    const KeyedRecord *rightRec = static_cast<const KeyedRecord *>(right);
+    return compareKeys(leftRec->key, leftRec->keyLength,
+                       rightRec->key, rightRec->keyLength);
+}
+
+/**
+ * Writes the sort key for s into the buffer, growing it as needed.
+ * Returns the key length.
+ */
+int32_t getPrimaryKey(const RuleBasedCollator &coll, const UnicodeString &s,
+                      MaybeStackArray<uint8_t, 64> &buffer, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) { return 0; }
+    int32_t length = coll.getSortKey(s, buffer.getAlias(), buffer.getCapacity());
+    if (length > buffer.getCapacity()) {
+        if (buffer.resize(length) == NULL) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return 0;
+        }
+        length = coll.getSortKey(s, buffer.getAlias(), buffer.getCapacity());
+    }
+    return length;
+}
+
+}  // namespace
+
 /**
  * Creates an index, and buckets and sorts the list of records into the index.
  */
@@ -637,16 +682,79 @@ void AlphabeticIndex::initBuckets(UErrorCode &errorCode) {
         return;
     }
 
+    // Compute each record's sort key once, into one arena,
+    // then sort and bucket by comparing key bytes.
+    // This replaces O(n log n) full collation comparisons (and one
+    // primary comparison per record against the bucket boundaries)
+    // with one key generation per record plus cheap byte comparisons.
+    int32_t count = inputList_->size();
+    LocalMemory<int32_t> offsets;
+    if (offsets.allocateInsteadAndReset(count + 1) == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    LocalMemory<uint8_t> arena;
+    int32_t capacity = count * 16;
+    if (arena.allocateInsteadAndReset(capacity) == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int32_t totalLength = 0;
+    for (int32_t i = 0; i < count; ++i) {
+        Record *r = getRecord(*inputList_, i);
+        offsets[i] = totalLength;
+        for (;;) {
+            int32_t keyLength = collator_->getSortKey(
+                r->name_, arena.getAlias() + totalLength, capacity - totalLength);
+            if (keyLength <= capacity - totalLength) {
+                totalLength += keyLength;
+                break;
+            }
+            // Grow the arena and regenerate this key.
+            int32_t newCapacity = 2 * capacity + keyLength;
+            if (arena.allocateInsteadAndCopy(newCapacity, totalLength) == NULL) {
+                errorCode = U_MEMORY_ALLOCATION_ERROR;
+                return;
+            }
+            capacity = newCapacity;
+        }
+    }
+    offsets[count] = totalLength;
+
     // Sort the records by name.
     // Stable sort preserves input order of collation duplicates.
-    inputList_->sortWithUComparator(recordCompareFn, collator_, errorCode);
+    LocalMemory<KeyedRecord> keyed;
+    if (keyed.allocateInsteadAndReset(count) == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    for (int32_t i = 0; i < count; ++i) {
+        keyed[i].key = arena.getAlias() + offsets[i];
+        keyed[i].keyLength = offsets[i + 1] - offsets[i];
+        keyed[i].record = getRecord(*inputList_, i);
+    }
+    uprv_sortArray(keyed.getAlias(), count, (int32_t)sizeof(KeyedRecord),
+                   keyedRecordCompareFn, NULL, TRUE, &errorCode);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    // Store the sorted order back, without tripping the vector's deleter.
+    UObjectDeleter *deleter = inputList_->setDeleter(NULL);
+    for (int32_t i = 0; i < count; ++i) {
+        inputList_->setElementAt(keyed[i].record, i);
+    }
+    inputList_->setDeleter(deleter);
 
     // Now, we traverse all of the input, which is now sorted.
     // If the item doesn't go in the current bucket, we find the next bucket that contains it.
     // This makes the process order n*log(n), since we just sort the list and then do a linear process.
-    // However, if the user adds an item at a time and then gets the buckets, this isn't efficient, so
-    // we need to improve it for that case.
 
+    // A record belongs before a bucket boundary if its name's primary-level
+    // weights precede the boundary's. The primary weights are the leading
+    // bytes of the record's full sort key, and the level separator (01) and
+    // terminator (00) bytes order below any weight byte, so comparing the
+    // full key against the boundary's primary-only key byte-wise gives the
+    // same answer as the former collatorPrimaryOnly_->compare() per record.
     Bucket *currentBucket = getBucket(*buckets_->bucketList_, 0);
     int32_t bucketIndex = 1;
     Bucket *nextBucket;
@@ -658,21 +766,33 @@ void AlphabeticIndex::initBuckets(UErrorCode &errorCode) {
         nextBucket = NULL;
         upperBoundary = NULL;
     }
-    for (int32_t i = 0; i < inputList_->size(); ++i) {
-        Record *r = getRecord(*inputList_, i);
+    MaybeStackArray<uint8_t, 64> boundaryKey;
+    int32_t boundaryKeyLength = 0;
+    if (upperBoundary != NULL) {
+        boundaryKeyLength = getPrimaryKey(*collatorPrimaryOnly_, *upperBoundary,
+                                          boundaryKey, errorCode);
+    }
+    for (int32_t i = 0; i < count; ++i) {
+        Record *r = keyed[i].record;
         // if the current bucket isn't the right one, find the one that is
         // We have a special flag for the last bucket so that we don't look any further
         while (upperBoundary != NULL &&
-                collatorPrimaryOnly_->compare(r->name_, *upperBoundary, errorCode) >= 0) {
+                compareKeys(keyed[i].key, keyed[i].keyLength,
+                            boundaryKey.getAlias(), boundaryKeyLength) >= 0) {
             currentBucket = nextBucket;
             // now reset the boundary that we compare against
             if (bucketIndex < buckets_->bucketList_->size()) {
                 nextBucket = getBucket(*buckets_->bucketList_, bucketIndex++);
                 upperBoundary = &nextBucket->lowerBoundary_;
+                boundaryKeyLength = getPrimaryKey(*collatorPrimaryOnly_, *upperBoundary,
+                                                  boundaryKey, errorCode);
             } else {
                 upperBoundary = NULL;
             }
         }
+        if (U_FAILURE(errorCode)) {
+            return;
+        }
         // now put the record into the bucket.
         Bucket *bucket = currentBucket;
         if (bucket->displayBucket_ != NULL) {
@@ -967,19 +1087,7 @@ collatorComparator(const void *context, const void *left, const void *right) {
     return col->compare(*leftString, *rightString, errorCode);
 }
 
-//
-//  Comparison function for UVector<Record *> sorting with a collator.
-//
-static int32_t U_CALLCONV
-recordCompareFn(const void *context, const void *left, const void *right) {
-    const UElement *leftElement = static_cast<const UElement *>(left);
-    const UElement *rightElement = static_cast<const UElement *>(right);
-    const AlphabeticIndex::Record *leftRec  = static_cast<const AlphabeticIndex::Record *>(leftElement->pointer);
-    const AlphabeticIndex::Record *rightRec = static_cast<const AlphabeticIndex::Record *>(rightElement->pointer);
-    const Collator *col = static_cast<const Collator *>(context);
-    UErrorCode errorCode = U_ZERO_ERROR;
-    return col->compare(leftRec->name_, rightRec->name_, errorCode);
-}
+
 
 UVector *AlphabeticIndex::firstStringsInScript(UErrorCode &status) {
     if (U_FAILURE(status)) {
@@ -14,8 +14,10 @@
 
 #if !UCONFIG_NO_TRANSLITERATION
 
+#include "unicode/uchar.h"
 #include "unicode/uobject.h"
 #include "unicode/uscript.h"
+#include "unicode/utf16.h"
 
 #include "anytrans.h"
 #include "hash.h"
@@ -39,6 +41,10 @@ static const UChar LATIN_PIVOT[] = {0x2D,0x4C,0x61,0x74,0x6E,0x3B,0x4C,0x61,0x74
 // (will grow as necessary, but we don't expect to have source text with more than 7 scripts)
 #define ANY_TRANS_CACHE_INIT_SIZE 7
 
+// number of code points classified per batched script property lookup
+// while scanning for script runs
+#define SCRIPT_RUN_BLOCK 32
+
 //------------------------------------------------------------
 
 U_CDECL_BEGIN
@@ -153,18 +159,38 @@ UBool ScriptRunIterator::next() {
     }
 
     // Move limit ahead to include COMMON, INHERITED, and characters
-    // of the current script.
+    // of the current script.  Classify a block of code points with a
+    // single batched property lookup instead of dispatching per
+    // character; the batch lookup also memoizes repeated code points,
+    // which spaces and other common characters hit constantly.
+    UChar32 cps[SCRIPT_RUN_BLOCK];
+    int32_t scripts[SCRIPT_RUN_BLOCK];
     while (limit < textLimit) {
-        ch = text.char32At(limit); // look ahead
-        s = uscript_getScript(ch, &ec);
-        if (s != USCRIPT_COMMON && s != USCRIPT_INHERITED) {
-            if (scriptCode == USCRIPT_INVALID_CODE) {
-                scriptCode = s;
-            } else if (s != scriptCode) {
-                break;
+        int32_t n = 0;
+        int32_t pos = limit;
+        while (pos < textLimit && n < SCRIPT_RUN_BLOCK) {
+            ch = text.char32At(pos); // look ahead
+            cps[n++] = ch;
+            pos += U16_LENGTH(ch);
+        }
+        u_getIntPropertyValues(UCHAR_SCRIPT, cps, n, scripts, &ec);
+        if (U_FAILURE(ec)) {
+            // Cannot happen with valid arguments; advance past the
+            // block so that the scan always terminates.
+            limit = pos;
+            break;
+        }
+        for (int32_t i = 0; i < n; ++i) {
+            s = (UScriptCode) scripts[i];
+            if (s != USCRIPT_COMMON && s != USCRIPT_INHERITED) {
+                if (scriptCode == USCRIPT_INVALID_CODE) {
+                    scriptCode = s;
+                } else if (s != scriptCode) {
+                    return TRUE;
+                }
             }
+            limit += U16_LENGTH(cps[i]);
         }
-        ++limit;
     }
 
     // Return TRUE even if the entire text is COMMON / INHERITED, in
@@ -238,6 +264,17 @@ void AnyTransliterator::handleTransliterate(Replaceable& text, UTransPosition& p
     int32_t allStart = pos.start;
     int32_t allLimit = pos.limit;
 
+    // Per-call memo of resolved per-script transliterators, so that
+    // each distinct script in the text goes through the shared cache
+    // (and its mutex) once per call rather than once per run.  The
+    // cached transliterators are owned by this instance and are never
+    // evicted, so the memoized pointers stay valid for the whole call.
+    struct {
+        UScriptCode script;
+        Transliterator* t;
+    } resolved[ANY_TRANS_CACHE_INIT_SIZE];
+    int32_t resolvedCount = 0;
+
     ScriptRunIterator it(text, pos.contextStart, pos.contextLimit);
 
     while (it.next()) {
@@ -246,7 +283,23 @@ void AnyTransliterator::handleTransliterate(Replaceable& text, UTransPosition& p
 
         // Try to instantiate transliterator from it.scriptCode to
         // our target or target/variant
-        Transliterator* t = getTransliterator(it.scriptCode);
+        Transliterator* t = NULL;
+        UBool haveT = FALSE;
+        for (int32_t i = 0; i < resolvedCount; ++i) {
+            if (resolved[i].script == it.scriptCode) {
+                t = resolved[i].t;
+                haveT = TRUE;
+                break;
+            }
+        }
+        if (!haveT) {
+            t = getTransliterator(it.scriptCode);
+            if (resolvedCount < ANY_TRANS_CACHE_INIT_SIZE) {
+                resolved[resolvedCount].script = it.scriptCode;
+                resolved[resolvedCount].t = t;
+                ++resolvedCount;
+            }
+        }
 
         if (t == NULL) {
             // We have no transliterator.  Do nothing, but keep
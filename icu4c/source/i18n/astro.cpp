@@ -1598,6 +1598,19 @@ CalendarCache::~CalendarCache() {
     }
 }
 
+int32_t CalendarFrontCache::get(int32_t key) const {
+    int64_t word = fSlots[(uint32_t)key & (kSlots - 1)].load(std::memory_order_acquire);
+    if ((int32_t)(word >> 32) == key) {
+        return (int32_t)word;
+    }
+    return 0;
+}
+
+void CalendarFrontCache::put(int32_t key, int32_t value) {
+    int64_t word = ((int64_t)key << 32) | (int64_t)(uint32_t)value;
+    fSlots[(uint32_t)key & (kSlots - 1)].store(word, std::memory_order_release);
+}
+
 U_NAMESPACE_END
 
 #endif //  !UCONFIG_NO_FORMATTING
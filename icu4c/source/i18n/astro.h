@@ -17,6 +17,8 @@
 #include "gregoimp.h"  // for Math
 #include "unicode/unistr.h"
 
+#include <atomic>
+
 U_NAMESPACE_BEGIN
 
 /**
@@ -751,6 +753,33 @@ private:
   UHashtable *fTable;
 };
 
+/**
+ * Lock-free read-mostly cache used by the astronomical calendars in front
+ * of the mutexed CalendarCache: a fixed, direct-mapped table whose slots
+ * each pack one (key, value) pair into a single atomic 64-bit word, so
+ * warm lookups never take a lock and scale across threads. A value of 0
+ * reads as "not cached", matching what CalendarCache::get() reports for a
+ * missing key. Instances are expected to have static storage duration;
+ * zero-initialization leaves every slot empty.
+ * @internal
+ */
+class CalendarFrontCache : public UMemory {
+public:
+  /**
+   * Returns the cached value for the key, or 0 if the key is not cached
+   * (or its slot has been overwritten by a colliding key).
+   */
+  int32_t get(int32_t key) const;
+  /**
+   * Stores the value for the key, overwriting any colliding entry.
+   * The value must be nonzero.
+   */
+  void put(int32_t key, int32_t value);
+private:
+  enum { kSlots = 1024 };  // power of two; spans a millennium of year keys
+  std::atomic<int64_t> fSlots[kSlots];
+};
+
 U_NAMESPACE_END
 
 #endif
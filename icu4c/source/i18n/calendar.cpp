@@ -828,6 +828,7 @@ Calendar::operator=(const Calendar &right)
         fWeekendCease            = right.fWeekendCease;
         fWeekendCeaseMillis      = right.fWeekendCeaseMillis;
         fNextStamp               = right.fNextStamp;
+        fDayCacheValid           = FALSE; // recomputed lazily by computeFields()
         uprv_strncpy(validLocale, right.validLocale, sizeof(validLocale));
         uprv_strncpy(actualLocale, right.actualLocale, sizeof(actualLocale));
         validLocale[sizeof(validLocale)-1] = 0;
@@ -1492,26 +1493,6 @@ void Calendar::computeFields(UErrorCode &ec)
     getTimeZone().getOffset(localMillis, FALSE, rawOffset, dstOffset, ec);
     localMillis += (rawOffset + dstOffset);
 
-    // Mark fields as set.  Do this before calling handleComputeFields().
-    uint32_t mask =   //fInternalSetMask;
-        (1 << UCAL_ERA) |
-        (1 << UCAL_YEAR) |
-        (1 << UCAL_MONTH) |
-        (1 << UCAL_DAY_OF_MONTH) | // = UCAL_DATE
-        (1 << UCAL_DAY_OF_YEAR) |
-        (1 << UCAL_EXTENDED_YEAR);
-
-    for (int32_t i=0; i<UCAL_FIELD_COUNT; ++i) {
-        if ((mask & 1) == 0) {
-            fStamp[i] = kInternallySet;
-            fIsSet[i] = TRUE; // Remove later
-        } else {
-            fStamp[i] = kUnset;
-            fIsSet[i] = FALSE; // Remove later
-        }
-        mask >>= 1;
-    }
-
     // We used to check for and correct extreme millis values (near
     // Long.MIN_VALUE or Long.MAX_VALUE) here.  Such values would cause
     // overflows from positive to negative (or vice versa) and had to
@@ -1523,24 +1504,74 @@ void Calendar::computeFields(UErrorCode &ec)
 
     int32_t days =  (int32_t)ClockMath::floorDivide(localMillis, (double)kOneDay);
 
-    internalSet(UCAL_JULIAN_DAY,days + kEpochStartAsJulianDay);
+    if (fDayCacheValid && days == fDayCacheEpochDays) {
+        // Same local day as the previous computation: restore the cached date
+        // fields and fall through to recompute only the time-of-day fields.
+        // The date fields depend only on the Julian day (and the cached week
+        // numbering parameters), so the snapshot is still valid.
+        uprv_arrayCopy(fDayCacheFields, fFields, UCAL_FIELD_COUNT);
+        fGregorianYear = fDayCacheGregorianYear;
+        fGregorianMonth = fDayCacheGregorianMonth;
+        fGregorianDayOfYear = fDayCacheGregorianDayOfYear;
+        fGregorianDayOfMonth = fDayCacheGregorianDayOfMonth;
+        for (int32_t i=0; i<UCAL_FIELD_COUNT; ++i) {
+            fStamp[i] = kInternallySet;
+            fIsSet[i] = TRUE; // Remove later
+        }
+    } else {
+        // Mark fields as set.  Do this before calling handleComputeFields().
+        uint32_t mask =   //fInternalSetMask;
+            (1 << UCAL_ERA) |
+            (1 << UCAL_YEAR) |
+            (1 << UCAL_MONTH) |
+            (1 << UCAL_DAY_OF_MONTH) | // = UCAL_DATE
+            (1 << UCAL_DAY_OF_YEAR) |
+            (1 << UCAL_EXTENDED_YEAR);
+
+        for (int32_t i=0; i<UCAL_FIELD_COUNT; ++i) {
+            if ((mask & 1) == 0) {
+                fStamp[i] = kInternallySet;
+                fIsSet[i] = TRUE; // Remove later
+            } else {
+                fStamp[i] = kUnset;
+                fIsSet[i] = FALSE; // Remove later
+            }
+            mask >>= 1;
+        }
+
+        internalSet(UCAL_JULIAN_DAY,days + kEpochStartAsJulianDay);
 
 #if defined (U_DEBUG_CAL)
-    //fprintf(stderr, "%s:%d- Hmm! Jules @ %d, as per %.0lf millis\n",
-    //__FILE__, __LINE__, fFields[UCAL_JULIAN_DAY], localMillis);
+        //fprintf(stderr, "%s:%d- Hmm! Jules @ %d, as per %.0lf millis\n",
+        //__FILE__, __LINE__, fFields[UCAL_JULIAN_DAY], localMillis);
 #endif
 
-    computeGregorianAndDOWFields(fFields[UCAL_JULIAN_DAY], ec);
-
-    // Call framework method to have subclass compute its fields.
-    // These must include, at a minimum, MONTH, DAY_OF_MONTH,
-    // EXTENDED_YEAR, YEAR, DAY_OF_YEAR.  This method will call internalSet(),
-    // which will update stamp[].
-    handleComputeFields(fFields[UCAL_JULIAN_DAY], ec);
-
-    // Compute week-related fields, based on the subclass-computed
-    // fields computed by handleComputeFields().
-    computeWeekFields(ec);
+        computeGregorianAndDOWFields(fFields[UCAL_JULIAN_DAY], ec);
+
+        // Call framework method to have subclass compute its fields.
+        // These must include, at a minimum, MONTH, DAY_OF_MONTH,
+        // EXTENDED_YEAR, YEAR, DAY_OF_YEAR.  This method will call internalSet(),
+        // which will update stamp[].
+        handleComputeFields(fFields[UCAL_JULIAN_DAY], ec);
+
+        // Compute week-related fields, based on the subclass-computed
+        // fields computed by handleComputeFields().
+        computeWeekFields(ec);
+
+        // Snapshot the date fields so that subsequent conversions landing on
+        // the same local day can skip straight to the time-of-day fields.
+        if (U_SUCCESS(ec)) {
+            fDayCacheEpochDays = days;
+            uprv_arrayCopy(fFields, fDayCacheFields, UCAL_FIELD_COUNT);
+            fDayCacheGregorianYear = fGregorianYear;
+            fDayCacheGregorianMonth = fGregorianMonth;
+            fDayCacheGregorianDayOfYear = fGregorianDayOfYear;
+            fDayCacheGregorianDayOfMonth = fGregorianDayOfMonth;
+            fDayCacheValid = TRUE;
+        } else {
+            fDayCacheValid = FALSE;
+        }
+    }
 
     // Compute time-related fields.  These are indepent of the date and
     // of the subclass algorithm.  They depend only on the local zone
@@ -1605,6 +1636,10 @@ void Calendar::computeGregorianFields(int32_t julianDay, UErrorCode & /* ec */)
     Grego::dayToFields(julianDay - kEpochStartAsJulianDay, fGregorianYear, fGregorianMonth, fGregorianDayOfMonth, gregorianDayOfWeekUnused, fGregorianDayOfYear);
 }
 
+void Calendar::invalidateDayCache() {
+    fDayCacheValid = FALSE;
+}
+
 /**
 * Compute the fields WEEK_OF_YEAR, YEAR_WOY, WEEK_OF_MONTH,
 * DAY_OF_WEEK_IN_MONTH, and DOW_LOCAL from EXTENDED_YEAR, YEAR,
@@ -2478,6 +2513,7 @@ Calendar::setFirstDayOfWeek(UCalendarDaysOfWeek value)
         value >= UCAL_SUNDAY && value <= UCAL_SATURDAY) {
             fFirstDayOfWeek = value;
             fAreFieldsSet = FALSE;
+            fDayCacheValid = FALSE; // week fields depend on this setting
         }
 }
 
@@ -2510,6 +2546,7 @@ Calendar::setMinimalDaysInFirstWeek(uint8_t value)
     if (fMinimalDaysInFirstWeek != value) {
         fMinimalDaysInFirstWeek = value;
         fAreFieldsSet = FALSE;
+        fDayCacheValid = FALSE; // week fields depend on this setting
     }
 }
 
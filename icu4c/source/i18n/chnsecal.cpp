@@ -58,6 +58,12 @@ static icu::CalendarAstronomer *gChineseCalendarAstro = NULL;
 static icu::CalendarCache *gChineseCalendarWinterSolsticeCache = NULL;
 static icu::CalendarCache *gChineseCalendarNewYearCache = NULL;
 
+// Lock-free front caches probed before the mutexed caches above, so that
+// warm year lookups scale across threads. Zero-initialized static storage;
+// entries are pure functions of the year, so they never need invalidation.
+static icu::CalendarFrontCache gChineseCalendarWinterSolsticeFrontCache;
+static icu::CalendarFrontCache gChineseCalendarNewYearFrontCache;
+
 static icu::TimeZone *gChineseCalendarZoneAstroCalc = NULL;
 static icu::UInitOnce gChineseCalendarZoneAstroCalcInitOnce = U_INITONCE_INITIALIZER;
 
@@ -525,8 +531,13 @@ double ChineseCalendar::millisToDays(double millis) const {
  */
 int32_t ChineseCalendar::winterSolstice(int32_t gyear) const {
 
+    int32_t cacheValue = gChineseCalendarWinterSolsticeFrontCache.get(gyear);
+    if (cacheValue != 0) {
+        return cacheValue;
+    }
+
     UErrorCode status = U_ZERO_ERROR;
-    int32_t cacheValue = CalendarCache::get(&gChineseCalendarWinterSolsticeCache, gyear, status);
+    cacheValue = CalendarCache::get(&gChineseCalendarWinterSolsticeCache, gyear, status);
 
     if (cacheValue == 0) {
         // In books December 15 is used, but it fails for some years
@@ -551,6 +562,9 @@ int32_t ChineseCalendar::winterSolstice(int32_t gyear) const {
     if(U_FAILURE(status)) {
         cacheValue = 0;
     }
+    if (cacheValue != 0) {
+        gChineseCalendarWinterSolsticeFrontCache.put(gyear, cacheValue);
+    }
     return cacheValue;
 }
 
@@ -757,8 +771,13 @@ void ChineseCalendar::computeChineseFields(int32_t days, int32_t gyear, int32_t
  * Chinese new year of the given year (this will be a new moon)
  */
 int32_t ChineseCalendar::newYear(int32_t gyear) const {
+    int32_t cacheValue = gChineseCalendarNewYearFrontCache.get(gyear);
+    if (cacheValue != 0) {
+        return cacheValue;
+    }
+
     UErrorCode status = U_ZERO_ERROR;
-    int32_t cacheValue = CalendarCache::get(&gChineseCalendarNewYearCache, gyear, status);
+    cacheValue = CalendarCache::get(&gChineseCalendarNewYearCache, gyear, status);
 
     if (cacheValue == 0) {
 
@@ -780,9 +799,36 @@ int32_t ChineseCalendar::newYear(int32_t gyear) const {
     if(U_FAILURE(status)) {
         cacheValue = 0;
     }
+    if (cacheValue != 0) {
+        gChineseCalendarNewYearFrontCache.put(gyear, cacheValue);
+    }
     return cacheValue;
 }
 
+/**
+ * Warm the winter solstice and new year caches for every Gregorian year
+ * in the given inclusive range.  newYear() pulls in the surrounding
+ * winter solstices, so one pass over the range fills both caches.
+ */
+void ChineseCalendar::precomputeYears(int32_t fromGregorianYear, int32_t toGregorianYear,
+                                      UErrorCode& status) const {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (fromGregorianYear > toGregorianYear) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    for (int32_t gyear = fromGregorianYear; gyear <= toGregorianYear; gyear++) {
+        if (newYear(gyear) == 0) {
+            // newYear() reports failure (typically a memory allocation
+            // error in the underlying cache) by returning 0.
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+    }
+}
+
 /**
  * Adjust this calendar to be delta months before or after a given
  * start position, pinning the day of month if necessary.  The start
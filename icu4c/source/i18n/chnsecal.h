@@ -175,6 +175,20 @@ class U_I18N_API ChineseCalendar : public Calendar {
   virtual void roll(UCalendarDateFields field, int32_t amount, UErrorCode &status);
   virtual void roll(EDateFields field, int32_t amount, UErrorCode &status);
 
+  /**
+   * Precompute the winter solstice and Chinese new year of every Gregorian
+   * year in the given inclusive range, warming the shared astronomical
+   * caches. A bulk conversion job can call this once up front so that its
+   * worker threads hit only the lock-free cached values afterwards.
+   *
+   * @param fromGregorianYear the first Gregorian year to precompute
+   * @param toGregorianYear the last Gregorian year to precompute, inclusive
+   * @param status output param set to success/failure code on exit
+   * @internal
+   */
+  void precomputeYears(int32_t fromGregorianYear, int32_t toGregorianYear,
+                       UErrorCode& status) const;
+
   //----------------------------------------------------------------------
   // Internal methods & astronomical calculations
   //----------------------------------------------------------------------
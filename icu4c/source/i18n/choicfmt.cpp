@@ -77,7 +77,11 @@ static const UChar RIGHT_CURLY_BRACE = 0x7D;    /*}*/
 ChoiceFormat::ChoiceFormat(const UnicodeString& newPattern,
                            UErrorCode& status)
 : constructorErrorCode(status),
-  msgPattern(status)
+  msgPattern(status),
+  fBoundaries(NULL),
+  fBoundaryStrict(NULL),
+  fBucketMsgStart(NULL),
+  fBucketCount(0)
 {
     applyPattern(newPattern, status);
 }
@@ -90,7 +94,11 @@ ChoiceFormat::ChoiceFormat(const double* limits,
                            const UnicodeString* formats, 
                            int32_t cnt )
 : constructorErrorCode(U_ZERO_ERROR),
-  msgPattern(constructorErrorCode)
+  msgPattern(constructorErrorCode),
+  fBoundaries(NULL),
+  fBoundaryStrict(NULL),
+  fBucketMsgStart(NULL),
+  fBucketCount(0)
 {
     setChoices(limits, NULL, formats, cnt, constructorErrorCode);
 }
@@ -102,7 +110,11 @@ ChoiceFormat::ChoiceFormat(const double* limits,
                            const UnicodeString* formats, 
                            int32_t cnt )
 : constructorErrorCode(U_ZERO_ERROR),
-  msgPattern(constructorErrorCode)
+  msgPattern(constructorErrorCode),
+  fBoundaries(NULL),
+  fBoundaryStrict(NULL),
+  fBucketMsgStart(NULL),
+  fBucketCount(0)
 {
     setChoices(limits, closures, formats, cnt, constructorErrorCode);
 }
@@ -113,8 +125,13 @@ ChoiceFormat::ChoiceFormat(const double* limits,
 ChoiceFormat::ChoiceFormat(const    ChoiceFormat&   that) 
 : NumberFormat(that),
   constructorErrorCode(that.constructorErrorCode),
-  msgPattern(that.msgPattern)
+  msgPattern(that.msgPattern),
+  fBoundaries(NULL),
+  fBoundaryStrict(NULL),
+  fBucketMsgStart(NULL),
+  fBucketCount(0)
 {
+    compileIntervals();
 }
 
 // -------------------------------------
@@ -126,7 +143,11 @@ ChoiceFormat::ChoiceFormat(const UnicodeString& newPattern,
                            UParseError& parseError,
                            UErrorCode& status)
 : constructorErrorCode(status),
-  msgPattern(status)
+  msgPattern(status),
+  fBoundaries(NULL),
+  fBoundaryStrict(NULL),
+  fBucketMsgStart(NULL),
+  fBucketCount(0)
 {
     applyPattern(newPattern,parseError, status);
 }
@@ -151,6 +172,7 @@ ChoiceFormat::operator=(const   ChoiceFormat& that)
         NumberFormat::operator=(that);
         constructorErrorCode = that.constructorErrorCode;
         msgPattern = that.msgPattern;
+        compileIntervals();
     }
     return *this;
 }
@@ -159,6 +181,9 @@ ChoiceFormat::operator=(const   ChoiceFormat& that)
 
 ChoiceFormat::~ChoiceFormat()
 {
+    uprv_free(fBoundaries);
+    uprv_free(fBoundaryStrict);
+    uprv_free(fBucketMsgStart);
 }
 
 // -------------------------------------
@@ -227,6 +252,7 @@ ChoiceFormat::applyPattern(const UnicodeString& pattern,
 {
     msgPattern.parseChoiceStyle(pattern, NULL, status);
     constructorErrorCode = status;
+    compileIntervals();
 }
 
 // -------------------------------------
@@ -239,6 +265,7 @@ ChoiceFormat::applyPattern(const UnicodeString& pattern,
 {
     msgPattern.parseChoiceStyle(pattern, &parseError, status);
     constructorErrorCode = status;
+    compileIntervals();
 }
 // -------------------------------------
 // Returns the input pattern string.
@@ -408,7 +435,12 @@ ChoiceFormat::format(double number,
         return appendTo;
     }
     // Get the appropriate sub-message.
-    int32_t msgStart = findSubMessage(msgPattern, 0, number);
+    int32_t msgStart;
+    if (fBucketCount > 0) {
+        msgStart = fBucketMsgStart[findBucket(number)];
+    } else {
+        msgStart = findSubMessage(msgPattern, 0, number);
+    }
     if (!MessageImpl::jdkAposMode(msgPattern)) {
         int32_t patternStart = msgPattern.getPart(msgStart).getLimit();
         int32_t msgLimit = msgPattern.getLimitPartIndex(msgStart);
@@ -462,6 +494,102 @@ ChoiceFormat::findSubMessage(const MessagePattern &pattern, int32_t partIndex, d
     return msgStart;
 }
 
+// -------------------------------------
+// Builds the interval table for binary search in format(double).
+
+void
+ChoiceFormat::compileIntervals() {
+    uprv_free(fBoundaries);
+    fBoundaries = NULL;
+    uprv_free(fBoundaryStrict);
+    fBoundaryStrict = NULL;
+    uprv_free(fBucketMsgStart);
+    fBucketMsgStart = NULL;
+    fBucketCount = 0;
+    int32_t count = msgPattern.countParts();
+    if (U_FAILURE(constructorErrorCode) || count == 0) {
+        return;
+    }
+    // First walk: count the sub-messages, iterating like findSubMessage().
+    int32_t numBuckets = 0;
+    int32_t partIndex = 2;
+    for (;;) {
+        ++numBuckets;
+        partIndex = msgPattern.getLimitPartIndex(partIndex);
+        if (++partIndex >= count ||
+                msgPattern.getPart(partIndex).getType() == UMSGPAT_PART_TYPE_ARG_LIMIT) {
+            break;
+        }
+        partIndex += 2;  // skip the boundary number and selector
+    }
+    fBoundaries = (double *)uprv_malloc(numBuckets * sizeof(double));
+    fBoundaryStrict = (UBool *)uprv_malloc(numBuckets * sizeof(UBool));
+    fBucketMsgStart = (int32_t *)uprv_malloc(numBuckets * sizeof(int32_t));
+    if (fBoundaries == NULL || fBoundaryStrict == NULL || fBucketMsgStart == NULL) {
+        uprv_free(fBoundaries);
+        fBoundaries = NULL;
+        uprv_free(fBoundaryStrict);
+        fBoundaryStrict = NULL;
+        uprv_free(fBucketMsgStart);
+        fBucketMsgStart = NULL;
+        return;  // fall back to the linear scan
+    }
+    // Second walk: record sub-message starts and the boundaries between them.
+    int32_t bucket = 0;
+    partIndex = 2;
+    for (;;) {
+        fBucketMsgStart[bucket++] = partIndex;
+        partIndex = msgPattern.getLimitPartIndex(partIndex);
+        if (++partIndex >= count) {
+            break;
+        }
+        const MessagePattern::Part &part = msgPattern.getPart(partIndex++);
+        if (part.getType() == UMSGPAT_PART_TYPE_ARG_LIMIT) {
+            break;
+        }
+        double boundary = msgPattern.getNumericValue(part);
+        int32_t selectorIndex = msgPattern.getPatternIndex(partIndex++);
+        // fBoundaries[k] guards entry into bucket k+1.
+        fBoundaries[bucket - 1] = boundary;
+        fBoundaryStrict[bucket - 1] =
+                (UBool)(msgPattern.getPatternString().charAt(selectorIndex) == LESS_THAN);
+        // Binary search requires the pass/fail predicate to be monotonic,
+        // which holds if the boundaries are strictly ascending.
+        if (bucket >= 2 && !(fBoundaries[bucket - 2] < boundary)) {
+            uprv_free(fBoundaries);
+            fBoundaries = NULL;
+            uprv_free(fBoundaryStrict);
+            fBoundaryStrict = NULL;
+            uprv_free(fBucketMsgStart);
+            fBucketMsgStart = NULL;
+            return;  // fall back to the linear scan
+        }
+    }
+    fBucketCount = bucket;
+}
+
+// -------------------------------------
+// Binary search over the precompiled boundaries.
+
+int32_t
+ChoiceFormat::findBucket(double number) const {
+    int32_t lo = 0;
+    int32_t hi = fBucketCount - 1;
+    while (lo < hi) {
+        int32_t mid = (lo + hi + 1) / 2;
+        double boundary = fBoundaries[mid - 1];
+        // Same comparisons as in findSubMessage(); NaN fails every boundary
+        // and therefore selects the first sub-message.
+        UBool pass = fBoundaryStrict[mid - 1] ? (number > boundary) : (number >= boundary);
+        if (pass) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return lo;
+}
+
 // -------------------------------------
 // Formats an array of objects. Checks if the data type of the objects
 // to get the right value for formatting.  
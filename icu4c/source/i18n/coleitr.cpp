@@ -277,21 +277,44 @@ void CollationElementIterator::setText(const UnicodeString& source,
         return;
     }
 
-    string_ = source;
+    // Keep a read-only alias if the source is one (e.g., from ucol_setText()),
+    // rather than copying the text.
+    string_.fastCopyFrom(source);
     const UChar *s = string_.getBuffer();
-    CollationIterator *newIter;
+    const UChar *limit = s + string_.length();
     UBool numeric = rbc_->settings->isNumeric();
+    // Reuse the existing iterator if it has the right type and numeric mode,
+    // keeping its grown-to-size CE buffer; usearch_setText() and other
+    // repeated-search callers then set new text without any allocation.
+    FCDUTF16CollationIterator *fcdIter = dynamic_cast<FCDUTF16CollationIterator *>(iter_);
     if (rbc_->settings->dontCheckFCD()) {
-        newIter = new UTF16CollationIterator(rbc_->data, numeric, s, s, s + string_.length());
+        UTF16CollationIterator *u16Iter = dynamic_cast<UTF16CollationIterator *>(iter_);
+        if (u16Iter != NULL && fcdIter == NULL && u16Iter->isNumericCollation() == numeric) {
+            u16Iter->setText(s, s, limit);
+        } else {
+            UTF16CollationIterator *newIter =
+                new UTF16CollationIterator(rbc_->data, numeric, s, s, limit);
+            if (newIter == NULL) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+                return;
+            }
+            delete iter_;
+            iter_ = newIter;
+        }
     } else {
-        newIter = new FCDUTF16CollationIterator(rbc_->data, numeric, s, s, s + string_.length());
-    }
-    if (newIter == NULL) {
-        status = U_MEMORY_ALLOCATION_ERROR;
-        return;
+        if (fcdIter != NULL && fcdIter->isNumericCollation() == numeric) {
+            fcdIter->setText(s, s, limit);
+        } else {
+            FCDUTF16CollationIterator *newIter =
+                new FCDUTF16CollationIterator(rbc_->data, numeric, s, s, limit);
+            if (newIter == NULL) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+                return;
+            }
+            delete iter_;
+            iter_ = newIter;
+        }
     }
-    delete iter_;
-    iter_ = newIter;
     otherHalf_ = 0;
     dir_ = 0;
 }
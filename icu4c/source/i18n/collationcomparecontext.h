@@ -0,0 +1,59 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+* collationcomparecontext.h
+*
+* created on: 2018sep14
+*/
+
+#ifndef __COLLATIONCOMPARECONTEXT_H__
+#define __COLLATIONCOMPARECONTEXT_H__
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_COLLATION
+
+#include "collationdata.h"
+#include "utf16collationiterator.h"
+
+U_NAMESPACE_BEGIN
+
+/**
+ * Reusable scratch for RuleBasedCollator::internalCompare().
+ *
+ * Keeps one pair of collation iterators alive across comparisons so that
+ * their CEBuffers, once grown, stay grown, and std::sort-style runs of
+ * millions of comparisons do not hit the allocator at all.
+ *
+ * A context is tied to the collator (and to its numeric setting) that
+ * created it, and must be used by only one thread at a time;
+ * keep one instance per thread.
+ *
+ * Created via RuleBasedCollator::internalCreateCompareContext().
+ */
+class U_I18N_API CollationCompareContext : public UMemory {
+public:
+    CollationCompareContext(const CollationData *d, UBool num)
+            : data(d), numeric(num),
+              leftIter(d, num, NULL, NULL, NULL),
+              rightIter(d, num, NULL, NULL, NULL),
+              leftFCDIter(d, num, NULL, NULL, NULL),
+              rightFCDIter(d, num, NULL, NULL, NULL) {}
+
+    const CollationData *data;
+    UBool numeric;
+    UTF16CollationIterator leftIter;
+    UTF16CollationIterator rightIter;
+    FCDUTF16CollationIterator leftFCDIter;
+    FCDUTF16CollationIterator rightFCDIter;
+
+private:
+    CollationCompareContext(const CollationCompareContext &);
+    void operator=(const CollationCompareContext &);
+};
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_COLLATION
+#endif  // __COLLATIONCOMPARECONTEXT_H__
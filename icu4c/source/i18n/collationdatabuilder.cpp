@@ -1210,6 +1210,12 @@ CollationDataBuilder::setLeadSurrogates(UErrorCode &errorCode) {
 
 void
 CollationDataBuilder::build(CollationData &data, UErrorCode &errorCode) {
+    buildMappingsPhase(data, errorCode);
+    buildFastLatinPhase(data, errorCode);
+}
+
+void
+CollationDataBuilder::buildMappingsPhase(CollationData &data, UErrorCode &errorCode) {
     buildMappings(data, errorCode);
     if(base != NULL) {
         data.numericPrimary = base->numericPrimary;
@@ -1219,7 +1225,6 @@ CollationDataBuilder::build(CollationData &data, UErrorCode &errorCode) {
         data.scriptStarts = base->scriptStarts;
         data.scriptStartsLength = base->scriptStartsLength;
     }
-    buildFastLatinTable(data, errorCode);
 }
 
 void
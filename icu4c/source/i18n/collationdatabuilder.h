@@ -153,6 +153,24 @@ public:
     void enableFastLatin() { fastLatinEnabled = TRUE; }
     virtual void build(CollationData &data, UErrorCode &errorCode);
 
+    /**
+     * First phase of build(): freezes the mappings into data.
+     * After this phase the builder's trie is frozen and data is usable
+     * for collation, except that it has no fast-Latin table yet.
+     */
+    void buildMappingsPhase(CollationData &data, UErrorCode &errorCode);
+
+    /**
+     * Second phase of build(): builds the fast-Latin table.
+     * Reads only the immutable result of buildMappingsPhase(), so a caller
+     * that manages its own worker threads can run this phase off the
+     * collator-open path (or on another thread, as long as data is not used
+     * for comparisons until this phase is done).
+     */
+    void buildFastLatinPhase(CollationData &data, UErrorCode &errorCode) {
+        buildFastLatinTable(data, errorCode);
+    }
+
     /**
      * Looks up CEs for s and appends them to the ces array.
      * Does not handle normalization: s should be in FCD form.
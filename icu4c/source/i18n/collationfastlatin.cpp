@@ -16,6 +16,7 @@
 #if !UCONFIG_NO_COLLATION
 
 #include "unicode/ucol.h"
+#include "cmemory.h"
 #include "collationdata.h"
 #include "collationfastlatin.h"
 #include "collationsettings.h"
@@ -23,6 +24,30 @@
 
 U_NAMESPACE_BEGIN
 
+namespace {
+
+/**
+ * Tests whether the next four UTF-16 code units are all ASCII,
+ * with one 64-bit load & mask rather than four compares.
+ * The caller guarantees that at least four units are readable.
+ */
+inline UBool allASCII4(const UChar *s) {
+    uint64_t block;
+    uprv_memcpy(&block, s, sizeof(block));
+    return (block & UINT64_C(0xff80ff80ff80ff80)) == 0;
+}
+
+/**
+ * Same as allASCII4() but for eight UTF-8 bytes.
+ */
+inline UBool allASCII8(const uint8_t *s) {
+    uint64_t block;
+    uprv_memcpy(&block, s, sizeof(block));
+    return (block & UINT64_C(0x8080808080808080)) == 0;
+}
+
+}  // namespace
+
 int32_t
 CollationFastLatin::getOptions(const CollationData *data, const CollationSettings &settings,
                                uint16_t *primaries, int32_t capacity) {
@@ -127,6 +152,35 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
      * If there is only one, then it is in the lower bits, and the upper bits are 0.
      */
     uint32_t leftPair = 0, rightPair = 0;
+    // Fast path, processing blocks of four code units:
+    // While both sides are all-ASCII with simple, single mini CEs
+    // (as the primaries table distinguishes), compare mini primaries directly,
+    // without the full per-character branches of the loop below.
+    // Drops to the general loop at the first "hard" character.
+    // Requires explicit lengths, not NUL-terminated strings.
+    if(leftLength >= 0 && rightLength >= 0) {
+        UBool simple = TRUE;
+        while(simple && leftIndex + 4 <= leftLength && rightIndex + 4 <= rightLength &&
+                allASCII4(left + leftIndex) && allASCII4(right + rightIndex)) {
+            for(int32_t i = 0; i < 4; ++i) {
+                uint32_t leftPrimary = primaries[left[leftIndex]];
+                uint32_t rightPrimary = primaries[right[rightIndex]];
+                if(leftPrimary == 0 || leftPrimary > 0xffff ||
+                        rightPrimary == 0 || rightPrimary > 0xffff) {
+                    // Digit, punctuation, contraction starter, or expansion:
+                    // re-fetch this character in the general loop.
+                    simple = FALSE;
+                    break;
+                }
+                ++leftIndex;
+                ++rightIndex;
+                if(leftPrimary != rightPrimary) {
+                    // Return the primary difference.
+                    return (leftPrimary < rightPrimary) ? UCOL_LESS : UCOL_GREATER;
+                }
+            }
+        }
+    }
     for(;;) {
         // We fetch CEs until we get a non-ignorable primary or reach the end.
         while(leftPair == 0) {
@@ -463,6 +517,31 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
      * If there is only one, then it is in the lower bits, and the upper bits are 0.
      */
     uint32_t leftPair = 0, rightPair = 0;
+    // Fast path, processing blocks of eight bytes:
+    // same as in compareUTF16() but with a byte-wise ASCII test.
+    if(leftLength >= 0 && rightLength >= 0) {
+        UBool simple = TRUE;
+        while(simple && leftIndex + 8 <= leftLength && rightIndex + 8 <= rightLength &&
+                allASCII8(left + leftIndex) && allASCII8(right + rightIndex)) {
+            for(int32_t i = 0; i < 8; ++i) {
+                uint32_t leftPrimary = primaries[left[leftIndex]];
+                uint32_t rightPrimary = primaries[right[rightIndex]];
+                if(leftPrimary == 0 || leftPrimary > 0xffff ||
+                        rightPrimary == 0 || rightPrimary > 0xffff) {
+                    // Digit, punctuation, contraction starter, or expansion:
+                    // re-fetch this character in the general loop.
+                    simple = FALSE;
+                    break;
+                }
+                ++leftIndex;
+                ++rightIndex;
+                if(leftPrimary != rightPrimary) {
+                    // Return the primary difference.
+                    return (leftPrimary < rightPrimary) ? UCOL_LESS : UCOL_GREATER;
+                }
+            }
+        }
+    }
     // Note: There is no need to assemble the code point.
     // We only need to look up the table entry for the character,
     // and nextPair() looks for whether c==0.
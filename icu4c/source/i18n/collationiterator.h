@@ -209,6 +209,9 @@ public:
         if(cesIndex == ceBuffer.length) { clearCEs(); }
     }
 
+    /** Returns whether this iterator was created for numeric collation. */
+    UBool isNumericCollation() const { return isNumeric; }
+
     /**
      * Returns the next code point (with post-increment).
      * Public for identical-level comparison and for testing.
@@ -27,7 +27,7 @@ CompactDecimalFormat::createInstance(const Locale& inLocale, UNumberCompactStyle
 
 CompactDecimalFormat::CompactDecimalFormat(const Locale& inLocale, UNumberCompactStyle style,
                                            UErrorCode& status)
-        : DecimalFormat(new DecimalFormatSymbols(inLocale, status), status) {
+        : DecimalFormat(DecimalFormatSymbols::createForLocale(inLocale, status), status) {
     if (U_FAILURE(status)) return;
     // Minimal properties: let the non-shim code path do most of the logic for us.
     fields->properties->compactStyle = style;
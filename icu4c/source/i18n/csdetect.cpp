@@ -229,6 +229,45 @@ int32_t CharsetDetector::getDetectableCount()
 
 const CharsetMatch *CharsetDetector::detect(UErrorCode &status)
 {
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+
+    if (textIn->isSet() && fFreshTextSet) {
+        //   Like detectAll(), but stop scanning as soon as a recognizer
+        //   reports a definitive match (confidence 100, e.g. from a BOM
+        //   or other signature): no later recognizer can outrank it,
+        //   so the remaining recognizers need not look at the input.
+        CharsetRecognizer *csr;
+        int32_t            i;
+
+        textIn->MungeInput(fStripTags);
+
+        resultCount = 0;
+        for (i = 0; i < fCSRecognizers_size; i += 1) {
+            csr = fCSRecognizers[i]->recognizer;
+            if (csr->match(textIn, resultArray[resultCount])) {
+                if (resultArray[resultCount]->getConfidence() == 100) {
+                    // Leave fFreshTextSet on so that a later detectAll()
+                    // still runs the full recognizer list.
+                    return resultArray[resultCount];
+                }
+                resultCount++;
+            }
+        }
+
+        if (resultCount > 1) {
+            uprv_sortArray(resultArray, resultCount, sizeof resultArray[0], charsetMatchComparator, NULL, TRUE, &status);
+        }
+        fFreshTextSet = FALSE;
+
+        if (resultCount > 0) {
+            return resultArray[0];
+        } else {
+            return NULL;
+        }
+    }
+
     int32_t maxMatchesFound = 0;
 
     detectAll(maxMatchesFound, status);
@@ -424,7 +463,8 @@ static const UEnumeration gCSDetEnumeration = {
     enumCount,
     uenum_unextDefault,
     enumNext,
-    enumReset
+    enumReset,
+    NULL  /* drain */
 };
 
 U_CDECL_END
@@ -101,7 +101,7 @@ public:
     virtual const DateFmtBestPattern *createObject(
             const void * /*unused*/, UErrorCode &status) const {
         LocalPointer<DateTimePatternGenerator> dtpg(
-                    DateTimePatternGenerator::createInstance(fLoc, status));
+                    DateTimePatternGenerator::createInstanceFromCache(fLoc, status));
         if (U_FAILURE(status)) {
             return NULL;
         }
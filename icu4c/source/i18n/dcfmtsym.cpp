@@ -39,6 +39,8 @@
 #include "ureslocs.h"
 #include "charstr.h"
 #include "uassert.h"
+#include "shareddecimalformatsymbols.h"
+#include "unifiedcache.h"
 
 // *****************************************************************************
 // class DecimalFormatSymbols
@@ -46,6 +48,27 @@
 
 U_NAMESPACE_BEGIN
 
+SharedDecimalFormatSymbols::~SharedDecimalFormatSymbols() {
+}
+
+template<> U_I18N_API
+const SharedDecimalFormatSymbols *
+        LocaleCacheKey<SharedDecimalFormatSymbols>::createObject(
+                const void * /*unusedContext*/, UErrorCode &status) const {
+    SharedDecimalFormatSymbols *shared
+            = new SharedDecimalFormatSymbols(fLoc, status);
+    if (shared == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    if (U_FAILURE(status)) {
+        delete shared;
+        return NULL;
+    }
+    shared->addRef();
+    return shared;
+}
+
 UOBJECT_DEFINE_RTTI_IMPLEMENTATION(DecimalFormatSymbols)
 
 static const char gNumberElements[] = "NumberElements";
@@ -131,6 +154,22 @@ DecimalFormatSymbols::createWithLastResortData(UErrorCode& status) {
     return sym;
 }
 
+DecimalFormatSymbols* U_EXPORT2
+DecimalFormatSymbols::createForLocale(const Locale& locale, UErrorCode& status) {
+    const SharedDecimalFormatSymbols *shared = NULL;
+    UnifiedCache::getByLocale(locale, shared, status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    DecimalFormatSymbols *result = new DecimalFormatSymbols(shared->get());
+    shared->removeRef();
+    if (result == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    return result;
+}
+
 // -------------------------------------
 
 DecimalFormatSymbols::~DecimalFormatSymbols()
@@ -141,7 +180,7 @@ DecimalFormatSymbols::~DecimalFormatSymbols()
 // copy constructor
 
 DecimalFormatSymbols::DecimalFormatSymbols(const DecimalFormatSymbols &source)
-    : UObject(source)
+    : UObject(source), currPattern(NULL)
 {
     *this = source;
 }
@@ -164,6 +203,9 @@ DecimalFormatSymbols::operator=(const DecimalFormatSymbols& rhs)
         locale = rhs.locale;
         uprv_strcpy(validLocale, rhs.validLocale);
         uprv_strcpy(actualLocale, rhs.actualLocale);
+        // points into the resource bundle data, which lives for the
+        // lifetime of the process
+        currPattern = rhs.currPattern;
         fIsCustomCurrencySymbol = rhs.fIsCustomCurrencySymbol; 
         fIsCustomIntlCurrencySymbol = rhs.fIsCustomIntlCurrencySymbol; 
         fCodePointZero = rhs.fCodePointZero;
@@ -115,7 +115,8 @@ DecimalFormat::DecimalFormat(const DecimalFormatSymbols* symbolsToAdopt, UErrorC
     fields->properties.adoptInsteadAndCheckErrorCode(new DecimalFormatProperties(), status);
     fields->exportedProperties.adoptInsteadAndCheckErrorCode(new DecimalFormatProperties(), status);
     if (adoptedSymbols.isNull()) {
-        fields->symbols.adoptInsteadAndCheckErrorCode(new DecimalFormatSymbols(status), status);
+        fields->symbols.adoptInsteadAndCheckErrorCode(
+                DecimalFormatSymbols::createForLocale(Locale::getDefault(), status), status);
     } else {
         fields->symbols.adoptInsteadAndCheckErrorCode(adoptedSymbols.orphan(), status);
     }
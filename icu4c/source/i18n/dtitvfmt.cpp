@@ -148,6 +148,7 @@ DateIntervalFormat::DateIntervalFormat(const DateIntervalFormat& itvfmt)
 DateIntervalFormat&
 DateIntervalFormat::operator=(const DateIntervalFormat& itvfmt) {
     if ( this != &itvfmt ) {
+        deleteSegmentFormats();
         delete fDateFormat;
         delete fInfo;
         delete fFromCalendar;
@@ -187,12 +188,18 @@ DateIntervalFormat::operator=(const DateIntervalFormat& itvfmt) {
         fDatePattern    = (itvfmt.fDatePattern)?    (UnicodeString*)itvfmt.fDatePattern->clone(): NULL;
         fTimePattern    = (itvfmt.fTimePattern)?    (UnicodeString*)itvfmt.fTimePattern->clone(): NULL;
         fDateTimeFormat = (itvfmt.fDateTimeFormat)? (UnicodeString*)itvfmt.fDateTimeFormat->clone(): NULL;
+        // Rebuild the pre-split segment formatters from the copied interval
+        // patterns; failure just leaves NULL slots and formatImpl() falls
+        // back to applying patterns on fDateFormat.
+        UErrorCode segStatus = U_ZERO_ERROR;
+        initSegmentFormats(segStatus);
     }
     return *this;
 }
 
 
 DateIntervalFormat::~DateIntervalFormat() {
+    deleteSegmentFormats();
     delete fInfo;
     delete fDateFormat;
     delete fFromCalendar;
@@ -388,6 +395,22 @@ DateIntervalFormat::formatImpl(Calendar& fromCalendar,
         firstCal = &fromCalendar;
         secondCal = &toCalendar;
     }
+    // Fast path: use the pre-split segment formatters when available,
+    // avoiding the applyPattern() round trips on the shared fDateFormat.
+    SimpleDateFormat* firstFmt = fSegmentFormats[2 * itvPtnIndex];
+    SimpleDateFormat* secondFmt = fSegmentFormats[2 * itvPtnIndex + 1];
+    if ( firstFmt != NULL ) {
+        firstFmt->format(*firstCal, appendTo, pos);
+        if ( secondFmt != NULL ) {
+            FieldPosition otherPos;
+            otherPos.setField(pos.getField());
+            secondFmt->format(*secondCal, appendTo, otherPos);
+            if (pos.getEndIndex() == 0 && otherPos.getEndIndex() > 0) {
+                pos = otherPos;
+            }
+        }
+        return appendTo;
+    }
     // break the interval pattern into 2 parts,
     // first part should not be empty,
     UnicodeString originalPattern;
@@ -443,6 +466,8 @@ DateIntervalFormat::setDateIntervalInfo(const DateIntervalInfo& newItvPattern,
 
     if (fDateFormat) {
         initializePattern(status);
+        deleteSegmentFormats();
+        initSegmentFormats(status);
     }
 }
 
@@ -529,6 +554,7 @@ DateIntervalFormat::DateIntervalFormat(const Locale& locale,
         fToCalendar = fDateFormat->getCalendar()->clone();
     }
     initializePattern(status);
+    initSegmentFormats(status);
 }
 
 DateIntervalFormat* U_EXPORT2
@@ -550,6 +576,48 @@ DateIntervalFormat::create(const Locale& locale,
 }
 
 
+void
+DateIntervalFormat::initSegmentFormats(UErrorCode& status) {
+    if ( U_FAILURE(status) || fDateFormat == NULL ) {
+        return;
+    }
+    for ( int32_t i = 0; i < DateIntervalInfo::kIPI_MAX_INDEX; ++i ) {
+        const PatternInfo& intervalPattern = fIntervalPatterns[i];
+        // An empty first part means either no interval pattern at all or a
+        // fall-back full pattern stored in the second part; both go through
+        // the slow path in formatImpl().
+        if ( intervalPattern.firstPart.isEmpty() ) {
+            continue;
+        }
+        SimpleDateFormat* firstFmt = (SimpleDateFormat*)fDateFormat->clone();
+        if ( firstFmt == NULL ) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        firstFmt->applyPattern(intervalPattern.firstPart);
+        fSegmentFormats[2 * i] = firstFmt;
+        if ( !intervalPattern.secondPart.isEmpty() ) {
+            SimpleDateFormat* secondFmt = (SimpleDateFormat*)fDateFormat->clone();
+            if ( secondFmt == NULL ) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+                return;
+            }
+            secondFmt->applyPattern(intervalPattern.secondPart);
+            fSegmentFormats[2 * i + 1] = secondFmt;
+        }
+    }
+}
+
+
+void
+DateIntervalFormat::deleteSegmentFormats() {
+    for ( int32_t i = 0; i < 2 * DateIntervalInfo::kIPI_MAX_INDEX; ++i ) {
+        delete fSegmentFormats[i];
+        fSegmentFormats[i] = NULL;
+    }
+}
+
+
 
 /**
  * Initialize interval patterns locale to this formatter
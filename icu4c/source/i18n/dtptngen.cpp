@@ -38,6 +38,8 @@
 #include "uhash.h"
 #include "uresimp.h"
 #include "dtptngen_impl.h"
+#include "shareddatetimepatterngenerator.h"
+#include "unifiedcache.h"
 #include "ucln_in.h"
 #include "charstr.h"
 #include "uassert.h"
@@ -310,6 +312,52 @@ DateTimePatternGenerator::createInstance(const Locale& locale, UErrorCode& statu
     return U_SUCCESS(status) ? result.orphan() : nullptr;
 }
 
+SharedDateTimePatternGenerator::~SharedDateTimePatternGenerator() {
+    delete ptr;
+}
+
+template<> U_I18N_API
+const SharedDateTimePatternGenerator *
+LocaleCacheKey<SharedDateTimePatternGenerator>::createObject(
+        const void * /*creationContext*/, UErrorCode &status) const {
+    DateTimePatternGenerator *dtpg = DateTimePatternGenerator::createInstance(fLoc, status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    SharedDateTimePatternGenerator *shared = new SharedDateTimePatternGenerator(dtpg);
+    if (shared == nullptr) {
+        delete dtpg;
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return nullptr;
+    }
+    shared->addRef();
+    return shared;
+}
+
+DateTimePatternGenerator* U_EXPORT2
+DateTimePatternGenerator::createInstanceFromCache(const Locale& locale, UErrorCode& status) {
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    const SharedDateTimePatternGenerator *shared = nullptr;
+    UnifiedCache::getByLocale(locale, shared, status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    DateTimePatternGenerator *result = new DateTimePatternGenerator(*shared->get());
+    shared->removeRef();
+    if (result == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return nullptr;
+    }
+    if (U_FAILURE(result->internalErrorCode)) {
+        status = result->internalErrorCode;
+        delete result;
+        return nullptr;
+    }
+    return result;
+}
+
 DateTimePatternGenerator*  U_EXPORT2
 DateTimePatternGenerator::createEmptyInstance(UErrorCode& status) {
     if (U_FAILURE(status)) {
@@ -323,6 +371,7 @@ DateTimePatternGenerator::createEmptyInstance(UErrorCode& status) {
 DateTimePatternGenerator::DateTimePatternGenerator(UErrorCode &status) :
     skipMatcher(nullptr),
     fAvailableFormatKeyHash(nullptr),
+    fBestPatternMemo(nullptr),
     internalErrorCode(U_ZERO_ERROR)
 {
     fp = new FormatParser();
@@ -337,6 +386,7 @@ DateTimePatternGenerator::DateTimePatternGenerator(UErrorCode &status) :
 DateTimePatternGenerator::DateTimePatternGenerator(const Locale& locale, UErrorCode &status) :
     skipMatcher(nullptr),
     fAvailableFormatKeyHash(nullptr),
+    fBestPatternMemo(nullptr),
     internalErrorCode(U_ZERO_ERROR)
 {
     fp = new FormatParser();
@@ -355,6 +405,7 @@ DateTimePatternGenerator::DateTimePatternGenerator(const DateTimePatternGenerato
     UObject(),
     skipMatcher(nullptr),
     fAvailableFormatKeyHash(nullptr),
+    fBestPatternMemo(nullptr),
     internalErrorCode(U_ZERO_ERROR)
 {
     fp = new FormatParser();
@@ -373,6 +424,7 @@ DateTimePatternGenerator::operator=(const DateTimePatternGenerator& other) {
     if (&other == this) {
         return *this;
     }
+    clearBestPatternMemo();
     internalErrorCode = other.internalErrorCode;
     pLocale = other.pLocale;
     fDefaultHourFormatChar = other.fDefaultHourFormatChar;
@@ -443,6 +495,7 @@ DateTimePatternGenerator::~DateTimePatternGenerator() {
     if (fAvailableFormatKeyHash!=nullptr) {
         delete fAvailableFormatKeyHash;
     }
+    delete fBestPatternMemo;
 
     if (fp != nullptr) delete fp;
     if (dtMatcher != nullptr) delete dtMatcher;
@@ -997,6 +1050,7 @@ DateTimePatternGenerator::setAppendItemFormat(UDateTimePatternField field, const
     appendItemFormats[field] = value;
     // NUL-terminate for the C API.
     appendItemFormats[field].getTerminatedBuffer();
+    clearBestPatternMemo();
 }
 
 const UnicodeString&
@@ -1007,6 +1061,7 @@ DateTimePatternGenerator::getAppendItemFormat(UDateTimePatternField field) const
 void
 DateTimePatternGenerator::setAppendItemName(UDateTimePatternField field, const UnicodeString& value) {
     setFieldDisplayName(field, UDATPG_WIDTH_APPENDITEM, value);
+    clearBestPatternMemo();
 }
 
 const UnicodeString&
@@ -1052,6 +1107,49 @@ DateTimePatternGenerator::getBestPattern(const UnicodeString& patternForm, UDate
         status = internalErrorCode;
         return UnicodeString();
     }
+    // Probe the memo first: callers tend to resolve the same few skeletons
+    // repeatedly, and the matching walk below is far more expensive than a
+    // hash lookup.
+    UnicodeString memoKey(patternForm);
+    memoKey.append((UChar)0x0001);  // separator; cannot occur in a skeleton
+    memoKey.append((UChar)((uint32_t)options & 0xFFFF));
+    memoKey.append((UChar)(((uint32_t)options >> 16) & 0xFFFF));
+    if (fBestPatternMemo != nullptr) {
+        const UnicodeString *memoized =
+                static_cast<const UnicodeString *>(fBestPatternMemo->get(memoKey));
+        if (memoized != nullptr) {
+            return *memoized;
+        }
+    }
+    UnicodeString result = computeBestPattern(patternForm, options, status);
+    if (U_SUCCESS(status)) {
+        // A memo failure only loses the caching, never the result.
+        UErrorCode memoStatus = U_ZERO_ERROR;
+        if (fBestPatternMemo == nullptr) {
+            LocalPointer<Hashtable> memo(new Hashtable(FALSE, memoStatus), memoStatus);
+            if (U_SUCCESS(memoStatus)) {
+                memo->setValueDeleter(uprv_deleteUObject);
+                fBestPatternMemo = memo.orphan();
+            }
+        }
+        if (fBestPatternMemo != nullptr) {
+            LocalPointer<UnicodeString> value(new UnicodeString(result), memoStatus);
+            if (U_SUCCESS(memoStatus)) {
+                fBestPatternMemo->put(memoKey, value.orphan(), memoStatus);
+            }
+        }
+    }
+    return result;
+}
+
+void
+DateTimePatternGenerator::clearBestPatternMemo() {
+    delete fBestPatternMemo;
+    fBestPatternMemo = nullptr;
+}
+
+UnicodeString
+DateTimePatternGenerator::computeBestPattern(const UnicodeString& patternForm, UDateTimePatternMatchOptions options, UErrorCode& status) {
     const UnicodeString *bestPattern = nullptr;
     UnicodeString dtFormat;
     UnicodeString resultPattern;
@@ -1208,6 +1306,7 @@ DateTimePatternGenerator::setDecimal(const UnicodeString& newDecimal) {
     this->decimal = newDecimal;
     // NUL-terminate for the C API.
     this->decimal.getTerminatedBuffer();
+    clearBestPatternMemo();
 }
 
 const UnicodeString&
@@ -1233,6 +1332,7 @@ DateTimePatternGenerator::setDateTimeFormat(const UnicodeString& dtFormat) {
     dateTimeFormat = dtFormat;
     // NUL-terminate for the C API.
     dateTimeFormat.getTerminatedBuffer();
+    clearBestPatternMemo();
 }
 
 const UnicodeString&
@@ -1330,6 +1430,8 @@ DateTimePatternGenerator::addPatternWithSkeleton(
         return UDATPG_NO_CONFLICT;
     }
 
+    clearBestPatternMemo();
+
     UnicodeString basePattern;
     PtnSkeleton   skeleton;
     UDateTimePatternConflict conflictingStatus = UDATPG_NO_CONFLICT;
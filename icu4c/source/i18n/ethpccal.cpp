@@ -65,6 +65,8 @@ void
 EthiopicCalendar::setAmeteAlemEra(UBool onOff)
 {
     eraType = onOff ? AMETE_ALEM_ERA : AMETE_MIHRET_ERA;
+    // The era type changes the era and year computed for a given day.
+    invalidateDayCache();
 }
     
 UBool
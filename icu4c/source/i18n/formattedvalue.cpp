@@ -67,6 +67,31 @@ UBool ConstrainedFieldPosition::matchesField(UFieldCategory category, int32_t fi
 
 FormattedValue::~FormattedValue() = default;
 
+int32_t FormattedValue::extractFieldSpans(
+        ConstrainedFieldPosition& cfpos,
+        int32_t* buffer,
+        int32_t capacity,
+        UErrorCode& status) const {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (capacity < 0 || (buffer == nullptr && capacity > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    int32_t count = 0;
+    while (nextPosition(cfpos, status)) {
+        if (count < capacity) {
+            int32_t* triple = buffer + 3 * count;
+            triple[0] = cfpos.getField();
+            triple[1] = cfpos.getStart();
+            triple[2] = cfpos.getLimit();
+        }
+        count++;
+    }
+    return count;
+}
+
 
 ///////////////////////
 /// C API FUNCTIONS ///
@@ -25,14 +25,12 @@
 
 #include "cmemory.h"
 #include "cstring.h"
-#include "mutex.h"
 #include "uassert.h"
 #include "ucln_in.h"
 #include "umutex.h"
 #include "uhash.h"
 
 static UHashtable* gGenderInfoCache = NULL;
-static icu::UMutex gGenderMetaLock = U_MUTEX_INITIALIZER;
 static const char* gNeutralStr = "neutral";
 static const char* gMailTaintsStr = "maleTaints";
 static const char* gMixedNeutralStr = "mixedNeutral";
@@ -82,6 +80,38 @@ void U_CALLCONV GenderInfo_initCache(UErrorCode &status) {
     return;
   }
   uhash_setKeyDeleter(gGenderInfoCache, uprv_free);
+
+  // Materialize the entire locale->style table up front. It is never
+  // modified afterwards, so lookups do not need to take a lock.
+  LocalUResourceBundlePointer rb(ures_openDirect(NULL, "genderList", &status));
+  LocalUResourceBundlePointer locRes(ures_getByKey(rb.getAlias(), "genderList", NULL, &status));
+  while (U_SUCCESS(status) && ures_hasNext(locRes.getAlias())) {
+    int32_t resLen = 0;
+    const char* key = NULL;
+    const UChar* s = ures_getNextString(locRes.getAlias(), &resLen, &key, &status);
+    if (U_FAILURE(status)) {
+      break;
+    }
+    char type_str[256];
+    if (resLen >= (int32_t)sizeof(type_str)) {
+      continue;
+    }
+    u_UCharsToChars(s, type_str, resLen + 1);
+    GenderInfo* value = &gObjs[NEUTRAL];
+    if (uprv_strcmp(type_str, gNeutralStr) == 0) {
+      value = &gObjs[NEUTRAL];
+    } else if (uprv_strcmp(type_str, gMixedNeutralStr) == 0) {
+      value = &gObjs[MIXED_NEUTRAL];
+    } else if (uprv_strcmp(type_str, gMailTaintsStr) == 0) {
+      value = &gObjs[MALE_TAINTS];
+    }
+    uhash_put(gGenderInfoCache, uprv_strdup(key), value, &status);
+  }
+  if (U_FAILURE(status)) {
+    uhash_close(gGenderInfoCache);
+    gGenderInfoCache = NULL;
+    delete [] gObjs;
+  }
 }
 
 
@@ -92,84 +122,35 @@ GenderInfo::~GenderInfo() {
 }
 
 const GenderInfo* GenderInfo::getInstance(const Locale& locale, UErrorCode& status) {
-  // Make sure our cache exists.
+  // Make sure the locale->style table exists.
   umtx_initOnce(gGenderInitOnce, &GenderInfo_initCache, status);
   if (U_FAILURE(status)) {
     return NULL;
   }
-
-  const GenderInfo* result = NULL;
-  const char* key = locale.getName();
-  {
-    Mutex lock(&gGenderMetaLock);
-    result = (const GenderInfo*) uhash_get(gGenderInfoCache, key);
-  }
-  if (result) {
-    return result;
-  }
-
-  // On cache miss, try to create GenderInfo from CLDR data
-  result = loadInstance(locale, status);
-  if (U_FAILURE(status)) {
-    return NULL;
-  }
-
-  // Try to put our GenderInfo object in cache. If there is a race condition,
-  // favor the GenderInfo object that is already in the cache.
-  {
-    Mutex lock(&gGenderMetaLock);
-    GenderInfo* temp = (GenderInfo*) uhash_get(gGenderInfoCache, key);
-    if (temp) {
-      result = temp;
-    } else {
-      uhash_put(gGenderInfoCache, uprv_strdup(key), (void*) result, &status);
-      if (U_FAILURE(status)) {
-        return NULL;
-      }
-    }
-  }
-  return result;
+  return loadInstance(locale, status);
 }
 
 const GenderInfo* GenderInfo::loadInstance(const Locale& locale, UErrorCode& status) {
-  LocalUResourceBundlePointer rb(
-      ures_openDirect(NULL, "genderList", &status));
   if (U_FAILURE(status)) {
     return NULL;
   }
-  LocalUResourceBundlePointer locRes(ures_getByKey(rb.getAlias(), "genderList", NULL, &status));
-  if (U_FAILURE(status)) {
-    return NULL;
+  // The table is fully built in GenderInfo_initCache() and immutable
+  // afterwards, so it can be probed without taking a lock.
+  const GenderInfo* result =
+      (const GenderInfo*) uhash_get(gGenderInfoCache, locale.getName());
+  if (result != NULL) {
+    return result;
   }
-  int32_t resLen = 0;
-  const char* curLocaleName = locale.getName();
   UErrorCode key_status = U_ZERO_ERROR;
-  const UChar* s = ures_getStringByKey(locRes.getAlias(), curLocaleName, &resLen, &key_status);
-  if (s == NULL) {
+  char parentLocaleName[ULOC_FULLNAME_CAPACITY];
+  uprv_strcpy(parentLocaleName, locale.getName());
+  while (uloc_getParent(parentLocaleName, parentLocaleName, ULOC_FULLNAME_CAPACITY, &key_status) > 0) {
     key_status = U_ZERO_ERROR;
-    char parentLocaleName[ULOC_FULLNAME_CAPACITY];
-    uprv_strcpy(parentLocaleName, curLocaleName);
-    while (s == NULL && uloc_getParent(parentLocaleName, parentLocaleName, ULOC_FULLNAME_CAPACITY, &key_status) > 0) {
-      key_status = U_ZERO_ERROR;
-      resLen = 0;
-      s = ures_getStringByKey(locRes.getAlias(), parentLocaleName, &resLen, &key_status);
-      key_status = U_ZERO_ERROR;
+    result = (const GenderInfo*) uhash_get(gGenderInfoCache, parentLocaleName);
+    if (result != NULL) {
+      return result;
     }
   }
-  if (s == NULL) {
-    return &gObjs[NEUTRAL];
-  }
-  char type_str[256];
-  u_UCharsToChars(s, type_str, resLen + 1);
-  if (uprv_strcmp(type_str, gNeutralStr) == 0) {
-    return &gObjs[NEUTRAL];
-  }
-  if (uprv_strcmp(type_str, gMixedNeutralStr) == 0) {
-    return &gObjs[MIXED_NEUTRAL]; 
-  }
-  if (uprv_strcmp(type_str, gMailTaintsStr) == 0) {
-    return &gObjs[MALE_TAINTS];
-  }
   return &gObjs[NEUTRAL];
 }
 
@@ -362,6 +362,9 @@ GregorianCalendar::setGregorianChange(UDate date, UErrorCode& status)
         fGregorianCutoverYear = 1 - fGregorianCutoverYear;
     fCutoverJulianDay = cutoverDay;
     delete cal;
+
+    // The cutover changes the fields computed for a given Julian day.
+    invalidateDayCache();
 }
 
 
@@ -56,6 +56,11 @@ static void debug_islamcal_msg(const char *pat, ...)
 // cache of months
 static icu::UMutex astroLock = U_MUTEX_INITIALIZER;  // pod bay door lock
 static icu::CalendarCache *gMonthCache = NULL;
+
+// Lock-free front cache probed before the mutexed month cache, so that
+// warm month-start lookups scale across threads. Zero-initialized static
+// storage; entries are pure functions of the month index.
+static icu::CalendarFrontCache gMonthFrontCache;
 static icu::CalendarAstronomer *gIslamicCalendarAstro = NULL;
 
 U_CDECL_BEGIN
@@ -254,6 +259,8 @@ void IslamicCalendar::setCalculationType(ECalculationType type, UErrorCode &stat
         UDate m = getTimeInMillis(status);
         cType = type;
         clear();
+        // The cached field snapshot was computed under the old rules.
+        invalidateDayCache();
         setTimeInMillis(m, status);
     }
 }
@@ -414,8 +421,13 @@ int32_t IslamicCalendar::monthStart(int32_t year, int32_t month) const {
 */
 int32_t IslamicCalendar::trueMonthStart(int32_t month) const
 {
+    int32_t start = gMonthFrontCache.get(month);
+    if (start != 0) {
+        return start;
+    }
+
     UErrorCode status = U_ZERO_ERROR;
-    int32_t start = CalendarCache::get(&gMonthCache, month, status);
+    start = CalendarCache::get(&gMonthCache, month, status);
 
     if (start==0) {
         // Make a guess at when the month started, using the average length
@@ -455,6 +467,9 @@ trueMonthStartEnd :
     if(U_FAILURE(status)) {
         start = 0;
     }
+    if (start != 0) {
+        gMonthFrontCache.put(month, start);
+    }
     return start;
 }
 
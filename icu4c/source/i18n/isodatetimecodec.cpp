@@ -0,0 +1,201 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_FORMATTING
+
+#include "isodatetimecodec.h"
+#include "gregoimp.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+/**
+ * Reads exactly count ASCII digits and returns their value, or -1 if any
+ * unit is not an ASCII digit. The unsigned subtraction folds the two range
+ * checks per digit into one.
+ */
+inline int32_t readDigits(const char16_t *s, int32_t count) {
+    int32_t value = 0;
+    for (int32_t i = 0; i < count; i++) {
+        uint32_t d = (uint32_t)s[i] - 0x30;  // '0'
+        if (d > 9) {
+            return -1;
+        }
+        value = value * 10 + (int32_t)d;
+    }
+    return value;
+}
+
+/** Writes exactly count digits of value, most significant first. */
+inline void writeDigits(char16_t *s, int32_t count, int32_t value) {
+    for (int32_t i = count - 1; i >= 0; i--) {
+        s[i] = (char16_t)(0x30 + value % 10);
+        value /= 10;
+    }
+}
+
+}  // namespace
+
+UDate
+IsoDateTimeCodec::parse(const UnicodeString &text, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    const char16_t *s = text.getBuffer();
+    int32_t len = text.length();
+
+    // Date part: yyyy-MM-dd
+    if (len < 10 || s[4] != 0x2D || s[7] != 0x2D) {  // '-'
+        status = U_PARSE_ERROR;
+        return 0;
+    }
+    int32_t year = readDigits(s, 4);
+    int32_t month = readDigits(s + 5, 2);
+    int32_t dom = readDigits(s + 8, 2);
+    if (year < 0 || month < 1 || month > 12 ||
+            dom < 1 || dom > Grego::monthLength(year, month - 1)) {
+        status = U_PARSE_ERROR;
+        return 0;
+    }
+
+    int32_t millisInDay = 0;
+    int32_t pos = 10;
+
+    // Optional time part: 'T'HH:mm[:ss[.S{1,3}]]
+    if (pos < len && s[pos] == 0x54) {  // 'T'
+        if (len < pos + 6 || s[pos + 3] != 0x3A) {  // ':'
+            status = U_PARSE_ERROR;
+            return 0;
+        }
+        int32_t hour = readDigits(s + pos + 1, 2);
+        int32_t minute = readDigits(s + pos + 4, 2);
+        if (hour < 0 || hour > 23 || minute < 0 || minute > 59) {
+            status = U_PARSE_ERROR;
+            return 0;
+        }
+        millisInDay = hour * kOneHour + minute * kOneMinute;
+        pos += 6;
+        if (pos < len && s[pos] == 0x3A) {  // ':'
+            if (len < pos + 3) {
+                status = U_PARSE_ERROR;
+                return 0;
+            }
+            int32_t second = readDigits(s + pos + 1, 2);
+            if (second < 0 || second > 59) {
+                status = U_PARSE_ERROR;
+                return 0;
+            }
+            millisInDay += second * kOneSecond;
+            pos += 3;
+            if (pos < len && s[pos] == 0x2E) {  // '.'
+                // 1 to 3 fractional digits, scaled to milliseconds.
+                int32_t scale = 100;
+                int32_t millis = 0;
+                int32_t digits = 0;
+                pos++;
+                while (pos < len && digits < 3) {
+                    int32_t d = readDigits(s + pos, 1);
+                    if (d < 0) {
+                        break;
+                    }
+                    millis += d * scale;
+                    scale /= 10;
+                    digits++;
+                    pos++;
+                }
+                if (digits == 0) {
+                    status = U_PARSE_ERROR;
+                    return 0;
+                }
+                millisInDay += millis;
+            }
+        }
+    }
+
+    // Optional zone part: 'Z' or +HH[:]mm, -HH[:]mm, +HH, -HH
+    int32_t offsetMillis = 0;
+    if (pos < len) {
+        char16_t c = s[pos];
+        if (c == 0x5A) {  // 'Z'
+            pos++;
+        } else if (c == 0x2B || c == 0x2D) {  // '+' / '-'
+            int32_t sign = (c == 0x2D) ? -1 : 1;
+            if (len < pos + 3) {
+                status = U_PARSE_ERROR;
+                return 0;
+            }
+            int32_t offHour = readDigits(s + pos + 1, 2);
+            if (offHour < 0 || offHour > 23) {
+                status = U_PARSE_ERROR;
+                return 0;
+            }
+            pos += 3;
+            int32_t offMinute = 0;
+            int32_t minutePos = (pos < len && s[pos] == 0x3A) ? pos + 1 : pos;  // ':'
+            if (minutePos + 2 <= len) {
+                offMinute = readDigits(s + minutePos, 2);
+                if (offMinute < 0 || offMinute > 59) {
+                    status = U_PARSE_ERROR;
+                    return 0;
+                }
+                pos = minutePos + 2;
+            } else if (minutePos != pos) {
+                // A ':' with no minutes after it.
+                status = U_PARSE_ERROR;
+                return 0;
+            }
+            offsetMillis = sign * (offHour * kOneHour + offMinute * kOneMinute);
+        }
+    }
+
+    if (pos != len) {
+        status = U_PARSE_ERROR;
+        return 0;
+    }
+
+    return Grego::fieldsToDay(year, month - 1, dom) * kOneDay
+            + millisInDay - offsetMillis;
+}
+
+UnicodeString &
+IsoDateTimeCodec::format(UDate date, UnicodeString &appendTo, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return appendTo;
+    }
+    double millisInDayD;
+    double day = ClockMath::floorDivide(date, (double)kOneDay, millisInDayD);
+    int32_t year, month, dom, dow;
+    Grego::dayToFields(day, year, month, dom, dow);
+    if (year < 0 || year > 9999) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return appendTo;
+    }
+    int32_t millisInDay = (int32_t)millisInDayD;
+    int32_t millis = millisInDay % kOneSecond;
+    int32_t seconds = millisInDay / kOneSecond;
+
+    // yyyy-MM-ddTHH:mm:ss.SSSZ == 24 units
+    char16_t buf[24];
+    writeDigits(buf, 4, year);
+    buf[4] = 0x2D;  // '-'
+    writeDigits(buf + 5, 2, month + 1);
+    buf[7] = 0x2D;  // '-'
+    writeDigits(buf + 8, 2, dom);
+    buf[10] = 0x54;  // 'T'
+    writeDigits(buf + 11, 2, seconds / 3600);
+    buf[13] = 0x3A;  // ':'
+    writeDigits(buf + 14, 2, (seconds / 60) % 60);
+    buf[16] = 0x3A;  // ':'
+    writeDigits(buf + 17, 2, seconds % 60);
+    buf[19] = 0x2E;  // '.'
+    writeDigits(buf + 20, 3, millis);
+    buf[23] = 0x5A;  // 'Z'
+    return appendTo.append(buf, 24);
+}
+
+U_NAMESPACE_END
+
+#endif /* #if !UCONFIG_NO_FORMATTING */
@@ -0,0 +1,55 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+#ifndef ISODATETIMECODEC_H
+#define ISODATETIMECODEC_H
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_FORMATTING
+
+#include "unicode/unistr.h"
+
+U_NAMESPACE_BEGIN
+
+/**
+ * Fixed-field parser and formatter for ISO-8601 date-time interchange,
+ * intended as a fast path next to SimpleDateFormat for the proleptic
+ * Gregorian / UTC case. Field extraction works directly on the digits and
+ * converts through the Grego day arithmetic, bypassing Calendar field
+ * resolution entirely.
+ *
+ * Accepted input is the interchange profile
+ *
+ *     yyyy-MM-dd['T'HH:mm[:ss[.S{1,3}]]][Z|+HH[:]mm|-HH[:]mm|+HH|-HH]
+ *
+ * with strict field widths; anything else fails with U_PARSE_ERROR and the
+ * caller should fall back to SimpleDateFormat. Output is always the full
+ * form yyyy-MM-dd'T'HH:mm:ss.SSS'Z' in UTC.
+ *
+ * All methods are static; the class is not instantiable.
+ */
+class U_I18N_API IsoDateTimeCodec {
+public:
+    /**
+     * Parses an ISO-8601 date-time string into a UDate. The whole string
+     * must be consumed. Sets U_PARSE_ERROR if the text does not match the
+     * accepted profile, including out-of-range field values.
+     */
+    static UDate parse(const UnicodeString &text, UErrorCode &status);
+
+    /**
+     * Formats a UDate as yyyy-MM-dd'T'HH:mm:ss.SSS'Z' (UTC) and appends it
+     * to the given string. Years outside 0..9999 cannot be represented in
+     * fixed width and fail with U_ILLEGAL_ARGUMENT_ERROR.
+     */
+    static UnicodeString &format(UDate date, UnicodeString &appendTo, UErrorCode &status);
+
+private:
+    IsoDateTimeCodec() = delete;
+};
+
+U_NAMESPACE_END
+
+#endif /* #if !UCONFIG_NO_FORMATTING */
+#endif // ISODATETIMECODEC_H
@@ -35,11 +35,51 @@
 
 U_NAMESPACE_BEGIN
 
+/**
+ * Returns TRUE and extracts the separator if pat is a separator-only
+ * pattern like "{0}, {1}": no literal text before {0} or after {1}, and
+ * each argument used exactly once, in order. Such a pattern joins its
+ * two values by plain concatenation with the separator in between.
+ */
+static UBool getSeparatorOnlyPattern(const SimpleFormatter &pat, UnicodeString &separator) {
+    UErrorCode errorCode = U_ZERO_ERROR;
+    UnicodeString empty;
+    const UnicodeString *params[2] = {&empty, &empty};
+    int32_t offsets[2];
+    UnicodeString text;
+    pat.formatAndAppend(params, UPRV_LENGTHOF(params), text,
+                        offsets, UPRV_LENGTHOF(offsets), errorCode);
+    if (U_FAILURE(errorCode) || offsets[0] != 0 || offsets[1] != text.length()) {
+        return FALSE;
+    }
+    // The offsets report only the last occurrence of each argument;
+    // verify the pattern shape by formatting distinguishable sentinels.
+    UnicodeString s0((UChar)0xFDD0), s1((UChar)0xFDD1);  // noncharacters
+    const UnicodeString *sentinels[2] = {&s0, &s1};
+    UnicodeString expected(s0);
+    expected.append(text).append(s1);
+    UnicodeString actual;
+    pat.formatAndAppend(sentinels, UPRV_LENGTHOF(sentinels), actual, nullptr, 0, errorCode);
+    if (U_FAILURE(errorCode) || actual != expected) {
+        return FALSE;
+    }
+    separator = text;
+    return TRUE;
+}
+
 struct ListFormatInternal : public UMemory {
     SimpleFormatter twoPattern;
     SimpleFormatter startPattern;
     SimpleFormatter middlePattern;
     SimpleFormatter endPattern;
+    // Separators extracted from separator-only patterns, valid if the
+    // corresponding flag is set; used by the direct-append fast path.
+    UnicodeString twoSeparator;
+    UnicodeString startSeparator;
+    UnicodeString middleSeparator;
+    UnicodeString endSeparator;
+    UBool simpleTwo;
+    UBool simpleStartMiddleEnd;
 
 ListFormatInternal(
         const UnicodeString& two,
@@ -50,19 +90,42 @@ ListFormatInternal(
         twoPattern(two, 2, 2, errorCode),
         startPattern(start, 2, 2, errorCode),
         middlePattern(middle, 2, 2, errorCode),
-        endPattern(end, 2, 2, errorCode) {}
+        endPattern(end, 2, 2, errorCode) {
+    specializePatterns(errorCode);
+}
 
 ListFormatInternal(const ListFormatData &data, UErrorCode &errorCode) :
         twoPattern(data.twoPattern, errorCode),
         startPattern(data.startPattern, errorCode),
         middlePattern(data.middlePattern, errorCode),
-        endPattern(data.endPattern, errorCode) { }
+        endPattern(data.endPattern, errorCode) {
+    specializePatterns(errorCode);
+}
 
 ListFormatInternal(const ListFormatInternal &other) :
     twoPattern(other.twoPattern),
     startPattern(other.startPattern),
     middlePattern(other.middlePattern),
-    endPattern(other.endPattern) { }
+    endPattern(other.endPattern),
+    twoSeparator(other.twoSeparator),
+    startSeparator(other.startSeparator),
+    middleSeparator(other.middleSeparator),
+    endSeparator(other.endSeparator),
+    simpleTwo(other.simpleTwo),
+    simpleStartMiddleEnd(other.simpleStartMiddleEnd) { }
+
+void specializePatterns(UErrorCode &errorCode) {
+    simpleTwo = FALSE;
+    simpleStartMiddleEnd = FALSE;
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    simpleTwo = getSeparatorOnlyPattern(twoPattern, twoSeparator);
+    simpleStartMiddleEnd =
+            getSeparatorOnlyPattern(startPattern, startSeparator) &&
+            getSeparatorOnlyPattern(middlePattern, middleSeparator) &&
+            getSeparatorOnlyPattern(endPattern, endSeparator);
+}
 };
 
 
@@ -457,6 +520,36 @@ UnicodeString& ListFormatter::format_(
         appendTo.append(items[0]);
         return appendTo;
     }
+    if (handler == nullptr && index < 0 &&
+            (nItems == 2 ? data->simpleTwo : data->simpleStartMiddleEnd)) {
+        // Separator-only patterns: measure the result, reserve once,
+        // then join with direct appends.
+        int32_t length = items[0].length();
+        if (nItems == 2) {
+            length += data->twoSeparator.length() + items[1].length();
+        } else {
+            length += data->startSeparator.length() + items[1].length();
+            for (int32_t i = 2; i < nItems - 1; ++i) {
+                length += data->middleSeparator.length() + items[i].length();
+            }
+            length += data->endSeparator.length() + items[nItems - 1].length();
+        }
+        int32_t start = appendTo.length();
+        if (appendTo.getBuffer(start + length) != nullptr) {
+            appendTo.releaseBuffer(start);
+        }
+        appendTo.append(items[0]);
+        if (nItems == 2) {
+            appendTo.append(data->twoSeparator).append(items[1]);
+        } else {
+            appendTo.append(data->startSeparator).append(items[1]);
+            for (int32_t i = 2; i < nItems - 1; ++i) {
+                appendTo.append(data->middleSeparator).append(items[i]);
+            }
+            appendTo.append(data->endSeparator).append(items[nItems - 1]);
+        }
+        return appendTo;
+    }
     UnicodeString result(items[0]);
     if (index == 0) {
         offset = 0;
@@ -112,12 +112,21 @@ public:
     UMeasureFormatWidth widthFallback[WIDTH_INDEX_COUNT];
     /** Measure unit -> format width -> array of patterns ("{0} meters") (plurals + PER_UNIT_INDEX) */
     SimpleFormatter* patterns[MEAS_UNIT_COUNT][WIDTH_INDEX_COUNT][PATTERN_COUNT];
+    /**
+     * patterns[] with the width fallback and the fallback of missing
+     * plural forms to OTHER already applied, so that per-call lookups
+     * reduce to a table index. Filled by resolvePatterns() after the
+     * resource data is loaded.
+     */
+    const SimpleFormatter* resolvedPatterns[MEAS_UNIT_COUNT][WIDTH_INDEX_COUNT][PATTERN_COUNT];
     const UChar* dnams[MEAS_UNIT_COUNT][WIDTH_INDEX_COUNT];
     SimpleFormatter perFormatters[WIDTH_INDEX_COUNT];
 
     MeasureFormatCacheData();
     virtual ~MeasureFormatCacheData();
 
+    void resolvePatterns();
+
     UBool hasPerFormatter(int32_t width) const {
         // TODO: Create a more obvious way to test if the per-formatter has been set?
         // Use pointers, check for NULL? Or add an isValid() method?
@@ -164,6 +173,7 @@ MeasureFormatCacheData::MeasureFormatCacheData()
         widthFallback[i] = UMEASFMT_WIDTH_COUNT;
     }
     memset(&patterns[0][0][0], 0, sizeof(patterns));
+    memset(&resolvedPatterns[0][0][0], 0, sizeof(resolvedPatterns));
     memset(&dnams[0][0], 0, sizeof(dnams));
     memset(currencyFormats, 0, sizeof(currencyFormats));
 }
@@ -184,6 +194,30 @@ MeasureFormatCacheData::~MeasureFormatCacheData() {
     delete numericDateFormatters;
 }
 
+void MeasureFormatCacheData::resolvePatterns() {
+    for (int32_t unit = 0; unit < MEAS_UNIT_COUNT; ++unit) {
+        for (int32_t width = 0; width < WIDTH_INDEX_COUNT; ++width) {
+            UMeasureFormatWidth fallbackWidth = widthFallback[width];
+            const SimpleFormatter *other = patterns[unit][width][StandardPlural::OTHER];
+            if (other == NULL && fallbackWidth != UMEASFMT_WIDTH_COUNT) {
+                other = patterns[unit][fallbackWidth][StandardPlural::OTHER];
+            }
+            for (int32_t index = 0; index < PATTERN_COUNT; ++index) {
+                const SimpleFormatter *pattern = patterns[unit][width][index];
+                if (pattern == NULL && fallbackWidth != UMEASFMT_WIDTH_COUNT) {
+                    pattern = patterns[unit][fallbackWidth][index];
+                }
+                if (pattern == NULL && index != PER_UNIT_INDEX) {
+                    // A missing plural form falls back to OTHER,
+                    // as in getPluralFormatter().
+                    pattern = other;
+                }
+                resolvedPatterns[unit][width][index] = pattern;
+            }
+        }
+    }
+}
+
 static UBool isCurrency(const MeasureUnit &unit) {
     return (uprv_strcmp(unit.getType(), "currency") == 0);
 }
@@ -513,6 +547,7 @@ const MeasureFormatCacheData *LocaleCacheKey<MeasureFormatCacheData>::createObje
             status)) {
         return NULL;
     }
+    result->resolvePatterns();
     result->adoptNumericDateFormatters(loadNumericDateFormatters(
             unitsBundle.getAlias(), status));
     if (U_FAILURE(status)) {
@@ -1134,13 +1169,14 @@ const SimpleFormatter *MeasureFormat::getPluralFormatter(
     if (U_FAILURE(errorCode)) {
         return NULL;
     }
-    if (index != StandardPlural::OTHER) {
-        const SimpleFormatter *pattern = getFormatterOrNull(unit, width, index);
-        if (pattern != NULL) {
-            return pattern;
-        }
+    // The width fallback and the fallback of missing plural forms to OTHER
+    // were applied once when the cache data was built.
+    const SimpleFormatter *pattern =
+            cache->resolvedPatterns[unit.getIndex()][getRegularWidth(width)][index];
+    if (pattern == NULL) {
+        errorCode = U_MISSING_RESOURCE_ERROR;
     }
-    return getFormatter(unit, width, StandardPlural::OTHER, errorCode);
+    return pattern;
 }
 
 const SimpleFormatter *MeasureFormat::getPerFormatter(
@@ -878,6 +878,78 @@ MessageFormat::format(const Formattable* source,
     return format(source, NULL, cnt, appendTo, &ignore, success);
 }
 
+// -------------------------------------
+// Formats an array of strings without boxing them into Formattable objects.
+
+UnicodeString&
+MessageFormat::formatStringArgs(const UnicodeString* arguments,
+                                int32_t count,
+                                UnicodeString& appendTo,
+                                UErrorCode& status) const
+{
+    if (U_FAILURE(status)) {
+        return appendTo;
+    }
+    if (count < 0 || (count > 0 && arguments == NULL)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return appendTo;
+    }
+    // Fast path: only literal text and plain numbered arguments,
+    // with no explicit argument types and no formatters from setFormat().
+    const UnicodeString& msgString = msgPattern.getPatternString();
+    int32_t startLength = appendTo.length();
+    int32_t prevIndex = msgPattern.getPart(0).getLimit();
+    UBool simple = TRUE;
+    for (int32_t i = 1; simple; ++i) {
+        const MessagePattern::Part* part = &msgPattern.getPart(i);
+        const UMessagePatternPartType type = part->getType();
+        int32_t index = part->getIndex();
+        appendTo.append(msgString, prevIndex, index - prevIndex);
+        if (type == UMSGPAT_PART_TYPE_MSG_LIMIT) {
+            return appendTo;
+        }
+        prevIndex = part->getLimit();
+        if (type != UMSGPAT_PART_TYPE_ARG_START) {
+            continue;  // skipped syntax, as in the regular engine
+        }
+        if (part->getArgType() != UMSGPAT_ARG_TYPE_NONE) {
+            simple = FALSE;
+            break;
+        }
+        int32_t argLimit = msgPattern.getLimitPartIndex(i);
+        int32_t argStart = i;
+        part = &msgPattern.getPart(++i);
+        if (part->getType() != UMSGPAT_PART_TYPE_ARG_NUMBER ||
+                (cachedFormatters != NULL && uhash_iget(cachedFormatters, argStart) != NULL)) {
+            // Named argument, or a formatter from setFormat() and its siblings.
+            simple = FALSE;
+            break;
+        }
+        int32_t argNumber = part->getValue();
+        if (0 <= argNumber && argNumber < count) {
+            appendTo.append(arguments[argNumber]);
+        } else {
+            appendTo.append(LEFT_CURLY_BRACE);
+            appendTo.append(msgPattern.getSubstring(*part));
+            appendTo.append(RIGHT_CURLY_BRACE);
+        }
+        prevIndex = msgPattern.getPart(argLimit).getLimit();
+        i = argLimit;
+    }
+    // The pattern needs the regular formatting engine; box the strings.
+    appendTo.truncate(startLength);
+    LocalArray<Formattable> args(count > 0 ? new Formattable[count] : NULL);
+    if (count > 0 && args.getAlias() == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return appendTo;
+    }
+    for (int32_t j = 0; j < count; ++j) {
+        args[j].setString(arguments[j]);
+    }
+    FieldPosition ignore(FieldPosition::DONT_CARE);
+    return format(args.getAlias(), count, appendTo, ignore, status);
+}
+
 // -------------------------------------
 // Internally creates a MessageFormat instance based on the
 // pattern and formats the arguments Formattable array and
@@ -265,6 +265,26 @@ void CompactHandler::precomputeAllModifiers(MutablePatternModifier &buildReferen
         if (U_FAILURE(status)) { return; }
         info.patternString = patternString;
     }
+
+    // Resolve the (magnitude, plural) matrix up front, so that processQuantity needs only a
+    // direct index. getPattern already applies magnitude clamping and the "other" fallback.
+    for (int32_t magnitude = 0; magnitude <= COMPACT_MAX_DIGITS; magnitude++) {
+        for (int32_t plural = 0; plural < StandardPlural::COUNT; plural++) {
+            const UChar *patternString = data.getPattern(
+                    magnitude, static_cast<StandardPlural::Form>(plural));
+            if (patternString == nullptr) {
+                continue;
+            }
+            for (int32_t i = 0; i < precomputedModsLength; i++) {
+                if (u_strcmp(patternString, precomputedMods[i].patternString) == 0) {
+                    precomputedModMatrix[getIndex(
+                            magnitude, static_cast<StandardPlural::Form>(plural))] =
+                            precomputedMods[i].mod;
+                    break;
+                }
+            }
+        }
+    }
 }
 
 void CompactHandler::processQuantity(DecimalQuantity &quantity, MicroProps &micros,
@@ -285,32 +305,36 @@ void CompactHandler::processQuantity(DecimalQuantity &quantity, MicroProps &micr
     }
 
     StandardPlural::Form plural = utils::getStandardPlural(rules, quantity);
-    const UChar *patternString = data.getPattern(magnitude, plural);
-    if (patternString == nullptr) {
-        // Use the default (non-compact) modifier.
-        // No need to take any action.
-    } else if (safe) {
-        // Safe code path.
-        // Java uses a hash set here for O(1) lookup.  C++ uses a linear search.
-        // TODO: Benchmark this and maybe change to a binary search or hash table.
-        int32_t i = 0;
-        for (; i < precomputedModsLength; i++) {
-            const CompactModInfo &info = precomputedMods[i];
-            if (u_strcmp(patternString, info.patternString) == 0) {
-                info.mod->applyToMicros(micros, quantity);
-                break;
+    if (safe) {
+        // Safe code path: direct lookup in the matrix resolved at build time.
+        // Mirror the magnitude clamping performed by CompactData::getPattern.
+        const ImmutablePatternModifier *mod = nullptr;
+        if (magnitude >= 0) {
+            if (magnitude > COMPACT_MAX_DIGITS) {
+                magnitude = COMPACT_MAX_DIGITS;
             }
+            mod = precomputedModMatrix[getIndex(magnitude, plural)];
+        }
+        if (mod != nullptr) {
+            mod->applyToMicros(micros, quantity);
+        } else {
+            // Use the default (non-compact) modifier.
+            // No need to take any action.
         }
-        // It should be guaranteed that we found the entry.
-        U_ASSERT(i < precomputedModsLength);
     } else {
-        // Unsafe code path.
-        // Overwrite the PatternInfo in the existing modMiddle.
-        // C++ Note: Use unsafePatternInfo for proper lifecycle.
-        ParsedPatternInfo &patternInfo = const_cast<CompactHandler *>(this)->unsafePatternInfo;
-        PatternParser::parseToPatternInfo(UnicodeString(patternString), patternInfo, status);
-        static_cast<MutablePatternModifier*>(const_cast<Modifier*>(micros.modMiddle))
-            ->setPatternInfo(&patternInfo, UNUM_COMPACT_FIELD);
+        const UChar *patternString = data.getPattern(magnitude, plural);
+        if (patternString == nullptr) {
+            // Use the default (non-compact) modifier.
+            // No need to take any action.
+        } else {
+            // Unsafe code path.
+            // Overwrite the PatternInfo in the existing modMiddle.
+            // C++ Note: Use unsafePatternInfo for proper lifecycle.
+            ParsedPatternInfo &patternInfo = const_cast<CompactHandler *>(this)->unsafePatternInfo;
+            PatternParser::parseToPatternInfo(UnicodeString(patternString), patternInfo, status);
+            static_cast<MutablePatternModifier*>(const_cast<Modifier*>(micros.modMiddle))
+                ->setPatternInfo(&patternInfo, UNUM_COMPACT_FIELD);
+        }
     }
 
     // We already performed rounding. Do not perform it again.
@@ -72,6 +72,13 @@ class CompactHandler : public MicroPropsGenerator, public UMemory {
     // Initial capacity of 12 for 0K, 00K, 000K, ...M, ...B, and ...T
     MaybeStackArray<CompactModInfo, 12> precomputedMods;
     int32_t precomputedModsLength = 0;
+    /**
+     * Used by the safe code path: the modifier for each (magnitude, plural) pair, resolved at
+     * build time so that processQuantity does a direct index instead of a pattern search.
+     * Aliases entries owned by precomputedMods; nullptr means use the default modifier.
+     */
+    const ImmutablePatternModifier *precomputedModMatrix[(COMPACT_MAX_DIGITS + 1) *
+                                                         StandardPlural::COUNT] = {};
     CompactData data;
     ParsedPatternInfo unsafePatternInfo;
     UBool safe;
@@ -78,7 +78,9 @@ DecimalQuantity::DecimalQuantity() {
 
 DecimalQuantity::~DecimalQuantity() {
     if (usingBytes) {
-        uprv_free(fBCD.bcdBytes.ptr);
+        if (fBCD.bcdBytes.ptr != fInlineBCD) {
+            uprv_free(fBCD.bcdBytes.ptr);
+        }
         fBCD.bcdBytes.ptr = nullptr;
         usingBytes = false;
     }
@@ -600,7 +602,8 @@ void DecimalQuantity::toDecNum(DecNum& output, UErrorCode& status) const {
 
     // Use the BCD constructor. We need to do a little bit of work to convert, though.
     // The decNumber constructor expects most-significant first, but we store least-significant first.
-    MaybeStackArray<uint8_t, 20> ubcd(precision);
+    // Stack capacity covers decimal128 operands; see DECNUM_INITIAL_CAPACITY.
+    MaybeStackArray<uint8_t, DECNUM_INITIAL_CAPACITY> ubcd(precision);
     for (int32_t m = 0; m < precision; m++) {
         ubcd[precision - m - 1] = static_cast<uint8_t>(getDigitPos(m));
     }
@@ -996,7 +999,9 @@ void DecimalQuantity::popFromLeft(int32_t numDigits) {
 
 void DecimalQuantity::setBcdToZero() {
     if (usingBytes) {
-        uprv_free(fBCD.bcdBytes.ptr);
+        if (fBCD.bcdBytes.ptr != fInlineBCD) {
+            uprv_free(fBCD.bcdBytes.ptr);
+        }
         fBCD.bcdBytes.ptr = nullptr;
         usingBytes = false;
     }
@@ -1008,18 +1013,37 @@ void DecimalQuantity::setBcdToZero() {
     origDelta = 0;
 }
 
+namespace {
+// Packed BCD for the values 0-99: high nibble = tens digit, low nibble = units
+// digit. Lets the integer-to-BCD loops consume two decimal digits per
+// division; small integers are the most common input by far.
+const uint8_t kBcdPairs[100] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59,
+    0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99};
+}  // namespace
+
 void DecimalQuantity::readIntToBcd(int32_t n) {
     U_ASSERT(n != 0);
     // ints always fit inside the long implementation.
     uint64_t result = 0L;
-    int i = 16;
-    for (; n != 0; n /= 10, i--) {
-        result = (result >> 4) + ((static_cast<uint64_t>(n) % 10) << 60);
+    int i = 0;
+    for (; n >= 100; n /= 100, i += 2) {
+        result |= static_cast<uint64_t>(kBcdPairs[n % 100]) << (4 * i);
     }
+    result |= static_cast<uint64_t>(kBcdPairs[n]) << (4 * i);
+    i += (n >= 10) ? 2 : 1;
     U_ASSERT(!usingBytes);
-    fBCD.bcdLong = result >> (i * 4);
+    fBCD.bcdLong = result;
     scale = 0;
-    precision = 16 - i;
+    precision = i;
 }
 
 void DecimalQuantity::readLongToBcd(int64_t n) {
@@ -1035,15 +1059,17 @@ void DecimalQuantity::readLongToBcd(int64_t n) {
         precision = i;
     } else {
         uint64_t result = 0L;
-        int i = 16;
-        for (; n != 0L; n /= 10L, i--) {
-            result = (result >> 4) + ((n % 10) << 60);
+        int i = 0;
+        for (; n >= 100L; n /= 100L, i += 2) {
+            result |= static_cast<uint64_t>(kBcdPairs[n % 100]) << (4 * i);
         }
-        U_ASSERT(i >= 0);
+        result |= static_cast<uint64_t>(kBcdPairs[n]) << (4 * i);
+        i += (n >= 10L) ? 2 : 1;
+        U_ASSERT(i <= 16);
         U_ASSERT(!usingBytes);
-        fBCD.bcdLong = result >> (i * 4);
+        fBCD.bcdLong = result;
         scale = 0;
-        precision = 16 - i;
+        precision = i;
     }
 }
 
@@ -1140,16 +1166,24 @@ void DecimalQuantity::ensureCapacity(int32_t capacity) {
         // TODO: There is nothing being done to check for memory allocation failures.
         // TODO: Consider indexing by nybbles instead of bytes in C++, so that we can
         // make these arrays half the size.
-        fBCD.bcdBytes.ptr = static_cast<int8_t*>(uprv_malloc(capacity * sizeof(int8_t)));
-        fBCD.bcdBytes.len = capacity;
+        if (capacity <= kInlineBcdCapacity) {
+            // Small numbers use the inline buffer and never touch the heap.
+            fBCD.bcdBytes.ptr = fInlineBCD;
+            fBCD.bcdBytes.len = kInlineBcdCapacity;
+        } else {
+            fBCD.bcdBytes.ptr = static_cast<int8_t*>(uprv_malloc(capacity * sizeof(int8_t)));
+            fBCD.bcdBytes.len = capacity;
+        }
         // Initialize the byte array to zeros (this is done automatically in Java)
-        uprv_memset(fBCD.bcdBytes.ptr, 0, capacity * sizeof(int8_t));
+        uprv_memset(fBCD.bcdBytes.ptr, 0, fBCD.bcdBytes.len * sizeof(int8_t));
     } else if (oldCapacity < capacity) {
         auto bcd1 = static_cast<int8_t*>(uprv_malloc(capacity * 2 * sizeof(int8_t)));
         uprv_memcpy(bcd1, fBCD.bcdBytes.ptr, oldCapacity * sizeof(int8_t));
         // Initialize the rest of the byte array to zeros (this is done automatically in Java)
         uprv_memset(bcd1 + oldCapacity, 0, (capacity - oldCapacity) * sizeof(int8_t));
-        uprv_free(fBCD.bcdBytes.ptr);
+        if (fBCD.bcdBytes.ptr != fInlineBCD) {
+            uprv_free(fBCD.bcdBytes.ptr);
+        }
         fBCD.bcdBytes.ptr = bcd1;
         fBCD.bcdBytes.len = capacity * 2;
     }
@@ -1164,7 +1198,9 @@ void DecimalQuantity::switchStorage() {
             bcdLong <<= 4;
             bcdLong |= fBCD.bcdBytes.ptr[i];
         }
-        uprv_free(fBCD.bcdBytes.ptr);
+        if (fBCD.bcdBytes.ptr != fInlineBCD) {
+            uprv_free(fBCD.bcdBytes.ptr);
+        }
         fBCD.bcdBytes.ptr = nullptr;
         fBCD.bcdLong = bcdLong;
         usingBytes = false;
@@ -1194,12 +1230,18 @@ void DecimalQuantity::copyBcdFrom(const DecimalQuantity &other) {
 void DecimalQuantity::moveBcdFrom(DecimalQuantity &other) {
     setBcdToZero();
     if (other.usingBytes) {
-        usingBytes = true;
-        fBCD.bcdBytes.ptr = other.fBCD.bcdBytes.ptr;
-        fBCD.bcdBytes.len = other.fBCD.bcdBytes.len;
-        // Take ownership away from the old instance:
-        other.fBCD.bcdBytes.ptr = nullptr;
-        other.usingBytes = false;
+        if (other.fBCD.bcdBytes.ptr == other.fInlineBCD) {
+            // The bytes live inside the other instance; they must be copied, not adopted.
+            ensureCapacity(other.precision);
+            uprv_memcpy(fBCD.bcdBytes.ptr, other.fBCD.bcdBytes.ptr, other.precision * sizeof(int8_t));
+        } else {
+            usingBytes = true;
+            fBCD.bcdBytes.ptr = other.fBCD.bcdBytes.ptr;
+            fBCD.bcdBytes.len = other.fBCD.bcdBytes.len;
+            // Take ownership away from the old instance:
+            other.fBCD.bcdBytes.ptr = nullptr;
+            other.usingBytes = false;
+        }
     } else {
         fBCD.bcdLong = other.fBCD.bcdLong;
     }
@@ -365,6 +365,16 @@ class U_I18N_API DecimalQuantity : public IFixedDecimal, public UMemory {
 
     bool usingBytes = false;
 
+    /** Inline capacity for byte-mode BCD; matches the default in ensureCapacity(). */
+    static constexpr int32_t kInlineBcdCapacity = 40;
+
+    /**
+     * Inline storage used by ensureCapacity() for numbers of up to kInlineBcdCapacity digits,
+     * so that byte mode does not touch the heap for typical arbitrary-precision values
+     * (e.g., decimal128 operands). When in use, fBCD.bcdBytes.ptr points at this array.
+     */
+    int8_t fInlineBCD[kInlineBcdCapacity];
+
     /**
      * Whether this {@link DecimalQuantity} has been explicitly converted to an exact double. true if
      * backed by a double that was explicitly converted via convertToAccurateDouble; false otherwise.
@@ -16,6 +16,9 @@
 #include "number_utypes.h"
 #include "util.h"
 #include "fphdlimp.h"
+#include "sharedobject.h"
+#include "unifiedcache.h"
+#include "unicode/ustring.h"
 
 using namespace icu;
 using namespace icu::number;
@@ -365,6 +368,100 @@ NumberFormatter::forSkeleton(const UnicodeString& skeleton, UParseError& perror,
     return skeleton::create(skeleton, &perror, status);
 }
 
+U_NAMESPACE_BEGIN
+
+// Process-wide cache of compiled currency formatters, keyed by (locale, currency).
+// LocalizedNumberFormatter is immutable and thread-safe, so one cached instance can
+// serve concurrent format calls.
+class U_I18N_API SharedCurrencyFormatter : public SharedObject {
+public:
+    LocalizedNumberFormatter fFormatter;
+
+    SharedCurrencyFormatter(const Locale& locale, const CurrencyUnit& currency)
+            : fFormatter(NumberFormatter::withLocale(locale).unit(currency)) { }
+    virtual ~SharedCurrencyFormatter();
+};
+
+SharedCurrencyFormatter::~SharedCurrencyFormatter() {
+}
+
+template<> U_I18N_API
+const SharedCurrencyFormatter *LocaleCacheKey<SharedCurrencyFormatter>::createObject(
+        const void * /*creationContext*/, UErrorCode &status) const {
+    // Only CurrencyFormatterKey, which carries the currency, can create the object.
+    status = U_UNSUPPORTED_ERROR;
+    return nullptr;
+}
+
+class U_I18N_API CurrencyFormatterKey : public LocaleCacheKey<SharedCurrencyFormatter> {
+private:
+    CurrencyUnit fCurrency;
+public:
+    CurrencyFormatterKey(const Locale &loc, const CurrencyUnit &currency)
+            : LocaleCacheKey<SharedCurrencyFormatter>(loc),
+              fCurrency(currency) { }
+    CurrencyFormatterKey(const CurrencyFormatterKey &other)
+            : LocaleCacheKey<SharedCurrencyFormatter>(other),
+              fCurrency(other.fCurrency) { }
+    virtual ~CurrencyFormatterKey();
+    virtual int32_t hashCode() const {
+        int32_t hash = LocaleCacheKey<SharedCurrencyFormatter>::hashCode();
+        const char16_t* iso = fCurrency.getISOCurrency();
+        for (int32_t i = 0; i < 3 && iso[i] != 0; i++) {
+            hash = (int32_t)(37u * (uint32_t)hash + iso[i]);
+        }
+        return hash;
+    }
+    virtual UBool operator==(const CacheKeyBase &other) const {
+        // reflexive
+        if (this == &other) {
+            return TRUE;
+        }
+        if (!LocaleCacheKey<SharedCurrencyFormatter>::operator==(other)) {
+            return FALSE;
+        }
+        // We know that this and other are of same class if we get this far.
+        const CurrencyFormatterKey &realOther =
+                static_cast<const CurrencyFormatterKey &>(other);
+        return u_strcmp(realOther.fCurrency.getISOCurrency(), fCurrency.getISOCurrency()) == 0;
+    }
+    virtual CacheKeyBase *clone() const {
+        return new CurrencyFormatterKey(*this);
+    }
+    virtual const SharedCurrencyFormatter *createObject(
+            const void * /*unused*/, UErrorCode &status) const {
+        SharedCurrencyFormatter *result = new SharedCurrencyFormatter(fLoc, fCurrency);
+        if (result == nullptr) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return nullptr;
+        }
+        result->addRef();
+        return result;
+    }
+};
+
+CurrencyFormatterKey::~CurrencyFormatterKey() {
+}
+
+U_NAMESPACE_END
+
+void NumberFormatter::formatCurrency(const Locale& locale, const CurrencyUnit& currency, double value,
+                                     UnicodeString& appendTo, UErrorCode& status) {
+    if (U_FAILURE(status)) { return; }
+    const UnifiedCache* cache = UnifiedCache::getInstance(status);
+    if (U_FAILURE(status)) { return; }
+    CurrencyFormatterKey key(locale, currency);
+    const SharedCurrencyFormatter* shared = nullptr;
+    cache->get(key, shared, status);
+    if (U_FAILURE(status)) { return; }
+    UFormattedNumberData data;
+    shared->fFormatter.formatDoubleToData(value, data, status);
+    if (U_SUCCESS(status)) {
+        appendTo.append(data.string.toTempUnicodeString());
+    }
+    shared->removeRef();
+}
+
 
 template<typename T> using NFS = NumberFormatterSettings<T>;
 using LNF = LocalizedNumberFormatter;
@@ -679,6 +776,57 @@ LocalizedNumberFormatter::formatDecimalQuantity(const DecimalQuantity& dq, UErro
     }
 }
 
+void LocalizedNumberFormatter::formatIntToData(int64_t value, impl::UFormattedNumberData& results,
+                                               UErrorCode& status) const {
+    if (U_FAILURE(status)) { return; }
+    results.string.clear();
+    results.quantity.setToLong(value);
+    formatImpl(&results, status);
+}
+
+void LocalizedNumberFormatter::formatDoubleToData(double value, impl::UFormattedNumberData& results,
+                                                  UErrorCode& status) const {
+    if (U_FAILURE(status)) { return; }
+    results.string.clear();
+    results.quantity.setToDouble(value);
+    formatImpl(&results, status);
+}
+
+void LocalizedNumberFormatter::formatDecimalToData(StringPiece value,
+                                                   impl::UFormattedNumberData& results,
+                                                   UErrorCode& status) const {
+    if (U_FAILURE(status)) { return; }
+    results.string.clear();
+    results.quantity.setToDecNumber(value, status);
+    formatImpl(&results, status);
+}
+
+void LocalizedNumberFormatter::formatDoubles(const double* values, int32_t count,
+                                             UnicodeString& appendTo, int32_t offsets[],
+                                             UErrorCode& status) const {
+    if (U_FAILURE(status)) { return; }
+    if (count < 0 || (values == nullptr && count != 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    // One results object serves the whole batch; clear() retains the string builder's
+    // capacity, so after the first value each iteration runs without heap operations.
+    UFormattedNumberData data;
+    for (int32_t i = 0; i < count; i++) {
+        data.string.clear();
+        data.quantity.setToDouble(values[i]);
+        formatImpl(&data, status);
+        if (U_FAILURE(status)) { return; }
+        if (offsets != nullptr) {
+            offsets[i] = appendTo.length();
+        }
+        appendTo.append(data.string.toTempUnicodeString());
+    }
+    if (offsets != nullptr) {
+        offsets[count] = appendTo.length();
+    }
+}
+
 void LocalizedNumberFormatter::formatImpl(impl::UFormattedNumberData* results, UErrorCode& status) const {
     if (computeCompiled(status)) {
         fCompiled->format(results->quantity, results->string, status);
@@ -486,6 +486,34 @@ int32_t NumberFormatterImpl::writeIntegerDigits(const MicroProps& micros, Decima
                                                 UErrorCode& status) {
     int length = 0;
     int integerCount = quantity.getUpperDisplayMagnitude() + 1;
+
+    // Fast path: when digits and the grouping separator are all single code units, assemble
+    // the whole integer part in a stack buffer and splice it into the string builder with a
+    // single call, instead of one insert (and one field-array shift) per character.
+    UChar32 cpZero = micros.symbols->getCodePointZero();
+    const UnicodeString& groupingString = micros.useCurrency ? micros.symbols->getSymbol(
+            DecimalFormatSymbols::ENumberFormatSymbol::kMonetaryGroupingSeparatorSymbol)
+                                                             : micros.symbols->getSymbol(
+            DecimalFormatSymbols::ENumberFormatSymbol::kGroupingSeparatorSymbol);
+    constexpr int32_t kBlockCapacity = 64;
+    if (cpZero != -1 && cpZero + 9 <= 0xFFFF && groupingString.length() == 1 &&
+        integerCount <= kBlockCapacity / 2) {
+        char16_t chars[kBlockCapacity];
+        Field fields[kBlockCapacity];
+        int32_t pos = kBlockCapacity;
+        for (int i = 0; i < integerCount; i++) {
+            if (micros.grouping.groupAtPosition(i, quantity)) {
+                pos--;
+                chars[pos] = groupingString.charAt(0);
+                fields[pos] = UNUM_GROUPING_SEPARATOR_FIELD;
+            }
+            pos--;
+            chars[pos] = static_cast<char16_t>(cpZero + quantity.getDigit(i));
+            fields[pos] = UNUM_INTEGER_FIELD;
+        }
+        return string.insert(index, chars + pos, fields + pos, kBlockCapacity - pos, status);
+    }
+
     for (int i = 0; i < integerCount; i++) {
         // Add grouping separator
         if (micros.grouping.groupAtPosition(i, quantity)) {
@@ -512,6 +540,21 @@ int32_t NumberFormatterImpl::writeFractionDigits(const MicroProps& micros, Decim
                                                  UErrorCode& status) {
     int length = 0;
     int fractionCount = -quantity.getLowerDisplayMagnitude();
+
+    // Fast path: single-code-unit digits can be assembled in a stack buffer and spliced in
+    // with a single call. See writeIntegerDigits.
+    UChar32 cpZero = micros.symbols->getCodePointZero();
+    constexpr int32_t kBlockCapacity = 64;
+    if (cpZero != -1 && cpZero + 9 <= 0xFFFF && fractionCount <= kBlockCapacity) {
+        char16_t chars[kBlockCapacity];
+        Field fields[kBlockCapacity];
+        for (int i = 0; i < fractionCount; i++) {
+            chars[i] = static_cast<char16_t>(cpZero + quantity.getDigit(-i - 1));
+            fields[i] = UNUM_FRACTION_FIELD;
+        }
+        return string.insert(index, chars, fields, fractionCount, status);
+    }
+
     for (int i = 0; i < fractionCount; i++) {
         // Get and append the next digit value
         int8_t nextDigit = quantity.getDigit(-i - 1);
@@ -11,6 +11,7 @@
 #include "number_stringbuilder.h"
 #include "unicode/unum.h"
 #include "number_microprops.h"
+#include "cmemory.h"
 
 using namespace icu;
 using namespace icu::number;
@@ -38,6 +39,40 @@ void ScientificModifier::set(int32_t exponent, const ScientificHandler *handler)
 
 int32_t ScientificModifier::apply(NumberStringBuilder &output, int32_t /*leftIndex*/, int32_t rightIndex,
                                   UErrorCode &status) const {
+    const ScientificHandler &h = *fHandler;
+
+    // Fast path: assemble the whole exponent (separator, sign, digits) from the pieces
+    // precomputed in the handler and splice it in with a single insert.
+    if (h.fFastPathOk) {
+        char16_t chars[ScientificHandler::kMaxSepLength + ScientificHandler::kMaxSignLength + 12];
+        Field fields[UPRV_LENGTHOF(chars)];
+        int32_t len = h.fSepLength;
+        uprv_memcpy(chars, h.fSepChars, len * sizeof(char16_t));
+        uprv_memcpy(fields, h.fSepFields, len * sizeof(Field));
+        if (fExponent < 0 && h.fSettings.fExponentSignDisplay != UNUM_SIGN_NEVER) {
+            uprv_memcpy(chars + len, h.fMinusChars, h.fMinusLength * sizeof(char16_t));
+            uprv_memcpy(fields + len, h.fMinusFields, h.fMinusLength * sizeof(Field));
+            len += h.fMinusLength;
+        } else if (fExponent >= 0 && h.fSettings.fExponentSignDisplay == UNUM_SIGN_ALWAYS) {
+            uprv_memcpy(chars + len, h.fPlusChars, h.fPlusLength * sizeof(char16_t));
+            uprv_memcpy(fields + len, h.fPlusFields, h.fPlusLength * sizeof(Field));
+            len += h.fPlusLength;
+        }
+        // Count the digits to be shown, then write them most-significant first.
+        int32_t disp = std::abs(fExponent);
+        int32_t count = 0;
+        for (int32_t d = disp; count < h.fSettings.fMinExponentDigits || d > 0; count++, d /= 10) {}
+        if (len + count <= UPRV_LENGTHOF(chars)) {
+            for (int32_t j = count - 1; j >= 0; j--, disp /= 10) {
+                chars[len + j] = static_cast<char16_t>(h.fDigitZero + disp % 10);
+                fields[len + j] = UNUM_EXPONENT_FIELD;
+            }
+            len += count;
+            return output.insert(rightIndex, chars, fields, len, status);
+        }
+        // Unusually many digits requested; fall through to the general path.
+    }
+
     // FIXME: Localized exponent separator location.
     int i = rightIndex;
     // Append the exponent separator and sign
@@ -113,10 +148,43 @@ bool ScientificModifier::semanticallyEquivalent(const Modifier& other) const {
     return fExponent == _other->fExponent;
 }
 
+namespace {
+
+/** Copies a symbol string and its field annotation into the given parallel arrays. */
+bool copySymbolPiece(const UnicodeString &symbol, Field field, char16_t *chars, Field *fields,
+                     int32_t capacity, int32_t &length) {
+    length = symbol.length();
+    if (length > capacity) {
+        return false;
+    }
+    for (int32_t i = 0; i < length; i++) {
+        chars[i] = symbol.charAt(i);
+        fields[i] = field;
+    }
+    return true;
+}
+
+} // namespace
+
 // Note: Visual Studio does not compile this function without full name space. Why?
 icu::number::impl::ScientificHandler::ScientificHandler(const Notation *notation, const DecimalFormatSymbols *symbols,
-	const MicroPropsGenerator *parent) : 
-	fSettings(notation->fUnion.scientific), fSymbols(symbols), fParent(parent) {}
+	const MicroPropsGenerator *parent) :
+	fSettings(notation->fUnion.scientific), fSymbols(symbols), fParent(parent) {
+    // Precompute the affix pieces for the fast path in ScientificModifier::apply.
+    UChar32 cpZero = symbols->getCodePointZero();
+    fDigitZero = static_cast<char16_t>(cpZero);
+    fFastPathOk = cpZero != -1 && cpZero + 9 <= 0xFFFF &&
+            copySymbolPiece(
+                    symbols->getSymbol(DecimalFormatSymbols::ENumberFormatSymbol::kExponentialSymbol),
+                    UNUM_EXPONENT_SYMBOL_FIELD, fSepChars, fSepFields, kMaxSepLength, fSepLength) &&
+            copySymbolPiece(
+                    symbols->getSymbol(DecimalFormatSymbols::ENumberFormatSymbol::kMinusSignSymbol),
+                    UNUM_EXPONENT_SIGN_FIELD, fMinusChars, fMinusFields, kMaxSignLength,
+                    fMinusLength) &&
+            copySymbolPiece(
+                    symbols->getSymbol(DecimalFormatSymbols::ENumberFormatSymbol::kPlusSignSymbol),
+                    UNUM_EXPONENT_SIGN_FIELD, fPlusChars, fPlusFields, kMaxSignLength, fPlusLength);
+}
 
 void ScientificHandler::processQuantity(DecimalQuantity &quantity, MicroProps &micros,
                                         UErrorCode &status) const {
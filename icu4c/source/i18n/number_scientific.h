@@ -56,6 +56,24 @@ class ScientificHandler : public UMemory, public MicroPropsGenerator, public Mul
     const DecimalFormatSymbols *fSymbols;
     const MicroPropsGenerator *fParent;
 
+    // Precomputed pieces of the exponent affix (separator, minus sign, plus sign), with their
+    // field annotations, so that ScientificModifier::apply can assemble the whole exponent in a
+    // stack buffer and splice it in with a single insert. Usable only when fFastPathOk is set:
+    // all pieces fit their buffers and the locale digits are single code units.
+    static constexpr int32_t kMaxSepLength = 8;
+    static constexpr int32_t kMaxSignLength = 4;
+    char16_t fSepChars[kMaxSepLength];
+    Field fSepFields[kMaxSepLength];
+    int32_t fSepLength;
+    char16_t fMinusChars[kMaxSignLength];
+    Field fMinusFields[kMaxSignLength];
+    int32_t fMinusLength;
+    char16_t fPlusChars[kMaxSignLength];
+    Field fPlusFields[kMaxSignLength];
+    int32_t fPlusLength;
+    char16_t fDigitZero;
+    bool fFastPathOk;
+
     friend class ScientificModifier;
 };
 
@@ -199,6 +199,22 @@ NumberStringBuilder::insert(int32_t index, const UnicodeString &unistr, int32_t
     return count;
 }
 
+int32_t
+NumberStringBuilder::insert(int32_t index, const char16_t *chars, const Field *fields, int32_t count,
+                            UErrorCode &status) {
+    if (count == 0) {
+        // Nothing to insert.
+        return 0;
+    }
+    int32_t position = prepareForInsert(index, count, status);
+    if (U_FAILURE(status)) {
+        return count;
+    }
+    uprv_memcpy(getCharPtr() + position, chars, sizeof(char16_t) * count);
+    uprv_memcpy(getFieldPtr() + position, fields, sizeof(Field) * count);
+    return count;
+}
+
 int32_t
 NumberStringBuilder::splice(int32_t startThis, int32_t endThis,  const UnicodeString &unistr,
                             int32_t startOther, int32_t endOther, Field field, UErrorCode& status) {
@@ -78,6 +78,13 @@ class U_I18N_API NumberStringBuilder : public UMemory {
     int32_t insert(int32_t index, const UnicodeString &unistr, int32_t start, int32_t end, Field field,
                    UErrorCode &status);
 
+    /**
+     * Inserts a run of code units with per-unit field annotations in a single splice.
+     * The chars and fields arrays must both contain at least count entries.
+     */
+    int32_t insert(int32_t index, const char16_t *chars, const Field *fields, int32_t count,
+                   UErrorCode &status);
+
     int32_t splice(int32_t startThis, int32_t endThis,  const UnicodeString &unistr,
                    int32_t startOther, int32_t endOther, Field field, UErrorCode& status);
 
@@ -1391,8 +1391,9 @@ NumberFormat::makeInstance(const Locale& desiredLocale,
         return NULL;
     }
     else {
-        // Loads the decimal symbols of the desired locale.
-        symbolsToAdopt.adoptInsteadAndCheckErrorCode(new DecimalFormatSymbols(desiredLocale, status), status);
+        // Loads the decimal symbols of the desired locale, via the unified cache.
+        symbolsToAdopt.adoptInsteadAndCheckErrorCode(
+                DecimalFormatSymbols::createForLocale(desiredLocale, status), status);
         if (U_FAILURE(status)) {
             return NULL;
         }
@@ -89,6 +89,21 @@ DecimalMatcher::DecimalMatcher(const DecimalFormatSymbols& symbols, const Groupe
     // Fraction grouping parsing is disabled for now but could be enabled later.
     // See http://bugs.icu-project.org/trac/ticket/10794
     // fractionGrouping = 0 != (parseFlags & PARSE_FLAG_FRACTION_GROUPING_ENABLED);
+
+    // Determine eligibility for tryFastParse. The fast path accepts only ASCII digits plus the
+    // decimal separator, and defers to the full match method as soon as it sees anything else,
+    // so the only requirement is that the separator be matchable as a single code unit. The
+    // main match loop accepts ASCII digits via u_isdigit in every locale, so the locale's own
+    // digit repertoire does not affect eligibility.
+    fastParseDecimalSep = 0;
+    fastParseOk = false;
+    if (decimalSeparator.isEmpty()) {
+        fastParseOk = true;
+    } else if (decimalSeparator.length() == 1 && !U16_IS_SURROGATE(decimalSeparator.charAt(0)) &&
+               !u_isdigit(decimalSeparator.charAt(0))) {
+        fastParseOk = true;
+        fastParseDecimalSep = decimalSeparator.charAt(0);
+    }
 }
 
 bool DecimalMatcher::match(StringSegment& segment, ParsedNumber& result, UErrorCode& status) const {
@@ -431,6 +446,52 @@ bool DecimalMatcher::validateGroup(int32_t sepType, int32_t count, bool isPrimar
     }
 }
 
+bool DecimalMatcher::tryFastParse(StringSegment& segment, ParsedNumber& result) const {
+    if (!fastParseOk || result.seenNumber()) {
+        return false;
+    }
+
+    // One pass over the segment: every code unit must be an ASCII digit, except for at most
+    // one occurrence of the decimal separator. Anything else (grouping separators, locale
+    // digits, exponents, affix characters) defers to the full matcher chain.
+    int32_t len = segment.length();
+    int32_t sepIndex = -1;
+    for (int32_t i = 0; i < len; i++) {
+        char16_t ch = segment.charAt(i);
+        if (ch >= u'0' && ch <= u'9') {
+            continue;
+        }
+        if (ch == fastParseDecimalSep && fastParseDecimalSep != 0 && sepIndex == -1 &&
+            !integerOnly) {
+            sepIndex = i;
+            continue;
+        }
+        return false;
+    }
+    if (len - (sepIndex >= 0 ? 1 : 0) == 0) {
+        // No digits.
+        return false;
+    }
+
+    // Commit the result, producing the same fields that the full match method would.
+    result.quantity.bogus = false;
+    result.quantity.clear();
+    for (int32_t i = 0; i < len; i++) {
+        if (i == sepIndex) {
+            continue;
+        }
+        result.quantity.appendDigit(static_cast<int8_t>(segment.charAt(i) - u'0'), 0, true);
+    }
+    if (sepIndex >= 0) {
+        // Adjust for fraction part.
+        result.quantity.adjustMagnitude(-(len - sepIndex - 1));
+        result.flags |= FLAG_HAS_DECIMAL_SEPARATOR;
+    }
+    segment.adjustOffset(len);
+    result.setCharsConsumed(segment);
+    return true;
+}
+
 bool DecimalMatcher::smokeTest(const StringSegment& segment) const {
     // The common case uses a static leadSet for efficiency.
     if (fLocalDigitStrings.isNull() && leadSet != nullptr) {
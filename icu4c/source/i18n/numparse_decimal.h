@@ -29,6 +29,15 @@ class DecimalMatcher : public NumberParseMatcher, public UMemory {
 
     bool smokeTest(const StringSegment& segment) const override;
 
+    /**
+     * Attempts to consume the entire remaining segment as a plain decimal string: ASCII digits
+     * with at most one occurrence of the locale decimal separator. Returns false without
+     * touching the result if the segment contains anything else (grouping separators, locale
+     * digits, exponents, affixes); the caller then falls back to the full matcher chain.
+     * Eligibility is determined once, at construction time.
+     */
+    bool tryFastParse(StringSegment& segment, ParsedNumber& result) const;
+
     UnicodeString toString() const override;
 
   private:
@@ -48,6 +57,12 @@ class DecimalMatcher : public NumberParseMatcher, public UMemory {
     int16_t grouping1;
     int16_t grouping2;
 
+    /** If true, tryFastParse is eligible to run; computed once in the constructor */
+    bool fastParseOk;
+
+    /** The decimal separator recognized by tryFastParse, or 0 if none */
+    char16_t fastParseDecimalSep;
+
     UnicodeString groupingSeparator;
     UnicodeString decimalSeparator;
 
@@ -182,6 +182,12 @@ NumberParserImpl::createParserFromProperties(const number::impl::DecimalFormatPr
     }
     parser->addMatcher(parser->fLocalMatchers.ignorables);
     parser->addMatcher(parser->fLocalMatchers.decimal = {symbols, grouper, parseFlags});
+    if (!parseCurrency && !affixProvider->hasCurrencySign()) {
+        // Enable the plain-decimal fast path. Not worthwhile when a currency matcher is
+        // present, because its smoke test currently accepts every string; see
+        // CombinedCurrencyMatcher::smokeTest.
+        parser->fFastPathMatcher = &parser->fLocalMatchers.decimal;
+    }
     // NOTE: parseNoExponent doesn't disable scientific parsing if we have a scientific formatter
     if (!properties.parseNoExponent || properties.minimumExponentDigits > 0) {
         parser->addMatcher(parser->fLocalMatchers.scientific = {symbols, grouper});
@@ -251,7 +257,27 @@ void NumberParserImpl::parse(const UnicodeString& input, int32_t start, bool gre
     // TODO: Check start >= 0 and start < input.length()
     StringSegment segment(input, 0 != (fParseFlags & PARSE_FLAG_IGNORE_CASE));
     segment.adjustOffset(start);
-    if (greedy) {
+    bool handled = false;
+    if (fFastPathMatcher != nullptr && segment.length() > 0) {
+        // Fast path for plain decimal strings, the common case for machine-readable input.
+        // Usable only if no other matcher could match at the start of the segment; matchers
+        // that apply later in the string (suffixes, exponents) are excluded by the fast path
+        // itself, which rejects any string that the decimal matcher alone would not consume
+        // in full. The postprocessing below applies either way.
+        bool othersCouldMatch = false;
+        for (int32_t i = 0; i < fNumMatchers; i++) {
+            if (fMatchers[i] != fFastPathMatcher && fMatchers[i]->smokeTest(segment)) {
+                othersCouldMatch = true;
+                break;
+            }
+        }
+        if (!othersCouldMatch) {
+            handled = fFastPathMatcher->tryFastParse(segment, result);
+        }
+    }
+    if (handled) {
+        // Fall through to postprocessing.
+    } else if (greedy) {
         parseGreedy(segment, result, status);
     } else if (0 != (fParseFlags & PARSE_FLAG_ALLOW_INFINITE_RECURSION)) {
         // Start at 1 so that recursionLevels never gets to 0
@@ -68,6 +68,10 @@ class U_I18N_API NumberParserImpl : public MutableMatcherCollection, public UMem
     MaybeStackArray<const NumberParseMatcher*, 10> fMatchers;
     bool fFrozen = false;
 
+    // If non-null, the decimal matcher to try as a fast path for plain decimal strings
+    // before falling back to the full matcher chain. Set by the factory methods.
+    const DecimalMatcher* fFastPathMatcher = nullptr;
+
     // WARNING: All of these matchers start in an undefined state (default-constructed).
     // You must use an assignment operator on them before using.
     struct {
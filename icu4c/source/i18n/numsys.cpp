@@ -25,7 +25,9 @@
 #include "unicode/schriter.h"
 #include "unicode/numsys.h"
 #include "cstring.h"
+#include "sharednumberingsystem.h"
 #include "uassert.h"
+#include "unifiedcache.h"
 #include "uresimp.h"
 #include "numsys_impl.h"
 
@@ -51,6 +53,10 @@ static const char gLatn[] = "latn";
 UOBJECT_DEFINE_RTTI_IMPLEMENTATION(NumberingSystem)
 UOBJECT_DEFINE_RTTI_IMPLEMENTATION(NumsysNameEnumeration)
 
+SharedNumberingSystem::~SharedNumberingSystem() {
+    delete ptr;
+}
+
     /**
      * Default Constructor.
      *
@@ -107,8 +113,8 @@ NumberingSystem::createInstance(int32_t radix_in, UBool isAlgorithmic_in, const
     return ns.orphan();
 }
 
-NumberingSystem* U_EXPORT2
-NumberingSystem::createInstance(const Locale & inLocale, UErrorCode& status) {
+static NumberingSystem*
+createInstanceForLocaleNonCached(const Locale & inLocale, UErrorCode& status) {
 
     if (U_FAILURE(status)) {
         return nullptr;
@@ -184,6 +190,48 @@ NumberingSystem::createInstance(const Locale & inLocale, UErrorCode& status) {
     }
  }
 
+template<> U_I18N_API
+const SharedNumberingSystem *LocaleCacheKey<SharedNumberingSystem>::createObject(
+        const void * /*unused*/, UErrorCode &status) const {
+    LocalPointer<NumberingSystem> ns(createInstanceForLocaleNonCached(fLoc, status), status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    LocalPointer<SharedNumberingSystem> result(new SharedNumberingSystem(ns.getAlias()), status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    ns.orphan(); // result was successfully created so it now owns ns.
+    result->addRef();
+    return result.orphan();
+}
+
+NumberingSystem* U_EXPORT2
+NumberingSystem::createInstance(const Locale & inLocale, UErrorCode& status) {
+
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+
+    // Numbering system resolution walks the locale's resource data and, for the
+    // default/native/traditional/finance aliases, may chase several fallbacks.
+    // The result depends only on the locale (including its "numbers" keyword),
+    // so share one resolved instance per locale via the unified cache. The
+    // cache replays the creation status, preserving U_USING_FALLBACK_WARNING
+    // on hits as well as misses.
+    const SharedNumberingSystem *shared = nullptr;
+    UnifiedCache::getByLocale(inLocale, shared, status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    NumberingSystem *result = new NumberingSystem(**shared);
+    shared->removeRef();
+    if (result == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    }
+    return result;
+}
+
 NumberingSystem* U_EXPORT2
 NumberingSystem::createInstance(UErrorCode& status) {
     return NumberingSystem::createInstance(Locale::getDefault(), status);
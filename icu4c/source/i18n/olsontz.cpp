@@ -101,6 +101,8 @@ void OlsonTimeZone::constructEmpty() {
 
     transitionCountPre32 = transitionCount32 = transitionCountPost32 = 0;
     transitionTimesPre32 = transitionTimes32 = transitionTimesPost32 = NULL;
+    uprv_free(transitionTimes64);
+    transitionTimes64 = NULL;
 
     typeMapData = NULL;
 
@@ -121,7 +123,7 @@ OlsonTimeZone::OlsonTimeZone(const UResourceBundle* top,
                              const UResourceBundle* res,
                              const UnicodeString& tzid,
                              UErrorCode& ec) :
-  BasicTimeZone(tzid), finalZone(NULL)
+  BasicTimeZone(tzid), transitionTimes64(NULL), fLastTransitionIdx(0), finalZone(NULL)
 {
     clearTransitionRules();
     U_DEBUG_TZ_MSG(("OlsonTimeZone(%s)\n", ures_getKey((UResourceBundle*)res)));
@@ -259,6 +261,27 @@ OlsonTimeZone::OlsonTimeZone(const UResourceBundle* top,
 
     if (U_FAILURE(ec)) {
         constructEmpty();
+    } else {
+        initTransitionTimes64();
+    }
+}
+
+/**
+ * Flatten the pre-32/32/post-32 transition arrays into a single array of
+ * 64-bit seconds. On allocation failure transitionTimes64 stays NULL and
+ * lookups fall back to reconstructing values from the resource arrays.
+ */
+void OlsonTimeZone::initTransitionTimes64() {
+    int16_t transCount = transitionCount();
+    if (transCount == 0) {
+        return;
+    }
+    transitionTimes64 = static_cast<int64_t*>(uprv_malloc(transCount * sizeof(int64_t)));
+    if (transitionTimes64 == NULL) {
+        return;
+    }
+    for (int16_t i = 0; i < transCount; i++) {
+        transitionTimes64[i] = transitionTimeInSeconds(i);
     }
 }
 
@@ -266,7 +289,7 @@ OlsonTimeZone::OlsonTimeZone(const UResourceBundle* top,
  * Copy constructor
  */
 OlsonTimeZone::OlsonTimeZone(const OlsonTimeZone& other) :
-    BasicTimeZone(other), finalZone(0) {
+    BasicTimeZone(other), transitionTimes64(NULL), fLastTransitionIdx(0), finalZone(0) {
     *this = other;
 }
 
@@ -284,6 +307,11 @@ OlsonTimeZone& OlsonTimeZone::operator=(const OlsonTimeZone& other) {
     transitionCount32 = other.transitionCount32;
     transitionCountPost32 = other.transitionCountPost32;
 
+    uprv_free(transitionTimes64);
+    transitionTimes64 = NULL;
+    initTransitionTimes64();
+    umtx_storeRelease(fLastTransitionIdx, 0);
+
     typeCount = other.typeCount;
     typeOffsets = other.typeOffsets;
     typeMapData = other.typeMapData;
@@ -305,6 +333,7 @@ OlsonTimeZone& OlsonTimeZone::operator=(const OlsonTimeZone& other) {
  */
 OlsonTimeZone::~OlsonTimeZone() {
     deleteTransitionRules();
+    uprv_free(transitionTimes64);
     delete finalZone;
 }
 
@@ -488,6 +517,31 @@ OlsonTimeZone::getHistoricalOffset(UDate date, UBool local,
             // Before the first transition time
             rawoff = initialRawOffset() * U_MILLIS_PER_SECOND;
             dstoff = initialDstOffset() * U_MILLIS_PER_SECOND;
+        } else if (!local && transitionTimes64 != NULL) {
+            // UTC lookup against the flattened transition table. Try the
+            // window that satisfied the previous lookup first; consecutive
+            // lookups usually land in the same window.
+            int32_t idx = umtx_loadAcquire(fLastTransitionIdx);
+            if (idx < 0 || idx >= transCount
+                    || sec < transitionTimes64[idx]
+                    || (idx + 1 < transCount && sec >= transitionTimes64[idx + 1])) {
+                // Binary search for the last transition time <= sec. The
+                // enclosing condition guarantees sec >= transitionTimes64[0].
+                int32_t lo = 0;
+                int32_t hi = transCount - 1;
+                while (lo < hi) {
+                    int32_t mid = (lo + hi + 1) >> 1;
+                    if (sec >= transitionTimes64[mid]) {
+                        lo = mid;
+                    } else {
+                        hi = mid - 1;
+                    }
+                }
+                idx = lo;
+                umtx_storeRelease(fLastTransitionIdx, idx);
+            }
+            rawoff = rawOffsetAt((int16_t)idx) * U_MILLIS_PER_SECOND;
+            dstoff = dstOffsetAt((int16_t)idx) * U_MILLIS_PER_SECOND;
         } else {
             // Linear search from the end is the fastest approach, since
             // most lookups will happen at/near the end.
@@ -343,6 +343,25 @@ private:
      */
     const int32_t *transitionTimesPost32; // alias into res; do not delete
 
+    /**
+     * All transition times in seconds from the 1970 epoch, flattened from
+     * the three resource arrays above at construction time, so that offset
+     * lookups do not reconstruct 64-bit values per comparison. Length is
+     * transitionCount(). NULL if there are no transitions or if the
+     * allocation failed; lookups then fall back to the resource arrays.
+     */
+    int64_t *transitionTimes64; // owned, may be NULL
+
+    /**
+     * Index of the transition window that satisfied the most recent
+     * non-local offset lookup. Consecutive lookups usually land in the same
+     * window. The value is validated against transitionTimes64 before use,
+     * so a stale read from another thread is harmless.
+     */
+    mutable u_atomic_int32_t fLastTransitionIdx;
+
+    void initTransitionTimes64();
+
     /**
      * Number of types, 1..255
      */
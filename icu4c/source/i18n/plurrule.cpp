@@ -69,6 +69,7 @@ PluralRules::PluralRules(UErrorCode& /*status*/)
     mRules(nullptr),
     mInternalStatus(U_ZERO_ERROR)
 {
+    compileSmallIntKeywords();
 }
 
 PluralRules::PluralRules(const PluralRules& other)
@@ -119,10 +120,43 @@ PluralRules::operator=(const PluralRules& other) {
                 mInternalStatus = mRules->fInternalStatus;
             }
         }
+        compileSmallIntKeywords();
     }
     return *this;
 }
 
+void
+PluralRules::compileSmallIntKeywords() {
+    UBool useFastPath = (mRules != nullptr && U_SUCCESS(mInternalStatus));
+    if (useFastPath) {
+        int32_t ruleCount = 0;
+        for (const RuleChain *rules = mRules; rules != nullptr; rules = rules->fNext) {
+            ++ruleCount;
+        }
+        if (ruleCount > 127) {
+            useFastPath = FALSE;  // cannot index the chain with an int8_t
+        }
+    }
+    if (!useFastPath) {
+        for (int32_t n = 0; n < kSmallIntKeywordCount; ++n) {
+            mSmallIntRuleIndex[n] = -2;
+        }
+        return;
+    }
+    for (int32_t n = 0; n < kSmallIntKeywordCount; ++n) {
+        FixedDecimal fd(n);
+        int8_t index = -1;  // no rule matched: the "other" keyword
+        int8_t r = 0;
+        for (RuleChain *rules = mRules; rules != nullptr; rules = rules->fNext, ++r) {
+            if (rules->ruleHeader->isFulfilled(fd)) {
+                index = r;
+                break;
+            }
+        }
+        mSmallIntRuleIndex[n] = index;
+    }
+}
+
 StringEnumeration* PluralRules::getAvailableLocales(UErrorCode &status) {
     if (U_FAILURE(status)) {
         return nullptr;
@@ -148,6 +182,8 @@ PluralRules::createRules(const UnicodeString& description, UErrorCode& status) {
     parser.parse(description, newRules.getAlias(), status);
     if (U_FAILURE(status)) {
         newRules.adoptInstead(nullptr);
+    } else {
+        newRules->compileSmallIntKeywords();
     }
     return newRules.orphan();
 }
@@ -251,12 +287,28 @@ PluralRules::internalForLocale(const Locale& locale, UPluralType type, UErrorCod
         //        should we silently use default rules?
         //        Original impl used default rules.
         //        Ask the question to ICU Core.
+    if (U_SUCCESS(status)) {
+        newObj->compileSmallIntKeywords();
+    }
 
     return newObj.orphan();
 }
 
 UnicodeString
 PluralRules::select(int32_t number) const {
+    if (0 <= number && number < kSmallIntKeywordCount) {
+        int32_t index = mSmallIntRuleIndex[number];
+        if (index >= 0) {
+            const RuleChain *rules = mRules;
+            while (index-- > 0) {
+                rules = rules->fNext;
+            }
+            return rules->fKeyword;
+        }
+        if (index == -1) {
+            return UnicodeString(TRUE, PLURAL_KEYWORD_OTHER, 5);
+        }
+    }
     return select(FixedDecimal(number));
 }
 
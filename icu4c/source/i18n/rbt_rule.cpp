@@ -228,6 +228,25 @@ int16_t TransliterationRule::getIndexValue() const {
     return (int16_t)(data->lookupMatcher(c) == NULL ? (c & 0xFF) : -1);
 }
 
+/**
+ * Internal method.  Returns the first code unit of the key if it is a
+ * literal character, or -1 if the key is empty or starts with a set or
+ * other matcher.  See getIndexValue(); this is the full code unit
+ * rather than its low byte.
+ */
+int32_t TransliterationRule::getFirstKeyUnit() const {
+    if (anteContextLength == pattern.length()) {
+        // Only ante context; can match any key.
+        return -1;
+    }
+    UChar32 c = pattern.char32At(anteContextLength);
+    if (data->lookupMatcher(c) != NULL) {
+        // The first key character is a set or segment reference.
+        return -1;
+    }
+    return pattern.charAt(anteContextLength);
+}
+
 /**
  * Internal method.  Returns true if this rule matches the given
  * index value.  The index value is an 8-bit integer, 0..255,
@@ -228,6 +228,17 @@ public:
      */
     int16_t getIndexValue() const;
 
+    /**
+     * Internal method.  Returns the first code unit of the key, if it
+     * is a literal character, or -1 if the key is empty or starts with
+     * a set or other matcher.  A rule with a non-negative first key
+     * unit can only match text whose code unit at the cursor equals
+     * that unit, which allows the rule set to reject the rule without
+     * attempting a match.
+     * @return    first literal key code unit, or -1.
+     */
+    int32_t getFirstKeyUnit() const;
+
     /**
      * Internal method.  Returns true if this rule matches the given
      * index value.  The index value is an 8-bit integer, 0..255,
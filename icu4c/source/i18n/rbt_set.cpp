@@ -172,6 +172,7 @@ TransliterationRuleSet::TransliterationRuleSet(UErrorCode& status) : UMemory() {
         status = U_MEMORY_ALLOCATION_ERROR;
     }
     rules = NULL;
+    firstKeyUnits = NULL;
     maxContextLength = 0;
 }
 
@@ -182,6 +183,7 @@ TransliterationRuleSet::TransliterationRuleSet(const TransliterationRuleSet& oth
     UMemory(other),
     ruleVector(0),
     rules(0),
+    firstKeyUnits(0),
     maxContextLength(other.maxContextLength) {
 
     int32_t i, len;
@@ -215,6 +217,7 @@ TransliterationRuleSet::TransliterationRuleSet(const TransliterationRuleSet& oth
 TransliterationRuleSet::~TransliterationRuleSet() {
     delete ruleVector; // This deletes the contained rules
     uprv_free(rules);
+    uprv_free(firstKeyUnits);
 }
 
 void TransliterationRuleSet::setData(const TransliterationRuleData* d) {
@@ -260,6 +263,8 @@ void TransliterationRuleSet::addRule(TransliterationRule* adoptedRule,
 
     uprv_free(rules);
     rules = 0;
+    uprv_free(firstKeyUnits);
+    firstKeyUnits = 0;
 }
 
 /**
@@ -336,20 +341,24 @@ void TransliterationRuleSet::freeze(UParseError& parseError,UErrorCode& status)
     /* Freeze things into an array.
      */
     uprv_free(rules); // Contains alias pointers
+    uprv_free(firstKeyUnits);
 
     /* You can't do malloc(0)! */
     if (v.size() == 0) {
         rules = NULL;
+        firstKeyUnits = NULL;
         return;
     }
     rules = (TransliterationRule **)uprv_malloc(v.size() * sizeof(TransliterationRule *));
+    firstKeyUnits = (int32_t *)uprv_malloc(v.size() * sizeof(int32_t));
     /* test for NULL */
-    if (rules == 0) {
+    if (rules == 0 || firstKeyUnits == 0) {
         status = U_MEMORY_ALLOCATION_ERROR;
         return;
     }
     for (j=0; j<v.size(); ++j) {
         rules[j] = (TransliterationRule*) v.elementAt(j);
+        firstKeyUnits[j] = rules[j]->getFirstKeyUnit();
     }
 
     // TODO Add error reporting that indicates the rules that
@@ -404,8 +413,17 @@ void TransliterationRuleSet::freeze(UParseError& parseError,UErrorCode& status)
 UBool TransliterationRuleSet::transliterate(Replaceable& text,
                                             UTransPosition& pos,
                                             UBool incremental) {
-    int16_t indexByte = (int16_t) (text.char32At(pos.start) & 0xFF);
+    UChar32 c = text.char32At(pos.start);
+    int16_t indexByte = (int16_t) (c & 0xFF);
+    // The first code unit at the cursor; rules whose key starts with a
+    // different literal unit cannot match and are skipped without
+    // attempting a match.
+    int32_t textUnit = U_IS_SUPPLEMENTARY(c) ? U16_LEAD(c) : (int32_t)c;
     for (int32_t i=index[indexByte]; i<index[indexByte+1]; ++i) {
+        int32_t keyUnit = firstKeyUnits[i];
+        if (keyUnit >= 0 && keyUnit != textUnit) {
+            continue;
+        }
         UMatchDegree m = rules[i]->matchAndReplace(text, pos, incremental);
         switch (m) {
         case U_MATCH:
@@ -419,7 +437,7 @@ UBool TransliterationRuleSet::transliterate(Replaceable& text,
         }
     }
     // No match or partial match from any rule
-    pos.start += U16_LENGTH(text.char32At(pos.start));
+    pos.start += U16_LENGTH(c);
     _debugOut("no match", NULL, text, pos);
     return TRUE;
 }
@@ -51,6 +51,14 @@ class TransliterationRuleSet : public UMemory {
      */
     TransliterationRule** rules;
 
+    /**
+     * First literal key code unit per entry of rules[], or -1 for
+     * entries whose key is empty or starts with a matcher.  Parallel
+     * to rules[]; created by freeze().  transliterate() uses it to
+     * reject rules in a bin without attempting a match.
+     */
+    int32_t* firstKeyUnits;
+
     /**
      * Index table.  For text having a first character c, compute x = c&0xFF.
      * Now use rules[index[x]..index[x+1]-1].  This index table is created by
@@ -19,9 +19,20 @@
 #include "gregoimp.h"
 #include "cmemory.h"
 #include "umutex.h"
+#include "putilimp.h"
 
 U_NAMESPACE_BEGIN
 
+/**
+ * When a zone uses a pair of final (permanent annual) rules, complete()
+ * materializes their transitions into the transition table up to this many
+ * years past the current date, so that getOffset lookups in that range are
+ * resolved by the table search instead of recomputing annual rule start
+ * dates on every call.  Dates beyond the horizon still fall back to
+ * findRuleInFinal().  Two transitions per year, 16 bytes each.
+ */
+static const int32_t kFinalRuleCacheYears = 30;
+
 /**
  * A struct representing a time zone transition
  */
@@ -340,6 +351,41 @@ RuleBasedTimeZone::complete(UErrorCode& status) {
             if (U_FAILURE(status)) {
                 goto cleanup;
             }
+            // Materialize upcoming final rule transitions through the cache
+            // horizon, so that getOffsetInternal resolves dates in that range
+            // with the table search instead of per-call annual rule math.
+            UDate cacheLimit = uprv_getUTCtime() + (UDate)kFinalRuleCacheYears * 365 * U_MILLIS_PER_DAY;
+            Transition *prev = final1;
+            while (prev->time < cacheLimit) {
+                TimeZoneRule *nextTo = (prev->to == rule0) ? rule1 : rule0;
+                UDate tt;
+                if (!nextTo->getNextStart(prev->time, prev->to->getRawOffset(), prev->to->getDSTSavings(), false, tt)) {
+                    // Should not happen, because both rules are permanent
+                    break;
+                }
+                if (tt <= prev->time) {
+                    // Degenerate rule pair (e.g. two annual rules starting
+                    // almost at the same time) - getNextStart did not
+                    // advance. Stop here; the table search falls back to the
+                    // final rules beyond the last materialized transition,
+                    // and the binary search requires ascending times.
+                    break;
+                }
+                Transition *trst = (Transition*)uprv_malloc(sizeof(Transition));
+                if (trst == NULL) {
+                    status = U_MEMORY_ALLOCATION_ERROR;
+                    goto cleanup;
+                }
+                trst->time = tt;
+                trst->from = prev->to;
+                trst->to = nextTo;
+                fHistoricTransitions->addElement(trst, status);
+                if (U_FAILURE(status)) {
+                    uprv_free(trst);
+                    goto cleanup;
+                }
+                prev = trst;
+            }
         }
     }
     fUpToDate = TRUE;
@@ -453,15 +499,21 @@ RuleBasedTimeZone::getOffsetInternal(UDate date, UBool local,
                     rule = ((Transition*)fHistoricTransitions->elementAt(idx))->to;
                 }
             } else {
-                // Find a historical transition
-                while (idx >= 0) {
-                    if (date >= getTransitionTime((Transition*)fHistoricTransitions->elementAt(idx),
+                // Binary search for the most recent transition at or
+                // before the given time.  Transition times are in
+                // ascending order.
+                int32_t lo = 0;
+                int32_t hi = idx;
+                while (lo < hi) {
+                    int32_t mid = lo + (hi - lo + 1) / 2;
+                    if (date >= getTransitionTime((Transition*)fHistoricTransitions->elementAt(mid),
                         local, NonExistingTimeOpt, DuplicatedTimeOpt)) {
-                        break;
+                        lo = mid;
+                    } else {
+                        hi = mid - 1;
                     }
-                    idx--;
                 }
-                rule = ((Transition*)fHistoricTransitions->elementAt(idx))->to;
+                rule = ((Transition*)fHistoricTransitions->elementAt(lo))->to;
             }
         }
     }
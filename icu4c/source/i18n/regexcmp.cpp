@@ -313,6 +313,7 @@ void    RegexCompile::compile(
     //   are too short.
     //
     fRXPat->fMinMatchLen = minMatchLength(3, fRXPat->fCompiledPat->size()-1);
+    fRXPat->fMaxMatchLen = maxMatchLength(3, fRXPat->fCompiledPat->size()-1);
 
     //
     // Optimization pass 2: match start type
@@ -332,8 +333,16 @@ void    RegexCompile::compile(
     int32_t i;
     for (i=0; i<numSets; i++) {
         UnicodeSet *s = (UnicodeSet *)fRXPat->fSets->elementAt(i);
+        if (s != NULL) {
+            // All modifications to the set are complete. Freeze it, so that
+            // the per-character contains() in the match engine goes through
+            // the precomputed two-level bitmap instead of the general
+            // binary search. Copies of frozen sets remain frozen.
+            s->freeze();
+        }
         fRXPat->fSets8[i].init(s);
     }
+    fRXPat->fInitialChars->freeze();
 
 }
 
@@ -1552,7 +1561,8 @@ UBool RegexCompile::doParseActions(int32_t action)
      case doSetBackslash_S:
         {
             UnicodeSet *set = (UnicodeSet *)fSetStack.peek();
-            UnicodeSet SSet(*RegexStaticSets::gStaticSets->fPropSets[URX_ISSPACE_SET]);
+            UnicodeSet SSet;   // plain copy construction would give a frozen set.
+            SSet.addAll(*RegexStaticSets::gStaticSets->fPropSets[URX_ISSPACE_SET]);
             SSet.complement();
             set->addAll(SSet);
             break;
@@ -1629,7 +1639,8 @@ UBool RegexCompile::doParseActions(int32_t action)
     case doSetBackslash_W:
         {
             UnicodeSet *set = (UnicodeSet *)fSetStack.peek();
-            UnicodeSet SSet(*RegexStaticSets::gStaticSets->fPropSets[URX_ISWORD_SET]);
+            UnicodeSet SSet;   // plain copy construction would give a frozen set.
+            SSet.addAll(*RegexStaticSets::gStaticSets->fPropSets[URX_ISWORD_SET]);
             SSet.complement();
             set->addAll(SSet);
             break;
@@ -2797,7 +2808,8 @@ void   RegexCompile::matchStartType() {
             if (currentLen == 0) {
                 int32_t  sn = URX_VAL(op);
                 const UnicodeSet *s = fRXPat->fStaticSets[sn];
-                UnicodeSet sc(*s);
+                UnicodeSet sc;   // plain copy construction would give a frozen set.
+                sc.addAll(*s);
                 sc.complement();
                 fRXPat->fInitialChars->addAll(sc);
                 numInitialStrings += 2;
@@ -4388,7 +4400,10 @@ UnicodeSet *RegexCompile::createSetForProperty(const UnicodeString &propName, UB
 
         status = U_ZERO_ERROR;
         if (propName.caseCompare(u"word", -1, 0) == 0) {
-            set.adoptInsteadAndCheckErrorCode(new UnicodeSet(*(fRXPat->fStaticSets[URX_ISWORD_SET])), status);
+            // cloneAsThawed(): the static set is frozen, and this copy may be
+            // modified by subsequent set operations in the pattern.
+            set.adoptInsteadAndCheckErrorCode(
+                (UnicodeSet *)fRXPat->fStaticSets[URX_ISWORD_SET]->cloneAsThawed(), status);
             break;
         }
         if (propName.compare(u"all", -1) == 0) {
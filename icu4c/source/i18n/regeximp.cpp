@@ -15,9 +15,24 @@
 #if !UCONFIG_NO_REGULAR_EXPRESSIONS
 #include "regeximp.h"
 #include "unicode/utf16.h"
+#include "cmemory.h"
 
 U_NAMESPACE_BEGIN
 
+#ifdef REGEX_OPCODE_PROFILE
+RegexOpcodeCounts gRegexOpcodeCounts;
+
+RegexOpcodeCounts::~RegexOpcodeCounts() {
+    static const char * const opNames[] = {URX_OPCODE_NAMES};
+    printf("Regex opcode execution counts:\n");
+    for (int32_t i=0; i<UPRV_LENGTHOF(opNames); i++) {
+        if (fCounts[i] != 0) {
+            printf("  %-18s %14lld\n", opNames[i], (long long)fCounts[i]);
+        }
+    }
+}
+#endif
+
 CaseFoldingUTextIterator::CaseFoldingUTextIterator(UText &text) :
    fUText(text), fFoldChars(NULL), fFoldLength(0) {
 }
@@ -34,6 +49,13 @@ UChar32 CaseFoldingUTextIterator::next() {
         if (originalC == U_SENTINEL) {
             return originalC;
         }
+        if (originalC < 0x80) {
+            // ASCII fast path. Only A-Z fold, each to the single code point a-z.
+            if (originalC >= 0x41 && originalC <= 0x5a) {
+                originalC += 0x20;
+            }
+            return originalC;
+        }
         fFoldLength = ucase_toFullFolding(originalC, &fFoldChars, U_FOLD_CASE_DEFAULT);
         if (fFoldLength >= UCASE_MAX_STRING_LENGTH || fFoldLength < 0) {
             // input code point folds to a single code point, possibly itself.
@@ -82,6 +104,13 @@ UChar32 CaseFoldingUCharIterator::next() {
         }
         U16_NEXT(fChars, fIndex, fLimit, originalC);
 
+        if (originalC < 0x80) {
+            // ASCII fast path. Only A-Z fold, each to the single code point a-z.
+            if (originalC >= 0x41 && originalC <= 0x5a) {
+                originalC += 0x20;
+            }
+            return originalC;
+        }
         fFoldLength = ucase_toFullFolding(originalC, &fFoldChars, U_FOLD_CASE_DEFAULT);
         if (fFoldLength >= UCASE_MAX_STRING_LENGTH || fFoldLength < 0) {
             // input code point folds to a single code point, possibly itself.
@@ -48,6 +48,27 @@ U_NAMESPACE_BEGIN
 #define REGEX_SCAN_DEBUG_PRINTF(a)
 #endif
 
+//
+//  Define REGEX_OPCODE_PROFILE to count the number of times the match
+//  engines execute each compiled opcode, attributing engine work to
+//  pattern constructs during performance investigations.  Process-wide
+//  totals are printed to stdout at exit.  For profiling builds only;
+//  the counter adds a memory increment to every interpreter step.
+//
+//#define REGEX_OPCODE_PROFILE
+
+#ifdef REGEX_OPCODE_PROFILE
+#include <stdio.h>
+struct RegexOpcodeCounts {
+    int64_t fCounts[256];
+    ~RegexOpcodeCounts();              // Prints the totals at process exit.
+};
+extern RegexOpcodeCounts gRegexOpcodeCounts;
+#define REGEX_OPCODE_COUNT(opType) (gRegexOpcodeCounts.fCounts[(opType) & 0xFF]++)
+#else
+#define REGEX_OPCODE_COUNT(opType)
+#endif
+
 
 //
 //  Opcode types     In the compiled form of the regexp, these are the type, or opcodes,
@@ -204,6 +204,10 @@ fEmptyText(NULL)
     for (i=0; i<URX_LAST_SET; i++) {
         if (fPropSets[i]) {
             fPropSets[i]->compact();
+            // Freeze the set so that the per-character contains() calls from
+            // the match engine use the precomputed two-level bitmap. Code
+            // needing a mutable copy must clone as thawed.
+            fPropSets[i]->freeze();
             fPropSets8[i].init(fPropSets[i]);
         }
     }
@@ -58,6 +58,8 @@ public:
                 for (int32_t pl = 0; pl < StandardPlural::COUNT; ++pl) {
                     relativeUnitsFormatters[style][relUnit][0][pl] = nullptr;
                     relativeUnitsFormatters[style][relUnit][1][pl] = nullptr;
+                    resolvedUnitsFormatters[style][relUnit][0][pl] = nullptr;
+                    resolvedUnitsFormatters[style][relUnit][1][pl] = nullptr;
                 }
             }
         }
@@ -76,6 +78,17 @@ public:
     SimpleFormatter *relativeUnitsFormatters[UDAT_STYLE_COUNT]
         [UDAT_REL_UNIT_COUNT][2][StandardPlural::COUNT];
 
+    // Aliases into relativeUnitsFormatters with the style and plural
+    // fallbacks already applied, so that a format-time lookup is a single
+    // array read. Not owned; filled once by resolveUnitFormatters() after
+    // the data is loaded.
+    const SimpleFormatter *resolvedUnitsFormatters[UDAT_STYLE_COUNT]
+        [UDAT_REL_UNIT_COUNT][2][StandardPlural::COUNT];
+
+    // Applies the style and plural fallback chains to every empty slot,
+    // populating resolvedUnitsFormatters.
+    void resolveUnitFormatters();
+
     const UnicodeString& getAbsoluteUnitString(int32_t fStyle,
                                                UDateAbsoluteUnit unit,
                                                UDateDirection direction) const;
@@ -156,28 +169,43 @@ const UnicodeString& RelativeDateTimeCacheData::getAbsoluteUnitString(
    return getRelativeDateTimeUnitFormatter(fStyle, rdtunit, pastFutureIndex, pluralUnit);
  }
 
- // Use fallback cache for SimpleFormatter relativeUnits.
+ // The fallbacks have been resolved into resolvedUnitsFormatters up front,
+ // so the lookup is a plain array read.
  const SimpleFormatter* RelativeDateTimeCacheData::getRelativeDateTimeUnitFormatter(
         int32_t fStyle,
         URelativeDateTimeUnit unit,
         int32_t pastFutureIndex,
         int32_t pluralUnit) const {
-    while (true) {
-        int32_t style = fStyle;
-        do {
-            if (relativeUnitsFormatters[style][unit][pastFutureIndex][pluralUnit] != nullptr) {
-                return relativeUnitsFormatters[style][unit][pastFutureIndex][pluralUnit];
-            }
-            style = fallBackCache[style];
-        } while (style != -1);
+    return resolvedUnitsFormatters[fStyle][unit][pastFutureIndex][pluralUnit];
+ }
 
-        if (pluralUnit == StandardPlural::OTHER) {
-            break;
+// Walks the style fallback chain, then retries with the OTHER plural form,
+// for every empty slot. Run once after loading; format-time lookups then
+// never repeat the walk.
+void RelativeDateTimeCacheData::resolveUnitFormatters() {
+    for (int32_t style = 0; style < UDAT_STYLE_COUNT; ++style) {
+        for (int32_t unit = 0; unit < UDAT_REL_UNIT_COUNT; ++unit) {
+            for (int32_t pastFutureIndex = 0; pastFutureIndex < 2; ++pastFutureIndex) {
+                for (int32_t pl = 0; pl < StandardPlural::COUNT; ++pl) {
+                    const SimpleFormatter *formatter = nullptr;
+                    int32_t pluralUnit = pl;
+                    while (formatter == nullptr) {
+                        int32_t fallbackStyle = style;
+                        do {
+                            formatter = relativeUnitsFormatters[fallbackStyle][unit][pastFutureIndex][pluralUnit];
+                            fallbackStyle = fallBackCache[fallbackStyle];
+                        } while (formatter == nullptr && fallbackStyle != -1);
+                        if (pluralUnit == StandardPlural::OTHER) {
+                            break;
+                        }
+                        pluralUnit = StandardPlural::OTHER;
+                    }
+                    resolvedUnitsFormatters[style][unit][pastFutureIndex][pl] = formatter;
+                }
+            }
         }
-        pluralUnit = StandardPlural::OTHER;
     }
-    return nullptr;  // No formatter found.
- }
+}
 
 static UBool getStringWithFallback(
         const UResourceBundle *resource,
@@ -704,6 +732,7 @@ const RelativeDateTimeCacheData *LocaleCacheKey<RelativeDateTimeCacheData>::crea
             status)) {
         return nullptr;
     }
+    result->resolveUnitFormatters();
     UnicodeString dateTimePattern;
     if (!getDateTimePattern(topLevel.getAlias(), dateTimePattern, status)) {
         return nullptr;
@@ -868,6 +897,10 @@ UnicodeString& RelativeDateTimeFormatter::format(
         status = U_INVALID_FORMAT_ERROR;
         return appendTo;
     }
+    if (fOptBreakIterator == nullptr) {
+        // No capitalization adjustment: assemble straight into the output.
+        return formatter->format(formattedNumber, appendTo, status);
+    }
     formatter->format(formattedNumber, result, status);
     adjustForContext(result);
     return appendTo.append(result);
@@ -905,6 +938,10 @@ UnicodeString& RelativeDateTimeFormatter::formatNumeric(
         status = U_INVALID_FORMAT_ERROR;
         return appendTo;
     }
+    if (fOptBreakIterator == nullptr) {
+        // No capitalization adjustment: assemble straight into the output.
+        return formatter->format(formattedNumber, appendTo, status);
+    }
     formatter->format(formattedNumber, result, status);
     adjustForContext(result);
     return appendTo.append(result);
@@ -773,6 +773,10 @@ UBool RegexMatcher::find(UErrorCode &status) {
             // Match starts on exactly one char.
             U_ASSERT(fPattern->fMinMatchLen > 0);
             UChar32 theChar = fPattern->fInitialChar;
+            // Only the first code point of the compiler's initial string is
+            // usable for screening; the whole string is not guaranteed to be
+            // a literal prefix of every match (e.g. capture references in
+            // look-ahead).
             UTEXT_SETNATIVEINDEX(fInputText, startPos);
             for (;;) {
                 int64_t pos = startPos;
@@ -1041,23 +1045,35 @@ UBool RegexMatcher::findUsingChunk(UErrorCode &status) {
         // Match starts on exactly one char.
         U_ASSERT(fPattern->fMinMatchLen > 0);
         UChar32 theChar = fPattern->fInitialChar;
+        // Only the first code point of the compiler's initial string is
+        // usable for screening; the whole string is not guaranteed to be
+        // a literal prefix of every match (e.g. capture references in
+        // look-ahead).
         for (;;) {
-            int32_t pos = startPos;
-            U16_NEXT(inputBuf, startPos, fActiveLimit, c);  // like c = inputBuf[startPos++];
-            if (c == theChar) {
-                MatchChunkAt(pos, FALSE, status);
-                if (U_FAILURE(status)) {
-                    return FALSE;
-                }
-                if (fMatch) {
-                    return TRUE;
-                }
+            // Skip directly to the next occurrence of the initial char
+            // instead of stepping one code point at a time.
+            int32_t spanLimit = testLen + U16_LENGTH(theChar);
+            if (spanLimit > (int32_t)fActiveLimit) {
+                spanLimit = (int32_t)fActiveLimit;
             }
-            if (startPos > testLen) {
+            const UChar *where = NULL;
+            if (startPos < spanLimit) {
+                where = u_memchr32(inputBuf + startPos, theChar, spanLimit - startPos);
+            }
+            if (where == NULL) {
                 fMatch = FALSE;
                 fHitEnd = TRUE;
                 return FALSE;
             }
+            int32_t pos = (int32_t)(where - inputBuf);
+            startPos = pos + U16_LENGTH(theChar);
+            MatchChunkAt(pos, FALSE, status);
+            if (U_FAILURE(status)) {
+                return FALSE;
+            }
+            if (fMatch) {
+                return TRUE;
+            }
             if  (findProgressInterrupt(startPos, status))
                 return FALSE;
         }
@@ -2798,6 +2814,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
         op      = (int32_t)pat[fp->fPatIdx];
         opType  = URX_TYPE(op);
         opValue = URX_VAL(op);
+        REGEX_OPCODE_COUNT(opType);
 #ifdef REGEX_RUN_DEBUG
         if (fTraceDebug) {
             UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
@@ -3152,8 +3169,8 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
                 UChar32 c = UTEXT_NEXT32(fInputText);
                 if (isLineTerminator(c)) {
-                    if (c == 0x0d && utext_current32(fInputText) == 0x0a) {
-                        utext_next32(fInputText);
+                    if (c == 0x0d && UTEXT_CURRENT32(fInputText) == 0x0a) {
+                        UTEXT_NEXT32(fInputText);
                     }
                     fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
                 } else {
@@ -3698,17 +3715,17 @@ GC_Done:
 
                 UBool success = TRUE;
                 for (;;) {
-                    if (utext_getNativeIndex(fAltInputText) >= groupEndIdx) {
+                    if (UTEXT_GETNATIVEINDEX(fAltInputText) >= groupEndIdx) {
                         success = TRUE;
                         break;
                     }
-                    if (utext_getNativeIndex(fInputText) >= fActiveLimit) {
+                    if (UTEXT_GETNATIVEINDEX(fInputText) >= fActiveLimit) {
                         success = FALSE;
                         fHitEnd = TRUE;
                         break;
                     }
-                    UChar32 captureGroupChar = utext_next32(fAltInputText);
-                    UChar32 inputChar = utext_next32(fInputText);
+                    UChar32 captureGroupChar = UTEXT_NEXT32(fAltInputText);
+                    UChar32 inputChar = UTEXT_NEXT32(fInputText);
                     if (inputChar != captureGroupChar) {
                         success = FALSE;
                         break;
@@ -3736,8 +3753,8 @@ GC_Done:
                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);   // FAIL, no match.
                     break;
                 }
-                utext_setNativeIndex(fAltInputText, groupStartIdx);
-                utext_setNativeIndex(fInputText, fp->fInputIdx);
+                UTEXT_SETNATIVEINDEX(fAltInputText, groupStartIdx);
+                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
                 CaseFoldingUTextIterator captureGroupItr(*fAltInputText);
                 CaseFoldingUTextIterator inputItr(*fInputText);
 
@@ -3747,11 +3764,11 @@ GC_Done:
 
                 UBool success = TRUE;
                 for (;;) {
-                    if (!captureGroupItr.inExpansion() && utext_getNativeIndex(fAltInputText) >= groupEndIdx) {
+                    if (!captureGroupItr.inExpansion() && UTEXT_GETNATIVEINDEX(fAltInputText) >= groupEndIdx) {
                         success = TRUE;
                         break;
                     }
-                    if (!inputItr.inExpansion() && utext_getNativeIndex(fInputText) >= fActiveLimit) {
+                    if (!inputItr.inExpansion() && UTEXT_GETNATIVEINDEX(fInputText) >= fActiveLimit) {
                         success = FALSE;
                         fHitEnd = TRUE;
                         break;
@@ -3852,7 +3869,9 @@ GC_Done:
                 UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
 
                 UChar32 c = UTEXT_NEXT32(fInputText);
-                if (u_foldCase(c, U_FOLD_CASE_DEFAULT) == opValue) {
+                // Case folding is idempotent, so input that is already equal to the
+                // (folded) pattern char matches without the folding lookup.
+                if (c == opValue || u_foldCase(c, U_FOLD_CASE_DEFAULT) == opValue) {
                     fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
                     break;
                 }
@@ -4376,6 +4395,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
         op      = (int32_t)pat[fp->fPatIdx];
         opType  = URX_TYPE(op);
         opValue = URX_VAL(op);
+        REGEX_OPCODE_COUNT(opType);
 #ifdef REGEX_RUN_DEBUG
         if (fTraceDebug) {
             UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
@@ -5379,7 +5399,9 @@ GC_Done:
             if (fp->fInputIdx < fActiveLimit) {
                 UChar32 c;
                 U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
-                if (u_foldCase(c, U_FOLD_CASE_DEFAULT) == opValue) {
+                // Case folding is idempotent, so input that is already equal to the
+                // (folded) pattern char matches without the folding lookup.
+                if (c == opValue || u_foldCase(c, U_FOLD_CASE_DEFAULT) == opValue) {
                     break;
                 }
             } else {
@@ -25,10 +25,18 @@
 #include "uvectr64.h"
 #include "regexcmp.h"
 #include "regeximp.h"
+#include "unicode/uniset.h"
+#include "unicode/utf16.h"
 #include "regexst.h"
+#include "umutex.h"
 
 U_NAMESPACE_BEGIN
 
+// Protects the per-pattern pools of idle matchers (fMatcherPool).
+// Held only for the few pointer operations in acquireMatcher() and
+// releaseMatcher(); one global mutex suffices.
+static UMutex gMatcherPoolMutex;
+
 //--------------------------------------------------------------------------
 //
 //    RegexPattern    Default Constructor
@@ -95,6 +103,7 @@ RegexPattern &RegexPattern::operator = (const RegexPattern &other) {
     fFlags            = other.fFlags;
     fLiteralText      = other.fLiteralText;
     fMinMatchLen      = other.fMinMatchLen;
+    fMaxMatchLen      = other.fMaxMatchLen;
     fFrameSize        = other.fFrameSize;
     fDataSize         = other.fDataSize;
     fStaticSets       = other.fStaticSets;
@@ -170,6 +179,7 @@ void RegexPattern::init() {
     fSets8            = NULL;
     fDeferredStatus   = U_ZERO_ERROR;
     fMinMatchLen      = 0;
+    fMaxMatchLen      = INT32_MAX;     // Conservative (unbounded) until computed by compile.
     fFrameSize        = 0;
     fDataSize         = 0;
     fGroupMap         = NULL;
@@ -183,6 +193,9 @@ void RegexPattern::init() {
     fInitialChars8    = NULL;
     fNeedsAltInput    = FALSE;
     fNamedCaptureMap  = NULL;
+    for (int32_t i=0; i<UPRV_LENGTHOF(fMatcherPool); i++) {
+        fMatcherPool[i] = NULL;
+    }
 
     fPattern          = NULL; // will be set later
     fPatternString    = NULL; // may be set later
@@ -248,6 +261,12 @@ void RegexPattern::zap() {
     }
     uhash_close(fNamedCaptureMap);
     fNamedCaptureMap = NULL;
+    // Pooled matchers were created by matcher(), so they do not own this
+    // pattern; deleting them here cannot recurse back into zap().
+    for (int32_t j=0; j<UPRV_LENGTHOF(fMatcherPool); j++) {
+        delete fMatcherPool[j];
+        fMatcherPool[j] = NULL;
+    }
 }
 
 
@@ -501,6 +520,134 @@ RegexMatcher *RegexPattern::matcher(UErrorCode &status)  const {
 }
 
 
+//---------------------------------------------------------------------
+//
+//   acquireMatcher & releaseMatcher
+//
+//       A small per-pattern pool of idle matchers. A matcher taken from
+//       the pool keeps the input UText structs, the backtrack stack and
+//       the per-matcher data block from its previous use, so in steady
+//       state acquire + reset(input) + release allocates nothing.
+//
+//---------------------------------------------------------------------
+RegexMatcher *RegexPattern::acquireMatcher(UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    RegexMatcher *retMatcher = NULL;
+    umtx_lock(&gMatcherPoolMutex);
+    for (int32_t i=0; i<UPRV_LENGTHOF(fMatcherPool); i++) {
+        if (fMatcherPool[i] != NULL) {
+            retMatcher = fMatcherPool[i];
+            fMatcherPool[i] = NULL;
+            break;
+        }
+    }
+    umtx_unlock(&gMatcherPoolMutex);
+    if (retMatcher == NULL) {
+        retMatcher = matcher(status);
+    }
+    return retMatcher;
+}
+
+
+void RegexPattern::releaseMatcher(RegexMatcher *adoptedMatcher) const {
+    if (adoptedMatcher == NULL) {
+        return;
+    }
+    // Drop any reference to the caller's input before parking the matcher.
+    // Resetting onto the shared empty UText reuses the matcher's existing
+    // input UText structs; no allocation takes place.
+    adoptedMatcher->reset(RegexStaticSets::gStaticSets->fEmptyText);
+    umtx_lock(&gMatcherPoolMutex);
+    for (int32_t i=0; i<UPRV_LENGTHOF(fMatcherPool); i++) {
+        if (fMatcherPool[i] == NULL) {
+            fMatcherPool[i] = adoptedMatcher;
+            adoptedMatcher = NULL;
+            break;
+        }
+    }
+    umtx_unlock(&gMatcherPoolMutex);
+    delete adoptedMatcher;   // NULL if it was parked in the pool.
+}
+
+
+//---------------------------------------------------------------------
+//
+//   screenCandidates
+//
+//       Single-pass screening of many patterns against one text, using
+//       the same start-of-match information that find() uses to skip
+//       ahead: the set of code points a match can start with, and the
+//       minimum match length. A pattern is screened out only when that
+//       information proves no match is possible anywhere in the text.
+//
+//---------------------------------------------------------------------
+void RegexPattern::screenCandidates(const RegexPattern * const patterns[],
+                                    int32_t    patternCount,
+                                    UText     *text,
+                                    UBool      couldMatch[],
+                                    UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (patternCount < 0 || text == NULL ||
+            (patternCount > 0 && (patterns == NULL || couldMatch == NULL))) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+
+    // One pass over the text: collect the set of code points that occur,
+    // and the text's length in UTF-16 code units for minimum length checks.
+    UnicodeSet textChars;
+    int64_t length16 = 0;
+    UChar32 c;
+    for (c = utext_next32From(text, 0); c != U_SENTINEL; c = UTEXT_NEXT32(text)) {
+        textChars.add(c);
+        length16 += U16_LENGTH(c);
+    }
+
+    for (int32_t i=0; i<patternCount; i++) {
+        const RegexPattern *pat = patterns[i];
+        couldMatch[i] = TRUE;
+        if (pat == NULL || U_FAILURE(pat->fDeferredStatus)) {
+            continue;    // Leave TRUE; running a matcher will report the problem.
+        }
+        if (pat->fMinMatchLen > length16) {
+            couldMatch[i] = FALSE;
+            continue;
+        }
+        switch (pat->fStartType) {
+        case START_CHAR:
+            couldMatch[i] = textChars.contains(pat->fInitialChar);
+            break;
+        case START_STRING:
+            {
+                // Every code point of the initial literal string must occur
+                // somewhere in the text, though not necessarily adjacently.
+                int32_t idx   = pat->fInitialStringIdx;
+                int32_t limit = idx + pat->fInitialStringLen;
+                while (idx < limit) {
+                    UChar32 sc = pat->fLiteralText.char32At(idx);
+                    if (!textChars.contains(sc)) {
+                        couldMatch[i] = FALSE;
+                        break;
+                    }
+                    idx += U16_LENGTH(sc);
+                }
+            }
+            break;
+        case START_SET:
+            couldMatch[i] = textChars.containsSome(*pat->fInitialChars);
+            break;
+        default:
+            // START_NO_INFO, START_START, START_LINE: no usable screen.
+            break;
+        }
+    }
+}
+
+
 
 //---------------------------------------------------------------------
 //
@@ -857,6 +1004,354 @@ void RegexPattern::dumpPattern() const {
 }
 
 
+//
+//   requiresBacktracking()
+//        Scan the compiled p-code for constructs that only the backtracking
+//        engine can execute. Operand words of multi-word ops are skipped
+//        explicitly; they are plain integers whose bit patterns could
+//        otherwise be misread as opcodes.
+//
+UBool RegexPattern::requiresBacktracking() const {
+    int32_t end = fCompiledPat->size() - 1;
+    for (int32_t loc = 1; loc <= end; loc++) {
+        int32_t op = (int32_t)fCompiledPat->elementAti(loc);
+        switch (URX_TYPE(op)) {
+        case URX_STRING:
+        case URX_STRING_I:
+            loc++;      // skip the URX_STRING_LEN operand word.
+            break;
+        case URX_CTR_INIT:
+        case URX_CTR_INIT_NG:
+            loc += 3;   // skip the loop end location and min/max counts.
+            break;
+        case URX_BACKREF:
+        case URX_BACKREF_I:
+        case URX_LA_START:
+        case URX_LB_START:
+            return TRUE;
+        default:
+            break;
+        }
+    }
+    return FALSE;
+}
+
+
+//
+//   maxMatchLength()
+//
+int32_t RegexPattern::maxMatchLength() const {
+    return fMaxMatchLen;
+}
+
+
+//
+//   flatten() / unflatten()
+//
+//        A flattened pattern is a byte image of the compiled state, in the
+//        native byte order, from which a pattern can be recreated without
+//        reparsing. As with precompiled break iterator rules, the image is
+//        tied to the internal format of the ICU version that wrote it; a
+//        magic number and version word guard against anything else.
+//
+//        Layout: a fixed header of int32 words, then the compiled p-code
+//        and group map as int32 arrays, then UChar string data (the literal
+//        text, the original pattern, and the sets as UnicodeSet patterns,
+//        which round-trip any strings added by case closure). UChar runs
+//        are padded to a multiple of two code units so that every int32
+//        in the image stays 32-bit aligned.
+//
+
+static const int32_t REGEX_FLATTEN_MAGIC   = 0x52657850;     // "RexP"
+static const int32_t REGEX_FLATTEN_VERSION = 1;
+static const int32_t REGEX_FLATTEN_HEADER_WORDS = 20;
+
+static int32_t flattenedUCharsSize(int32_t numUChars) {
+    return (numUChars + (numUChars & 1)) * 2;
+}
+
+static void flattenInt32(uint8_t *&p, int32_t val) {
+    *(int32_t *)p = val;
+    p += 4;
+}
+
+static void flattenUChars(uint8_t *&p, const UnicodeString &s) {
+    int32_t len = s.length();
+    s.extract(0, len, (UChar *)p);
+    if (len & 1) {
+        ((UChar *)p)[len] = 0;
+    }
+    p += flattenedUCharsSize(len);
+}
+
+static int32_t unflattenInt32(const uint8_t *&p, const uint8_t *limit, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (limit - p < 4) {
+        status = U_INVALID_FORMAT_ERROR;
+        return 0;
+    }
+    int32_t val = *(const int32_t *)p;
+    p += 4;
+    return val;
+}
+
+static void unflattenUChars(const uint8_t *&p, const uint8_t *limit,
+                            int32_t len, UnicodeString &dest, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (len < 0 || limit - p < flattenedUCharsSize(len)) {
+        status = U_INVALID_FORMAT_ERROR;
+        return;
+    }
+    dest.setTo((const UChar *)p, len);
+    p += flattenedUCharsSize(len);
+}
+
+
+int32_t RegexPattern::flatten(uint8_t *buffer, int32_t capacity, UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (capacity < 0 || (buffer == NULL && capacity != 0) ||
+            (buffer != NULL && ((size_t)buffer & 3) != 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if (U_FAILURE(fDeferredStatus)) {
+        status = fDeferredStatus;
+        return 0;
+    }
+
+    UnicodeString patString = pattern();
+    int32_t numSets = fSets->size();
+    int32_t numNamedCaptures = uhash_count(fNamedCaptureMap);
+
+    //   Patterns for the sets; built once, used for both sizing and writing.
+    LocalArray<UnicodeString> setPats(new UnicodeString[numSets]);
+    if (setPats.getAlias() == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    int32_t i;
+    for (i=1; i<numSets; i++) {
+        ((const UnicodeSet *)fSets->elementAt(i))->toPattern(setPats[i], TRUE);
+    }
+    UnicodeString initialCharsPat;
+    fInitialChars->toPattern(initialCharsPat, TRUE);
+
+    int32_t needed = REGEX_FLATTEN_HEADER_WORDS * 4;
+    needed += fCompiledPat->size() * 4;
+    needed += fGroupMap->size() * 4;
+    needed += flattenedUCharsSize(fLiteralText.length());
+    needed += flattenedUCharsSize(patString.length());
+    needed += flattenedUCharsSize(initialCharsPat.length());
+    for (i=1; i<numSets; i++) {
+        needed += 4 + flattenedUCharsSize(setPats[i].length());
+    }
+    int32_t hashPos = UHASH_FIRST;
+    while (const UHashElement *hashEl = uhash_nextElement(fNamedCaptureMap, &hashPos)) {
+        const UnicodeString *name = (const UnicodeString *)hashEl->key.pointer;
+        needed += 8 + flattenedUCharsSize(name->length());
+    }
+
+    if (needed > capacity) {
+        status = U_BUFFER_OVERFLOW_ERROR;
+        return needed;
+    }
+
+    uint8_t *p = buffer;
+    flattenInt32(p, REGEX_FLATTEN_MAGIC);
+    flattenInt32(p, REGEX_FLATTEN_VERSION);
+    flattenInt32(p, needed);
+    flattenInt32(p, (int32_t)fFlags);
+    flattenInt32(p, fMinMatchLen);
+    flattenInt32(p, fMaxMatchLen);
+    flattenInt32(p, fFrameSize);
+    flattenInt32(p, fDataSize);
+    flattenInt32(p, fStartType);
+    flattenInt32(p, fInitialStringIdx);
+    flattenInt32(p, fInitialStringLen);
+    flattenInt32(p, (int32_t)fInitialChar);
+    flattenInt32(p, fNeedsAltInput);
+    flattenInt32(p, fCompiledPat->size());
+    flattenInt32(p, fGroupMap->size());
+    flattenInt32(p, fLiteralText.length());
+    flattenInt32(p, patString.length());
+    flattenInt32(p, initialCharsPat.length());
+    flattenInt32(p, numSets);
+    flattenInt32(p, numNamedCaptures);
+
+    for (i=0; i<fCompiledPat->size(); i++) {
+        flattenInt32(p, (int32_t)fCompiledPat->elementAti(i));
+    }
+    for (i=0; i<fGroupMap->size(); i++) {
+        flattenInt32(p, fGroupMap->elementAti(i));
+    }
+    flattenUChars(p, fLiteralText);
+    flattenUChars(p, patString);
+    flattenUChars(p, initialCharsPat);
+    for (i=1; i<numSets; i++) {
+        flattenInt32(p, setPats[i].length());
+        flattenUChars(p, setPats[i]);
+    }
+    hashPos = UHASH_FIRST;
+    while (const UHashElement *hashEl = uhash_nextElement(fNamedCaptureMap, &hashPos)) {
+        const UnicodeString *name = (const UnicodeString *)hashEl->key.pointer;
+        flattenInt32(p, hashEl->value.integer);
+        flattenInt32(p, name->length());
+        flattenUChars(p, *name);
+    }
+    U_ASSERT(p == buffer + needed);
+    return needed;
+}
+
+
+RegexPattern *RegexPattern::unflatten(const uint8_t *data, int32_t length, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    if (data == NULL || ((size_t)data & 3) != 0 ||
+            length < REGEX_FLATTEN_HEADER_WORDS * 4) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+
+    const uint8_t *p = data;
+    const uint8_t *limit = data + length;
+    int32_t magic       = unflattenInt32(p, limit, status);
+    int32_t version     = unflattenInt32(p, limit, status);
+    int32_t totalLength = unflattenInt32(p, limit, status);
+    if (U_SUCCESS(status) &&
+            (magic != REGEX_FLATTEN_MAGIC || version != REGEX_FLATTEN_VERSION ||
+             totalLength < REGEX_FLATTEN_HEADER_WORDS * 4 || totalLength > length)) {
+        status = U_INVALID_FORMAT_ERROR;
+    }
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    limit = data + totalLength;
+
+    RegexStaticSets::initGlobals(&status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+
+    LocalPointer<RegexPattern> pat(new RegexPattern, status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    if (U_FAILURE(pat->fDeferredStatus)) {
+        status = pat->fDeferredStatus;
+        return NULL;
+    }
+
+    pat->fFlags            = (uint32_t)unflattenInt32(p, limit, status);
+    pat->fMinMatchLen      = unflattenInt32(p, limit, status);
+    pat->fMaxMatchLen      = unflattenInt32(p, limit, status);
+    pat->fFrameSize        = unflattenInt32(p, limit, status);
+    pat->fDataSize         = unflattenInt32(p, limit, status);
+    pat->fStartType        = unflattenInt32(p, limit, status);
+    pat->fInitialStringIdx = unflattenInt32(p, limit, status);
+    pat->fInitialStringLen = unflattenInt32(p, limit, status);
+    pat->fInitialChar      = (UChar32)unflattenInt32(p, limit, status);
+    pat->fNeedsAltInput    = (UBool)unflattenInt32(p, limit, status);
+    int32_t compiledPatSize    = unflattenInt32(p, limit, status);
+    int32_t groupMapSize       = unflattenInt32(p, limit, status);
+    int32_t literalTextLen     = unflattenInt32(p, limit, status);
+    int32_t patStringLen       = unflattenInt32(p, limit, status);
+    int32_t initialCharsPatLen = unflattenInt32(p, limit, status);
+    int32_t numSets            = unflattenInt32(p, limit, status);
+    int32_t numNamedCaptures   = unflattenInt32(p, limit, status);
+    if (U_SUCCESS(status) &&
+            (compiledPatSize < 0 || groupMapSize < 0 || numSets < 1 || numNamedCaptures < 0)) {
+        status = U_INVALID_FORMAT_ERROR;
+    }
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+
+    pat->fStaticSets  = RegexStaticSets::gStaticSets->fPropSets;
+    pat->fStaticSets8 = RegexStaticSets::gStaticSets->fPropSets8;
+
+    int32_t i;
+    for (i=0; i<compiledPatSize && U_SUCCESS(status); i++) {
+        pat->fCompiledPat->addElement((int64_t)unflattenInt32(p, limit, status), status);
+    }
+    for (i=0; i<groupMapSize && U_SUCCESS(status); i++) {
+        pat->fGroupMap->addElement(unflattenInt32(p, limit, status), status);
+    }
+    unflattenUChars(p, limit, literalTextLen, pat->fLiteralText, status);
+
+    UnicodeString patString;
+    unflattenUChars(p, limit, patStringLen, patString, status);
+    if (U_SUCCESS(status)) {
+        pat->fPatternString = new UnicodeString(patString);
+        if (pat->fPatternString == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+        } else {
+            pat->fPattern = utext_openConstUnicodeString(NULL, pat->fPatternString, &status);
+        }
+    }
+
+    UnicodeString initialCharsPat;
+    unflattenUChars(p, limit, initialCharsPatLen, initialCharsPat, status);
+    if (U_SUCCESS(status)) {
+        pat->fInitialChars->applyPattern(initialCharsPat, status);
+        pat->fInitialChars->freeze();
+        pat->fInitialChars8->init(pat->fInitialChars);
+    }
+
+    //   Note:  init() already added the reserved element zero to fSets.
+    pat->fSets8 = new Regex8BitSet[numSets];
+    if (pat->fSets8 == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    }
+    for (i=1; i<numSets && U_SUCCESS(status); i++) {
+        int32_t setPatLen = unflattenInt32(p, limit, status);
+        UnicodeString setPat;
+        unflattenUChars(p, limit, setPatLen, setPat, status);
+        if (U_FAILURE(status)) {
+            break;
+        }
+        UnicodeSet *set = new UnicodeSet(setPat, status);
+        if (set == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            break;
+        }
+        set->freeze();      // as the compiler leaves them; see RegexCompile::compile().
+        pat->fSets->addElement(set, status);
+        if (U_FAILURE(status)) {
+            delete set;
+            break;
+        }
+        pat->fSets8[i].init(set);
+    }
+
+    for (i=0; i<numNamedCaptures && U_SUCCESS(status); i++) {
+        int32_t number  = unflattenInt32(p, limit, status);
+        int32_t nameLen = unflattenInt32(p, limit, status);
+        UnicodeString name;
+        unflattenUChars(p, limit, nameLen, name, status);
+        if (U_FAILURE(status)) {
+            break;
+        }
+        UnicodeString *key = new UnicodeString(name);
+        if (key == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            break;
+        }
+        uhash_puti(pat->fNamedCaptureMap, key, number, &status);
+    }
+
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    return pat.orphan();
+}
+
 
 UOBJECT_DEFINE_RTTI_IMPLEMENTATION(RegexPattern)
 
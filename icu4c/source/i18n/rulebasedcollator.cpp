@@ -30,12 +30,14 @@
 #include "unicode/unistr.h"
 #include "unicode/usetiter.h"
 #include "unicode/utf8.h"
+#include "unicode/utrace.h"
 #include "unicode/uversion.h"
 #include "bocsu.h"
 #include "charstr.h"
 #include "cmemory.h"
 #include "collation.h"
 #include "collationcompare.h"
+#include "collationcomparecontext.h"
 #include "collationdata.h"
 #include "collationdatareader.h"
 #include "collationfastlatin.h"
@@ -160,22 +162,25 @@ RuleBasedCollator::RuleBasedCollator(const uint8_t *bin, int32_t length,
           explicitlySetAttributes(0),
           actualLocaleIsSameAsValid(FALSE) {
     if(U_FAILURE(errorCode)) { return; }
-    if(bin == NULL || length == 0 || base == NULL) {
+    if(bin == NULL || length == 0) {
         errorCode = U_ILLEGAL_ARGUMENT_ERROR;
         return;
     }
     const CollationTailoring *root = CollationRoot::getRoot(errorCode);
     if(U_FAILURE(errorCode)) { return; }
-    if(base->tailoring != root) {
+    // base == NULL is a shorthand for the root collator,
+    // so that a process reviving a shared, memory-mapped image
+    // need not open a base collator first.
+    if(base != NULL && base->tailoring != root) {
         errorCode = U_UNSUPPORTED_ERROR;
         return;
     }
-    LocalPointer<CollationTailoring> t(new CollationTailoring(base->tailoring->settings));
+    LocalPointer<CollationTailoring> t(new CollationTailoring(root->settings));
     if(t.isNull() || t->isBogus()) {
         errorCode = U_MEMORY_ALLOCATION_ERROR;
         return;
     }
-    CollationDataReader::read(base->tailoring, bin, length, *t, errorCode);
+    CollationDataReader::read(root, bin, length, *t, errorCode);
     if(U_FAILURE(errorCode)) { return; }
     t->actualLocale.setToBogus();
     adoptTailoring(t.orphan(), errorCode);
@@ -701,7 +706,7 @@ RuleBasedCollator::compare(const UnicodeString &left, const UnicodeString &right
                            UErrorCode &errorCode) const {
     if(U_FAILURE(errorCode)) { return UCOL_EQUAL; }
     return doCompare(left.getBuffer(), left.length(),
-                     right.getBuffer(), right.length(), errorCode);
+                     right.getBuffer(), right.length(), NULL, errorCode);
 }
 
 UCollationResult
@@ -717,7 +722,7 @@ RuleBasedCollator::compare(const UnicodeString &left, const UnicodeString &right
     if(leftLength > length) { leftLength = length; }
     if(rightLength > length) { rightLength = length; }
     return doCompare(left.getBuffer(), leftLength,
-                     right.getBuffer(), rightLength, errorCode);
+                     right.getBuffer(), rightLength, NULL, errorCode);
 }
 
 UCollationResult
@@ -736,7 +741,7 @@ RuleBasedCollator::compare(const UChar *left, int32_t leftLength,
     } else {
         if(rightLength >= 0) { leftLength = u_strlen(left); }
     }
-    return doCompare(left, leftLength, right, rightLength, errorCode);
+    return doCompare(left, leftLength, right, rightLength, NULL, errorCode);
 }
 
 UCollationResult
@@ -964,11 +969,51 @@ UCollationResult compareNFDIter(const Normalizer2Impl &nfcImpl,
 
 }  // namespace
 
+namespace {
+
+/**
+ * Returns the length of the identical prefix of the two strings,
+ * comparing one 64-bit word at a time before falling back to
+ * single units for the last partial word and the mismatch position.
+ */
+int32_t equalPrefixLength16(const UChar *left, const UChar *right, int32_t length) {
+    int32_t i = 0;
+    while(i + 4 <= length) {
+        uint64_t l, r;
+        uprv_memcpy(&l, left + i, sizeof(l));
+        uprv_memcpy(&r, right + i, sizeof(r));
+        if(l != r) { break; }
+        i += 4;
+    }
+    while(i < length && left[i] == right[i]) { ++i; }
+    return i;
+}
+
+/**
+ * Same as equalPrefixLength16() but for UTF-8 bytes.
+ */
+int32_t equalPrefixLength8(const uint8_t *left, const uint8_t *right, int32_t length) {
+    int32_t i = 0;
+    while(i + 8 <= length) {
+        uint64_t l, r;
+        uprv_memcpy(&l, left + i, sizeof(l));
+        uprv_memcpy(&r, right + i, sizeof(r));
+        if(l != r) { break; }
+        i += 8;
+    }
+    while(i < length && left[i] == right[i]) { ++i; }
+    return i;
+}
+
+}  // namespace
+
 UCollationResult
 RuleBasedCollator::doCompare(const UChar *left, int32_t leftLength,
                              const UChar *right, int32_t rightLength,
+                             CollationCompareContext *context,
                              UErrorCode &errorCode) const {
     // U_FAILURE(errorCode) checked by caller.
+    utrace_addCounter(UTRACE_COUNTER_COLLATION_COMPARE, 1);
     if(left == right && leftLength == rightLength) {
         return UCOL_EQUAL;
     }
@@ -988,15 +1033,10 @@ RuleBasedCollator::doCompare(const UChar *left, int32_t leftLength,
     } else {
         leftLimit = left + leftLength;
         rightLimit = right + rightLength;
-        for(;;) {
-            if(equalPrefixLength == leftLength) {
-                if(equalPrefixLength == rightLength) { return UCOL_EQUAL; }
-                break;
-            } else if(equalPrefixLength == rightLength ||
-                      left[equalPrefixLength] != right[equalPrefixLength]) {
-                break;
-            }
-            ++equalPrefixLength;
+        int32_t minLength = leftLength <= rightLength ? leftLength : rightLength;
+        equalPrefixLength = equalPrefixLength16(left, right, minLength);
+        if(equalPrefixLength == leftLength && equalPrefixLength == rightLength) {
+            return UCOL_EQUAL;
         }
     }
 
@@ -1047,17 +1087,31 @@ RuleBasedCollator::doCompare(const UChar *left, int32_t leftLength,
 
     if(result == CollationFastLatin::BAIL_OUT_RESULT) {
         if(settings->dontCheckFCD()) {
-            UTF16CollationIterator leftIter(data, numeric,
-                                            left, left + equalPrefixLength, leftLimit);
-            UTF16CollationIterator rightIter(data, numeric,
-                                            right, right + equalPrefixLength, rightLimit);
-            result = CollationCompare::compareUpToQuaternary(leftIter, rightIter, *settings, errorCode);
-        } else {
-            FCDUTF16CollationIterator leftIter(data, numeric,
-                                              left, left + equalPrefixLength, leftLimit);
-            FCDUTF16CollationIterator rightIter(data, numeric,
+            if(context != NULL) {
+                context->leftIter.setText(left, left + equalPrefixLength, leftLimit);
+                context->rightIter.setText(right, right + equalPrefixLength, rightLimit);
+                result = CollationCompare::compareUpToQuaternary(
+                        context->leftIter, context->rightIter, *settings, errorCode);
+            } else {
+                UTF16CollationIterator leftIter(data, numeric,
+                                                left, left + equalPrefixLength, leftLimit);
+                UTF16CollationIterator rightIter(data, numeric,
                                                 right, right + equalPrefixLength, rightLimit);
-            result = CollationCompare::compareUpToQuaternary(leftIter, rightIter, *settings, errorCode);
+                result = CollationCompare::compareUpToQuaternary(leftIter, rightIter, *settings, errorCode);
+            }
+        } else {
+            if(context != NULL) {
+                context->leftFCDIter.setText(left, left + equalPrefixLength, leftLimit);
+                context->rightFCDIter.setText(right, right + equalPrefixLength, rightLimit);
+                result = CollationCompare::compareUpToQuaternary(
+                        context->leftFCDIter, context->rightFCDIter, *settings, errorCode);
+            } else {
+                FCDUTF16CollationIterator leftIter(data, numeric,
+                                                  left, left + equalPrefixLength, leftLimit);
+                FCDUTF16CollationIterator rightIter(data, numeric,
+                                                    right, right + equalPrefixLength, rightLimit);
+                result = CollationCompare::compareUpToQuaternary(leftIter, rightIter, *settings, errorCode);
+            }
         }
     }
     if(result != UCOL_EQUAL || settings->getStrength() < UCOL_IDENTICAL || U_FAILURE(errorCode)) {
@@ -1088,6 +1142,7 @@ RuleBasedCollator::doCompare(const uint8_t *left, int32_t leftLength,
                              const uint8_t *right, int32_t rightLength,
                              UErrorCode &errorCode) const {
     // U_FAILURE(errorCode) checked by caller.
+    utrace_addCounter(UTRACE_COUNTER_COLLATION_COMPARE, 1);
     if(left == right && leftLength == rightLength) {
         return UCOL_EQUAL;
     }
@@ -1101,15 +1156,10 @@ RuleBasedCollator::doCompare(const uint8_t *left, int32_t leftLength,
             ++equalPrefixLength;
         }
     } else {
-        for(;;) {
-            if(equalPrefixLength == leftLength) {
-                if(equalPrefixLength == rightLength) { return UCOL_EQUAL; }
-                break;
-            } else if(equalPrefixLength == rightLength ||
-                      left[equalPrefixLength] != right[equalPrefixLength]) {
-                break;
-            }
-            ++equalPrefixLength;
+        int32_t minLength = leftLength <= rightLength ? leftLength : rightLength;
+        equalPrefixLength = equalPrefixLength8(left, right, minLength);
+        if(equalPrefixLength == leftLength && equalPrefixLength == rightLength) {
+            return UCOL_EQUAL;
         }
     }
     // Back up to the start of a partially-equal code point.
@@ -1328,6 +1378,148 @@ RuleBasedCollator::getSortKey(const UChar *s, int32_t length,
     return U_SUCCESS(errorCode) ? sink.NumberOfBytesAppended() : 0;
 }
 
+namespace {
+
+/**
+ * internalGetSortKeyLevels() calls CollationKeys::writeSortKeyUpToQuaternary()
+ * with an instance of this callback class,
+ * which stops the key writer before the first level above maxLevel.
+ */
+class StopLevelCallback : public CollationKeys::LevelCallback {
+public:
+    StopLevelCallback(Collation::Level max) : maxLevel(max) {}
+    virtual ~StopLevelCallback() {}
+    virtual UBool needToWrite(Collation::Level l) { return l <= maxLevel; }
+
+private:
+    Collation::Level maxLevel;
+};
+
+}  // namespace
+
+int32_t
+RuleBasedCollator::internalGetSortKeyLevels(const UChar *s, int32_t length,
+                                            int32_t minLevel, int32_t maxLevel,
+                                            uint8_t *dest, int32_t capacity,
+                                            UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return 0; }
+    if((s == NULL && length != 0) || length < 0 ||
+            minLevel < Collation::PRIMARY_LEVEL || maxLevel < minLevel ||
+            Collation::QUATERNARY_LEVEL < maxLevel ||
+            capacity < 0 || (dest == NULL && capacity > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    uint8_t noDest[1] = { 0 };
+    if(dest == NULL) {
+        // Pure preflighting.
+        dest = noDest;
+        capacity = 0;
+    }
+    FixedSortKeyByteSink sink(reinterpret_cast<char *>(dest), capacity);
+    StopLevelCallback callback((Collation::Level)maxLevel);
+    UBool numeric = settings->isNumeric();
+    const UChar *limit = s + length;
+    if(settings->dontCheckFCD()) {
+        UTF16CollationIterator iter(data, numeric, s, s, limit);
+        CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
+                                                  sink, (Collation::Level)minLevel,
+                                                  callback, TRUE, errorCode);
+    } else {
+        FCDUTF16CollationIterator iter(data, numeric, s, s, limit);
+        CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
+                                                  sink, (Collation::Level)minLevel,
+                                                  callback, TRUE, errorCode);
+    }
+    return U_SUCCESS(errorCode) ? sink.NumberOfBytesAppended() : 0;
+}
+
+CollationCompareContext *
+RuleBasedCollator::internalCreateCompareContext(UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return NULL; }
+    CollationCompareContext *context =
+            new CollationCompareContext(data, settings->isNumeric());
+    if(context == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+    }
+    return context;
+}
+
+UCollationResult
+RuleBasedCollator::internalCompare(const UChar *left, int32_t leftLength,
+                                   const UChar *right, int32_t rightLength,
+                                   CollationCompareContext &context,
+                                   UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return UCOL_EQUAL; }
+    if((left == NULL && leftLength != 0) || (right == NULL && rightLength != 0) ||
+            leftLength < 0 || rightLength < 0) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return UCOL_EQUAL;
+    }
+    if(context.data != data || context.numeric != settings->isNumeric()) {
+        // Stale context: created for another collator or before a settings change.
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return UCOL_EQUAL;
+    }
+    return doCompare(left, leftLength, right, rightLength, &context, errorCode);
+}
+
+int32_t
+RuleBasedCollator::internalGetSortKeys(const UnicodeString *strings, int32_t count,
+                                       uint8_t *dest, int32_t capacity,
+                                       int32_t *offsets, UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return 0; }
+    if(count < 0 || (strings == NULL && count != 0) ||
+            capacity < 0 || (dest == NULL && capacity > 0) || offsets == NULL) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    uint8_t noDest[1] = { 0 };
+    if(dest == NULL) {
+        // Pure preflighting.
+        dest = noDest;
+        capacity = 0;
+    }
+    UBool numeric = settings->isNumeric();
+    UBool checkFCD = !settings->dontCheckFCD();
+    UBool identical = settings->getStrength() == UCOL_IDENTICAL;
+    // Hoist the iterators out of the loop; per string, setText() only resets pointers
+    // and keeps the CEBuffer and any other grown-to-size storage.
+    UTF16CollationIterator utf16Iter(data, numeric, NULL, NULL, NULL);
+    FCDUTF16CollationIterator fcdIter(data, numeric, NULL, NULL, NULL);
+    CollationKeys::LevelCallback callback;
+    int32_t totalLength = 0;
+    for(int32_t i = 0; i < count; ++i) {
+        offsets[i] = totalLength;
+        const UnicodeString &str = strings[i];
+        const UChar *s = str.getBuffer();
+        const UChar *limit = s + str.length();
+        int32_t written = (totalLength <= capacity) ? totalLength : capacity;
+        FixedSortKeyByteSink sink(reinterpret_cast<char *>(dest) + written,
+                                  capacity - written);
+        if(checkFCD) {
+            fcdIter.setText(s, s, limit);
+            CollationKeys::writeSortKeyUpToQuaternary(fcdIter, data->compressibleBytes, *settings,
+                                                      sink, Collation::PRIMARY_LEVEL,
+                                                      callback, TRUE, errorCode);
+        } else {
+            utf16Iter.setText(s, s, limit);
+            CollationKeys::writeSortKeyUpToQuaternary(utf16Iter, data->compressibleBytes, *settings,
+                                                      sink, Collation::PRIMARY_LEVEL,
+                                                      callback, TRUE, errorCode);
+        }
+        if(identical) {
+            writeIdenticalLevel(s, limit, sink, errorCode);
+        }
+        static const char terminator = 0;  // TERMINATOR_BYTE
+        sink.Append(&terminator, 1);
+        if(U_FAILURE(errorCode)) { return 0; }
+        totalLength += sink.NumberOfBytesAppended();
+    }
+    offsets[count] = totalLength;
+    return totalLength;
+}
+
 void
 RuleBasedCollator::writeSortKey(const UChar *s, int32_t length,
                                 SortKeyByteSink &sink, UErrorCode &errorCode) const {
@@ -44,15 +44,26 @@ UOBJECT_DEFINE_RTTI_IMPLEMENTATION(SelectFormat)
 static const UChar SELECT_KEYWORD_OTHER[] = {LOW_O, LOW_T, LOW_H, LOW_E, LOW_R, 0};
 
 SelectFormat::SelectFormat(const UnicodeString& pat,
-                           UErrorCode& status) : msgPattern(status) {
+                           UErrorCode& status) : msgPattern(status),
+                                                 fSelectors(nullptr),
+                                                 fSelectorMsgStarts(nullptr),
+                                                 fSelectorCount(0),
+                                                 fOtherMsgStart(0) {
    applyPattern(pat, status);
 }
 
 SelectFormat::SelectFormat(const SelectFormat& other) : Format(other),
-                                                        msgPattern(other.msgPattern) {
+                                                        msgPattern(other.msgPattern),
+                                                        fSelectors(nullptr),
+                                                        fSelectorMsgStarts(nullptr),
+                                                        fSelectorCount(0),
+                                                        fOtherMsgStart(0) {
+    compileSelectors();
 }
 
 SelectFormat::~SelectFormat() {
+    delete[] fSelectors;
+    delete[] fSelectorMsgStarts;
 }
 
 void
@@ -65,6 +76,62 @@ SelectFormat::applyPattern(const UnicodeString& newPattern, UErrorCode& status)
     if (U_FAILURE(status)) {
         msgPattern.clear();
     }
+    compileSelectors();
+}
+
+void
+SelectFormat::compileSelectors() {
+    delete[] fSelectors;
+    fSelectors = nullptr;
+    delete[] fSelectorMsgStarts;
+    fSelectorMsgStarts = nullptr;
+    fSelectorCount = 0;
+    fOtherMsgStart = 0;
+    int32_t count = msgPattern.countParts();
+    if (count == 0) {
+        return;
+    }
+    // First walk: count the selectors, iterating like findSubMessage().
+    int32_t numSelectors = 0;
+    int32_t partIndex = 0;
+    do {
+        const MessagePattern::Part& part = msgPattern.getPart(partIndex++);
+        if (part.getType() == UMSGPAT_PART_TYPE_ARG_LIMIT) {
+            break;
+        }
+        ++numSelectors;
+        partIndex = msgPattern.getLimitPartIndex(partIndex);
+    } while (++partIndex < count);
+    if (numSelectors == 0) {
+        return;
+    }
+    fSelectors = new UnicodeString[numSelectors];
+    fSelectorMsgStarts = new int32_t[numSelectors];
+    if (fSelectors == nullptr || fSelectorMsgStarts == nullptr) {
+        delete[] fSelectors;
+        fSelectors = nullptr;
+        delete[] fSelectorMsgStarts;
+        fSelectorMsgStarts = nullptr;
+        return;  // fall back to findSubMessage()
+    }
+    // Second walk: record the keywords and their sub-message starts.
+    UnicodeString other(FALSE, SELECT_KEYWORD_OTHER, 5);
+    int32_t i = 0;
+    partIndex = 0;
+    do {
+        const MessagePattern::Part& part = msgPattern.getPart(partIndex++);
+        if (part.getType() == UMSGPAT_PART_TYPE_ARG_LIMIT) {
+            break;
+        }
+        fSelectors[i] = msgPattern.getSubstring(part);
+        fSelectorMsgStarts[i] = partIndex;
+        if (fOtherMsgStart == 0 && fSelectors[i] == other) {
+            fOtherMsgStart = partIndex;
+        }
+        ++i;
+        partIndex = msgPattern.getLimitPartIndex(partIndex);
+    } while (++partIndex < count);
+    fSelectorCount = i;
 }
 
 UnicodeString&
@@ -100,7 +167,18 @@ SelectFormat::format(const UnicodeString& keyword,
         status = U_INVALID_STATE_ERROR;
         return appendTo;
     }
-    int32_t msgStart = findSubMessage(msgPattern, 0, keyword, status);
+    int32_t msgStart;
+    if (fSelectorCount > 0 && U_SUCCESS(status)) {
+        msgStart = fOtherMsgStart;
+        for (int32_t i = 0; i < fSelectorCount; ++i) {
+            if (fSelectors[i] == keyword) {
+                msgStart = fSelectorMsgStarts[i];
+                break;
+            }
+        }
+    } else {
+        msgStart = findSubMessage(msgPattern, 0, keyword, status);
+    }
     if (!MessageImpl::jdkAposMode(msgPattern)) {
         int32_t patternStart = msgPattern.getPart(msgStart).getLimit();
         int32_t msgLimit = msgPattern.getLimitPartIndex(msgStart);
@@ -160,6 +238,7 @@ SelectFormat&
 SelectFormat::operator=(const SelectFormat& other) {
     if (this != &other) {
         msgPattern = other.msgPattern;
+        compileSelectors();
     }
     return *this;
 }
@@ -0,0 +1,33 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+******************************************************************************
+* shareddatetimepatterngenerator.h
+*/
+
+#ifndef __SHARED_DATETIMEPATTERNGENERATOR_H__
+#define __SHARED_DATETIMEPATTERNGENERATOR_H__
+
+#include "unicode/utypes.h"
+#include "sharedobject.h"
+
+U_NAMESPACE_BEGIN
+
+class DateTimePatternGenerator;
+
+class U_I18N_API SharedDateTimePatternGenerator : public SharedObject {
+public:
+    SharedDateTimePatternGenerator(DateTimePatternGenerator *dtpgToAdopt) : ptr(dtpgToAdopt) { }
+    virtual ~SharedDateTimePatternGenerator();
+    const DateTimePatternGenerator *get() const { return ptr; }
+    const DateTimePatternGenerator *operator->() const { return ptr; }
+    const DateTimePatternGenerator &operator*() const { return *ptr; }
+private:
+    DateTimePatternGenerator *ptr;
+    SharedDateTimePatternGenerator(const SharedDateTimePatternGenerator &);
+    SharedDateTimePatternGenerator &operator=(const SharedDateTimePatternGenerator &);
+};
+
+U_NAMESPACE_END
+
+#endif
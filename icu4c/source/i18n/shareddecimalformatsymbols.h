@@ -0,0 +1,40 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+******************************************************************************
+* Copyright (C) 2014, International Business Machines
+* Corporation and others.  All Rights Reserved.
+******************************************************************************
+* shareddecimalformatsymbols.h
+*/
+
+#ifndef __SHARED_DECIMALFORMATSYMBOLS_H__
+#define __SHARED_DECIMALFORMATSYMBOLS_H__
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_FORMATTING
+
+#include "sharedobject.h"
+#include "unicode/dcfmtsym.h"
+
+U_NAMESPACE_BEGIN
+
+
+class U_I18N_API SharedDecimalFormatSymbols : public SharedObject {
+public:
+    SharedDecimalFormatSymbols(const Locale &loc, UErrorCode &status)
+            : dfs(loc, status) { }
+    virtual ~SharedDecimalFormatSymbols();
+    const DecimalFormatSymbols &get() const { return dfs; }
+private:
+    DecimalFormatSymbols dfs;
+    SharedDecimalFormatSymbols(const SharedDecimalFormatSymbols &);
+    SharedDecimalFormatSymbols &operator=(const SharedDecimalFormatSymbols &);
+};
+
+U_NAMESPACE_END
+
+#endif /* !UCONFIG_NO_FORMATTING */
+
+#endif
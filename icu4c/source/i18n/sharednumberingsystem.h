@@ -0,0 +1,35 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+******************************************************************************
+* Copyright (C) 2014, International Business Machines
+* Corporation and others.  All Rights Reserved.
+******************************************************************************
+* sharednumberingsystem.h
+*/
+
+#ifndef __SHARED_NUMBERINGSYSTEM_H__
+#define __SHARED_NUMBERINGSYSTEM_H__
+
+#include "unicode/utypes.h"
+#include "sharedobject.h"
+
+U_NAMESPACE_BEGIN
+
+class NumberingSystem;
+
+class U_I18N_API SharedNumberingSystem : public SharedObject {
+public:
+    SharedNumberingSystem(NumberingSystem *nsToAdopt) : ptr(nsToAdopt) { }
+    virtual ~SharedNumberingSystem();
+    const NumberingSystem *operator->() const { return ptr; }
+    const NumberingSystem &operator*() const { return *ptr; }
+private:
+    NumberingSystem *ptr;
+    SharedNumberingSystem(const SharedNumberingSystem &);
+    SharedNumberingSystem &operator=(const SharedNumberingSystem &);
+};
+
+U_NAMESPACE_END
+
+#endif
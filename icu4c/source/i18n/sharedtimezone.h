@@ -0,0 +1,33 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+******************************************************************************
+* sharedtimezone.h
+*/
+
+#ifndef __SHARED_TIMEZONE_H__
+#define __SHARED_TIMEZONE_H__
+
+#include "unicode/utypes.h"
+#include "sharedobject.h"
+
+U_NAMESPACE_BEGIN
+
+class TimeZone;
+
+class U_I18N_API SharedTimeZone : public SharedObject {
+public:
+    SharedTimeZone(TimeZone *tzToAdopt) : ptr(tzToAdopt) { }
+    virtual ~SharedTimeZone();
+    const TimeZone *get() const { return ptr; }
+    const TimeZone *operator->() const { return ptr; }
+    const TimeZone &operator*() const { return *ptr; }
+private:
+    TimeZone *ptr;
+    SharedTimeZone(const SharedTimeZone &);
+    SharedTimeZone &operator=(const SharedTimeZone &);
+};
+
+U_NAMESPACE_END
+
+#endif
@@ -319,6 +319,7 @@ const NumberFormat *SimpleDateFormat::getNumberFormatByIndex(
 SimpleDateFormat::~SimpleDateFormat()
 {
     delete fSymbols;
+    uprv_free(fCompiledOps);
     if (fSharedNumberFormatters) {
         freeSharedNumberFormatters(fSharedNumberFormatters);
     }
@@ -582,6 +583,7 @@ SimpleDateFormat& SimpleDateFormat::operator=(const SimpleDateFormat& other)
     fPattern = other.fPattern;
     fHasMinute = other.fHasMinute;
     fHasSecond = other.fHasSecond;
+    parsePattern();
 
     // TimeZoneFormat in ICU4C only depends on a locale for now
     if (fLocale != other.fLocale) {
@@ -980,6 +982,25 @@ SimpleDateFormat::_format(Calendar& cal, UnicodeString& appendTo,
     int32_t fieldNum = 0;
     UDisplayContext capitalizationContext = getContext(UDISPCTX_TYPE_CAPITALIZATION, status);
 
+    // Fast path: execute the op list compiled by parsePattern(), which encodes
+    // the same sequence of appends and subFormat() calls as the loop below.
+    if (fCompiledOps != NULL) {
+        const UChar* literals = fCompiledLiterals.getBuffer();
+        for (int32_t i = 0; i < fCompiledOpCount && U_SUCCESS(status); ++i) {
+            const PatternOp& op = fCompiledOps[i];
+            if (op.field == 0) {
+                appendTo.append(literals + op.offset, op.count);
+            } else {
+                subFormat(appendTo, op.field, op.count, capitalizationContext, fieldNum++,
+                          handler, *workCal, status);
+            }
+        }
+        if (calClone != NULL) {
+            delete calClone;
+        }
+        return appendTo;
+    }
+
     // loop through the pattern string character by character
     for (int32_t i = 0; i < fPattern.length() && U_SUCCESS(status); ++i) {
         UChar ch = fPattern[i];
@@ -3883,6 +3904,7 @@ SimpleDateFormat::applyLocalizedPattern(const UnicodeString& pattern,
     translatePattern(pattern, fPattern,
                      fSymbols->fLocalPatternChars,
                      UnicodeString(DateFormatSymbols::getPatternUChars()), status);
+    parsePattern();
 }
 
 //----------------------------------------------------------------------
@@ -4208,14 +4230,58 @@ void SimpleDateFormat::parsePattern() {
     fHasMinute = FALSE;
     fHasSecond = FALSE;
 
-    int len = fPattern.length();
+    // Lower the pattern into a flat list of literal-copy and field ops, so that
+    // _format() does not have to re-interpret quoting on every call. The walk
+    // below mirrors the character loop in _format() exactly.
+    uprv_free(fCompiledOps);
+    fCompiledOps = NULL;
+    fCompiledOpCount = 0;
+    fCompiledLiterals.remove();
+
+    int32_t len = fPattern.length();
+    // Each pattern character starts at most one op, so len ops always suffice.
+    PatternOp* ops = (len > 0) ?
+            static_cast<PatternOp*>(uprv_malloc(len * sizeof(PatternOp))) : NULL;
+
     UBool inQuote = FALSE;
+    UChar prevCh = 0;
+    int32_t count = 0;
+    int32_t opCount = 0;
+    PatternOp* litOp = NULL;  // open literal run, extended until a field starts
     for (int32_t i = 0; i < len; ++i) {
         UChar ch = fPattern[i];
+        if (ch != prevCh && count > 0) {
+            if (ops != NULL) {
+                ops[opCount].field = prevCh;
+                ops[opCount].count = count;
+                ops[opCount].offset = 0;
+                opCount++;
+            }
+            count = 0;
+        }
         if (ch == QUOTE) {
-            inQuote = !inQuote;
+            // Consecutive single quotes are a single quote literal,
+            // either outside of quotes or between quotes
+            if ((i+1) < len && fPattern[i+1] == QUOTE) {
+                if (ops != NULL) {
+                    if (litOp == NULL) {
+                        litOp = &ops[opCount++];
+                        litOp->field = 0;
+                        litOp->count = 0;
+                        litOp->offset = fCompiledLiterals.length();
+                    }
+                    fCompiledLiterals.append((UChar)QUOTE);
+                    litOp->count++;
+                }
+                ++i;
+            } else {
+                inQuote = ! inQuote;
+            }
         }
-        if (!inQuote) {
+        else if (!inQuote && isSyntaxChar(ch)) {
+            prevCh = ch;
+            ++count;
+            litOp = NULL;
             if (ch == 0x6D) {  // 0x6D == 'm'
                 fHasMinute = TRUE;
             }
@@ -4223,6 +4289,31 @@ void SimpleDateFormat::parsePattern() {
                 fHasSecond = TRUE;
             }
         }
+        else {
+            if (ops != NULL) {
+                if (litOp == NULL) {
+                    litOp = &ops[opCount++];
+                    litOp->field = 0;
+                    litOp->count = 0;
+                    litOp->offset = fCompiledLiterals.length();
+                }
+                fCompiledLiterals.append(ch);
+                litOp->count++;
+            }
+        }
+    }
+    if (count > 0 && ops != NULL) {
+        ops[opCount].field = prevCh;
+        ops[opCount].count = count;
+        ops[opCount].offset = 0;
+        opCount++;
+    }
+
+    if (ops != NULL && !fCompiledLiterals.isBogus()) {
+        fCompiledOps = ops;
+        fCompiledOpCount = opCount;
+    } else {
+        uprv_free(ops);
     }
 }
 
@@ -87,6 +87,8 @@ static char gStrBuf[256];
 #include "unicode/strenum.h"
 #include "uassert.h"
 #include "zonemeta.h"
+#include "sharedtimezone.h"
+#include "unifiedcache.h"
 
 #define kZONEINFO "zoneinfo64"
 #define kREGIONS  "Regions"
@@ -448,6 +450,83 @@ TimeZone::createTimeZone(const UnicodeString& ID)
 
 // -------------------------------------
 
+SharedTimeZone::~SharedTimeZone() {
+    delete ptr;
+}
+
+namespace {
+
+/**
+ * Cache key mapping a time zone ID to a SharedTimeZone in the unified cache.
+ */
+class TimeZoneCacheKey : public CacheKey<SharedTimeZone> {
+public:
+    TimeZoneCacheKey(const UnicodeString &id) : fId(id) { }
+    TimeZoneCacheKey(const TimeZoneCacheKey &other)
+            : CacheKey<SharedTimeZone>(other), fId(other.fId) { }
+    virtual ~TimeZoneCacheKey() { }
+    virtual int32_t hashCode() const {
+        return (int32_t)(37u * (uint32_t)CacheKey<SharedTimeZone>::hashCode()
+                + (uint32_t)fId.hashCode());
+    }
+    virtual CacheKeyBase *clone() const {
+        return new TimeZoneCacheKey(*this);
+    }
+    virtual UBool operator == (const CacheKeyBase &other) const {
+        // reflexive
+        if (this == &other) {
+            return TRUE;
+        }
+        if (!CacheKey<SharedTimeZone>::operator == (other)) {
+            return FALSE;
+        }
+        // We know that this and other are of same class if we get this far.
+        const TimeZoneCacheKey *realOther = static_cast<const TimeZoneCacheKey *>(&other);
+        return realOther->fId == fId;
+    }
+    virtual const SharedTimeZone *createObject(
+            const void * /*creationContext*/, UErrorCode &status) const {
+        TimeZone *tz = TimeZone::createTimeZone(fId);
+        if (tz == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return NULL;
+        }
+        SharedTimeZone *shared = new SharedTimeZone(tz);
+        if (shared == NULL) {
+            delete tz;
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return NULL;
+        }
+        shared->addRef();
+        return shared;
+    }
+
+private:
+    const UnicodeString fId;
+};
+
+}  // namespace
+
+const SharedTimeZone* U_EXPORT2
+TimeZone::getFrozen(const UnicodeString& ID, UErrorCode& status)
+{
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    const UnifiedCache *cache = UnifiedCache::getInstance(status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    const SharedTimeZone *shared = NULL;
+    cache->get(TimeZoneCacheKey(ID), shared, status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    return shared;
+}
+
+// -------------------------------------
+
 TimeZone* U_EXPORT2
 TimeZone::detectHostTimeZone()
 {
@@ -17,6 +17,7 @@
 #if !UCONFIG_NO_TRANSLITERATION
 
 #include "unicode/putil.h"
+#include "unicode/appendable.h"
 #include "unicode/translit.h"
 #include "unicode/locid.h"
 #include "unicode/msgfmt.h"
@@ -98,6 +99,23 @@ static icu::UMutex registryMutex = U_MUTEX_INITIALIZER;
  */
 static icu::TransliteratorRegistry* registry = 0;
 
+/**
+ * Cache of master instances for createInstance(), keyed by direction
+ * plus the caller's ID. Worker threads that repeatedly create the same
+ * transliterator clone a master under this mutex alone, instead of
+ * serializing on the registry mutex and re-instantiating. The cache is
+ * discarded whenever the registry is modified.
+ */
+static UHashtable* gInstanceCache = NULL;
+static icu::UMutex gInstanceCacheMutex = U_MUTEX_INITIALIZER;
+static const int32_t INSTANCE_CACHE_MAX_ENTRIES = 32;
+
+U_CDECL_BEGIN
+static void U_CALLCONV _deleteTransliterator(void *obj) {
+    delete (icu::Transliterator*) obj;
+}
+U_CDECL_END
+
 // Macro to check/initialize the registry. ONLY USE WITHIN
 // MUTEX. Avoids function call when registry is initialized.
 #define HAVE_REGISTRY(status) (registry!=0 || initializeRegistry(status))
@@ -343,6 +361,57 @@ void Transliterator::finishTransliteration(Replaceable& text,
     filteredTransliterate(text, index, FALSE, TRUE);
 }
 
+void Transliterator::transliterateTo(const UnicodeString& text,
+                                     Appendable& sink,
+                                     UErrorCode& status) const {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    // Process the input in bounded chunks through a small working
+    // buffer, flushing finished output to the sink as we go, so that
+    // tail-shifting inside the buffer stays O(chunk) rather than
+    // O(document).
+    static const int32_t CHUNK_SIZE = 0x1000;
+    UnicodeString buf;
+    UTransPosition pos = { 0, 0, 0, 0 };
+    int32_t srcIndex = 0;
+    int32_t srcLength = text.length();
+    do {
+        int32_t n = srcLength - srcIndex;
+        if (n > CHUNK_SIZE) {
+            n = CHUNK_SIZE;
+        }
+        buf.append(text, srcIndex, n);
+        srcIndex += n;
+        // Do not split a surrogate pair across chunks.
+        if (srcIndex < srcLength && U16_IS_LEAD(buf[buf.length() - 1])) {
+            buf.append(text[srcIndex++]);
+        }
+        pos.limit = pos.contextLimit = buf.length();
+        transliterate(buf, pos, status);
+        if (U_FAILURE(status)) {
+            return;
+        }
+        // Everything before pos.start is final, but retain enough of
+        // it in the buffer to serve as left context for later matches.
+        int32_t flushLimit = pos.start - getMaximumContextLength();
+        if (flushLimit > 0) {
+            if (!sink.appendString(buf.getBuffer(), flushLimit)) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+                return;
+            }
+            buf.remove(0, flushLimit);
+            pos.start -= flushLimit;
+            pos.limit -= flushLimit;
+            pos.contextLimit -= flushLimit;
+        }
+    } while (srcIndex < srcLength);
+    finishTransliteration(buf, pos);
+    if (!sink.appendString(buf.getBuffer(), buf.length())) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    }
+}
+
 /**
  * This internal method does keyboard transliteration.  If the
  * 'insertion' is non-null then we append it to 'text' before
@@ -896,6 +965,69 @@ Transliterator::createInstance(const UnicodeString& ID,
     return createInstance(ID, dir, parseError, status);
 }
 
+/**
+ * Builds the instance cache key for an ID and direction:
+ * a direction letter, a colon, and the ID as given by the caller.
+ */
+static void instanceCacheKey(const UnicodeString& id, UTransDirection dir,
+                             UnicodeString& key) {
+    key.remove();
+    key.append((UChar)(dir == UTRANS_FORWARD ? 0x46 : 0x52));  // 'F' or 'R'
+    key.append((UChar)0x3A);  // ':'
+    key.append(id);
+}
+
+/**
+ * Remembers a master clone of a newly created transliterator so that
+ * later createInstance() calls for the same ID and direction can clone
+ * it without entering the registry. Adopts the master. Failure to
+ * cache is never an error; the entry is simply not added.
+ */
+static void cacheInstance(const UnicodeString& id, UTransDirection dir,
+                          Transliterator* master) {
+    UnicodeString *key = new UnicodeString();
+    if (key == NULL) {
+        delete master;
+        return;
+    }
+    instanceCacheKey(id, dir, *key);
+    UErrorCode ec = U_ZERO_ERROR;
+    Mutex lock(&gInstanceCacheMutex);
+    if (gInstanceCache == NULL) {
+        gInstanceCache = uhash_open(uhash_hashUnicodeString,
+                                    uhash_compareUnicodeString, NULL, &ec);
+        if (U_FAILURE(ec)) {
+            gInstanceCache = NULL;
+            delete key;
+            delete master;
+            return;
+        }
+        uhash_setKeyDeleter(gInstanceCache, uprv_deleteUObject);
+        uhash_setValueDeleter(gInstanceCache, _deleteTransliterator);
+    }
+    if (uhash_count(gInstanceCache) >= INSTANCE_CACHE_MAX_ENTRIES ||
+            uhash_get(gInstanceCache, key) != NULL) {
+        delete key;
+        delete master;
+        return;
+    }
+    uhash_put(gInstanceCache, key, master, &ec);
+    // On failure, uhash_put() deletes the key and value via the deleters.
+}
+
+/**
+ * Discards all cached master instances. Must be called whenever the
+ * registry contents change, since cached masters may no longer match
+ * what the registry would produce.
+ */
+static void invalidateInstanceCache() {
+    Mutex lock(&gInstanceCacheMutex);
+    if (gInstanceCache != NULL) {
+        uhash_close(gInstanceCache);
+        gInstanceCache = NULL;
+    }
+}
+
 /**
  * Returns a <code>Transliterator</code> object given its ID.
  * The ID must be either a system transliterator ID or a ID registered
@@ -917,6 +1049,28 @@ Transliterator::createInstance(const UnicodeString& ID,
         return 0;
     }
 
+    // Fast path: clone a cached master instance,
+    // without entering the registry mutex.
+    {
+        UnicodeString key;
+        instanceCacheKey(ID, dir, key);
+        Mutex lock(&gInstanceCacheMutex);
+        if (gInstanceCache != NULL) {
+            Transliterator *master =
+                    (Transliterator*) uhash_get(gInstanceCache, &key);
+            if (master != NULL) {
+                Transliterator *dup = master->clone();
+                if (dup != NULL) {
+                    // Some clone() implementations rebuild the instance with
+                    // the canonical ID; restore the ID that createInstance()
+                    // originally assigned.
+                    dup->setID(master->getID());
+                    return dup;
+                }
+            }
+        }
+    }
+
     UnicodeString canonID;
     UVector list(status);
     if (U_FAILURE(status)) {
@@ -956,6 +1110,16 @@ Transliterator::createInstance(const UnicodeString& ID,
         if (globalFilter != NULL) {
             t->adoptFilter(globalFilter);
         }
+        if (U_SUCCESS(status)) {
+            Transliterator *master = t->clone();
+            if (master != NULL) {
+                // Some clone() implementations rebuild the instance with
+                // the canonical ID; keep the ID assigned above so that a
+                // cache hit returns the same getID() as this call.
+                master->setID(t->getID());
+                cacheInstance(ID, dir, master);
+            }
+        }
     }
     else if (U_SUCCESS(status)) {
         status = U_MEMORY_ALLOCATION_ERROR;
@@ -1216,6 +1380,7 @@ void U_EXPORT2 Transliterator::registerFactory(const UnicodeString& id,
     UErrorCode ec = U_ZERO_ERROR;
     if (HAVE_REGISTRY(ec)) {
         _registerFactory(id, factory, context);
+        invalidateInstanceCache();
     }
 }
 
@@ -1255,6 +1420,7 @@ void U_EXPORT2 Transliterator::registerInstance(Transliterator* adoptedPrototype
     UErrorCode ec = U_ZERO_ERROR;
     if (HAVE_REGISTRY(ec)) {
         _registerInstance(adoptedPrototype);
+        invalidateInstanceCache();
     }
 }
 
@@ -1269,6 +1435,7 @@ void U_EXPORT2 Transliterator::registerAlias(const UnicodeString& aliasID,
     UErrorCode ec = U_ZERO_ERROR;
     if (HAVE_REGISTRY(ec)) {
         _registerAlias(aliasID, realID);
+        invalidateInstanceCache();
     }
 }
 
@@ -1291,6 +1458,7 @@ void U_EXPORT2 Transliterator::unregister(const UnicodeString& ID) {
     UErrorCode ec = U_ZERO_ERROR;
     if (HAVE_REGISTRY(ec)) {
         registry->remove(ID);
+        invalidateInstanceCache();
     }
 }
 
@@ -1636,6 +1804,10 @@ U_NAMESPACE_END
 U_CFUNC UBool utrans_transliterator_cleanup(void) {
     U_NAMESPACE_USE
     TransliteratorIDParser::cleanup();
+    if (gInstanceCache) {
+        uhash_close(gInstanceCache);
+        gInstanceCache = NULL;
+    }
     if (registry) {
         delete registry;
         registry = NULL;
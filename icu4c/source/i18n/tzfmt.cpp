@@ -129,6 +129,12 @@ static int32_t MAX_OFFSET = 24 * MILLIS_PER_HOUR;
 
 // Maximum values for GMT offset fields
 static const int32_t MAX_OFFSET_HOUR = 23;
+
+// Quarter-hour grid covered by the pre-rendered localized GMT strings;
+// every current time zone offset is a multiple of 15 minutes in +/-14:00.
+static const int32_t kGMTOffsetMemoStep = 15 * 60 * 1000;
+static const int32_t kGMTOffsetMemoMax = 14 * 4;
+static const int32_t kGMTOffsetMemoSlots = 2 * kGMTOffsetMemoMax + 1;
 static const int32_t MAX_OFFSET_MINUTE = 59;
 static const int32_t MAX_OFFSET_SECOND = 59;
 
@@ -315,7 +321,7 @@ UOBJECT_DEFINE_RTTI_IMPLEMENTATION(TimeZoneFormat)
 
 TimeZoneFormat::TimeZoneFormat(const Locale& locale, UErrorCode& status) 
 : fLocale(locale), fTimeZoneNames(NULL), fTimeZoneGenericNames(NULL),
-  fDefParseOptionFlags(0), fTZDBTimeZoneNames(NULL) {
+  fDefParseOptionFlags(0), fGMTOffsetMemo(NULL), fTZDBTimeZoneNames(NULL) {
 
     for (int32_t i = 0; i < UTZFMT_PAT_COUNT; i++) {
         fGMTOffsetPatternItems[i] = NULL;
@@ -410,11 +416,15 @@ TimeZoneFormat::TimeZoneFormat(const Locale& locale, UErrorCode& status)
         uprv_memcpy(fGMTOffsetDigits, DEFAULT_GMT_DIGITS, sizeof(UChar32) * 10);
     }
     delete ns;
+
+    if (U_SUCCESS(status)) {
+        initGMTOffsetMemo();
+    }
 }
 
 TimeZoneFormat::TimeZoneFormat(const TimeZoneFormat& other)
 : Format(other), fTimeZoneNames(NULL), fTimeZoneGenericNames(NULL),
-  fTZDBTimeZoneNames(NULL) {
+  fGMTOffsetMemo(NULL), fTZDBTimeZoneNames(NULL) {
 
     for (int32_t i = 0; i < UTZFMT_PAT_COUNT; i++) {
         fGMTOffsetPatternItems[i] = NULL;
@@ -430,6 +440,7 @@ TimeZoneFormat::~TimeZoneFormat() {
     for (int32_t i = 0; i < UTZFMT_PAT_COUNT; i++) {
         delete fGMTOffsetPatternItems[i];
     }
+    delete[] fGMTOffsetMemo;
 }
 
 TimeZoneFormat&
@@ -472,6 +483,8 @@ TimeZoneFormat::operator=(const TimeZoneFormat& other) {
 
     fDefParseOptionFlags = other.fDefParseOptionFlags;
 
+    initGMTOffsetMemo();
+
     return *this;
 }
 
@@ -557,6 +570,9 @@ TimeZoneFormat::getGMTPattern(UnicodeString& pattern) const {
 void
 TimeZoneFormat::setGMTPattern(const UnicodeString& pattern, UErrorCode& status) {
     initGMTPattern(pattern, status);
+    if (U_SUCCESS(status)) {
+        initGMTOffsetMemo();
+    }
 }
 
 UnicodeString&
@@ -601,6 +617,7 @@ TimeZoneFormat::setGMTOffsetPattern(UTimeZoneFormatGMTOffsetPatternType type, co
     delete fGMTOffsetPatternItems[type];
     fGMTOffsetPatternItems[type] = patternItems;
     checkAbuttingHoursAndMinutes();
+    initGMTOffsetMemo();
 }
 
 UnicodeString&
@@ -623,6 +640,7 @@ TimeZoneFormat::setGMTOffsetDigits(const UnicodeString& digits, UErrorCode& stat
         return;
     }
     uprv_memcpy(fGMTOffsetDigits, digitArray, sizeof(UChar32)*10);
+    initGMTOffsetMemo();
 }
 
 UnicodeString&
@@ -1566,6 +1584,14 @@ TimeZoneFormat::formatOffsetLocalizedGMT(int32_t offset, UBool isShort, UnicodeS
         return result;
     }
 
+    if (fGMTOffsetMemo != NULL && (offset % kGMTOffsetMemoStep) == 0) {
+        int32_t slot = offset / kGMTOffsetMemoStep + kGMTOffsetMemoMax;
+        if (0 <= slot && slot < kGMTOffsetMemoSlots) {
+            result.setTo(fGMTOffsetMemo[(isShort ? 0 : kGMTOffsetMemoSlots) + slot]);
+            return result;
+        }
+    }
+
     UBool positive = TRUE;
     if (offset < 0) {
         offset = -offset;
@@ -2665,6 +2691,30 @@ TimeZoneFormat::checkAbuttingHoursAndMinutes() {
     }
 }
 
+void
+TimeZoneFormat::initGMTOffsetMemo() {
+    delete[] fGMTOffsetMemo;
+    fGMTOffsetMemo = NULL;  // formatting falls back to pattern assembly meanwhile
+
+    UnicodeString* memo = new UnicodeString[2 * kGMTOffsetMemoSlots];
+    if (memo == NULL) {
+        return;  // not an error - the assembly path still works
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    for (int32_t shortIdx = 0; shortIdx < 2; shortIdx++) {
+        for (int32_t slot = 0; slot < kGMTOffsetMemoSlots; slot++) {
+            int32_t offset = (slot - kGMTOffsetMemoMax) * kGMTOffsetMemoStep;
+            formatOffsetLocalizedGMT(offset, (UBool)(shortIdx == 0),
+                memo[shortIdx * kGMTOffsetMemoSlots + slot], status);
+        }
+    }
+    if (U_FAILURE(status)) {
+        delete[] memo;
+        return;
+    }
+    fGMTOffsetMemo = memo;
+}
+
 UBool
 TimeZoneFormat::toCodePoints(const UnicodeString& str, UChar32* codeArray, int32_t size) {
     int32_t count = str.countChar32();
@@ -174,6 +174,7 @@ TextTrieMapSearchResultHandler::~TextTrieMapSearchResultHandler(){
 TextTrieMap::TextTrieMap(UBool ignoreCase, UObjectDeleter *valueDeleter)
 : fIgnoreCase(ignoreCase), fNodes(NULL), fNodesCapacity(0), fNodesCount(0), 
   fLazyContents(NULL), fIsEmpty(TRUE), fValueDeleter(valueDeleter) {
+    umtx_storeRelease(fIsBuilt, 0);
 }
 
 TextTrieMap::~TextTrieMap() {
@@ -240,6 +241,8 @@ TextTrieMap::put(const UChar *key, void *value, UErrorCode &status) {
     }
 
     fLazyContents->addElement(value, status);
+    // The new entry must be merged into the nodes before the next search.
+    umtx_storeRelease(fIsBuilt, 0);
 }
 
 void
@@ -377,20 +380,25 @@ void TextTrieMap::buildTrie(UErrorCode &status) {
     }
 }
 
+// Makes sure the pending contents are merged into the node structure, then
+// publishes that fact through fIsBuilt. Steady-state searches see the flag
+// with acquire semantics and never touch the mutex.
+void TextTrieMap::build(UErrorCode &status) {
+    Mutex lock(&TextTrieMutex);
+    if (fLazyContents != NULL) {
+        buildTrie(status);
+    }
+    if (U_SUCCESS(status)) {
+        umtx_storeRelease(fIsBuilt, 1);
+    }
+}
+
 void
 TextTrieMap::search(const UnicodeString &text, int32_t start,
                   TextTrieMapSearchResultHandler *handler, UErrorCode &status) const {
-    {
-        // TODO: if locking the mutex for each check proves to be a performance problem,
-        //       add a flag of type atomic_int32_t to class TextTrieMap, and use only
-        //       the ICU atomic safe functions for assigning and testing.
-        //       Don't test the pointer fLazyContents.
-        //       Don't do unless it's really required.
-        Mutex lock(&TextTrieMutex);
-        if (fLazyContents != NULL) {
-            TextTrieMap *nonConstThis = const_cast<TextTrieMap *>(this);
-            nonConstThis->buildTrie(status);
-        }
+    TextTrieMap *nonConstThis = const_cast<TextTrieMap *>(this);
+    if (umtx_loadAcquire(nonConstThis->fIsBuilt) == 0) {
+        nonConstThis->build(status);
     }
     if (fNodes == NULL) {
         return;
@@ -1583,7 +1591,13 @@ void TimeZoneNamesImpl::loadAllDisplayNames(UErrorCode& status) {
     {
         Mutex lock(&gDataMutex);
         internalLoadAllDisplayNames(status);
+        // Also populate and build the parsing trie now. Parsing pipelines can
+        // call this once per locale up front, so the first findTimeZoneNames()
+        // does not pay the full build under the data lock.
+        addAllNamesIntoTrie(status);
+        fNamesTrieFullyLoaded = TRUE;
     }
+    fNamesTrie.build(status);
 }
 
 void TimeZoneNamesImpl::getDisplayNames(const UnicodeString& tzID,
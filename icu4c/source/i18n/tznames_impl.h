@@ -140,6 +140,12 @@ public:
     void search(const UnicodeString &text, int32_t start,
         TextTrieMapSearchResultHandler *handler, UErrorCode& status) const;
     int32_t isEmpty() const;
+    /**
+     * Builds the trie node structure from the pending contents now,
+     * instead of on the first search(). After this returns, searches
+     * are lock-free until the next put().
+     */
+    void build(UErrorCode &status);
 
 private:
     UBool           fIgnoreCase;
@@ -150,6 +156,9 @@ private:
     UVector         *fLazyContents;
     UBool           fIsEmpty;
     UObjectDeleter  *fValueDeleter;
+    u_atomic_int32_t fIsBuilt;   // all pending contents are in the nodes; set
+                                 // with release, checked in search() with
+                                 // acquire so reads need no lock
 
     UBool growNodes();
     CharacterNode* addChildNode(CharacterNode *parent, UChar c, UErrorCode &status);
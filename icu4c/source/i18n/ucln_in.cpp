@@ -16,9 +16,10 @@
 *   created by: George Rhoten
 */
 
+#include <atomic>
+
 #include "ucln.h"
 #include "ucln_in.h"
-#include "mutex.h"
 #include "uassert.h"
 
 /**  Auto-client for UCLN_I18N **/
@@ -28,7 +29,8 @@
 /* Leave this copyright notice here! It needs to go somewhere in this library. */
 static const char copyright[] = U_COPYRIGHT_STRING;
 
-static cleanupFunc *gCleanupFunctions[UCLN_I18N_COUNT];
+/* Atomic so that registration does not need the global mutex; see ucln_cmn.cpp. */
+static std::atomic<cleanupFunc *> gCleanupFunctions[UCLN_I18N_COUNT];
 
 static UBool U_CALLCONV i18n_cleanup(void)
 {
@@ -36,10 +38,10 @@ static UBool U_CALLCONV i18n_cleanup(void)
     (void)copyright;   /* Suppress unused variable warning with clang. */
 
     while (++libType<UCLN_I18N_COUNT) {
-        if (gCleanupFunctions[libType])
+        cleanupFunc *func = gCleanupFunctions[libType].exchange(NULL, std::memory_order_acquire);
+        if (func != NULL)
         {
-            gCleanupFunctions[libType]();
-            gCleanupFunctions[libType] = NULL;
+            func();
         }
     }
 #if !UCLN_NO_AUTO_CLEANUP && (defined(UCLN_AUTO_ATEXIT) || defined(UCLN_AUTO_LOCAL))
@@ -51,12 +53,9 @@ static UBool U_CALLCONV i18n_cleanup(void)
 void ucln_i18n_registerCleanup(ECleanupI18NType type,
                                cleanupFunc *func) {
     U_ASSERT(UCLN_I18N_START < type && type < UCLN_I18N_COUNT);
-    {
-        icu::Mutex m;   // See ticket 10295 for discussion.
-        ucln_registerCleanup(UCLN_I18N, i18n_cleanup);
-        if (UCLN_I18N_START < type && type < UCLN_I18N_COUNT) {
-            gCleanupFunctions[type] = func;
-        }
+    ucln_registerCleanup(UCLN_I18N, i18n_cleanup);
+    if (UCLN_I18N_START < type && type < UCLN_I18N_COUNT) {
+        gCleanupFunctions[type].store(func, std::memory_order_release);
     }
 #if !UCLN_NO_AUTO_CLEANUP && (defined(UCLN_AUTO_ATEXIT) || defined(UCLN_AUTO_LOCAL))
     ucln_registerAutomaticCleanup();
@@ -611,7 +611,8 @@ static const UEnumeration defaultKeywordValues = {
     ulist_count_keyword_values,
     uenum_unextDefault,
     ulist_next_keyword_value,
-    ulist_reset_keyword_values_iterator
+    ulist_reset_keyword_values_iterator,
+    NULL  /* drain */
 };
 
 namespace {
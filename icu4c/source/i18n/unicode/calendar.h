@@ -2229,6 +2229,22 @@ private:
      */
     int32_t fGregorianDayOfMonth;
 
+    /**
+     * Snapshot of the date-dependent fields from the most recent successful
+     * computeFields() call, keyed by the local epoch day. When consecutive
+     * millis->fields conversions land on the same local day, computeFields()
+     * restores this snapshot and recomputes only the time-of-day fields.
+     * Invalidated when the week-numbering parameters change, since the week
+     * fields depend on them.
+     */
+    UBool   fDayCacheValid = FALSE;
+    int32_t fDayCacheEpochDays = 0;
+    int32_t fDayCacheFields[UCAL_FIELD_COUNT];
+    int32_t fDayCacheGregorianYear;
+    int32_t fDayCacheGregorianMonth;
+    int32_t fDayCacheGregorianDayOfYear;
+    int32_t fDayCacheGregorianDayOfMonth;
+
     /* calculations */
 
     /**
@@ -2250,6 +2266,15 @@ protected:
      */
     void computeGregorianFields(int32_t julianDay, UErrorCode &ec);
 
+    /**
+     * Invalidates the per-day field snapshot used by computeFields().
+     * Subclasses must call this when a parameter that changes the fields
+     * computed for a given Julian day is modified, for example the
+     * Gregorian cutover date.
+     * @internal
+     */
+    void invalidateDayCache();
+
 private:
 
     /**
@@ -541,6 +541,31 @@ private:
      */
     MessagePattern msgPattern;
 
+    /**
+     * Builds the interval table below from msgPattern, or clears it if the
+     * boundaries are not strictly ascending (then format() falls back to
+     * the linear findSubMessage() scan).
+     */
+    void compileIntervals();
+
+    /**
+     * Returns the index of the interval containing the number,
+     * by binary search over fBoundaries. Requires fBucketCount>0.
+     */
+    int32_t findBucket(double number) const;
+
+    /**
+     * Precomputed interval table for format(double):
+     * fBoundaries[k] guards entry into the sub-message starting at
+     * fBucketMsgStart[k+1]; fBoundaryStrict[k] is TRUE for a "<" selector.
+     * Empty (fBucketCount==0) if no pattern is set or the boundaries are
+     * not strictly ascending.
+     */
+    double *fBoundaries;
+    UBool *fBoundaryStrict;
+    int32_t *fBucketMsgStart;
+    int32_t fBucketCount;
+
     /**
      * Docs & fields from before ICU 4.8, before MessagePattern was used.
      * Commented out, and left only for explanation of semantics.
@@ -228,6 +228,21 @@ public:
      */
     static DecimalFormatSymbols* createWithLastResortData(UErrorCode& status);
 
+#ifndef U_HIDE_INTERNAL_API
+    /**
+     * Creates a DecimalFormatSymbols instance for the given locale, backed by
+     * an immutable per-locale object in the unified cache. The resource data
+     * is loaded once per locale; subsequent calls copy the cached symbols
+     * instead of reloading them.
+     * @param locale the locale.
+     * @param status error returned here.
+     * @return the new DecimalFormatSymbols which the caller owns.
+     * @internal For ICU use only.
+     */
+    static DecimalFormatSymbols* U_EXPORT2 createForLocale(
+            const Locale& locale, UErrorCode& status);
+#endif  /* U_HIDE_INTERNAL_API */
+
     /**
      * Copy constructor.
      * @stable ICU 2.0
@@ -754,6 +754,19 @@ private:
      */
     void initializePattern(UErrorCode& status);
 
+    /**
+     * Build the pre-split formatter pairs in fSegmentFormats from
+     * fIntervalPatterns. Called after initializePattern() has filled in
+     * the interval patterns.
+     * @param status          output param set to success/failure code on exit
+     */
+    void initSegmentFormats(UErrorCode& status);
+
+    /**
+     * Delete and clear all entries in fSegmentFormats.
+     */
+    void deleteSegmentFormats();
+
 
 
     /**
@@ -1025,6 +1038,16 @@ private:
     UnicodeString fSkeleton;
     PatternInfo fIntervalPatterns[DateIntervalInfo::kIPI_MAX_INDEX];
 
+    /**
+     * Pre-split formatter pair for each interval pattern entry:
+     * fSegmentFormats[2*i] is a SimpleDateFormat already carrying
+     * fIntervalPatterns[i].firstPart, and fSegmentFormats[2*i+1] the
+     * secondPart, so that formatImpl() does not have to re-apply patterns
+     * on the shared fDateFormat for every call. NULL where the entry has
+     * no real interval pattern or the part is empty.
+     */
+    SimpleDateFormat* fSegmentFormats[2 * DateIntervalInfo::kIPI_MAX_INDEX] = {};
+
     /**
      * Patterns for fallback formatting.
      */
@@ -79,6 +79,15 @@ public:
      */
     static DateTimePatternGenerator* U_EXPORT2 internalMakeInstance(const Locale& uLocale, UErrorCode& status);
 
+    /**
+     * For ICU use only. Returns a copy of the generator cached for the locale
+     * in the unified cache, so that repeated construction for the same locale
+     * does not reload resource data.
+     *
+     * @internal
+     */
+    static DateTimePatternGenerator* U_EXPORT2 createInstanceFromCache(const Locale& uLocale, UErrorCode& status);
+
 #endif /* U_HIDE_INTERNAL_API */
 
     /**
@@ -533,6 +542,12 @@ private:
     UnicodeString decimal;
     DateTimeMatcher *skipMatcher;
     Hashtable *fAvailableFormatKeyHash;
+    /**
+     * Memo of getBestPattern() results, keyed by skeleton plus match options.
+     * Lazily created, and cleared whenever the patterns or formats that feed
+     * best-pattern resolution are modified. May be nullptr.
+     */
+    Hashtable *fBestPatternMemo;
     UnicodeString emptyString;
     char16_t fDefaultHourFormatChar;
 
@@ -572,6 +587,8 @@ private:
     UnicodeString mapSkeletonMetacharacters(const UnicodeString& patternForm, int32_t* flags, UErrorCode& status);
     const UnicodeString* getBestRaw(DateTimeMatcher& source, int32_t includeMask, DistanceInfo* missingFields, UErrorCode& status, const PtnSkeleton** specifiedSkeletonPtr = 0);
     UnicodeString adjustFieldTypes(const UnicodeString& pattern, const PtnSkeleton* specifiedSkeleton, int32_t flags, UDateTimePatternMatchOptions options = UDATPG_MATCH_NO_OPTIONS);
+    UnicodeString computeBestPattern(const UnicodeString& patternForm, UDateTimePatternMatchOptions options, UErrorCode& status);
+    void clearBestPatternMemo();
     UnicodeString getBestAppending(int32_t missingFields, int32_t flags, UErrorCode& status, UDateTimePatternMatchOptions options = UDATPG_MATCH_NO_OPTIONS);
     int32_t getTopBitNumber(int32_t foundMask) const;
     void setAvailableFormat(const UnicodeString &key, UErrorCode& status);
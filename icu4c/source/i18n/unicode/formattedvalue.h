@@ -308,6 +308,35 @@ class U_I18N_API FormattedValue /* not : public UObject because this is an inter
      * @draft ICU 64
      */
     virtual UBool nextPosition(ConstrainedFieldPosition& cfpos, UErrorCode& status) const = 0;
+
+#ifndef U_HIDE_INTERNAL_API
+    /**
+     * Writes this value's field positions into a caller-owned buffer as
+     * consecutive (field, start, limit) int32_t triples, in iteration order,
+     * with no heap allocation.
+     *
+     * Iteration starts from the current state of cfpos, honoring any
+     * category or field constraint set on it; pass a freshly reset or
+     * constrained instance to extract all positions. At most capacity
+     * triples are written, but the return value always reports the total
+     * number of matching positions, so a caller can detect a too-small
+     * buffer by comparing the return value against capacity.
+     *
+     * @param cfpos Carries optional constraints in; consumed as the
+     *              iteration state.
+     * @param buffer Receives 3 * min(capacity, total) int32_t values.
+     *               May be NULL if capacity is 0.
+     * @param capacity The number of triples the buffer can hold.
+     * @param status Set if an error occurs.
+     * @return The total number of matching field positions.
+     * @internal
+     */
+    int32_t extractFieldSpans(
+        ConstrainedFieldPosition& cfpos,
+        int32_t* buffer,
+        int32_t capacity,
+        UErrorCode& status) const;
+#endif  /* U_HIDE_INTERNAL_API */
 };
 
 
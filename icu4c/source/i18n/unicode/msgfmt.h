@@ -667,6 +667,33 @@ public:
                           FieldPosition& ignore,
                           UErrorCode& status) const;
 
+#ifndef U_HIDE_INTERNAL_API
+    /**
+     * Formats the given array of strings without boxing them into
+     * Formattable objects. Intended for high-volume rendering of simple
+     * templates. When the pattern consists only of literal text and plain
+     * numbered arguments ("{0}", "{1}", ...), the strings are appended
+     * directly; otherwise the arguments are boxed as kString Formattables
+     * and the regular formatting engine is used, so the result is always
+     * the same as for format(const Formattable*, ...) with string values.
+     *
+     * <p>If this format uses named arguments, appendTo is unchanged and
+     * status is set to U_ILLEGAL_ARGUMENT_ERROR.
+     *
+     * @param arguments An array of strings to be substituted.
+     * @param count     The number of elements of 'arguments'.
+     * @param appendTo  Output parameter to receive result.
+     *                  Result is appended to existing contents.
+     * @param status    Input/output error code.
+     * @return          Reference to 'appendTo' parameter.
+     * @internal
+     */
+    UnicodeString& formatStringArgs(const UnicodeString* arguments,
+                                    int32_t count,
+                                    UnicodeString& appendTo,
+                                    UErrorCode& status) const;
+#endif  /* U_HIDE_INTERNAL_API */
+
     /**
      * Formats the given array of arguments into a user-readable string
      * using the given pattern.
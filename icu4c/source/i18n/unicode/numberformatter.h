@@ -2349,6 +2349,57 @@ class U_I18N_API LocalizedNumberFormatter
      */
     void formatImpl(impl::UFormattedNumberData *results, UErrorCode &status) const;
 
+    /**
+     * Like formatInt, but writes into a caller-owned results object instead of allocating a
+     * new one, the same way the C API does. Reusing one results object across calls keeps
+     * steady-state formatting free of heap operations for fixed-notation integer and decimal
+     * values: clear() retains the string builder's capacity, and the compiled pipeline
+     * itself works in stack state only.
+     *
+     * @param value
+     *            The number to format.
+     * @param results
+     *            The results object, owned by the caller and reusable across calls.
+     * @param status
+     * @internal
+     */
+    void formatIntToData(int64_t value, impl::UFormattedNumberData &results, UErrorCode &status) const;
+
+    /**
+     * Like formatDouble, but writes into a caller-owned results object. See formatIntToData.
+     * @internal
+     */
+    void formatDoubleToData(double value, impl::UFormattedNumberData &results, UErrorCode &status) const;
+
+    /**
+     * Like formatDecimal, but writes into a caller-owned results object. See formatIntToData.
+     * @internal
+     */
+    void formatDecimalToData(StringPiece value, impl::UFormattedNumberData &results,
+                             UErrorCode &status) const;
+
+    /**
+     * Formats a batch of doubles into a single output string, reusing one internal results
+     * object for the whole batch. Intended for tabular output, where the per-value cost of
+     * allocating a FormattedNumber and setting up field positions can exceed the cost of
+     * digit generation itself.
+     *
+     * @param values
+     *            The numbers to format. May be NULL only if count is 0.
+     * @param count
+     *            The number of values.
+     * @param appendTo
+     *            The formatted values are appended here, in order.
+     * @param offsets
+     *            If not NULL, must have room for count+1 entries. On return, offsets[i] is
+     *            the index in appendTo where value i begins, and offsets[count] is the final
+     *            length of appendTo.
+     * @param status
+     * @internal
+     */
+    void formatDoubles(const double *values, int32_t count, UnicodeString &appendTo,
+                       int32_t offsets[], UErrorCode &status) const;
+
 #endif  /* U_HIDE_INTERNAL_API */
 
     /**
@@ -2608,6 +2659,28 @@ class U_I18N_API NumberFormatter final {
     static UnlocalizedNumberFormatter forSkeleton(const UnicodeString& skeleton,
                                                   UParseError& perror, UErrorCode& status);
 
+#ifndef U_HIDE_INTERNAL_API
+    /**
+     * Formats a value using a process-wide formatter for the given locale and currency, cached
+     * in the unified cache. Any (locale, currency) pair formats at compiled-formatter speed
+     * without the caller holding a formatter object per pair; sign handling comes from the
+     * pattern modifiers inside the cached formatter, so it is not part of the cache key.
+     *
+     * @param locale
+     *            The locale from which to load formats and symbols.
+     * @param currency
+     *            The currency to apply.
+     * @param value
+     *            The number to format.
+     * @param appendTo
+     *            The formatted value is appended here.
+     * @param status
+     * @internal
+     */
+    static void formatCurrency(const Locale &locale, const CurrencyUnit &currency, double value,
+                               UnicodeString &appendTo, UErrorCode &status);
+#endif  /* U_HIDE_INTERNAL_API */
+
     /**
      * Use factory methods instead of the constructor to create a NumberFormatter.
      */
@@ -512,7 +512,19 @@ public:
 private:
     RuleChain  *mRules;
 
+    /**
+     * Precompiled select() results for small non-negative integer values,
+     * so that selecting a keyword for common integer counts does not build
+     * a FixedDecimal nor interpret the rule constraints per call.
+     * Entry values: >=0: index of the matching rule in the mRules chain;
+     * -1: no rule matched (the "other" keyword);
+     * -2: not compiled, use the regular rule evaluation.
+     */
+    enum { kSmallIntKeywordCount = 128 };
+    int8_t mSmallIntRuleIndex[kSmallIntKeywordCount];
+
     PluralRules();   // default constructor not implemented
+    void            compileSmallIntKeywords();
     void            parseDescription(const UnicodeString& ruleData, UErrorCode &status);
     int32_t         getNumberValue(const UnicodeString& token) const;
     UnicodeString   getRuleFromResource(const Locale& locale, UPluralType type, UErrorCode& status);
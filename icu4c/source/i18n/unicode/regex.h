@@ -599,7 +599,12 @@ private:
                                    //   >= this value.  For some patterns, this calculated
                                    //   value may be less than the true shortest
                                    //   possible match.
-    
+
+    int32_t         fMaxMatchLen;  // Maximum Match Length, in 16 bit code units.
+                                   //   INT32_MAX if the length is unbounded or hard
+                                   //   to characterize.  May be longer than the true
+                                   //   longest possible match, never shorter.
+
     int32_t         fFrameSize;    // Size of a state stack frame in the
                                    //   execution engine.
 
@@ -626,6 +631,11 @@ private:
 
     UHashtable     *fNamedCaptureMap;  // Map from capture group names to numbers.
 
+    mutable RegexMatcher  *fMatcherPool[4];
+                                       // Idle matchers parked by releaseMatcher(),
+                                       //   for reuse by acquireMatcher().
+                                       //   Mutable state; guarded by a mutex in repattrn.cpp.
+
     friend class RegexCompile;
     friend class RegexMatcher;
     friend class RegexCImpl;
@@ -645,6 +655,92 @@ private:
       * @internal
       */
     void        dumpPattern() const;
+
+    /**
+      * Reports whether the compiled pattern uses constructs that only the
+      * backtracking engine can execute: back references and look-around
+      * blocks. Patterns without them are candidates for execution by a
+      * non-backtracking (automaton-based) engine; callers handling
+      * untrusted pattern sources can also use this to restrict inputs to
+      * the subset, or to apply tighter time and stack limits otherwise.
+      * @internal
+      */
+    UBool       requiresBacktracking() const;
+
+    /**
+      * Returns a matcher for this pattern, reusing one previously returned
+      * to releaseMatcher() when available. Reused matchers keep their input
+      * buffers and backtrack stack, so acquire + reset(input) + release in
+      * steady state performs no heap allocation; when the pool is empty a
+      * matcher is created as by matcher(status). The caller owns the
+      * returned matcher until it is released or deleted, and must not use
+      * it after the pattern itself is deleted.
+      * @internal
+      */
+    RegexMatcher *acquireMatcher(UErrorCode &status) const;
+
+    /**
+      * Returns a matcher obtained from acquireMatcher() (or matcher()) on
+      * this pattern to the pool for reuse. The matcher is reset, dropping
+      * any reference to the caller's input text. If the pool is full the
+      * matcher is deleted. Passing NULL is a no-op.
+      * @internal
+      */
+    void          releaseMatcher(RegexMatcher *adoptedMatcher) const;
+
+    /**
+      * Screen a set of patterns against one piece of text in a single pass.
+      * For each pattern, sets couldMatch[i] to FALSE only when the compiled
+      * start-of-match information (required first characters, minimum match
+      * length) proves the pattern cannot match anywhere in the text.
+      * Entries left TRUE must still be run through a matcher. One scan of
+      * the text replaces a find() over it for every pattern that is
+      * screened out, which is most of them when many patterns are applied
+      * to each document. The text's iteration position is left undefined.
+      * @internal
+      */
+    static void screenCandidates(const RegexPattern * const patterns[],
+                                 int32_t    patternCount,
+                                 UText     *text,
+                                 UBool      couldMatch[],
+                                 UErrorCode &status);
+
+    /**
+      * Write a flattened binary image of this compiled pattern to the
+      * supplied buffer, from which unflatten() can recreate the pattern
+      * without reparsing. Follows the usual ICU preflighting convention:
+      * the return value is the required size in bytes, and
+      * U_BUFFER_OVERFLOW_ERROR is set if the capacity is insufficient.
+      * The buffer must be 32-bit aligned. Like precompiled break iterator
+      * rules, the image is in the native byte order and internal format
+      * of the ICU version that created it, and is only valid with the
+      * same format; unflatten() rejects anything else.
+      * @internal
+      */
+    int32_t flatten(uint8_t *buffer, int32_t capacity, UErrorCode &status) const;
+
+    /**
+      * Recreate a compiled pattern from an image written by flatten(),
+      * skipping parsing and compilation entirely. The data must be
+      * 32-bit aligned and remains owned by the caller; the returned
+      * pattern (owned by the caller) makes its own copy of everything
+      * it needs.
+      * @internal
+      */
+    static RegexPattern *unflatten(const uint8_t *data, int32_t length, UErrorCode &status);
+
+    /**
+      * An upper bound on the length of any string this pattern can match,
+      * in 16 bit code units, or INT32_MAX if the length is unbounded
+      * (loops without an upper count, back references, \\X). The bound may
+      * exceed the true maximum but is never less. A caller scanning a
+      * stream through a sliding window can use a bounded value to size the
+      * overlap retained between windows: no match is lost if successive
+      * windows overlap by maxMatchLength() - 1 code units. Pair with
+      * RegexMatcher::hitEnd() to detect matches cut off at a window edge.
+      * @internal
+      */
+    int32_t maxMatchLength() const;
 #endif  /* U_HIDE_INTERNAL_API */
 };
 
@@ -358,7 +358,24 @@ private:
     static int32_t findSubMessage(const MessagePattern& pattern, int32_t partIndex,
                                   const UnicodeString& keyword, UErrorCode& ec);
 
+    /**
+     * Builds the selector table below from msgPattern, or clears it
+     * (then format() falls back to findSubMessage()).
+     */
+    void compileSelectors();
+
     MessagePattern msgPattern;
+
+    /**
+     * Selector keywords and their sub-message start part indexes,
+     * precomputed when the pattern changes so that format() compares the
+     * keyword against a dense array instead of walking the pattern parts.
+     * Empty (fSelectorCount==0) if no pattern is set.
+     */
+    UnicodeString *fSelectors;
+    int32_t *fSelectorMsgStarts;
+    int32_t fSelectorCount;
+    int32_t fOtherMsgStart;
 };
 
 U_NAMESPACE_END
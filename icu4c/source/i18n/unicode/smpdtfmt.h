@@ -1599,7 +1599,27 @@ private:
     UBool                fHasSecond;
 
     /**
-     * Sets fHasMinutes and fHasSeconds.
+     * One step of the compiled form of the pattern: either a literal run to be
+     * copied from fCompiledLiterals, or a repeated pattern character to be
+     * handled by subFormat().
+     */
+    struct PatternOp {
+        char16_t field;  // pattern character, or 0 for a literal run
+        int32_t count;   // field repeat count, or literal run length
+        int32_t offset;  // start of the literal run in fCompiledLiterals
+    };
+
+    /**
+     * The pattern lowered into a flat list of literal-copy and field ops, so
+     * that formatting does not re-interpret quoting on every call. NULL if the
+     * compilation failed; _format() then falls back to walking fPattern.
+     */
+    PatternOp*           fCompiledOps = NULL;
+    int32_t              fCompiledOpCount = 0;
+    UnicodeString        fCompiledLiterals;
+
+    /**
+     * Sets fHasMinutes and fHasSeconds, and rebuilds fCompiledOps.
      */
     void                 parsePattern();
 
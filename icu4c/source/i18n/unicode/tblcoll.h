@@ -84,6 +84,7 @@ class StringSearch;
 /**
 * @stable ICU 2.0
 */
+class CollationCompareContext;
 class CollationElementIterator;
 class CollationKey;
 class SortKeyByteSink;
@@ -191,7 +192,8 @@ public:
     *  @param length size of the image. If negative, the API will try to
     *                figure out the length of the image
     *  @param base Base collator, for lookup of untailored characters.
-    *              Must be the root collator, must not be NULL.
+    *              Must be the root collator, or NULL which is equivalent to
+    *              passing the root collator.
     *              The base is required to be present through the lifetime of the collator.
     *  @param status for catching errors
     *  @return newly created collator
@@ -790,6 +792,67 @@ public:
      * @internal for tests & tools
      */
     void internalGetCEs(const UnicodeString &str, UVector64 &ces, UErrorCode &errorCode) const;
+
+    /**
+     * Writes the sort keys for a batch of strings into one caller-supplied buffer,
+     * amortizing the per-call iterator and buffer setup of getSortKey()
+     * across the whole batch.
+     * The keys are written back-to-back, each including its terminating 0 byte.
+     * offsets must have space for count+1 values; offsets[i] is the start of
+     * the i-th key and offsets[count] is the total number of key bytes.
+     * Supports preflighting: if capacity is too small (it may be 0, with dest NULL),
+     * then the keys that do not fit are not written but their lengths are
+     * still accumulated, and the total length is returned.
+     * @param strings the input strings
+     * @param count the number of input strings
+     * @param dest the key bytes buffer
+     * @param capacity the number of bytes available in dest
+     * @param offsets output array of count+1 key start offsets
+     * @param errorCode in/out ICU error code
+     * @return the total number of key bytes for all of the strings
+     * @internal for high-volume index builds
+     */
+    int32_t internalGetSortKeys(const UnicodeString *strings, int32_t count,
+                                uint8_t *dest, int32_t capacity,
+                                int32_t *offsets, UErrorCode &errorCode) const;
+
+    /**
+     * Writes only the sort key levels minLevel..maxLevel (inclusive) for s,
+     * for top-K queries that sort by primary-level prefixes first and
+     * extend the keys only for the rows that actually tie.
+     * Levels are Collation::Level values
+     * (1=primary .. 5=quaternary; the identical level is not supported).
+     * The fragments do not include the 00 terminator byte; concatenating the
+     * fragment for levels 1..n with the fragment for levels n+1..m yields the
+     * leading part of the regular sort key for levels 1..m.
+     * Supports preflighting like getSortKey().
+     * @return the length of the requested levels' key bytes
+     * @internal for incremental top-K sort key generation
+     */
+    int32_t internalGetSortKeyLevels(const char16_t *s, int32_t length,
+                                     int32_t minLevel, int32_t maxLevel,
+                                     uint8_t *dest, int32_t capacity,
+                                     UErrorCode &errorCode) const;
+
+    /**
+     * Creates a comparison context for internalCompare().
+     * The context is tied to this collator's data and current numeric setting
+     * and must be used by at most one thread at a time; keep one per thread.
+     * The caller owns (deletes) the returned object.
+     * @internal for allocation-free sort runs
+     */
+    CollationCompareContext *internalCreateCompareContext(UErrorCode &errorCode) const;
+
+    /**
+     * Compares two UTF-16 strings like compare(), but reuses the context's
+     * collation iterators, including their grown-to-size CE buffers,
+     * so that repeated comparisons in a sort run do not allocate.
+     * @internal for allocation-free sort runs
+     */
+    UCollationResult internalCompare(const char16_t *left, int32_t leftLength,
+                                     const char16_t *right, int32_t rightLength,
+                                     CollationCompareContext &context,
+                                     UErrorCode &errorCode) const;
 #endif  // U_HIDE_INTERNAL_API
 
 protected:
@@ -821,8 +884,10 @@ private:
     void adoptTailoring(CollationTailoring *t, UErrorCode &errorCode);
 
     // Both lengths must be <0 or else both must be >=0.
+    // context can be NULL; if not, its iterators are reused for the comparison.
     UCollationResult doCompare(const char16_t *left, int32_t leftLength,
                                const char16_t *right, int32_t rightLength,
+                               CollationCompareContext *context,
                                UErrorCode &errorCode) const;
     UCollationResult doCompare(const uint8_t *left, int32_t leftLength,
                                const uint8_t *right, int32_t rightLength,
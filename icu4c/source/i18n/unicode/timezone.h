@@ -46,6 +46,7 @@
 U_NAMESPACE_BEGIN
 
 class StringEnumeration;
+class SharedTimeZone;
 
 /**
  *
@@ -849,6 +850,19 @@ protected:
      * @internal
      */
     static UResourceBundle* loadRule(const UResourceBundle* top, const UnicodeString& ruleid, UResourceBundle* oldbundle, UErrorCode&status);
+
+    /**
+     * Returns a shared immutable instance for the given ID from the unified
+     * cache, creating and caching it on first use. Unlike createTimeZone(),
+     * repeated calls for the same ID return the same underlying TimeZone with
+     * no per-call allocation or resource load. The caller must not modify the
+     * zone and must call removeRef() on the returned object when done.
+     * @param ID the time zone ID
+     * @param status Status parameter
+     * @return the shared instance, or NULL on failure
+     * @internal For ICU use only.
+     */
+    static const SharedTimeZone* U_EXPORT2 getFrozen(const UnicodeString& ID, UErrorCode& status);
 #endif  /* U_HIDE_INTERNAL_API */
 
 private:
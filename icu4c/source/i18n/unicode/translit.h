@@ -29,6 +29,7 @@
 
 U_NAMESPACE_BEGIN
 
+class Appendable;
 class UnicodeFilter;
 class UnicodeSet;
 class TransliteratorParser;
@@ -766,6 +767,25 @@ public:
     virtual void finishTransliteration(Replaceable& text,
                                        UTransPosition& index) const;
 
+#ifndef U_HIDE_INTERNAL_API
+    /**
+     * Transliterates an entire read-only string, appending the output
+     * to a sink.  Unlike {@link #transliterate(Replaceable&) const },
+     * which splices each replacement into the text buffer and shifts
+     * the tail of the buffer, this method works through the input in
+     * bounded chunks and appends finished output to the sink, so the
+     * cost is linear in the length of the text.  Intended for bulk
+     * conversion of whole documents.
+     * @param text the text to be transliterated; it is not modified.
+     * @param sink receives the transliterated output.
+     * @param status Output param filled in with success or error status.
+     * @internal
+     */
+    void transliterateTo(const UnicodeString& text,
+                         Appendable& sink,
+                         UErrorCode& status) const;
+#endif  /* U_HIDE_INTERNAL_API */
+
 private:
 
     /**
@@ -706,6 +706,10 @@ private:
     /* Compiled offset patterns generated from fGMTOffsetPatterns[] */
     UVector* fGMTOffsetPatternItems[UTZFMT_PAT_COUNT];
 
+    /* Pre-rendered localized GMT strings for offsets on the quarter-hour
+       grid (short forms, then long forms); NULL when not built */
+    UnicodeString* fGMTOffsetMemo;
+
     UBool fAbuttingOffsetHoursAndMinutes;
 
     /* TZDBTimeZoneNames object used for parsing */
@@ -1038,6 +1042,16 @@ private:
      */
     void checkAbuttingHoursAndMinutes();
 
+    /**
+     * Pre-renders localized GMT format strings for offsets on the
+     * quarter-hour grid, which covers every current time zone offset, so
+     * that formatOffsetLocalizedGMT() becomes a string copy for them.
+     * Must be re-run after any change to the GMT pattern, the offset
+     * patterns, or the offset digits; formatting falls back to pattern
+     * assembly while the memo is absent.
+     */
+    void initGMTOffsetMemo();
+
     /**
      * Creates an instance of TimeZone for the given offset
      * @param offset the offset
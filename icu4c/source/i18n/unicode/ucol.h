@@ -1480,7 +1480,8 @@ ucol_cloneBinary(const UCollator *coll,
  *  @param length size of the image. If negative, the API will try to
  *                figure out the length of the image
  *  @param base Base collator, for lookup of untailored characters.
- *              Must be the root collator, must not be NULL.
+ *              Must be the root collator, or NULL which is equivalent to
+ *              passing the root collator.
  *              The base is required to be present through the lifetime of the collator.
  *  @param status for catching errors
  *  @return newly created collator
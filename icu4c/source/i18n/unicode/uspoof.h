@@ -1493,6 +1493,33 @@ uspoof_getSkeletonUnicodeString(const USpoofChecker *sc,
                                 const icu::UnicodeString &id,
                                 icu::UnicodeString &dest,
                                 UErrorCode *status);
+
+#ifndef U_HIDE_INTERNAL_API
+/**
+ *  Get the skeletons for an array of identifiers in one pass.
+ *  Equivalent to calling uspoof_getSkeletonUnicodeString() once per
+ *  identifier, but the checker is validated once and the internal
+ *  normalization and mapping buffers are reused across identifiers,
+ *  which matters when screening large numbers of short identifiers.
+ *
+ *  Processing stops at the first failure; destination strings past
+ *  that point are left untouched.
+ *
+ * @param sc      The USpoofChecker.
+ * @param ids     The input identifiers whose skeletons will be computed.
+ * @param count   The number of identifiers, which must be &gt;=0.
+ * @param dests   Receives one skeleton string per input identifier.
+ * @param status  The error code, set if an error occurred while attempting to
+ *                perform the check.
+ *
+ * @internal
+ */
+U_INTERNAL void U_EXPORT2
+uspoof_getSkeletonsUnicodeString(const USpoofChecker *sc,
+                                 const icu::UnicodeString *ids, int32_t count,
+                                 icu::UnicodeString *dests,
+                                 UErrorCode *status);
+#endif  /* U_HIDE_INTERNAL_API */
 #endif   /* U_SHOW_CPLUSPLUS_API */
 
 /**
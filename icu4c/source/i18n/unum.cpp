@@ -72,7 +72,7 @@ unum_open(  UNumberFormatStyle    style,
             parseErr = &tErr;
         }
 
-        DecimalFormatSymbols *syms = new DecimalFormatSymbols(Locale(locale), *status);
+        DecimalFormatSymbols *syms = DecimalFormatSymbols::createForLocale(Locale(locale), *status);
         if(syms == NULL) {
             *status = U_MEMORY_ALLOCATION_ERROR;
             return NULL;
@@ -26,13 +26,16 @@
 
 U_NAMESPACE_USE
 
-// don't use Boyer-Moore
+// don't use Boyer-Moore by default
 // (and if we decide to turn this on again there are several new TODOs that will need to be addressed)
+#ifndef BOYER_MOORE
 #define BOYER_MOORE 0
+#endif
 
 // internal definition ---------------------------------------------------
 
 #define LAST_BYTE_MASK_          0xFF
+#define MAX_SHIFT_VALUE_         0x7FFF
 #define SECOND_LAST_BYTE_SHIFT_  8
 #define SUPPLEMENTARY_MIN_VALUE_ 0x10000
 
@@ -348,6 +351,41 @@ inline uint16_t initializePatternCETable(UStringSearch *strsrch,
     return result;
 }
 
+/**
+* Hashes a processed CE into the pattern's pceShift table.
+*/
+static
+inline int32_t hashFromPCE64(int64_t pce)
+{
+    uint32_t hash = (uint32_t)((uint64_t)pce ^ ((uint64_t)pce >> 32));
+    return (int32_t)(hash % MAX_TABLE_SIZE_);
+}
+
+/**
+* Builds the Horspool-style bad-"character" shift table over the pattern's
+* processed CEs, done once per pattern so that scans over large texts can
+* skip ahead at a mismatch instead of re-trying every CE position.
+* Hash collisions keep the smaller shift, which is safe (never skips a
+* possible match), merely less effective.
+* @param pattern pattern whose pces table has just been built
+*/
+static
+inline void initializePceShiftTable(UPattern *pattern)
+{
+    int32_t patternlength = pattern->pcesLength;
+    for (int32_t count = 0; count < MAX_TABLE_SIZE_; count ++) {
+        pattern->pceShift[count] = (int16_t)(patternlength <= MAX_SHIFT_VALUE_ ?
+                                             patternlength : MAX_SHIFT_VALUE_);
+    }
+    for (int32_t count = 0; count < patternlength - 1; count ++) {
+        int32_t hash  = hashFromPCE64(pattern->pces[count]);
+        int32_t shift = patternlength - 1 - count;
+        if (shift < pattern->pceShift[hash]) {
+            pattern->pceShift[hash] = (int16_t)shift;
+        }
+    }
+}
+
 /**
 * Initializing the pce table for a pattern.
 * Stores non-ignorable collation keys.
@@ -422,6 +460,8 @@ inline uint16_t initializePatternPCETable(UStringSearch *strsrch,
     pattern->pces       = pcetable;
     pattern->pcesLength = offset;
 
+    initializePceShiftTable(pattern);
+
     return result;
 }
 
@@ -3937,7 +3977,31 @@ U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
         targetIxOffset += strsrch->pattern.pcesLength; // this is now the offset in target CE space to end of the match so far
 
         if (!found && ((targetCEI == NULL) || (targetCEI->ce != UCOL_PROCESSED_NULLORDER))) {
-            // No match at this targetIx.  Try again at the next.
+            // No match at this targetIx.
+            // With the default element comparison (pure CE equality), skip
+            // ahead by the pattern's precomputed bad-CE shift for the text CE
+            // aligned with the end of the pattern, Horspool-style, instead of
+            // re-trying every CE position. The fuzzy comparison types can
+            // stretch a match, so they keep the one-CE advance.
+            if (strsrch->search->elementComparisonType == 0 &&
+                    strsrch->pattern.pcesLength > 1) {
+                // The compare loop above may have stopped before reaching the
+                // probe position, and CEIBuffer::get() only permits fetching
+                // one CE past the highest index fetched so far. Walk up to
+                // the probe index sequentially.
+                const CEI *alignCEI = NULL;
+                for (int32_t probeIx = targetIx;
+                        probeIx <= targetIx + strsrch->pattern.pcesLength - 1; probeIx++) {
+                    alignCEI = ceb.get(probeIx);
+                    if (alignCEI == NULL || alignCEI->ce == UCOL_PROCESSED_NULLORDER) {
+                        break;
+                    }
+                }
+                if (alignCEI != NULL && alignCEI->ce != UCOL_PROCESSED_NULLORDER) {
+                    // -1 because the loop increment adds one.
+                    targetIx += strsrch->pattern.pceShift[hashFromPCE64(alignCEI->ce)] - 1;
+                }
+            }
             continue;
         }
 
@@ -695,6 +695,43 @@ uspoof_getSkeleton(const USpoofChecker *sc,
 
 
 
+// Skeleton computation core, with caller-provided scratch strings so
+// that batch callers can reuse their capacity across identifiers.
+static void getSkeletonImpl(const SpoofImpl *This,
+                            const UnicodeString &id,
+                            UnicodeString &dest,
+                            UnicodeString &nfdId,
+                            UnicodeString &skelStr,
+                            UErrorCode *status) {
+    // Most identifiers are already NFD; skip the normalization copy then.
+    const UnicodeString *nfd;
+    if (gNfdNormalizer->isNormalized(id, *status)) {
+        nfd = &id;
+    } else {
+        gNfdNormalizer->normalize(id, nfdId, *status);
+        nfd = &nfdId;
+    }
+    if (U_FAILURE(*status)) {
+        return;
+    }
+
+    // Apply the skeleton mapping to the NFD normalized input string
+    // Accumulate the skeleton, possibly unnormalized, in a UnicodeString.
+    skelStr.remove();
+    int32_t normalizedLen = nfd->length();
+    for (int32_t inputIndex=0; inputIndex < normalizedLen; ) {
+        UChar32 c = nfd->char32At(inputIndex);
+        inputIndex += U16_LENGTH(c);
+        This->fSpoofData->confusableLookup(c, skelStr);
+    }
+
+    if (gNfdNormalizer->isNormalized(skelStr, *status)) {
+        dest = skelStr;     // copy-on-write, no character copy
+    } else {
+        gNfdNormalizer->normalize(skelStr, dest, *status);
+    }
+}
+
 U_I18N_API UnicodeString &  U_EXPORT2
 uspoof_getSkeletonUnicodeString(const USpoofChecker *sc,
                                 uint32_t /*type*/,
@@ -707,21 +744,32 @@ uspoof_getSkeletonUnicodeString(const USpoofChecker *sc,
     }
 
     UnicodeString nfdId;
-    gNfdNormalizer->normalize(id, nfdId, *status);
-
-    // Apply the skeleton mapping to the NFD normalized input string
-    // Accumulate the skeleton, possibly unnormalized, in a UnicodeString.
-    int32_t inputIndex = 0;
     UnicodeString skelStr;
-    int32_t normalizedLen = nfdId.length();
-    for (inputIndex=0; inputIndex < normalizedLen; ) {
-        UChar32 c = nfdId.char32At(inputIndex);
-        inputIndex += U16_LENGTH(c);
-        This->fSpoofData->confusableLookup(c, skelStr);
+    getSkeletonImpl(This, id, dest, nfdId, skelStr, status);
+    return dest;
+}
+
+U_CAPI void U_EXPORT2
+uspoof_getSkeletonsUnicodeString(const USpoofChecker *sc,
+                                 const UnicodeString *ids, int32_t count,
+                                 UnicodeString *dests,
+                                 UErrorCode *status) {
+    const SpoofImpl *This = SpoofImpl::validateThis(sc, *status);
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    if (count < 0 || (count > 0 && (ids == NULL || dests == NULL))) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
     }
 
-    gNfdNormalizer->normalize(skelStr, dest, *status);
-    return dest;
+    // The scratch strings keep their capacity from one identifier to
+    // the next, so in steady state no allocation occurs per identifier.
+    UnicodeString nfdId;
+    UnicodeString skelStr;
+    for (int32_t i = 0; i < count && U_SUCCESS(*status); ++i) {
+        getSkeletonImpl(This, ids[i], dests[i], nfdId, skelStr, status);
+    }
 }
 
 
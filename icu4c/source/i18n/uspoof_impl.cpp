@@ -16,6 +16,7 @@
 #include "cmemory.h"
 #include "cstring.h"
 #include "scriptset.h"
+#include "uprops.h"
 #include "umutex.h"
 #include "udataswp.h"
 #include "uassert.h"
@@ -278,12 +279,21 @@ void SpoofImpl::getResolvedScriptSetWithout(const UnicodeString& input, UScriptC
 
     ScriptSet temp;
     UChar32 codePoint;
+    // Script_Extensions data word of the previous character. Characters with
+    // the same word have identical augmented script sets, and real text is
+    // mostly runs of same-script characters, so decode the extension list
+    // once per run instead of once per character.
+    uint32_t lastScriptX = 0xffffffff;
     for (int32_t i = 0; i < input.length(); i += U16_LENGTH(codePoint)) {
         codePoint = input.char32At(i);
 
-        // Compute the augmented script set for the character
-        getAugmentedScriptSet(codePoint, temp, status);
-        if (U_FAILURE(status)) { return; }
+        uint32_t scriptX = u_getUnicodeProperties(codePoint, 0) & UPROPS_SCRIPT_X_MASK;
+        if (scriptX != lastScriptX) {
+            // Compute the augmented script set for the character
+            getAugmentedScriptSet(codePoint, temp, status);
+            if (U_FAILURE(status)) { return; }
+            lastScriptX = scriptX;
+        }
 
         // Intersect the augmented script set with the resolved script set, but only if the character doesn't
         // have the script specified in the function call
@@ -163,6 +163,11 @@ struct UPattern {
           int16_t             defaultShiftSize;
           int16_t             shift[MAX_TABLE_SIZE_];
           int16_t             backShift[MAX_TABLE_SIZE_];
+          // Bad-"character" shift table over the processed CEs, for the
+          // Horspool-style skip in the forward exact search.
+          // Indexed by a hash of the CE; collisions keep the smaller
+          // (conservative) shift. See initializePceShiftTable() in usearch.cpp.
+          int16_t             pceShift[MAX_TABLE_SIZE_];
 };
 
 struct UStringSearch {
@@ -54,6 +54,13 @@ public:
         limit = lim;
     }
 
+    void setText(const UChar *s, const UChar *p, const UChar *lim) {
+        reset();
+        start = s;
+        pos = p;
+        limit = lim;
+    }
+
     virtual UChar32 nextCodePoint(UErrorCode &errorCode);
 
     virtual UChar32 previousCodePoint(UErrorCode &errorCode);
@@ -95,6 +102,15 @@ public:
 
     virtual ~FCDUTF16CollationIterator();
 
+    void setText(const UChar *s, const UChar *p, const UChar *lim) {
+        UTF16CollationIterator::setText(s, p, lim);
+        rawStart = s;
+        segmentStart = p;
+        segmentLimit = NULL;
+        rawLimit = lim;
+        checkDir = 1;
+    }
+
     virtual UBool operator==(const CollationIterator &other) const;
 
     virtual void resetToOffset(int32_t newOffset);
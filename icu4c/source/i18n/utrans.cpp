@@ -368,7 +368,8 @@ static const UEnumeration utransEnumeration={
     utrans_enum_count,
     utrans_enum_unext,
     uenum_nextDefault,
-    utrans_enum_reset
+    utrans_enum_reset,
+    NULL  /* drain */
 };
 
 U_CAPI UEnumeration * U_EXPORT2
@@ -16,7 +16,8 @@
 *   created by: George Rhoten
 */
 
-#include "mutex.h"
+#include <atomic>
+
 #include "ucln.h"
 #include "ucln_io.h"
 #include "uassert.h"
@@ -33,7 +34,8 @@
 /* Leave this copyright notice here! It needs to go somewhere in this library. */
 static const char copyright[] = U_COPYRIGHT_STRING;
 
-static cleanupFunc *gCleanupFunctions[UCLN_IO_COUNT];
+/* Atomic so that registration does not need the global mutex; see ucln_cmn.cpp. */
+static std::atomic<cleanupFunc *> gCleanupFunctions[UCLN_IO_COUNT];
 
 static UBool U_CALLCONV io_cleanup(void)
 {
@@ -41,10 +43,10 @@ static UBool U_CALLCONV io_cleanup(void)
 
     (void)copyright;  // Suppress unused variable warning.
     while (++libType<UCLN_IO_COUNT) {
-        if (gCleanupFunctions[libType])
+        cleanupFunc *func = gCleanupFunctions[libType].exchange(NULL, std::memory_order_acquire);
+        if (func != NULL)
         {
-            gCleanupFunctions[libType]();
-            gCleanupFunctions[libType] = NULL;
+            func();
         }
     }
 #if !UCLN_NO_AUTO_CLEANUP && (defined(UCLN_AUTO_ATEXIT) || defined(UCLN_AUTO_LOCAL))
@@ -56,12 +58,9 @@ static UBool U_CALLCONV io_cleanup(void)
 void ucln_io_registerCleanup(ECleanupIOType type,
                                cleanupFunc *func) {
     U_ASSERT(UCLN_IO_START < type && type < UCLN_IO_COUNT);
-    {
-        icu::Mutex m;       // See ticket 10295 for discussion.
-        ucln_registerCleanup(UCLN_IO, io_cleanup);
-        if (UCLN_IO_START < type && type < UCLN_IO_COUNT) {
-            gCleanupFunctions[type] = func;
-        }
+    ucln_registerCleanup(UCLN_IO, io_cleanup);
+    if (UCLN_IO_START < type && type < UCLN_IO_COUNT) {
+        gCleanupFunctions[type].store(func, std::memory_order_release);
     }
 
 #if !UCLN_NO_AUTO_CLEANUP && (defined(UCLN_AUTO_ATEXIT) || defined(UCLN_AUTO_LOCAL))
@@ -29,6 +29,7 @@ typedef enum ECleanupIOType {
     UCLN_IO_START = -1,
     UCLN_IO_LOCBUND,
     UCLN_IO_PRINTF,
+    UCLN_IO_PRINTF_SPEC,
     UCLN_IO_COUNT /* This must be last */
 } ECleanupIOType;
 
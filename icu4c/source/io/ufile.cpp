@@ -90,6 +90,8 @@ finit_owner(FILE         *f,
 
     if(U_SUCCESS(status)) {
         result->fOwnFile = takeOwnership;
+        result->fUTF8Writes = (UBool)(result->fConverter != NULL &&
+                ucnv_getType(result->fConverter) == UCNV_UTF8);
     }
     else {
 #if !UCONFIG_NO_FORMATTING
@@ -320,6 +322,8 @@ u_fsetcodepage(    const char    *codepage,
     if ((file->str.fPos == file->str.fBuffer) && (file->str.fLimit == file->str.fBuffer)) {
         ucnv_close(file->fConverter);
         file->fConverter = ucnv_open(codepage, &status);
+        file->fUTF8Writes = (UBool)(U_SUCCESS(status) && file->fConverter != NULL &&
+                ucnv_getType(file->fConverter) == UCNV_UTF8);
         if(U_SUCCESS(status)) {
             retVal = 0;
         }
@@ -331,6 +335,9 @@ u_fsetcodepage(    const char    *codepage,
 U_CAPI UConverter * U_EXPORT2 /* U_CAPI ... U_EXPORT2 added by Peter Kirk 17 Nov 2001 */
 u_fgetConverter(UFILE *file)
 {
+    /* The caller may change the converter's behavior, for example its
+       callbacks, so writes must go through it from now on. */
+    file->fUTF8Writes = FALSE;
     return file->fConverter;
 }
 #if !UCONFIG_NO_FORMATTING
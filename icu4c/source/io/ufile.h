@@ -34,8 +34,11 @@
 /* The buffer size for fromUnicode calls */
 #define UFILE_CHARBUFFER_SIZE 1024
 
+/* Conversion batch size for large writes; see u_file_write_flush. */
+#define UFILE_WRITEBUFFER_SIZE 65536
+
 /* The buffer size for toUnicode calls */
-#define UFILE_UCHARBUFFER_SIZE 1024
+#define UFILE_UCHARBUFFER_SIZE 4096
 
 /* A UFILE */
 
@@ -76,6 +79,9 @@ struct UFILE {
 
     UBool       fOwnFile;       /* TRUE if fFile should be closed */
 
+    UBool       fUTF8Writes;    /* TRUE if the converter is UTF-8 and writes
+                                   may convert directly, bypassing it */
+
     int32_t     fFileno;        /* File number. Useful to determine if it's stdin. */
 };
 
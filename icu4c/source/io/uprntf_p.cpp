@@ -28,7 +28,12 @@
 #include "uprintf.h"
 #include "ufmt_cmn.h"
 #include "cmemory.h"
+#include "mutex.h"
 #include "putilimp.h"
+#include "uassert.h"
+#include "ucln_io.h"
+#include "uhash.h"
+#include "umutex.h"
 
 /* ANSI style formatting */
 /* Use US-ASCII characters only for formatting */
@@ -1217,267 +1222,489 @@ static ufmt_args* parseArguments(const UChar *alias, va_list ap, UErrorCode *sta
     return arglist;
 }
 
-/* We parse the argument list in Unicode */
-U_CFUNC int32_t
-u_printf_parse(const u_printf_stream_handler *streamHandler,
-               const UChar     *fmt,
-               void            *context,
-               u_localized_print_string *locStringContext,
-               ULocaleBundle   *formatBundle,
-               int32_t         *written,
-               va_list         ap)
+/* Parses a single format specification, from the initial '%' through the
+ * conversion letter. Consumes no arguments and performs no output, so the
+ * result can be cached and replayed. Returns the position just past the
+ * specification. */
+static const UChar *
+u_printf_parse_spec(const UChar *alias,
+                    u_printf_spec *spec)
 {
-    uint16_t         handlerNum;
-    ufmt_args        args;
-    ufmt_type_info   argType;
-    u_printf_handler *handler;
-    u_printf_spec    spec;
-    u_printf_spec_info *info = &(spec.fInfo);
-
-    const UChar *alias = fmt;
     const UChar *backup;
-    const UChar *lastAlias;
-    const UChar *orgAlias = fmt;
-    /* parsed argument list */
-    ufmt_args *arglist = NULL; /* initialized it to avoid compiler warnings */
-    UErrorCode status = U_ZERO_ERROR;
-    if (!locStringContext || locStringContext->available >= 0) {
-        /* get the parsed list of argument types */
-        arglist = parseArguments(orgAlias, ap, &status);
+    u_printf_spec_info *info = &(spec->fInfo);
 
-        /* Return error if parsing failed. */
-        if (U_FAILURE(status)) {
-            return -1;
-        }
-    }
-    
-    /* iterate through the pattern */
-    while(!locStringContext || locStringContext->available >= 0) {
+    /* initialize spec to default values */
+    spec->fWidthPos     = -1;
+    spec->fPrecisionPos = -1;
+    spec->fArgPos       = -1;
 
-        /* find the next '%' */
-        lastAlias = alias;
-        while(*alias != UP_PERCENT && *alias != 0x0000) {
-            alias++;
+    uprv_memset(info, 0, sizeof(*info));
+    info->fPrecision    = -1;
+    info->fWidth        = -1;
+    info->fPadChar      = 0x0020;
+
+    /* skip over the initial '%' */
+    alias++;
+
+    /* Check for positional argument */
+    if(ISDIGIT(*alias)) {
+
+        /* Save the current position */
+        backup = alias;
+
+        /* handle positional parameters */
+        if(ISDIGIT(*alias)) {
+            spec->fArgPos = (int) (*alias++ - DIGIT_ZERO);
+
+            while(ISDIGIT(*alias)) {
+                spec->fArgPos *= 10;
+                spec->fArgPos += (int) (*alias++ - DIGIT_ZERO);
+            }
         }
 
-        /* write any characters before the '%' */
-        if(alias > lastAlias) {
-            *written += (streamHandler->write)(context, lastAlias, (int32_t)(alias - lastAlias));
+        /* if there is no '$', don't read anything */
+        if(*alias != SPEC_DOLLARSIGN) {
+            spec->fArgPos = -1;
+            alias = backup;
         }
+        /* munge the '$' */
+        else
+            alias++;
+    }
 
-        /* break if at end of string */
-        if(*alias == 0x0000) {
+    /* Get any format flags */
+    while(ISFLAG(*alias)) {
+        switch(*alias++) {
+
+            /* left justify */
+        case FLAG_MINUS:
+            info->fLeft = TRUE;
             break;
-        }
 
-        /* initialize spec to default values */
-        spec.fWidthPos     = -1;
-        spec.fPrecisionPos = -1;
-        spec.fArgPos       = -1;
+            /* always show sign */
+        case FLAG_PLUS:
+            info->fShowSign = TRUE;
+            break;
 
-        uprv_memset(info, 0, sizeof(*info));
-        info->fPrecision    = -1;
-        info->fWidth        = -1;
-        info->fPadChar      = 0x0020;
+            /* use space if no sign present */
+        case FLAG_SPACE:
+            info->fShowSign = TRUE;
+            info->fSpace = TRUE;
+            break;
 
-        /* skip over the initial '%' */
-        alias++;
+            /* use alternate form */
+        case FLAG_POUND:
+            info->fAlt = TRUE;
+            break;
 
-        /* Check for positional argument */
-        if(ISDIGIT(*alias)) {
+            /* pad with leading zeroes */
+        case FLAG_ZERO:
+            info->fZero = TRUE;
+            info->fPadChar = 0x0030;
+            break;
 
-            /* Save the current position */
-            backup = alias;
+            /* pad character specified */
+        case FLAG_PAREN:
 
-            /* handle positional parameters */
-            if(ISDIGIT(*alias)) {
-                spec.fArgPos = (int) (*alias++ - DIGIT_ZERO);
+            /* TODO test that all four are numbers */
+            /* first four characters are hex values for pad char */
+            info->fPadChar = (UChar)ufmt_digitvalue(*alias++);
+            info->fPadChar = (UChar)((info->fPadChar * 16) + ufmt_digitvalue(*alias++));
+            info->fPadChar = (UChar)((info->fPadChar * 16) + ufmt_digitvalue(*alias++));
+            info->fPadChar = (UChar)((info->fPadChar * 16) + ufmt_digitvalue(*alias++));
 
-                while(ISDIGIT(*alias)) {
-                    spec.fArgPos *= 10;
-                    spec.fArgPos += (int) (*alias++ - DIGIT_ZERO);
-                }
-            }
+            /* final character is ignored */
+            alias++;
 
-            /* if there is no '$', don't read anything */
-            if(*alias != SPEC_DOLLARSIGN) {
-                spec.fArgPos = -1;
-                alias = backup;
-            }
-            /* munge the '$' */
-            else
-                alias++;
+            break;
         }
+    }
 
-        /* Get any format flags */
-        while(ISFLAG(*alias)) {
-            switch(*alias++) {
-
-                /* left justify */
-            case FLAG_MINUS:
-                info->fLeft = TRUE;
-                break;
+    /* Get the width */
 
-                /* always show sign */
-            case FLAG_PLUS:
-                info->fShowSign = TRUE;
-                break;
+    /* width is specified out of line */
+    if(*alias == SPEC_ASTERISK) {
 
-                /* use space if no sign present */
-            case FLAG_SPACE:
-                info->fShowSign = TRUE;
-                info->fSpace = TRUE;
-                break;
+        info->fWidth = -2;
 
-                /* use alternate form */
-            case FLAG_POUND:
-                info->fAlt = TRUE;
-                break;
+        /* Skip the '*' */
+        alias++;
 
-                /* pad with leading zeroes */
-            case FLAG_ZERO:
-                info->fZero = TRUE;
-                info->fPadChar = 0x0030;
-                break;
+        /* Save the current position */
+        backup = alias;
 
-                /* pad character specified */
-            case FLAG_PAREN:
+        /* handle positional parameters */
+        if(ISDIGIT(*alias)) {
+            spec->fWidthPos = (int) (*alias++ - DIGIT_ZERO);
 
-                /* TODO test that all four are numbers */
-                /* first four characters are hex values for pad char */
-                info->fPadChar = (UChar)ufmt_digitvalue(*alias++);
-                info->fPadChar = (UChar)((info->fPadChar * 16) + ufmt_digitvalue(*alias++));
-                info->fPadChar = (UChar)((info->fPadChar * 16) + ufmt_digitvalue(*alias++));
-                info->fPadChar = (UChar)((info->fPadChar * 16) + ufmt_digitvalue(*alias++));
+            while(ISDIGIT(*alias)) {
+                spec->fWidthPos *= 10;
+                spec->fWidthPos += (int) (*alias++ - DIGIT_ZERO);
+            }
+        }
 
-                /* final character is ignored */
-                alias++;
+        /* if there is no '$', don't read anything */
+        if(*alias != SPEC_DOLLARSIGN) {
+            spec->fWidthPos = -1;
+            alias = backup;
+        }
+        /* munge the '$' */
+        else
+            alias++;
+    }
+    /* read the width, if present */
+    else if(ISDIGIT(*alias)){
+        info->fWidth = (int) (*alias++ - DIGIT_ZERO);
 
-                break;
-            }
+        while(ISDIGIT(*alias)) {
+            info->fWidth *= 10;
+            info->fWidth += (int) (*alias++ - DIGIT_ZERO);
         }
+    }
+
+    /* Get the precision */
 
-        /* Get the width */
+    if(*alias == SPEC_PERIOD) {
+
+        /* eat up the '.' */
+        alias++;
 
-        /* width is specified out of line */
+        /* precision is specified out of line */
         if(*alias == SPEC_ASTERISK) {
 
-            info->fWidth = -2;
+            info->fPrecision = -2;
 
             /* Skip the '*' */
             alias++;
 
-            /* Save the current position */
+            /* save the current position */
             backup = alias;
 
             /* handle positional parameters */
             if(ISDIGIT(*alias)) {
-                spec.fWidthPos = (int) (*alias++ - DIGIT_ZERO);
+                spec->fPrecisionPos = (int) (*alias++ - DIGIT_ZERO);
 
                 while(ISDIGIT(*alias)) {
-                    spec.fWidthPos *= 10;
-                    spec.fWidthPos += (int) (*alias++ - DIGIT_ZERO);
+                    spec->fPrecisionPos *= 10;
+                    spec->fPrecisionPos += (int) (*alias++ - DIGIT_ZERO);
                 }
-            }
 
-            /* if there is no '$', don't read anything */
-            if(*alias != SPEC_DOLLARSIGN) {
-                spec.fWidthPos = -1;
-                alias = backup;
+                /* if there is no '$', don't read anything */
+                if(*alias != SPEC_DOLLARSIGN) {
+                    spec->fPrecisionPos = -1;
+                    alias = backup;
+                }
+                else {
+                    /* munge the '$' */
+                    alias++;
+                }
             }
-            /* munge the '$' */
-            else
-                alias++;
         }
-        /* read the width, if present */
+        /* read the precision */
         else if(ISDIGIT(*alias)){
-            info->fWidth = (int) (*alias++ - DIGIT_ZERO);
+            info->fPrecision = (int) (*alias++ - DIGIT_ZERO);
 
             while(ISDIGIT(*alias)) {
-                info->fWidth *= 10;
-                info->fWidth += (int) (*alias++ - DIGIT_ZERO);
+                info->fPrecision *= 10;
+                info->fPrecision += (int) (*alias++ - DIGIT_ZERO);
             }
         }
+    }
 
-        /* Get the precision */
+    /* Get any modifiers */
+    if(ISMOD(*alias)) {
+        switch(*alias++) {
 
-        if(*alias == SPEC_PERIOD) {
+            /* short */
+        case MOD_H:
+            info->fIsShort = TRUE;
+            break;
 
-            /* eat up the '.' */
-            alias++;
+            /* long or long long */
+        case MOD_LOWERL:
+            if(*alias == MOD_LOWERL) {
+                info->fIsLongLong = TRUE;
+                /* skip over the next 'l' */
+                alias++;
+            }
+            else
+                info->fIsLong = TRUE;
+            break;
 
-            /* precision is specified out of line */
-            if(*alias == SPEC_ASTERISK) {
+            /* long double */
+        case MOD_L:
+            info->fIsLongDouble = TRUE;
+            break;
+        }
+    }
 
-                info->fPrecision = -2;
+    /* finally, get the specifier letter */
+    info->fSpec = *alias++;
+    info->fOrigSpec = info->fSpec;
 
-                /* Skip the '*' */
-                alias++;
+    return alias;
+}
 
-                /* save the current position */
-                backup = alias;
 
-                /* handle positional parameters */
-                if(ISDIGIT(*alias)) {
-                    spec.fPrecisionPos = (int) (*alias++ - DIGIT_ZERO);
+/* Number of format strings retained in the compiled-format cache. The cache
+ * exists for applications that emit many lines with a handful of formats;
+ * once it is full, additional formats simply take the parsing path. */
+#define UPRINTF_COMPILED_CACHE_CAPACITY 64
 
-                    while(ISDIGIT(*alias)) {
-                        spec.fPrecisionPos *= 10;
-                        spec.fPrecisionPos += (int) (*alias++ - DIGIT_ZERO);
-                    }
+/* Limits on what gets compiled. Formats with more specifications or more
+ * text than this are rare enough that reparsing them is acceptable. */
+#define UPRINTF_COMPILED_MAX_SPECS 16
+#define UPRINTF_COMPILED_MAX_FMT_LENGTH 256
 
-                    /* if there is no '$', don't read anything */
-                    if(*alias != SPEC_DOLLARSIGN) {
-                        spec.fPrecisionPos = -1;
-                        alias = backup;
-                    }
-                    else {
-                        /* munge the '$' */
-                        alias++;
-                    }
-                }
-            }
-            /* read the precision */
-            else if(ISDIGIT(*alias)){
-                info->fPrecision = (int) (*alias++ - DIGIT_ZERO);
+/**
+ * A single precompiled format specification: the parsed spec plus the
+ * literal text run that precedes it in the format string.
+ */
+typedef struct u_printf_compiled_spec {
+    u_printf_spec fSpec;       /* fully parsed specification */
+    int32_t fTextOffset;       /* literal text run preceding this spec */
+    int32_t fTextLength;
+    int32_t fSpecOffset;       /* offset of the '%' */
+    int32_t fSpecLength;       /* length of the spec, including the '%' */
+} u_printf_compiled_spec;
 
-                while(ISDIGIT(*alias)) {
-                    info->fPrecision *= 10;
-                    info->fPrecision += (int) (*alias++ - DIGIT_ZERO);
-                }
+/**
+ * A precompiled format string: the spec sequence plus an owned copy of the
+ * format text. Entries are immutable once inserted into the cache and live
+ * until library cleanup, so callers may hold the pointer without locking.
+ */
+typedef struct u_printf_compiled_format {
+    UChar *fFormat;            /* owned copy of the format string */
+    int32_t fFormatLength;
+    int32_t fTailOffset;       /* literal text following the last spec */
+    int32_t fTailLength;
+    int32_t fSpecCount;
+    u_printf_compiled_spec fSpecs[UPRINTF_COMPILED_MAX_SPECS];
+} u_printf_compiled_format;
+
+static UHashtable *gCompiledFormats = NULL;
+static icu::UMutex gCompiledFormatsLock = U_MUTEX_INITIALIZER;
+static icu::UInitOnce gCompiledFormatsInitOnce = U_INITONCE_INITIALIZER;
+
+static void U_CALLCONV
+compiled_format_deleter(void *obj)
+{
+    u_printf_compiled_format *compiled = (u_printf_compiled_format *)obj;
+    uprv_free(compiled->fFormat);
+    uprv_free(compiled);
+}
+
+static UBool U_CALLCONV
+uprintf_compiled_cleanup(void)
+{
+    if (gCompiledFormats != NULL) {
+        uhash_close(gCompiledFormats);
+        gCompiledFormats = NULL;
+    }
+    gCompiledFormatsInitOnce.reset();
+    return TRUE;
+}
+
+static void U_CALLCONV
+compiled_formats_init()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    U_ASSERT(gCompiledFormats == NULL);
+    gCompiledFormats = uhash_open(uhash_hashUChars, uhash_compareUChars, NULL, &status);
+    if (U_FAILURE(status)) {
+        gCompiledFormats = NULL;
+        return;
+    }
+    /* Keys are the fFormat members of the values; the value deleter frees both. */
+    uhash_setValueDeleter(gCompiledFormats, compiled_format_deleter);
+    ucln_io_registerCleanup(UCLN_IO_PRINTF_SPEC, &uprintf_compiled_cleanup);
+}
+
+/* Compiles a format string into its spec sequence, or returns NULL if the
+ * format is too large, malformed, or memory is unavailable; such formats
+ * take the regular parsing path. */
+static u_printf_compiled_format *
+u_printf_compile_format(const UChar *fmt)
+{
+    const UChar *alias = fmt;
+    const UChar *lastAlias;
+    u_printf_compiled_format *compiled;
+    u_printf_compiled_spec *compiledSpec;
+    int32_t len = u_strlen(fmt);
+
+    if (len > UPRINTF_COMPILED_MAX_FMT_LENGTH) {
+        return NULL;
+    }
+    compiled = (u_printf_compiled_format *)uprv_malloc(sizeof(u_printf_compiled_format));
+    if (compiled == NULL) {
+        return NULL;
+    }
+    compiled->fFormat = (UChar *)uprv_malloc((len + 1) * sizeof(UChar));
+    if (compiled->fFormat == NULL) {
+        uprv_free(compiled);
+        return NULL;
+    }
+    u_strcpy(compiled->fFormat, fmt);
+    compiled->fFormatLength = len;
+    compiled->fSpecCount = 0;
+
+    for (;;) {
+        /* find the next '%' */
+        lastAlias = alias;
+        while(*alias != UP_PERCENT && *alias != 0x0000) {
+            alias++;
+        }
+        if (*alias == 0x0000) {
+            compiled->fTailOffset = (int32_t)(lastAlias - fmt);
+            compiled->fTailLength = (int32_t)(alias - lastAlias);
+            break;
+        }
+        if (compiled->fSpecCount == UPRINTF_COMPILED_MAX_SPECS) {
+            compiled_format_deleter(compiled);
+            return NULL;
+        }
+        compiledSpec = &compiled->fSpecs[compiled->fSpecCount++];
+        compiledSpec->fTextOffset = (int32_t)(lastAlias - fmt);
+        compiledSpec->fTextLength = (int32_t)(alias - lastAlias);
+        compiledSpec->fSpecOffset = (int32_t)(alias - fmt);
+        alias = u_printf_parse_spec(alias, &compiledSpec->fSpec);
+        compiledSpec->fSpecLength = (int32_t)(alias - fmt) - compiledSpec->fSpecOffset;
+        if (compiledSpec->fSpec.fInfo.fSpec == 0x0000) {
+            /* a trailing '%'; leave this malformed format to the parser */
+            compiled_format_deleter(compiled);
+            return NULL;
+        }
+    }
+    return compiled;
+}
+
+/* Returns the compiled form of fmt, compiling and caching it on first use,
+ * or NULL if the format is not cacheable. */
+static const u_printf_compiled_format *
+u_printf_get_compiled_format(const UChar *fmt)
+{
+    const u_printf_compiled_format *result = NULL;
+    u_printf_compiled_format *compiled;
+
+    umtx_initOnce(gCompiledFormatsInitOnce, &compiled_formats_init);
+    if (gCompiledFormats == NULL) {
+        return NULL;
+    }
+    {
+        icu::Mutex lock(&gCompiledFormatsLock);
+        result = (const u_printf_compiled_format *)uhash_get(gCompiledFormats, fmt);
+    }
+    if (result != NULL) {
+        return result;
+    }
+    compiled = u_printf_compile_format(fmt);
+    if (compiled == NULL) {
+        return NULL;
+    }
+    {
+        icu::Mutex lock(&gCompiledFormatsLock);
+        UErrorCode status = U_ZERO_ERROR;
+        /* If there is a race condition, favor the entry already in the cache. */
+        result = (const u_printf_compiled_format *)uhash_get(gCompiledFormats, compiled->fFormat);
+        if (result != NULL || uhash_count(gCompiledFormats) >= UPRINTF_COMPILED_CACHE_CAPACITY) {
+            compiled_format_deleter(compiled);
+        } else {
+            uhash_put(gCompiledFormats, compiled->fFormat, compiled, &status);
+            /* On failure uhash_put has already freed compiled via the value deleter. */
+            if (U_SUCCESS(status)) {
+                result = compiled;
             }
         }
+    }
+    return result;
+}
 
-        /* Get any modifiers */
-        if(ISMOD(*alias)) {
-            switch(*alias++) {
+/* We parse the argument list in Unicode */
+U_CFUNC int32_t
+u_printf_parse(const u_printf_stream_handler *streamHandler,
+               const UChar     *fmt,
+               void            *context,
+               u_localized_print_string *locStringContext,
+               ULocaleBundle   *formatBundle,
+               int32_t         *written,
+               va_list         ap)
+{
+    uint16_t         handlerNum;
+    ufmt_args        args;
+    ufmt_type_info   argType;
+    u_printf_handler *handler;
+    u_printf_spec    spec;
+    u_printf_spec_info *info = &(spec.fInfo);
 
-                /* short */
-            case MOD_H:
-                info->fIsShort = TRUE;
-                break;
+    const UChar *alias = fmt;
+    const UChar *lastAlias;
+    const UChar *orgAlias = fmt;
+    const u_printf_compiled_format *compiled = NULL;
+    int32_t specIndex = 0;
+    /* parsed argument list */
+    ufmt_args *arglist = NULL; /* initialized it to avoid compiler warnings */
+    UErrorCode status = U_ZERO_ERROR;
+    if (!locStringContext || locStringContext->available >= 0) {
+        /* get the parsed list of argument types */
+        arglist = parseArguments(orgAlias, ap, &status);
 
-                /* long or long long */
-            case MOD_LOWERL:
-                if(*alias == MOD_LOWERL) {
-                    info->fIsLongLong = TRUE;
-                    /* skip over the next 'l' */
-                    alias++;
+        /* Return error if parsing failed. */
+        if (U_FAILURE(status)) {
+            return -1;
+        }
+    }
+
+    if (locStringContext == NULL) {
+        /* Repeated formats are common; replay the cached spec sequence when
+           one is available instead of reparsing the format string. */
+        compiled = u_printf_get_compiled_format(fmt);
+    }
+    
+    /* iterate through the pattern */
+    while(!locStringContext || locStringContext->available >= 0) {
+
+        if (compiled != NULL) {
+            /* take the next precompiled spec; argument fetching and handler
+               dispatch below are shared with the parsing path */
+            const u_printf_compiled_spec *compiledSpec;
+            if (specIndex == compiled->fSpecCount) {
+                /* write any literal text following the last spec */
+                if (compiled->fTailLength > 0) {
+                    *written += (streamHandler->write)(context, fmt + compiled->fTailOffset, compiled->fTailLength);
                 }
-                else
-                    info->fIsLong = TRUE;
+                alias = fmt + compiled->fFormatLength;
                 break;
+            }
+            compiledSpec = &compiled->fSpecs[specIndex++];
 
-                /* long double */
-            case MOD_L:
-                info->fIsLongDouble = TRUE;
-                break;
+            /* write any characters before the '%' */
+            if (compiledSpec->fTextLength > 0) {
+                *written += (streamHandler->write)(context, fmt + compiledSpec->fTextOffset, compiledSpec->fTextLength);
             }
+            spec = compiledSpec->fSpec;
+            lastAlias = fmt + compiledSpec->fSpecOffset;
+            alias = lastAlias + compiledSpec->fSpecLength;
+        } else {
+
+        /* find the next '%' */
+        lastAlias = alias;
+        while(*alias != UP_PERCENT && *alias != 0x0000) {
+            alias++;
+        }
+
+        /* write any characters before the '%' */
+        if(alias > lastAlias) {
+            *written += (streamHandler->write)(context, lastAlias, (int32_t)(alias - lastAlias));
         }
 
-        /* finally, get the specifier letter */
-        info->fSpec = *alias++;
-        info->fOrigSpec = info->fSpec;
+        /* break if at end of string */
+        if(*alias == 0x0000) {
+            break;
+        }
+
+        alias = u_printf_parse_spec(alias, &spec);
+
+        }
 
         /* fill in the precision and width, if specified out of line */
 
@@ -60,6 +60,29 @@ static const uint32_t DELIMITERS_LEN = 1;
 #define IS_COMBINED_STRING_DELIMITER(c1, c2) \
  (UBool)((c1) == DELIM_CR && (c2) == DELIM_LF)
 
+/* Word-at-a-time helpers for the u_fgets copy loop. */
+
+/* Nonzero if any 16-bit lane of w is zero. */
+static inline uint64_t
+hasZeroLane(uint64_t w) {
+    return (w - UINT64_C(0x0001000100010001)) & ~w & UINT64_C(0x8000800080008000);
+}
+
+/* TRUE if none of the four UChars starting at s is a string delimiter, i.e.
+ * the block can be copied without per-character checks. */
+static inline UBool
+isDelimiterFreeBlock(const UChar *s) {
+    uint64_t w, folded, hit;
+    uprv_memcpy(&w, s, 8);  /* four UChars */
+    /* fold the low bit so that each check below covers a delimiter pair */
+    folded = w & ~UINT64_C(0x0001000100010001);
+    hit  = hasZeroLane(folded ^ UINT64_C(0x000A000A000A000A));  /* LF, VT */
+    hit |= hasZeroLane(folded ^ UINT64_C(0x000C000C000C000C));  /* FF, CR */
+    hit |= hasZeroLane(folded ^ UINT64_C(0x2028202820282028));  /* LS, PS */
+    hit |= hasZeroLane(w ^ UINT64_C(0x0085008500850085));       /* NEL */
+    return (UBool)(hit == 0);
+}
+
 
 #if !UCONFIG_NO_TRANSLITERATION
 
@@ -318,8 +341,11 @@ u_file_write_flush(const UChar *chars,
     const UChar *mySource    = chars;
     const UChar *mySourceBegin; 
     const UChar *mySourceEnd;
-    char        charBuffer[UFILE_CHARBUFFER_SIZE];
-    char        *myTarget   = charBuffer;
+    char        stackBuffer[UFILE_CHARBUFFER_SIZE];
+    char        *charBuffer  = stackBuffer;
+    char        *charLimit   = stackBuffer + UFILE_CHARBUFFER_SIZE;
+    char        *heapBuffer  = NULL;
+    char        *myTarget;
     int32_t     written      = 0;
     int32_t     numConverted = 0;
 
@@ -349,6 +375,53 @@ u_file_write_flush(const UChar *chars,
 
     mySourceEnd = mySource + count;
 
+    /* Direct UTF-8 mode: the converter is stateless for UTF-8, so convert
+       with u_strToUTF8WithSub instead of running the converter machinery,
+       substituting U+FFFD like the converter's default callback would. */
+    /* flushIO also flushes converter state, which the direct mode bypasses;
+       let those rare calls take the converter path below. */
+    if (f->fUTF8Writes && !flushIO) {
+        while (mySource < mySourceEnd) {
+            int32_t chunk = (int32_t)(mySourceEnd - mySource);
+            int32_t numBytes = 0;
+            /* UFILE_CHARBUFFER_SIZE/3 UChars always fit after conversion */
+            if (chunk > UFILE_CHARBUFFER_SIZE / 3) {
+                chunk = UFILE_CHARBUFFER_SIZE / 3;
+                /* don't split a surrogate pair between chunks */
+                if (U16_IS_LEAD(mySource[chunk - 1])) {
+                    chunk--;
+                }
+            }
+            status = U_ZERO_ERROR;
+            u_strToUTF8WithSub(stackBuffer, UFILE_CHARBUFFER_SIZE, &numBytes,
+                               mySource, chunk, 0xFFFD, NULL, &status);
+            if (U_FAILURE(status)) {
+                /* should not happen; finish through the converter */
+                break;
+            }
+            if (numBytes > 0) {
+                fwrite(stackBuffer, sizeof(char), numBytes, f->fFile);
+            }
+            mySource += chunk;
+            written += chunk;
+        }
+        if (mySource == mySourceEnd) {
+            return written;
+        }
+    }
+
+    /* For large writes, convert in UFILE_WRITEBUFFER_SIZE batches so that the
+       conversion and the stdio calls run a few times instead of once per KB.
+       If the allocation fails, the stack buffer still works. */
+    if ((int32_t)(mySourceEnd - mySource) > UFILE_CHARBUFFER_SIZE) {
+        heapBuffer = (char*)uprv_malloc(UFILE_WRITEBUFFER_SIZE);
+        if (heapBuffer != NULL) {
+            charBuffer = heapBuffer;
+            charLimit = heapBuffer + UFILE_WRITEBUFFER_SIZE;
+        }
+    }
+    myTarget = charBuffer;
+
     /* Perform the conversion in a loop */
     do {
         mySourceBegin = mySource; /* beginning location for this loop */
@@ -356,7 +429,7 @@ u_file_write_flush(const UChar *chars,
         if(f->fConverter != NULL) { /* We have a valid converter */
             ucnv_fromUnicode(f->fConverter,
                 &myTarget,
-                charBuffer + UFILE_CHARBUFFER_SIZE,
+                charLimit,
                 &mySource,
                 mySourceEnd,
                 NULL,
@@ -364,8 +437,8 @@ u_file_write_flush(const UChar *chars,
                 &status);
         } else { /*weiv: do the invariant conversion */
             int32_t convertChars = (int32_t) (mySourceEnd - mySource); 
-            if (convertChars > UFILE_CHARBUFFER_SIZE) { 
-                convertChars = UFILE_CHARBUFFER_SIZE; 
+            if (convertChars > (int32_t)(charLimit - charBuffer)) { 
+                convertChars = (int32_t)(charLimit - charBuffer); 
                 status = U_BUFFER_OVERFLOW_ERROR; 
             } 
             u_UCharsToChars(mySource, myTarget, convertChars); 
@@ -387,6 +460,10 @@ u_file_write_flush(const UChar *chars,
     }
     while(status == U_BUFFER_OVERFLOW_ERROR);
 
+    if (heapBuffer != NULL) {
+        uprv_free(heapBuffer);
+    }
+
     /* return # of chars written */
     return written;
 }
@@ -413,6 +490,7 @@ ufile_fill_uchar_buffer(UFILE *f)
     int32_t     bytesRead;
     int32_t     availLength;
     int32_t     dataSize;
+    int32_t     requestBytes;
     char        charBuffer[UFILE_CHARBUFFER_SIZE];
     u_localized_string *str;
 
@@ -441,41 +519,59 @@ ufile_fill_uchar_buffer(UFILE *f)
     /* weiv: if converter is NULL, we use invariant converter with charwidth = 1)*/
     maxCPBytes = availLength / (f->fConverter!=NULL?(2*ucnv_getMinCharSize(f->fConverter)):1);
 
-    /* Read in the data to convert */
-    if (f->fFileno == 0) {
-        /* Special case. Read from stdin one line at a time. */
-        char *retStr = fgets(charBuffer, ufmt_min(maxCPBytes, UFILE_CHARBUFFER_SIZE), f->fFile);
-        bytesRead = (int32_t)(retStr ? uprv_strlen(charBuffer) : 0);
-    }
-    else {
-        /* A normal file */
-        bytesRead = (int32_t)fread(charBuffer,
-            sizeof(char),
-            ufmt_min(maxCPBytes, UFILE_CHARBUFFER_SIZE),
-            f->fFile);
-    }
-
-    /* Set up conversion parameters */
-    status      = U_ZERO_ERROR;
-    mySource    = charBuffer;
-    mySourceEnd = charBuffer + bytesRead;
+    /* Read in the data and convert it, looping for normal files: one fread
+       sees at most UFILE_CHARBUFFER_SIZE bytes, so keep going until the
+       UChar buffer is full or the stream is drained. stdin stays
+       line-at-a-time. */
     myTarget    = f->fUCBuffer + dataSize;
     bufferSize  = UFILE_UCHARBUFFER_SIZE;
+    for (;;) {
+        requestBytes = ufmt_min(maxCPBytes, UFILE_CHARBUFFER_SIZE);
+        if (f->fFileno == 0) {
+            /* Special case. Read from stdin one line at a time. */
+            char *retStr = fgets(charBuffer, requestBytes, f->fFile);
+            bytesRead = (int32_t)(retStr ? uprv_strlen(charBuffer) : 0);
+        }
+        else {
+            /* A normal file */
+            bytesRead = (int32_t)fread(charBuffer,
+                sizeof(char),
+                requestBytes,
+                f->fFile);
+        }
 
-    if(f->fConverter != NULL) { /* We have a valid converter */
-        /* Perform the conversion */
-        ucnv_toUnicode(f->fConverter,
-            &myTarget,
-            f->fUCBuffer + bufferSize,
-            &mySource,
-            mySourceEnd,
-            NULL,
-            (UBool)(feof(f->fFile) != 0),
-            &status);
+        /* Set up conversion parameters */
+        status      = U_ZERO_ERROR;
+        mySource    = charBuffer;
+        mySourceEnd = charBuffer + bytesRead;
 
-    } else { /*weiv: do the invariant conversion */
-        u_charsToUChars(mySource, myTarget, bytesRead);
-        myTarget += bytesRead;
+        if(f->fConverter != NULL) { /* We have a valid converter */
+            /* Perform the conversion */
+            ucnv_toUnicode(f->fConverter,
+                &myTarget,
+                f->fUCBuffer + bufferSize,
+                &mySource,
+                mySourceEnd,
+                NULL,
+                (UBool)(feof(f->fFile) != 0),
+                &status);
+
+        } else { /*weiv: do the invariant conversion */
+            u_charsToUChars(mySource, myTarget, bytesRead);
+            myTarget += bytesRead;
+        }
+
+        if (f->fFileno == 0 || bytesRead < requestBytes) {
+            /* stdin, end of file, or a read error: stop here */
+            break;
+        }
+
+        /* determine how many more codepage bytes the remaining space can hold */
+        availLength = (int32_t)(f->fUCBuffer + bufferSize - myTarget);
+        maxCPBytes = availLength / (f->fConverter!=NULL?(2*ucnv_getMinCharSize(f->fConverter)):1);
+        if (maxCPBytes <= 0) {
+            break;
+        }
     }
 
     /* update the pointers into our array */
@@ -533,6 +629,13 @@ u_fgets(UChar        *s,
         }
 
         if (!currDelim) {
+            /* Copy delimiter-free blocks of four UChars without testing each one */
+            while ((alias + 4) <= limit && isDelimiterFreeBlock(alias)) {
+                uprv_memcpy(sItr, alias, 8);
+                sItr += 4;
+                alias += 4;
+                count += 4;
+            }
             /* Copy UChars until we find the first occurrence of a delimiter character */
             while (alias < limit && !IS_FIRST_STRING_DELIMITER(*alias)) {
                 count++;
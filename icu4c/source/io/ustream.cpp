@@ -41,27 +41,45 @@ operator<<(STD_OSTREAM& stream, const UnicodeString& str)
 {
     if(str.length() > 0) {
         char buffer[200];
+        char *s8 = buffer;
+        int32_t capacity = (int32_t)sizeof(buffer);
         UConverter *converter;
         UErrorCode errorCode = U_ZERO_ERROR;
 
-        // use the default converter to convert chunks of text
+        // use the default converter to convert the string
         converter = u_getDefaultConverter(&errorCode);
         if(U_SUCCESS(errorCode)) {
+            // size the target up front so that a single conversion call
+            // (and a single write) suffices for long strings
+            int32_t maxLength =
+                UCNV_GET_MAX_BYTES_FOR_STRING(str.length(), ucnv_getMaxCharSize(converter)) + 1;
+            if(maxLength > capacity) {
+                s8 = (char *)uprv_malloc(maxLength);
+                if(s8 != NULL) {
+                    capacity = maxLength;
+                } else {
+                    s8 = buffer;  // convert through the stack buffer in chunks
+                }
+            }
             const UChar *us = str.getBuffer();
             const UChar *uLimit = us + str.length();
-            char *s, *sLimit = buffer + (sizeof(buffer) - 1);
+            char *s, *sLimit = s8 + (capacity - 1);  // leave room for the terminating NUL
             do {
                 errorCode = U_ZERO_ERROR;
-                s = buffer;
+                s = s8;
                 ucnv_fromUnicode(converter, &s, sLimit, &us, uLimit, 0, FALSE, &errorCode);
                 *s = 0;
 
-                // write this chunk
-                if(s > buffer) {
-                    stream << buffer;
+                // insert this chunk as formatted output,
+                // so that the stream's width and fill settings apply
+                if(s > s8) {
+                    stream << s8;
                 }
             } while(errorCode == U_BUFFER_OVERFLOW_ERROR);
             u_releaseDefaultConverter(converter);
+            if(s8 != buffer) {
+                uprv_free(s8);
+            }
         }
     }
 
@@ -2268,31 +2268,20 @@ static void
 TestOpenBinary(void)
 {
     /*
-     * ucol_openBinary() documents:
-     * "The API also takes a base collator which usually should be UCA."
-     * and
-     * "Currently it cannot be NULL."
-     *
-     * However, the check for NULL was commented out in ICU 3.4 (r18149).
-     * Ticket #4355 requested "Make collation work with minimal data.
-     * Optionally without UCA, with relevant parts of UCA copied into the tailoring table."
-     *
-     * The ICU team agreed with ticket #10517 "require base collator in ucol_openBinary() etc."
-     * to require base!=NULL again.
+     * ucol_openBinary() requires the base collator to be the root
+     * collator; base==NULL is accepted as a shorthand for the root
+     * collator, so that reopening a serialized image does not require
+     * opening a base collator first. Both forms must produce the same
+     * collator.
      */
-#define OPEN_BINARY_ACCEPTS_NULL_BASE 0
     UErrorCode status = U_ZERO_ERROR;
     /*
     char rule[] = "&h < d < c < b";
     char *wUCA[] = { "a", "h", "d", "c", "b", "i" };
-    char *noUCA[] = {"d", "c", "b", "a", "h", "i" };
     */
     /* we have to use Cyrillic letters because latin-1 always gets copied */
     const char rule[] = "&\\u0452 < \\u0434 < \\u0433 < \\u0432"; /* &dje < d < g < v */
     const char *wUCA[] = { "\\u0430", "\\u0452", "\\u0434", "\\u0433", "\\u0432", "\\u0435" }; /* a, dje, d, g, v, e */
-#if OPEN_BINARY_ACCEPTS_NULL_BASE
-    const char *noUCA[] = {"\\u0434", "\\u0433", "\\u0432", "\\u0430", "\\u0435", "\\u0452" }; /* d, g, v, a, e, dje */
-#endif
 
     UChar uRules[256];
     int32_t uRulesLen = u_unescape(rule, uRules, 256);
@@ -2328,18 +2317,17 @@ TestOpenBinary(void)
 
     cloneWUCA = ucol_openBinary(image, imageSize, UCA, &status);
     cloneNOUCA = ucol_openBinary(image, imageSize, NULL, &status);
-#if !OPEN_BINARY_ACCEPTS_NULL_BASE
-    if(status != U_ILLEGAL_ARGUMENT_ERROR) {
-        log_err("ucol_openBinary(base=NULL) unexpectedly did not fail - %s\n", u_errorName(status));
+    if(U_FAILURE(status) || cloneNOUCA == NULL) {
+        log_err("ucol_openBinary(base=NULL) unexpectedly failed - %s\n", u_errorName(status));
     }
-#endif
 
     genericOrderingTest(coll, wUCA, UPRV_LENGTHOF(wUCA));
 
     genericOrderingTest(cloneWUCA, wUCA, UPRV_LENGTHOF(wUCA));
-#if OPEN_BINARY_ACCEPTS_NULL_BASE
-    genericOrderingTest(cloneNOUCA, noUCA, UPRV_LENGTHOF(noUCA));
-#endif
+    if(cloneNOUCA != NULL) {
+        /* base==NULL means the root collator, so the ordering is the same */
+        genericOrderingTest(cloneNOUCA, wUCA, UPRV_LENGTHOF(wUCA));
+    }
 
     if(image != imageBuffer) {
         free(image);
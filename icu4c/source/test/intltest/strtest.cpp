@@ -24,6 +24,10 @@
 #include "unicode/ustring.h"
 #include "unicode/utf_old.h"    // for UTF8_COUNT_TRAIL_BYTES
 #include "unicode/utf8.h"
+#include "unicode/casemap.h"
+#include "unicode/edits.h"
+#include "unicode/normalizer2.h"
+#include "bytesinkutil.h"
 #include "charstr.h"
 #include "cstr.h"
 #include "intltest.h"
@@ -181,6 +185,7 @@ void StringTest::runIndexedTest(int32_t index, UBool exec, const char *&name, ch
     TESTCASE_AUTO(TestCheckedArrayByteSink);
     TESTCASE_AUTO(TestStringByteSink);
     TESTCASE_AUTO(TestCharString);
+    TESTCASE_AUTO(TestUTF8TransformChain);
     TESTCASE_AUTO(TestCStr);
     TESTCASE_AUTO(Testctou);
     TESTCASE_AUTO_END;
@@ -575,6 +580,97 @@ StringTest::TestCharString() {
     }
 }
 
+void
+StringTest::TestUTF8TransformChain() {
+#if !UCONFIG_NO_NORMALIZATION
+    IcuTestErrorCode errorCode(*this, "TestUTF8TransformChain()");
+    const Normalizer2 *nfc = Normalizer2::getNFCInstance(errorCode);
+    if (errorCode.errDataIfFailureAndReset("Normalizer2::getNFCInstance() failed")) {
+        return;
+    }
+    // "A" + combining diaeresis + capital sharp s:
+    // casefolding maps A->a and U+1E9E->"ss", NFC then composes a+diaeresis.
+    static const char src[] = "A\xCC\x88\xE1\xBA\x9E";
+
+    // Reference: materialize each stage's output and merge the Edits by hand.
+    UErrorCode ec = U_ZERO_ERROR;
+    CharString folded;
+    Edits foldEdits;
+    {
+        CharStringByteSink sink(&folded);
+        CaseMap::utf8Fold(0, src, sink, &foldEdits, ec);
+    }
+    CharString normalized;
+    Edits nfcEdits;
+    {
+        CharStringByteSink sink(&normalized);
+        nfc->normalizeUTF8(0, folded.toStringPiece(), sink, &nfcEdits, ec);
+    }
+    Edits expectedEdits;
+    expectedEdits.mergeAndAppend(foldEdits, nfcEdits, ec);
+    assertSuccess("reference casefold+NFC", ec);
+    assertEquals("reference result", "\xC3\xA4ss", normalized.data());
+
+    // Same pipeline through the chain, without intermediate strings.
+    UTF8TransformChain chain(src);
+    {
+        CharStringByteSink sink(&chain.nextOutput());
+        Edits edits;
+        CaseMap::utf8Fold(0, chain.input(), sink, &edits, errorCode);
+        chain.stageDone(edits, errorCode);
+    }
+    {
+        CharStringByteSink sink(&chain.nextOutput());
+        Edits edits;
+        nfc->normalizeUTF8(0, chain.input(), sink, &edits, errorCode);
+        chain.stageDone(edits, errorCode);
+    }
+    if (errorCode.errIfFailureAndReset("UTF8TransformChain stages failed")) {
+        return;
+    }
+    StringPiece result = chain.result();
+    assertEquals("chain result length", normalized.length(), result.length());
+    if (result.length() == normalized.length() &&
+            0 != memcmp(result.data(), normalized.data(), result.length())) {
+        errln("UTF8TransformChain result differs from the two-step reference");
+    }
+
+    // The merged Edits must equal the hand-merged reference.
+    Edits::Iterator expIter = expectedEdits.getFineIterator();
+    Edits::Iterator chainIter = chain.edits().getFineIterator();
+    int32_t i = 0;
+    for (;;) {
+        UBool expHasNext = expIter.next(errorCode);
+        UBool chainHasNext = chainIter.next(errorCode);
+        assertEquals("same number of edits", expHasNext, chainHasNext);
+        if (!expHasNext || !chainHasNext || errorCode.isFailure()) {
+            break;
+        }
+        assertEquals(UnicodeString("hasChange @") + i, expIter.hasChange(), chainIter.hasChange());
+        assertEquals(UnicodeString("oldLength @") + i, expIter.oldLength(), chainIter.oldLength());
+        assertEquals(UnicodeString("newLength @") + i, expIter.newLength(), chainIter.newLength());
+        ++i;
+    }
+    errorCode.errIfFailureAndReset("Edits comparison failed");
+
+    // Spot-check final->original offsets: "ss" starts at index 1 of the
+    // result and at index 3 of the original text.
+    Edits::Iterator mapIter = chain.edits().getFineIterator();
+    assertEquals("source index of 's'", 3, mapIter.sourceIndexFromDestinationIndex(1, errorCode));
+
+    // reset() restarts the chain with the buffers reused.
+    chain.reset("K");  // U+004B folds to k, already NFC
+    {
+        CharStringByteSink sink(&chain.nextOutput());
+        Edits edits;
+        CaseMap::utf8Fold(0, chain.input(), sink, &edits, errorCode);
+        chain.stageDone(edits, errorCode);
+    }
+    assertEquals("result after reset", UnicodeString("k"),
+                 UnicodeString::fromUTF8(chain.result()));
+#endif
+}
+
 void
 StringTest::TestCStr() {
     const char *cs = "This is a test string.";
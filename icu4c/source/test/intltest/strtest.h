@@ -47,6 +47,7 @@ private:
     void TestStringByteSink();
     void TestSTLCompatibility();
     void TestCharString();
+    void TestUTF8TransformChain();
     void TestCStr();
     void Testctou();
 };
@@ -10,6 +10,7 @@
 */
 
 #include <string.h>
+#include <thread>
 #include "unicode/localpointer.h"
 #include "unicode/uperf.h"
 #include "unicode/ucol.h"
@@ -17,6 +18,7 @@
 #include "unicode/uiter.h"
 #include "unicode/ustring.h"
 #include "unicode/sortkey.h"
+#include "cmemory.h"
 #include "uarrsort.h"
 #include "uoptions.h"
 #include "ustr_imp.h"
@@ -328,6 +330,148 @@ long GetSortKey::getOperationsPerIteration()
     return source->count;
 }
 
+//
+// Test case like GetSortKey, but reporting the total number of sort key bytes
+// as the event count, so that the driver prints ns/sort-key-byte and
+// events/operations gives the average sort key bytes per input string.
+//
+class GetSortKeyBytes : public UPerfFunction
+{
+public:
+    GetSortKeyBytes(const UCollator* coll, const CA_uchar* source);
+    ~GetSortKeyBytes();
+    virtual void call(UErrorCode* status);
+    virtual long getOperationsPerIteration();
+    virtual long getEventsPerIteration();
+
+private:
+    const UCollator *coll;
+    const CA_uchar *source;
+    long totalKeyLen;
+};
+
+GetSortKeyBytes::GetSortKeyBytes(const UCollator* coll, const CA_uchar* source)
+    :   coll(coll),
+        source(source),
+        totalKeyLen(0)
+{
+}
+
+GetSortKeyBytes::~GetSortKeyBytes()
+{
+}
+
+#define KEY_BUF_SIZE_BYTES 512
+
+void GetSortKeyBytes::call(UErrorCode* status)
+{
+    if (U_FAILURE(*status)) return;
+
+    uint8_t key[KEY_BUF_SIZE_BYTES];
+
+    totalKeyLen = 0;
+    for (int32_t i = 0; i < source->count; i++) {
+        totalKeyLen += ucol_getSortKey(coll, source->dataOf(i), source->lengthOf(i), key, KEY_BUF_SIZE_BYTES);
+    }
+}
+
+long GetSortKeyBytes::getOperationsPerIteration()
+{
+    return source->count;
+}
+
+long GetSortKeyBytes::getEventsPerIteration()
+{
+    return totalKeyLen;
+}
+
+//
+// Test case calling ucol_strcoll from several threads sharing one UCollator,
+// to expose contention on shared collator state. Each thread permutes the
+// same test data, like Strcoll but with a smaller cap so that one iteration
+// stays reasonably short.
+//
+#define MAX_TEST_STRINGS_FOR_CONCURRENT 300
+#define MAX_CONCURRENT_THREADS 8
+
+class StrcollConcurrent : public UPerfFunction
+{
+public:
+    StrcollConcurrent(const UCollator* coll, const CA_uchar* source, int32_t numThreads);
+    ~StrcollConcurrent();
+    virtual void call(UErrorCode* status);
+    virtual long getOperationsPerIteration();
+
+private:
+    void compareAll(UErrorCode* status) const;
+
+    const UCollator *coll;
+    const CA_uchar *source;
+    int32_t numThreads;
+    int32_t maxTestStrings;
+};
+
+StrcollConcurrent::StrcollConcurrent(const UCollator* coll, const CA_uchar* source, int32_t numThreads)
+    :   coll(coll),
+        source(source),
+        numThreads(numThreads)
+{
+    if (this->numThreads > MAX_CONCURRENT_THREADS) {
+        this->numThreads = MAX_CONCURRENT_THREADS;
+    }
+    maxTestStrings = source->count > MAX_TEST_STRINGS_FOR_CONCURRENT ?
+            MAX_TEST_STRINGS_FOR_CONCURRENT : source->count;
+}
+
+StrcollConcurrent::~StrcollConcurrent()
+{
+}
+
+void StrcollConcurrent::compareAll(UErrorCode* status) const
+{
+    int32_t divisor = source->count / maxTestStrings;
+    int32_t cmp = 0;
+    for (int32_t i = 0, numTestStringsI = 0; i < source->count && numTestStringsI < maxTestStrings; i++) {
+        if (i % divisor) continue;
+        numTestStringsI++;
+        for (int32_t j = 0, numTestStringsJ = 0; j < source->count && numTestStringsJ < maxTestStrings; j++) {
+            if (j % divisor) continue;
+            numTestStringsJ++;
+            cmp += ucol_strcoll(coll, source->dataOf(i), source->lengthOf(i),
+                                source->dataOf(j), source->lengthOf(j));
+        }
+    }
+    // At the end, cmp must be 0
+    if (cmp != 0) {
+        *status = U_INTERNAL_PROGRAM_ERROR;
+    }
+}
+
+void StrcollConcurrent::call(UErrorCode* status)
+{
+    if (U_FAILURE(*status)) return;
+
+    std::thread threads[MAX_CONCURRENT_THREADS];
+    UErrorCode statuses[MAX_CONCURRENT_THREADS];
+
+    for (int32_t t = 0; t < numThreads; t++) {
+        statuses[t] = U_ZERO_ERROR;
+        UErrorCode *threadStatus = &statuses[t];
+        threads[t] = std::thread([this, threadStatus]() { compareAll(threadStatus); });
+    }
+    for (int32_t t = 0; t < numThreads; t++) {
+        threads[t].join();
+        if (U_FAILURE(statuses[t]) && U_SUCCESS(*status)) {
+            *status = statuses[t];
+        }
+    }
+}
+
+long StrcollConcurrent::getOperationsPerIteration()
+{
+    return (long)numThreads * maxTestStrings * maxTestStrings;
+}
+
 //
 // Test case taking a single test data array in UTF-16, calling ucol_nextSortKeyPart for each for the
 // given buffer size
@@ -1065,6 +1209,9 @@ private:
     CA_uchar* randomData16;
     CA_char* randomData8;
 
+    CA_uchar* latinData16;
+    CA_uchar* mixedData16;
+
     const CA_uchar* getData16(UErrorCode &status);
     const CA_char* getData8(UErrorCode &status);
 
@@ -1077,6 +1224,10 @@ private:
     const CA_uchar* getRandomData16(UErrorCode &status);
     const CA_char* getRandomData8(UErrorCode &status);
 
+    const CA_uchar* getLatinData16(UErrorCode &status);
+    const CA_uchar* getMixedData16(UErrorCode &status);
+    static CA_uchar* generateData16(UBool latinOnly, UErrorCode &status);
+
     static CA_uchar* sortData16(
             const CA_uchar* d16,
             UComparator *cmp, const void *context,
@@ -1091,8 +1242,17 @@ private:
     UPerfFunction* TestStrcollUTF8Null();
     UPerfFunction* TestStrcollUTF8Similar();
 
+    UPerfFunction* TestStrcollFastLatin();
+    UPerfFunction* TestStrcollMixedScript();
+    UPerfFunction* TestStrcollConcurrent2();
+    UPerfFunction* TestStrcollConcurrent4();
+    UPerfFunction* TestStrcollConcurrent8();
+
     UPerfFunction* TestGetSortKey();
     UPerfFunction* TestGetSortKeyNull();
+    UPerfFunction* TestGetSortKeyBytes();
+    UPerfFunction* TestGetSortKeyBytesFastLatin();
+    UPerfFunction* TestGetSortKeyBytesMixedScript();
 
     UPerfFunction* TestNextSortKeyPart_4All();
     UPerfFunction* TestNextSortKeyPart_4x2();
@@ -1140,7 +1300,9 @@ CollPerf2Test::CollPerf2Test(int32_t argc, const char *argv[], UErrorCode &statu
     sortedData16(NULL),
     sortedData8(NULL),
     randomData16(NULL),
-    randomData8(NULL)
+    randomData8(NULL),
+    latinData16(NULL),
+    mixedData16(NULL)
 {
     if (U_FAILURE(status)) {
         return;
@@ -1169,6 +1331,8 @@ CollPerf2Test::~CollPerf2Test()
     delete sortedData8;
     delete randomData16;
     delete randomData8;
+    delete latinData16;
+    delete mixedData16;
 }
 
 #define MAX_NUM_DATA 10000
@@ -1324,6 +1488,79 @@ const CA_char* CollPerf2Test::getRandomData8(UErrorCode &status) {
     return randomData8 = getData8FromData16(getRandomData16(status), status);
 }
 
+const CA_uchar* CollPerf2Test::getLatinData16(UErrorCode &status) {
+    if (U_FAILURE(status)) return NULL;
+    if (latinData16) return latinData16;
+    return latinData16 = generateData16(TRUE, status);
+}
+
+const CA_uchar* CollPerf2Test::getMixedData16(UErrorCode &status) {
+    if (U_FAILURE(status)) return NULL;
+    if (mixedData16) return mixedData16;
+    return mixedData16 = generateData16(FALSE, status);
+}
+
+#define NUM_SYNTHETIC_STRINGS 1000
+
+// Synthetic reference corpora, independent of the -f input file, so that
+// the fast-Latin and script-mix numbers are comparable across machines and
+// ICU versions. A fixed-seed LCG keeps the data identical from run to run.
+// latinOnly=TRUE stays within the CollationFastLatin repertoire (ASCII
+// letters plus a few Latin-1 accents); otherwise every fourth string is
+// Cyrillic and every eighth is Han, breaking out of the fast path.
+// String lengths follow a short-biased distribution (3..14 UChars) with a
+// long tail (20..79 UChars) on every eighth string.
+CA_uchar* CollPerf2Test::generateData16(UBool latinOnly, UErrorCode &status) {
+    if (U_FAILURE(status)) return NULL;
+
+    static const UChar latinChars[] = {
+        0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A,  // a-j
+        0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75,  // k-p, r-u
+        0x41, 0x4D, 0x53, 0x20,                                      // A M S space
+        0xE0, 0xE9, 0xEE, 0xF6, 0xFC                                 // à é î ö ü
+    };
+    enum { LATIN_CHAR_COUNT = UPRV_LENGTHOF(latinChars) };
+
+    uint32_t seed = 20131; // fixed seed - data must not vary between runs
+
+    LocalPointer<CA_uchar> d16(new CA_uchar());
+    for (int32_t i = 0; i < NUM_SYNTHETIC_STRINGS; i++) {
+        seed = seed * 1103515245 + 12345;
+        int32_t len;
+        if ((i & 7) == 7) {
+            len = 20 + (int32_t)((seed >> 16) % 60);  // long tail
+        } else {
+            len = 3 + (int32_t)((seed >> 16) % 12);   // short strings dominate
+        }
+
+        int32_t script = latinOnly ? 0 : (i & 7) == 3 ? 1 : (i & 7) == 6 ? 2 : 0;
+
+        d16->append_one(len + 1);  // including NUL terminator
+        UChar *p = d16->last();
+        for (int32_t j = 0; j < len; j++) {
+            seed = seed * 1103515245 + 12345;
+            uint32_t r = seed >> 16;
+            switch (script) {
+            case 1:  // Cyrillic
+                p[j] = (UChar)(0x0430 + r % 32);
+                break;
+            case 2:  // Han
+                p[j] = (UChar)(0x4E00 + r % 1000);
+                break;
+            default:
+                p[j] = latinChars[r % LATIN_CHAR_COUNT];
+                break;
+            }
+        }
+        // no leading space - keep the primary weights meaningful
+        if (p[0] == 0x20) {
+            p[0] = 0x61;
+        }
+        p[len] = 0;
+    }
+    return d16.orphan();
+}
+
 CA_uchar* CollPerf2Test::sortData16(const CA_uchar* d16,
                                     UComparator *cmp, const void *context,
                                     UErrorCode &status) {
@@ -1400,8 +1637,17 @@ CollPerf2Test::runIndexedTest(int32_t index, UBool exec, const char *&name, char
     TESTCASE_AUTO(TestStrcollUTF8Null);
     TESTCASE_AUTO(TestStrcollUTF8Similar);
 
+    TESTCASE_AUTO(TestStrcollFastLatin);
+    TESTCASE_AUTO(TestStrcollMixedScript);
+    TESTCASE_AUTO(TestStrcollConcurrent2);
+    TESTCASE_AUTO(TestStrcollConcurrent4);
+    TESTCASE_AUTO(TestStrcollConcurrent8);
+
     TESTCASE_AUTO(TestGetSortKey);
     TESTCASE_AUTO(TestGetSortKeyNull);
+    TESTCASE_AUTO(TestGetSortKeyBytes);
+    TESTCASE_AUTO(TestGetSortKeyBytesFastLatin);
+    TESTCASE_AUTO(TestGetSortKeyBytesMixedScript);
 
     TESTCASE_AUTO(TestNextSortKeyPart_4All);
     TESTCASE_AUTO(TestNextSortKeyPart_4x4);
@@ -1528,6 +1774,94 @@ UPerfFunction* CollPerf2Test::TestGetSortKeyNull()
     return testCase;
 }
 
+UPerfFunction* CollPerf2Test::TestStrcollFastLatin()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    Strcoll *testCase = new Strcoll(coll, getLatinData16(status), TRUE /* useLen */);
+    if (U_FAILURE(status)) {
+        delete testCase;
+        return NULL;
+    }
+    return testCase;
+}
+
+UPerfFunction* CollPerf2Test::TestStrcollMixedScript()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    Strcoll *testCase = new Strcoll(coll, getMixedData16(status), TRUE /* useLen */);
+    if (U_FAILURE(status)) {
+        delete testCase;
+        return NULL;
+    }
+    return testCase;
+}
+
+UPerfFunction* CollPerf2Test::TestStrcollConcurrent2()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    StrcollConcurrent *testCase = new StrcollConcurrent(coll, getLatinData16(status), 2);
+    if (U_FAILURE(status)) {
+        delete testCase;
+        return NULL;
+    }
+    return testCase;
+}
+
+UPerfFunction* CollPerf2Test::TestStrcollConcurrent4()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    StrcollConcurrent *testCase = new StrcollConcurrent(coll, getLatinData16(status), 4);
+    if (U_FAILURE(status)) {
+        delete testCase;
+        return NULL;
+    }
+    return testCase;
+}
+
+UPerfFunction* CollPerf2Test::TestStrcollConcurrent8()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    StrcollConcurrent *testCase = new StrcollConcurrent(coll, getLatinData16(status), 8);
+    if (U_FAILURE(status)) {
+        delete testCase;
+        return NULL;
+    }
+    return testCase;
+}
+
+UPerfFunction* CollPerf2Test::TestGetSortKeyBytes()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    GetSortKeyBytes *testCase = new GetSortKeyBytes(coll, getData16(status));
+    if (U_FAILURE(status)) {
+        delete testCase;
+        return NULL;
+    }
+    return testCase;
+}
+
+UPerfFunction* CollPerf2Test::TestGetSortKeyBytesFastLatin()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    GetSortKeyBytes *testCase = new GetSortKeyBytes(coll, getLatinData16(status));
+    if (U_FAILURE(status)) {
+        delete testCase;
+        return NULL;
+    }
+    return testCase;
+}
+
+UPerfFunction* CollPerf2Test::TestGetSortKeyBytesMixedScript()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    GetSortKeyBytes *testCase = new GetSortKeyBytes(coll, getMixedData16(status));
+    if (U_FAILURE(status)) {
+        delete testCase;
+        return NULL;
+    }
+    return testCase;
+}
+
 UPerfFunction* CollPerf2Test::TestNextSortKeyPart_4All()
 {
     UErrorCode status = U_ZERO_ERROR;
@@ -0,0 +1,342 @@
+/*
+***********************************************************************
+* © 2016 and later: Unicode, Inc. and others.
+* License & terms of use: http://www.unicode.org/copyright.html#License
+***********************************************************************
+*/
+/*
+ * convmatrix: conversion throughput matrix.
+ *
+ * Runs every installed converter (or the subset matching --match) over a
+ * UTF-16 corpus derived from the input file, in both directions and with
+ * several buffer sizes, and prints one MB/s table row per converter.
+ * Unmappable characters are substituted, so any corpus can be pushed
+ * through any charset; the output is therefore a throughput measure, not
+ * a round-trip fidelity measure.
+ *
+ * Columns per converter:
+ *   toU     streaming ucnv_toUnicode() with source chunks of the buffer size
+ *   fromU   streaming ucnv_fromUnicode() with a target buffer of the buffer size
+ *   convEx  streaming ucnv_convertEx() charset -> UTF-8 through the UTF-16
+ *           pivot, with source chunks of the buffer size
+ *
+ * MB/s is charset bytes per second for toU and convEx, and UTF-16 bytes
+ * per second for fromU.
+ *
+ * Usage: convmatrix -f <file> [-e <encoding>] [-m <substring>] [-v]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "unicode/utypes.h"
+#include "unicode/ucnv.h"
+#include "unicode/uclean.h"
+#include "unicode/utimer.h"
+#include "cmemory.h"
+#include "filestrm.h"
+#include "uoptions.h"
+
+#define PIVOT_BUF_SIZE 8192
+#define OUT_BUF_SIZE 65536
+
+/* Approximate number of corpus bytes to push through each matrix cell;
+   the corpus is repeated until this volume is reached. */
+#define TARGET_BYTES_PER_CELL (8 * 1024 * 1024)
+
+static const int32_t bufSizes[] = { 512, 4096, 65536 };
+
+static UOption options[] = {
+    UOPTION_HELP_H,             /* 0 */
+    UOPTION_HELP_QUESTION_MARK, /* 1 */
+    UOPTION_DEF("file-name", 'f', UOPT_REQUIRES_ARG), /* 2 */
+    UOPTION_DEF("encoding",  'e', UOPT_REQUIRES_ARG), /* 3 */
+    UOPTION_DEF("match",     'm', UOPT_REQUIRES_ARG), /* 4 */
+    UOPTION_VERBOSE             /* 5 */
+};
+
+static void usage(const char *pname) {
+    fprintf(stderr,
+            "Usage: %s -f file [OPTIONS]\n"
+            "\tPrints a conversion throughput table (MB/s) for the installed converters.\n"
+            "Options:\n"
+            "\t-h or -? or --help   this usage text\n"
+            "\t-f or --file-name    corpus file, required\n"
+            "\t-e or --encoding     encoding of the corpus file (default UTF-8)\n"
+            "\t-m or --match        only converters whose name contains the substring\n"
+            "\t-v or --verbose      print corpus statistics and per-cell iteration counts\n",
+            pname);
+}
+
+/* One streaming pass of ucnv_toUnicode over the charset bytes,
+   feeding the source in chunks of chunkSize. */
+static void streamToUnicode(UConverter *cnv, const char *bytes, int32_t byteLen,
+                            int32_t chunkSize, UErrorCode *status) {
+    static UChar out[OUT_BUF_SIZE];
+    const char *s = bytes;
+    const char *limit = bytes + byteLen;
+
+    ucnv_resetToUnicode(cnv);
+    while (s < limit && U_SUCCESS(*status)) {
+        const char *chunkEnd = s + chunkSize;
+        if (chunkEnd > limit) {
+            chunkEnd = limit;
+        }
+        UBool flush = (UBool)(chunkEnd == limit);
+        for (;;) {
+            UChar *t = out;
+            *status = U_ZERO_ERROR;
+            ucnv_toUnicode(cnv, &t, out + UPRV_LENGTHOF(out), &s, chunkEnd, NULL, flush, status);
+            if (*status != U_BUFFER_OVERFLOW_ERROR) {
+                break;
+            }
+        }
+    }
+}
+
+/* One streaming pass of ucnv_fromUnicode over the UTF-16 corpus,
+   draining into a target buffer of chunkSize bytes. */
+static void streamFromUnicode(UConverter *cnv, const UChar *us, int32_t uLen,
+                              int32_t chunkSize, UErrorCode *status) {
+    static char out[OUT_BUF_SIZE];
+    const UChar *s = us;
+    const UChar *limit = us + uLen;
+
+    ucnv_resetFromUnicode(cnv);
+    for (;;) {
+        char *t = out;
+        *status = U_ZERO_ERROR;
+        ucnv_fromUnicode(cnv, &t, out + chunkSize, &s, limit, NULL, TRUE, status);
+        if (*status != U_BUFFER_OVERFLOW_ERROR) {
+            break;
+        }
+    }
+}
+
+/* One streaming pass of ucnv_convertEx charset -> UTF-8 through the
+   UTF-16 pivot, feeding the source in chunks of chunkSize. */
+static void streamConvertEx(UConverter *cnv, UConverter *utf8Cnv,
+                            const char *bytes, int32_t byteLen,
+                            int32_t chunkSize, UErrorCode *status) {
+    static char out[OUT_BUF_SIZE];
+    static UChar pivot[PIVOT_BUF_SIZE];
+    UChar *pivotSource = pivot;
+    UChar *pivotTarget = pivot;
+    const char *s = bytes;
+    const char *limit = bytes + byteLen;
+
+    ucnv_resetToUnicode(cnv);
+    ucnv_resetFromUnicode(utf8Cnv);
+    while (s < limit && U_SUCCESS(*status)) {
+        const char *chunkEnd = s + chunkSize;
+        if (chunkEnd > limit) {
+            chunkEnd = limit;
+        }
+        UBool flush = (UBool)(chunkEnd == limit);
+        for (;;) {
+            char *t = out;
+            *status = U_ZERO_ERROR;
+            ucnv_convertEx(utf8Cnv, cnv, &t, out + sizeof(out), &s, chunkEnd,
+                           pivot, &pivotSource, &pivotTarget, pivot + UPRV_LENGTHOF(pivot),
+                           FALSE, flush, status);
+            if (*status != U_BUFFER_OVERFLOW_ERROR) {
+                break;
+            }
+        }
+    }
+}
+
+/* Times fn-style streaming passes and returns MB/s, or a negative value
+   on conversion error. bytesPerPass is what one pass processes. */
+enum MatrixOp { OP_TO_UNICODE, OP_FROM_UNICODE, OP_CONVERT_EX };
+
+static double timeCell(MatrixOp op, UConverter *cnv, UConverter *utf8Cnv,
+                       const UChar *us, int32_t uLen,
+                       const char *bytes, int32_t byteLen,
+                       int32_t chunkSize, UBool verbose) {
+    long bytesPerPass = (op == OP_FROM_UNICODE) ? (long)uLen * U_SIZEOF_UCHAR : byteLen;
+    int32_t reps = (int32_t)(TARGET_BYTES_PER_CELL / (bytesPerPass > 0 ? bytesPerPass : 1));
+    UTimer start, stop;
+    UErrorCode status = U_ZERO_ERROR;
+
+    if (reps < 1) {
+        reps = 1;
+    }
+    if (verbose) {
+        printf("# chunk %6d reps %6d\n", (int)chunkSize, (int)reps);
+    }
+
+    utimer_getTime(&start);
+    for (int32_t i = 0; i < reps && U_SUCCESS(status); i++) {
+        switch (op) {
+        case OP_TO_UNICODE:
+            streamToUnicode(cnv, bytes, byteLen, chunkSize, &status);
+            break;
+        case OP_FROM_UNICODE:
+            streamFromUnicode(cnv, us, uLen, chunkSize, &status);
+            break;
+        case OP_CONVERT_EX:
+            streamConvertEx(cnv, utf8Cnv, bytes, byteLen, chunkSize, &status);
+            break;
+        }
+    }
+    utimer_getTime(&stop);
+
+    if (U_FAILURE(status)) {
+        return -1.0;
+    }
+    double seconds = utimer_getDeltaSeconds(&start, &stop);
+    if (seconds <= 0.0) {
+        return -1.0;
+    }
+    return ((double)bytesPerPass * reps) / seconds / 1.0E6;
+}
+
+static void printCell(double mbps) {
+    if (mbps < 0.0) {
+        printf(" %8s", "-");
+    } else {
+        printf(" %8.1f", mbps);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    const char *pname = argv[0];
+    const char *fileName = NULL;
+    const char *encoding = "UTF-8";
+    const char *match = NULL;
+    UBool verbose = FALSE;
+    UErrorCode status = U_ZERO_ERROR;
+
+    argc = u_parseArgs(argc, argv, UPRV_LENGTHOF(options), options);
+    if (argc < 0 || options[0].doesOccur || options[1].doesOccur || !options[2].doesOccur) {
+        usage(pname);
+        return argc < 0 ? 1 : 0;
+    }
+    fileName = options[2].value;
+    if (options[3].doesOccur) {
+        encoding = options[3].value;
+    }
+    if (options[4].doesOccur) {
+        match = options[4].value;
+    }
+    if (options[5].doesOccur) {
+        verbose = TRUE;
+    }
+
+    /* Read the corpus file. */
+    FileStream *in = T_FileStream_open(fileName, "rb");
+    if (in == NULL) {
+        fprintf(stderr, "%s: could not open %s\n", pname, fileName);
+        return 2;
+    }
+    int32_t fileLen = T_FileStream_size(in);
+    char *fileBytes = (char *)malloc(fileLen > 0 ? fileLen : 1);
+    if (fileBytes == NULL || T_FileStream_read(in, fileBytes, fileLen) != fileLen) {
+        fprintf(stderr, "%s: could not read %s\n", pname, fileName);
+        T_FileStream_close(in);
+        free(fileBytes);
+        return 2;
+    }
+    T_FileStream_close(in);
+
+    /* Convert it to the UTF-16 reference corpus. */
+    UConverter *srcCnv = ucnv_open(encoding, &status);
+    int32_t uLen = ucnv_toUChars(srcCnv, NULL, 0, fileBytes, fileLen, &status);
+    if (status == U_BUFFER_OVERFLOW_ERROR) {
+        status = U_ZERO_ERROR;
+    }
+    UChar *us = (UChar *)malloc((uLen + 1) * U_SIZEOF_UCHAR);
+    if (us == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    } else {
+        ucnv_toUChars(srcCnv, us, uLen + 1, fileBytes, fileLen, &status);
+    }
+    ucnv_close(srcCnv);
+    free(fileBytes);
+    if (U_FAILURE(status)) {
+        fprintf(stderr, "%s: could not convert %s from %s: %s\n",
+                pname, fileName, encoding, u_errorName(status));
+        free(us);
+        return 2;
+    }
+    if (verbose) {
+        printf("# corpus: %s, %d UChars\n", fileName, (int)uLen);
+    }
+
+    UConverter *utf8Cnv = ucnv_open("UTF-8", &status);
+    if (U_FAILURE(status)) {
+        fprintf(stderr, "%s: could not open UTF-8 converter: %s\n", pname, u_errorName(status));
+        free(us);
+        return 2;
+    }
+
+    /* Header: three direction groups x the buffer sizes. */
+    printf("%-28s |", "converter (MB/s)");
+    static const char *const groups[] = { "toU", "fromU", "convEx" };
+    for (int32_t g = 0; g < UPRV_LENGTHOF(groups); g++) {
+        for (int32_t b = 0; b < UPRV_LENGTHOF(bufSizes); b++) {
+            printf(" %5s/%-2d", groups[g], (int)(bufSizes[b] / 1024) > 0 ? (int)(bufSizes[b] / 1024) : 0);
+        }
+        printf(" |");
+    }
+    printf("\n");
+
+    int32_t numConverters = ucnv_countAvailable();
+    for (int32_t c = 0; c < numConverters; c++) {
+        const char *name = ucnv_getAvailableName(c);
+        if (match != NULL && strstr(name, match) == NULL) {
+            continue;
+        }
+
+        status = U_ZERO_ERROR;
+        UConverter *cnv = ucnv_open(name, &status);
+        /* Substitute instead of stopping, so that every corpus can be
+           pushed through every charset. */
+        ucnv_setFromUCallBack(cnv, UCNV_FROM_U_CALLBACK_SUBSTITUTE, NULL, NULL, NULL, &status);
+        ucnv_setToUCallBack(cnv, UCNV_TO_U_CALLBACK_SUBSTITUTE, NULL, NULL, NULL, &status);
+        if (U_FAILURE(status)) {
+            ucnv_close(cnv);
+            printf("%-28s | open failed: %s\n", name, u_errorName(status));
+            continue;
+        }
+
+        /* Charset-encoded corpus for the toUnicode and convertEx cells. */
+        int32_t byteLen = ucnv_fromUChars(cnv, NULL, 0, us, uLen, &status);
+        if (status == U_BUFFER_OVERFLOW_ERROR) {
+            status = U_ZERO_ERROR;
+        }
+        char *bytes = (char *)malloc(byteLen + 1);
+        if (bytes != NULL) {
+            ucnv_fromUChars(cnv, bytes, byteLen + 1, us, uLen, &status);
+        } else {
+            status = U_MEMORY_ALLOCATION_ERROR;
+        }
+        if (U_FAILURE(status)) {
+            printf("%-28s | encode failed: %s\n", name, u_errorName(status));
+            ucnv_close(cnv);
+            free(bytes);
+            continue;
+        }
+
+        printf("%-28s |", name);
+        for (int32_t g = 0; g < 3; g++) {
+            for (int32_t b = 0; b < UPRV_LENGTHOF(bufSizes); b++) {
+                printCell(timeCell((MatrixOp)g, cnv, utf8Cnv, us, uLen,
+                                   bytes, byteLen, bufSizes[b], verbose));
+            }
+            printf(" |");
+        }
+        printf("\n");
+        fflush(stdout);
+
+        free(bytes);
+        ucnv_close(cnv);
+    }
+
+    ucnv_close(utf8Cnv);
+    free(us);
+    u_cleanup();
+    return 0;
+}
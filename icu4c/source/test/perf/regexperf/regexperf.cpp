@@ -0,0 +1,274 @@
+/***********************************************************************
+ * © 2016 and later: Unicode, Inc. and others.
+ * License & terms of use: http://www.unicode.org/copyright.html#License
+ ***********************************************************************
+ ***********************************************************************
+ * COPYRIGHT:
+ * Copyright (C) 2016 IBM, Inc.   All Rights Reserved.
+ *
+ ***********************************************************************/
+/**
+ * This program tests regular expression matching performance.
+ * The workloads cover the common pattern classes: literal scans that
+ * mostly hit, literal scans that always miss, case-insensitive literals,
+ * token scanning with \w+, capture group extraction, whole-line anchored
+ * matches, and a pathological backtracking pattern.
+ *
+ * A corpus file may be supplied with the standard -f option, one subject
+ * string per line; without one, a built-in synthetic corpus is used.
+ * With -j, results are written as JSON lines for mechanical collection.
+ */
+
+#include "regexperf.h"
+
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS
+#include "cmemory.h"
+#include "uoptions.h"
+
+UOption options[] = {
+    UOPTION_DEF("json", 'j', UOPT_NO_ARG),
+};
+enum {
+    JSON_OPTION = 0
+};
+
+int main(int argc, const char *argv[])
+{
+    UErrorCode status = U_ZERO_ERROR;
+    RegexPerformanceTest test(argc, argv, status);
+    if (U_FAILURE(status)) {
+        return status;
+    }
+    UBool ok;
+    if (test.fDoJson) {
+        ok = test.runJson();
+    } else {
+        ok = test.run();
+    }
+    if (ok == FALSE) {
+        fprintf(stderr, "FAILED: Tests could not be run please check the "
+            "arguments.\n");
+        return -1;
+    }
+    return 0;
+}
+
+//
+//  The built-in corpus, used when no -f file is given.  A small set of
+//  base lines is repeated with a varying numeric suffix, giving text in
+//  which the literal workloads mostly hit, the miss workload never does,
+//  and the token and capture workloads always find work to do.
+//
+static const char * const baseLines[] = {
+    "The quick brown fox jumps over the lazy dog",
+    "Regular expression performance depends on the pattern class",
+    "Error reading configuration file, retry scheduled",
+    "GET /index.html HTTP/1.1 status=200 bytes=5120",
+    "user=alice action=login result=ok elapsed=35",
+    "A line with no interesting tokens at all",
+    "PERFORMANCE measurement requires repeatable workloads",
+    "connection from 192.168.10.20 port 43512 closed",
+};
+
+RegexPerformanceTest::RegexPerformanceTest(int32_t argc, const char *argv[],
+                                           UErrorCode &status)
+                                           : UPerfTest(argc, argv, status),
+                                             fDoJson(FALSE),
+                                             fCorpus(NULL),
+                                             fCorpusLines(0)
+{
+    if (status == U_ILLEGAL_ARGUMENT_ERROR) {
+        fprintf(stderr, gUsageString, "regexperf");
+        return;
+    }
+    if (U_FAILURE(status)) {
+        fprintf(stderr, "FAILED to create UPerfTest object. Error: %s\n",
+            u_errorName(status));
+        return;
+    }
+
+    if (_remainingArgc < 0) {
+        // that means there are some -names not matched in the super class
+        // first tag is always skipped in u_parseArgs
+        int size = - _remainingArgc;
+        argv += argc - size;
+        argc = size;
+        _remainingArgc = u_parseArgs(argc, (char **)argv,
+            UPRV_LENGTHOF(options), options);
+    }
+    if (options[JSON_OPTION].doesOccur) {
+        fDoJson = TRUE;
+    }
+
+    loadCorpus(status);
+
+    // Input for the pathological workload:  a run of a's with no final b,
+    // forcing (a+)+b to explore its exponential split space before failing.
+    fBacktrackInput = UnicodeString("aaaaaaaaaaaaaaaac");
+}
+
+RegexPerformanceTest::~RegexPerformanceTest()
+{
+    delete [] fCorpus;
+}
+
+void RegexPerformanceTest::loadCorpus(UErrorCode &status)
+{
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (fileName != NULL) {
+        const ULine *fileLines = getLines(status);
+        if (U_FAILURE(status)) {
+            fprintf(stderr, "FAILED to read corpus file. Error: %s\n",
+                u_errorName(status));
+            return;
+        }
+        fCorpus = new UnicodeString[numLines];
+        if (fCorpus == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        for (int32_t i = 0; i < numLines; i++) {
+            fCorpus[i].setTo(fileLines[i].name, fileLines[i].len);
+        }
+        fCorpusLines = numLines;
+        return;
+    }
+
+    // No file given.  Build the synthetic corpus.
+    const int32_t kLines = 400;
+    fCorpus = new UnicodeString[kLines];
+    if (fCorpus == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    for (int32_t i = 0; i < kLines; i++) {
+        char suffix[40];
+        sprintf(suffix, " seq=%d time=%d:%02d", i, i % 24, i % 60);
+        fCorpus[i] = UnicodeString(baseLines[i % UPRV_LENGTHOF(baseLines)]);
+        fCorpus[i].append(UnicodeString(suffix));
+    }
+    fCorpusLines = kLines;
+}
+
+UPerfFunction* RegexPerformanceTest::runIndexedTest(int32_t index, UBool exec,
+                                                    const char *&name,
+                                                    char *par)
+{
+    switch (index) {
+        TESTCASE(0, TestLiteralFind);
+        TESTCASE(1, TestLiteralFindMiss);
+        TESTCASE(2, TestCaseInsensitiveFind);
+        TESTCASE(3, TestWordScan);
+        TESTCASE(4, TestNumberCapture);
+        TESTCASE(5, TestAnchoredMatch);
+        TESTCASE(6, TestBacktrackHeavy);
+        default:
+            name = "";
+            return NULL;
+    }
+    return NULL;
+}
+
+UPerfFunction* RegexPerformanceTest::TestLiteralFind()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    return new RegexPerfFunction(UnicodeString("performance"), 0,
+                                 fCorpus, fCorpusLines, FALSE, status);
+}
+
+UPerfFunction* RegexPerformanceTest::TestLiteralFindMiss()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    return new RegexPerfFunction(UnicodeString("zxqvjkwpmzzt"), 0,
+                                 fCorpus, fCorpusLines, FALSE, status);
+}
+
+UPerfFunction* RegexPerformanceTest::TestCaseInsensitiveFind()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    return new RegexPerfFunction(UnicodeString("Performance"),
+                                 UREGEX_CASE_INSENSITIVE,
+                                 fCorpus, fCorpusLines, FALSE, status);
+}
+
+UPerfFunction* RegexPerformanceTest::TestWordScan()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    return new RegexPerfFunction(UnicodeString("\\w+"), 0,
+                                 fCorpus, fCorpusLines, FALSE, status);
+}
+
+UPerfFunction* RegexPerformanceTest::TestNumberCapture()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    return new RegexPerfFunction(UnicodeString("(\\d+):(\\d+)"), 0,
+                                 fCorpus, fCorpusLines, FALSE, status);
+}
+
+UPerfFunction* RegexPerformanceTest::TestAnchoredMatch()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    return new RegexPerfFunction(UnicodeString("[A-Za-z0-9 ,./:=]*"), 0,
+                                 fCorpus, fCorpusLines, TRUE, status);
+}
+
+UPerfFunction* RegexPerformanceTest::TestBacktrackHeavy()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    return new RegexPerfFunction(UnicodeString("(a+)+b"), 0,
+                                 &fBacktrackInput, 1, FALSE, status);
+}
+
+//
+//  JSON mode.  Each workload is timed with a fixed iteration count
+//  (-i, defaulting to 10) and reported as one JSON object per line, so
+//  that successive runs can be collected and trended mechanically.
+//
+UBool RegexPerformanceTest::runJson()
+{
+    int32_t loops = iterations > 0 ? iterations : 10;
+    printf("[\n");
+    int32_t index;
+    for (index = 0; ; index++) {
+        const char *name = NULL;
+        runIndexedTest(index, FALSE, name);
+        if (name == NULL || name[0] == 0) {
+            break;
+        }
+        UErrorCode status = U_ZERO_ERROR;
+        UPerfFunction *f = runIndexedTest(index, TRUE, name);
+        if (f == NULL) {
+            fprintf(stderr, "%s function returned NULL\n", name);
+            return FALSE;
+        }
+        double t = f->time(loops, &status);
+        long ops = f->getOperationsPerIteration();
+        if (U_FAILURE(status)) {
+            fprintf(stderr, "%s failed: %s\n", name, u_errorName(status));
+            delete f;
+            return FALSE;
+        }
+        printf("%s  {\"test\": \"%s\", \"iterations\": %d, \"seconds\": %.6f, "
+               "\"operations\": %ld, \"ops_per_sec\": %.1f}",
+               index == 0 ? "" : ",\n",
+               name, (int)loops, t, ops,
+               t > 0 ? (double)ops * loops / t : 0.0);
+        delete f;
+    }
+    printf("\n]\n");
+    return TRUE;
+}
+
+#else   // UCONFIG_NO_REGULAR_EXPRESSIONS
+
+#include <stdio.h>
+
+int main(int, const char **)
+{
+    fprintf(stderr, "regexperf: regular expressions are disabled in this build.\n");
+    return 0;
+}
+
+#endif  // !UCONFIG_NO_REGULAR_EXPRESSIONS
@@ -0,0 +1,113 @@
+/*
+**********************************************************************
+* © 2016 and later: Unicode, Inc. and others.
+* License & terms of use: http://www.unicode.org/copyright.html#License
+**********************************************************************
+**********************************************************************
+* Copyright (c) 2002-2016, International Business Machines
+* Corporation and others.  All Rights Reserved.
+**********************************************************************
+**********************************************************************
+*/
+#ifndef _REGEXPERF_H
+#define _REGEXPERF_H
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS
+
+#include "unicode/regex.h"
+#include "unicode/unistr.h"
+#include "unicode/uperf.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+//
+//  A single regex workload:  one pattern, compiled once, run against every
+//  line of the corpus on each call.  Unanchored workloads iterate find()
+//  over each line and touch the match extent, as a scanning client would;
+//  anchored workloads test the whole line with matches().
+//
+class RegexPerfFunction : public UPerfFunction
+{
+public:
+    RegexPerfFunction(const UnicodeString &pattern, uint32_t flags,
+                      const UnicodeString *lines, int32_t numLines,
+                      UBool anchored, UErrorCode &status)
+            : fLines(lines), fNumLines(numLines), fAnchored(anchored),
+              fMatcher(NULL)
+    {
+        fMatcher = new RegexMatcher(pattern, flags, status);
+        if (fMatcher == NULL && U_SUCCESS(status)) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+        }
+    }
+
+    ~RegexPerfFunction()
+    {
+        delete fMatcher;
+    }
+
+    virtual void call(UErrorCode *status)
+    {
+        for (int32_t i = 0; i < fNumLines; i++) {
+            fMatcher->reset(fLines[i]);
+            if (fAnchored) {
+                fMatcher->matches(*status);
+            } else {
+                while (fMatcher->find()) {
+                    fMatcher->start(*status);
+                    fMatcher->end(*status);
+                }
+            }
+            if (U_FAILURE(*status)) {
+                return;
+            }
+        }
+    }
+
+    virtual long getOperationsPerIteration()
+    {
+        return fNumLines;
+    }
+
+private:
+    const UnicodeString *fLines;
+    int32_t              fNumLines;
+    UBool                fAnchored;
+    RegexMatcher        *fMatcher;
+};
+
+class RegexPerformanceTest : public UPerfTest
+{
+public:
+    RegexPerformanceTest(int32_t argc, const char *argv[], UErrorCode &status);
+    ~RegexPerformanceTest();
+    virtual UPerfFunction* runIndexedTest(int32_t index, UBool exec,
+        const char *&name,
+        char *par = NULL);
+
+    UPerfFunction* TestLiteralFind();
+    UPerfFunction* TestLiteralFindMiss();
+    UPerfFunction* TestCaseInsensitiveFind();
+    UPerfFunction* TestWordScan();
+    UPerfFunction* TestNumberCapture();
+    UPerfFunction* TestAnchoredMatch();
+    UPerfFunction* TestBacktrackHeavy();
+
+    //  Run every workload and write one JSON object per line to stdout,
+    //  for results that are collected and trended by machine.
+    UBool runJson();
+
+    UBool fDoJson;
+
+private:
+    void loadCorpus(UErrorCode &status);
+
+    UnicodeString *fCorpus;          // One entry per line.
+    int32_t        fCorpusLines;
+    UnicodeString  fBacktrackInput;  // Input for the pathological workload.
+};
+
+#endif   // !UCONFIG_NO_REGULAR_EXPRESSIONS
+#endif   // _REGEXPERF_H
@@ -0,0 +1,258 @@
+/*
+***********************************************************************
+* © 2016 and later: Unicode, Inc. and others.
+* License & terms of use: http://www.unicode.org/copyright.html#License
+***********************************************************************
+*/
+/*
+ * spoofperf: security screening throughput and latency distribution.
+ *
+ * uspoof_check() and UTS #46 IDNA processing sit in authentication hot
+ * paths, and their cost spreads by orders of magnitude between plain
+ * ASCII identifiers and confusable-dense input. This tool times each
+ * identifier of several built-in corpora individually and reports the
+ * p50/p90/p99/max per-check latency, so the worst case is visible, not
+ * just the mean:
+ *
+ *   corpora: ascii              plain [a-z0-9_] identifiers
+ *            latin-accent       Latin with Latin-1 accents
+ *            cyrillic-mixed     ASCII with Cyrillic lookalikes mixed in
+ *                               (classic mixed-script spoof shape)
+ *            confusable-dense   long identifiers built entirely from
+ *                               Cyrillic/Greek confusables of Latin
+ *
+ *   checks:  confusable         uspoof_check(), USPOOF_CONFUSABLE
+ *            restriction        uspoof_check(), USPOOF_RESTRICTION_LEVEL
+ *                               (mixed-script screening)
+ *            idna-toascii       uidna_nameToASCII_UTF8(), UTS #46
+ *
+ * The corpora are synthesized with a fixed seed so that runs are
+ * comparable across versions. Each identifier is timed over repeated
+ * calls to get above timer resolution; the figure reported is per call.
+ *
+ * Usage: spoofperf [-i inner-repeats] [-v]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "unicode/utypes.h"
+#include "unicode/uspoof.h"
+#include "unicode/uidna.h"
+#include "unicode/utimer.h"
+#include "cmemory.h"
+#include "uoptions.h"
+
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS && !UCONFIG_NO_NORMALIZATION && !UCONFIG_NO_IDNA
+
+#define IDENTIFIERS_PER_CORPUS 1000
+#define MAX_IDENTIFIER_LENGTH 64
+#define DEFAULT_INNER_REPEATS 20
+
+/* One corpus: IDENTIFIERS_PER_CORPUS NUL-terminated UTF-8 identifiers. */
+struct Corpus {
+    const char *name;
+    char strings[IDENTIFIERS_PER_CORPUS][4 * MAX_IDENTIFIER_LENGTH];
+};
+
+/* Appends cp as UTF-8; identifiers stay well inside the buffer. */
+static int32_t appendUTF8(char *s, int32_t i, uint32_t cp) {
+    if (cp < 0x80) {
+        s[i++] = (char)cp;
+    } else if (cp < 0x800) {
+        s[i++] = (char)(0xC0 | (cp >> 6));
+        s[i++] = (char)(0x80 | (cp & 0x3F));
+    } else {
+        s[i++] = (char)(0xE0 | (cp >> 12));
+        s[i++] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        s[i++] = (char)(0x80 | (cp & 0x3F));
+    }
+    return i;
+}
+
+static const char asciiChars[] = "abcdefghijklmnopqrstuvwxyz0123456789_";
+static const uint32_t latinAccents[] = { 0xE0, 0xE9, 0xEE, 0xF1, 0xF6, 0xFC };
+/* Cyrillic and Greek lookalikes of Latin letters: а с е о р х у ѕ і ϳ ο ν. */
+static const uint32_t confusables[] = {
+    0x0430, 0x0441, 0x0435, 0x043E, 0x0440, 0x0445,
+    0x0443, 0x0455, 0x0456, 0x03F3, 0x03BF, 0x03BD
+};
+
+static void generateCorpus(Corpus *corpus, int32_t kind) {
+    uint32_t seed = 31337 + (uint32_t)kind;  /* fixed seed - corpora must not vary */
+    for (int32_t n = 0; n < IDENTIFIERS_PER_CORPUS; n++) {
+        char *s = corpus->strings[n];
+        int32_t i = 0;
+        /* Adversarial inputs are long; representative ones are short. */
+        int32_t length = (kind == 3) ? 30 + (int32_t)((seed >> 16) % 30)
+                                     : 3 + (int32_t)((seed >> 16) % 15);
+        for (int32_t j = 0; j < length; j++) {
+            seed = seed * 1103515245 + 12345;
+            uint32_t r = seed >> 16;
+            switch (kind) {
+            case 0: /* ascii */
+                i = appendUTF8(s, i, (uint32_t)asciiChars[r % (sizeof(asciiChars) - 1)]);
+                break;
+            case 1: /* latin-accent: every fourth char accented */
+                if ((j & 3) == 3) {
+                    i = appendUTF8(s, i, latinAccents[r % UPRV_LENGTHOF(latinAccents)]);
+                } else {
+                    i = appendUTF8(s, i, (uint32_t)asciiChars[r % 26]);
+                }
+                break;
+            case 2: /* cyrillic-mixed: every third char a lookalike */
+                if ((j % 3) == 2) {
+                    i = appendUTF8(s, i, confusables[r % UPRV_LENGTHOF(confusables)]);
+                } else {
+                    i = appendUTF8(s, i, (uint32_t)asciiChars[r % 26]);
+                }
+                break;
+            default: /* confusable-dense: lookalikes only */
+                i = appendUTF8(s, i, confusables[r % UPRV_LENGTHOF(confusables)]);
+                break;
+            }
+        }
+        /* Identifiers must not start with a digit or _ for IDNA. */
+        if ((uint8_t)s[0] < 0x80 && !(s[0] >= 'a' && s[0] <= 'z')) {
+            s[0] = 'x';
+        }
+        s[i] = 0;
+    }
+}
+
+enum CheckType { CHECK_CONFUSABLE, CHECK_RESTRICTION, CHECK_IDNA, CHECK_TYPE_COUNT };
+static const char *const checkNames[CHECK_TYPE_COUNT] = {
+    "confusable", "restriction", "idna-toascii"
+};
+
+static int U_CALLCONV compareDoubles(const void *a, const void *b) {
+    double diff = *(const double *)a - *(const double *)b;
+    return diff < 0 ? -1 : diff > 0 ? 1 : 0;
+}
+
+static UOption options[] = {
+    UOPTION_HELP_H,             /* 0 */
+    UOPTION_HELP_QUESTION_MARK, /* 1 */
+    UOPTION_DEF("inner-repeats", 'i', UOPT_REQUIRES_ARG), /* 2 */
+    UOPTION_VERBOSE             /* 3 */
+};
+
+int main(int argc, char *argv[]) {
+    const char *pname = argv[0];
+    int32_t innerRepeats = DEFAULT_INNER_REPEATS;
+    UBool verbose = FALSE;
+    UErrorCode status = U_ZERO_ERROR;
+
+    argc = u_parseArgs(argc, argv, UPRV_LENGTHOF(options), options);
+    if (argc < 0 || options[0].doesOccur || options[1].doesOccur) {
+        fprintf(stderr,
+                "Usage: %s [OPTIONS]\n"
+                "\tTimes uspoof/IDNA checks per identifier and prints latency percentiles.\n"
+                "Options:\n"
+                "\t-h or -? or --help     this usage text\n"
+                "\t-i or --inner-repeats  calls per identifier per sample (default %d)\n"
+                "\t-v or --verbose        print flagged-identifier counts\n",
+                pname, DEFAULT_INNER_REPEATS);
+        return argc < 0 ? 1 : 0;
+    }
+    if (options[2].doesOccur) {
+        innerRepeats = atoi(options[2].value);
+        if (innerRepeats < 1) {
+            innerRepeats = 1;
+        }
+    }
+    if (options[3].doesOccur) {
+        verbose = TRUE;
+    }
+
+    USpoofChecker *confusableChecker = uspoof_open(&status);
+    uspoof_setChecks(confusableChecker, USPOOF_CONFUSABLE, &status);
+    USpoofChecker *restrictionChecker = uspoof_open(&status);
+    uspoof_setChecks(restrictionChecker, USPOOF_RESTRICTION_LEVEL, &status);
+    uspoof_setRestrictionLevel(restrictionChecker, USPOOF_MODERATELY_RESTRICTIVE);
+    UIDNA *idna = uidna_openUTS46(UIDNA_CHECK_BIDI | UIDNA_CHECK_CONTEXTJ, &status);
+    if (U_FAILURE(status)) {
+        fprintf(stderr, "%s: setup failed: %s\n", pname, u_errorName(status));
+        return 2;
+    }
+
+    static Corpus corpora[4];
+    corpora[0].name = "ascii";
+    corpora[1].name = "latin-accent";
+    corpora[2].name = "cyrillic-mixed";
+    corpora[3].name = "confusable-dense";
+    for (int32_t k = 0; k < UPRV_LENGTHOF(corpora); k++) {
+        generateCorpus(&corpora[k], k);
+    }
+
+    static double samples[IDENTIFIERS_PER_CORPUS];
+    char dest[4 * MAX_IDENTIFIER_LENGTH + 16];
+
+    printf("%-18s %-14s %10s %10s %10s %10s\n",
+           "corpus", "check", "p50 ns", "p90 ns", "p99 ns", "max ns");
+    for (int32_t k = 0; k < UPRV_LENGTHOF(corpora); k++) {
+        const Corpus *corpus = &corpora[k];
+        for (int32_t c = 0; c < CHECK_TYPE_COUNT; c++) {
+            int32_t flagged = 0;
+            for (int32_t n = 0; n < IDENTIFIERS_PER_CORPUS; n++) {
+                const char *id = corpus->strings[n];
+                int32_t idLen = (int32_t)strlen(id);
+                UTimer start, stop;
+                utimer_getTime(&start);
+                for (int32_t r = 0; r < innerRepeats; r++) {
+                    UErrorCode subStatus = U_ZERO_ERROR;
+                    switch ((CheckType)c) {
+                    case CHECK_CONFUSABLE:
+                        if (uspoof_checkUTF8(confusableChecker, id, idLen, NULL, &subStatus) != 0) {
+                            flagged++;
+                        }
+                        break;
+                    case CHECK_RESTRICTION:
+                        if (uspoof_checkUTF8(restrictionChecker, id, idLen, NULL, &subStatus) != 0) {
+                            flagged++;
+                        }
+                        break;
+                    default: {
+                        UIDNAInfo info = UIDNA_INFO_INITIALIZER;
+                        uidna_nameToASCII_UTF8(idna, id, idLen, dest, (int32_t)sizeof(dest),
+                                               &info, &subStatus);
+                        if (info.errors != 0) {
+                            flagged++;
+                        }
+                        break;
+                    }
+                    }
+                }
+                utimer_getTime(&stop);
+                samples[n] = utimer_getDeltaSeconds(&start, &stop) / innerRepeats;
+            }
+            qsort(samples, IDENTIFIERS_PER_CORPUS, sizeof(double), compareDoubles);
+            printf("%-18s %-14s %10.0f %10.0f %10.0f %10.0f\n",
+                   corpus->name, checkNames[c],
+                   samples[IDENTIFIERS_PER_CORPUS / 2] * 1.0E9,
+                   samples[(IDENTIFIERS_PER_CORPUS * 90) / 100] * 1.0E9,
+                   samples[(IDENTIFIERS_PER_CORPUS * 99) / 100] * 1.0E9,
+                   samples[IDENTIFIERS_PER_CORPUS - 1] * 1.0E9);
+            if (verbose) {
+                printf("# %s/%s flagged %d of %d identifier checks\n",
+                       corpus->name, checkNames[c], (int)flagged,
+                       (int)(IDENTIFIERS_PER_CORPUS * innerRepeats));
+            }
+        }
+    }
+
+    uidna_close(idna);
+    uspoof_close(restrictionChecker);
+    uspoof_close(confusableChecker);
+    return 0;
+}
+
+#else
+
+int main(int, char **) {
+    fprintf(stderr, "spoofperf: requires regex, normalization and IDNA support\n");
+    return 0;
+}
+
+#endif
@@ -0,0 +1,280 @@
+/*
+***********************************************************************
+* © 2016 and later: Unicode, Inc. and others.
+* License & terms of use: http://www.unicode.org/copyright.html#License
+***********************************************************************
+*/
+/*
+ * startupperf: first-use latency measurement.
+ *
+ * First-use costs (data file mapping in udata.cpp, rule building,
+ * dictionary loading) are paid once per process and are invisible to the
+ * looping perf targets, whose warmup pass absorbs them. This tool forks
+ * a fresh child process for every sample, times exactly one first-use
+ * path inside the child, and reports per-scenario figures:
+ *
+ *   ures-open-en     first resource bundle open (maps the common data)
+ *   unorm2-nfc       first unorm2_getNFCInstance()
+ *   ubrk-word-root   first word break iterator (rule based)
+ *   ubrk-word-th     first Thai word break iterator (loads the dictionary)
+ *   ucol-open-root   first ucol_open() for the root locale
+ *   u-init           u_init()
+ *   sequential       all of the above in one process, timed step by step,
+ *                    showing the incremental cost once the common data is
+ *                    already mapped
+ *
+ * The first sample of the run is taken before this process has touched
+ * any ICU data, so it sees the page cache as the system left it; every
+ * later sample sees pages warmed by its predecessors. The tool therefore
+ * reports the first sample separately from the min/median of the warm
+ * repetitions. For a true cold-cache measurement, drop the OS page cache
+ * (e.g. /proc/sys/vm/drop_caches) between runs; no unprivileged process
+ * can do that itself.
+ *
+ * Forking is POSIX-only; on Windows this target only prints a notice.
+ *
+ * Usage: startupperf [-i iterations] [-v]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "unicode/utypes.h"
+#include "unicode/uclean.h"
+#include "unicode/ures.h"
+#include "unicode/unorm2.h"
+#include "unicode/ubrk.h"
+#include "unicode/ucol.h"
+#include "unicode/utimer.h"
+#include "cmemory.h"
+#include "uoptions.h"
+
+#if U_PLATFORM_HAS_WIN32_API
+
+int main(int, char **) {
+    fprintf(stderr, "startupperf: needs fork(), not supported on this platform\n");
+    return 0;
+}
+
+#else
+
+#include <unistd.h>
+#include <sys/wait.h>
+
+#define DEFAULT_ITERATIONS 10
+#define MAX_SEQ_STEPS 8
+
+static void scenario_uresOpenEn(UErrorCode *status) {
+    UResourceBundle *r = ures_open(NULL, "en", status);
+    ures_close(r);
+}
+
+static void scenario_unorm2Nfc(UErrorCode *status) {
+    unorm2_getNFCInstance(status);  /* singleton, not closed */
+}
+
+static void scenario_ubrkWordRoot(UErrorCode *status) {
+    UBreakIterator *b = ubrk_open(UBRK_WORD, "root", NULL, 0, status);
+    ubrk_close(b);
+}
+
+static void scenario_ubrkWordTh(UErrorCode *status) {
+    UBreakIterator *b = ubrk_open(UBRK_WORD, "th", NULL, 0, status);
+    ubrk_close(b);
+}
+
+static void scenario_ucolOpenRoot(UErrorCode *status) {
+    UCollator *c = ucol_open("", status);
+    ucol_close(c);
+}
+
+static void scenario_uInit(UErrorCode *status) {
+    u_init(status);
+}
+
+typedef void Scenario(UErrorCode *status);
+
+static const struct {
+    const char *name;
+    Scenario *fn;
+} scenarios[] = {
+    { "ures-open-en",   scenario_uresOpenEn },
+    { "unorm2-nfc",     scenario_unorm2Nfc },
+    { "ubrk-word-root", scenario_ubrkWordRoot },
+    { "ubrk-word-th",   scenario_ubrkWordTh },
+    { "ucol-open-root", scenario_ucolOpenRoot },
+    { "u-init",         scenario_uInit }
+};
+
+/* Runs one scenario in a freshly forked child and returns the measured
+   seconds, or a negative value on failure. The child has never touched
+   ICU (the parent only parses options), so the scenario is its true
+   first use. */
+static double runInChild(Scenario *fn) {
+    int fds[2];
+    double seconds = -1.0;
+    pid_t child;
+
+    if (pipe(fds) != 0) {
+        return -1.0;
+    }
+    child = fork();
+    if (child < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        return -1.0;
+    }
+    if (child == 0) {
+        UErrorCode status = U_ZERO_ERROR;
+        UTimer start, stop;
+        close(fds[0]);
+        utimer_getTime(&start);
+        fn(&status);
+        utimer_getTime(&stop);
+        seconds = utimer_getDeltaSeconds(&start, &stop);
+        if (U_FAILURE(status)) {
+            seconds = -1.0;
+        }
+        if (write(fds[1], &seconds, sizeof(seconds)) != sizeof(seconds)) {
+            _exit(1);
+        }
+        _exit(0);
+    }
+    close(fds[1]);
+    if (read(fds[0], &seconds, sizeof(seconds)) != sizeof(seconds)) {
+        seconds = -1.0;
+    }
+    close(fds[0]);
+    waitpid(child, NULL, 0);
+    return seconds;
+}
+
+/* Runs every scenario back to back in one fresh child, timing each step,
+   so that the difference against the per-process figures shows how much
+   of each first use is the shared common-data mapping. */
+static int32_t runSequentialChild(double times[MAX_SEQ_STEPS]) {
+    int fds[2];
+    int32_t numScenarios = UPRV_LENGTHOF(scenarios);
+    pid_t child;
+
+    if (pipe(fds) != 0 || numScenarios > MAX_SEQ_STEPS) {
+        return -1;
+    }
+    child = fork();
+    if (child < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        return -1;
+    }
+    if (child == 0) {
+        close(fds[0]);
+        for (int32_t i = 0; i < numScenarios; i++) {
+            UErrorCode status = U_ZERO_ERROR;
+            UTimer start, stop;
+            utimer_getTime(&start);
+            scenarios[i].fn(&status);
+            utimer_getTime(&stop);
+            times[i] = U_SUCCESS(status) ? utimer_getDeltaSeconds(&start, &stop) : -1.0;
+        }
+        if (write(fds[1], times, numScenarios * sizeof(double)) !=
+                (ssize_t)(numScenarios * sizeof(double))) {
+            _exit(1);
+        }
+        _exit(0);
+    }
+    close(fds[1]);
+    if (read(fds[0], times, numScenarios * sizeof(double)) !=
+            (ssize_t)(numScenarios * sizeof(double))) {
+        numScenarios = -1;
+    }
+    close(fds[0]);
+    waitpid(child, NULL, 0);
+    return numScenarios;
+}
+
+static int U_CALLCONV compareDoubles(const void *a, const void *b) {
+    double diff = *(const double *)a - *(const double *)b;
+    return diff < 0 ? -1 : diff > 0 ? 1 : 0;
+}
+
+static UOption options[] = {
+    UOPTION_HELP_H,             /* 0 */
+    UOPTION_HELP_QUESTION_MARK, /* 1 */
+    UOPTION_DEF("iterations", 'i', UOPT_REQUIRES_ARG), /* 2 */
+    UOPTION_VERBOSE             /* 3 */
+};
+
+int main(int argc, char *argv[]) {
+    const char *pname = argv[0];
+    int32_t iterations = DEFAULT_ITERATIONS;
+    UBool verbose = FALSE;
+
+    argc = u_parseArgs(argc, argv, UPRV_LENGTHOF(options), options);
+    if (argc < 0 || options[0].doesOccur || options[1].doesOccur) {
+        fprintf(stderr,
+                "Usage: %s [OPTIONS]\n"
+                "\tMeasures ICU first-use latencies, one fresh process per sample.\n"
+                "Options:\n"
+                "\t-h or -? or --help   this usage text\n"
+                "\t-i or --iterations   samples per scenario (default %d)\n"
+                "\t-v or --verbose      print every sample\n",
+                pname, DEFAULT_ITERATIONS);
+        return argc < 0 ? 1 : 0;
+    }
+    if (options[2].doesOccur) {
+        iterations = atoi(options[2].value);
+        if (iterations < 1) {
+            iterations = 1;
+        }
+    }
+    if (options[3].doesOccur) {
+        verbose = TRUE;
+    }
+
+    double *samples = (double *)malloc(iterations * sizeof(double));
+    if (samples == NULL) {
+        return 1;
+    }
+
+    printf("%-16s %12s %12s %12s\n", "scenario", "first us", "min us", "median us");
+    for (int32_t s = 0; s < UPRV_LENGTHOF(scenarios); s++) {
+        double first = -1.0;
+        int32_t validSamples = 0;
+        for (int32_t i = 0; i < iterations; i++) {
+            double t = runInChild(scenarios[s].fn);
+            if (verbose) {
+                printf("# %s sample %d: %.1f us\n", scenarios[s].name, (int)i, t * 1.0E6);
+            }
+            if (i == 0) {
+                /* Sees the page cache as the predecessors left it; for the
+                   very first scenario of the run, as the system left it. */
+                first = t;
+            } else if (t >= 0.0) {
+                samples[validSamples++] = t;
+            }
+        }
+        if (validSamples > 0) {
+            qsort(samples, validSamples, sizeof(double), compareDoubles);
+            printf("%-16s %12.1f %12.1f %12.1f\n", scenarios[s].name,
+                   first * 1.0E6, samples[0] * 1.0E6,
+                   samples[validSamples / 2] * 1.0E6);
+        } else {
+            printf("%-16s %12.1f %12s %12s\n", scenarios[s].name, first * 1.0E6, "-", "-");
+        }
+    }
+
+    double seqTimes[MAX_SEQ_STEPS];
+    int32_t seqCount = runSequentialChild(seqTimes);
+    if (seqCount > 0) {
+        printf("sequential (one process, incremental):\n");
+        for (int32_t s = 0; s < seqCount; s++) {
+            printf("%-16s %12.1f\n", scenarios[s].name, seqTimes[s] * 1.0E6);
+        }
+    }
+
+    free(samples);
+    return 0;
+}
+
+#endif /* !U_PLATFORM_HAS_WIN32_API */
@@ -0,0 +1,181 @@
+/*
+***********************************************************************
+* © 2016 and later: Unicode, Inc. and others.
+* License & terms of use: http://www.unicode.org/copyright.html#License
+***********************************************************************
+*/
+/*
+ * threadscale: throughput of shared ICU paths under thread contention.
+ *
+ * Every test exists at 1, 2, 4 and 8 threads; run the whole group and
+ * compare the per-operation figures to get a throughput-vs-threads
+ * curve. Flat per-operation cost means the path scales; cost growing
+ * with the thread count means the threads serialize on a shared lock or
+ * cache. Covered paths:
+ *
+ *   ResBundOpen   ures_open/ures_close  (resource bundle cache mutex)
+ *   CnvOpen       ucnv_open/ucnv_close  (converter cache)
+ *   CollCreate    Collator::createInstance/delete  (UnifiedCache get)
+ *   StrcollShared ucol_strcoll on one shared collator  (read-only use
+ *                 of an immutable object; the scaling baseline)
+ */
+
+#include "unicode/uperf.h"
+#include "unicode/ures.h"
+#include "unicode/ucnv.h"
+#include "unicode/ucol.h"
+#include "unicode/coll.h"
+#include "cmemory.h"
+#include <stdio.h>
+
+#define OPEN_CLOSE_PER_THREAD 1000
+#define CREATE_PER_THREAD 200
+#define STRCOLL_PER_THREAD 10000
+
+class ResBundOpen : public UPerfThreadedFunction {
+public:
+    ResBundOpen(int32_t numThreads) : UPerfThreadedFunction(numThreads) {}
+    virtual void threadCall(UErrorCode* status) {
+        static const char* const locales[] = { "en", "fr", "de", "ja", "ru", "zh_Hans", "es", "ar" };
+        for (int32_t i = 0; i < OPEN_CLOSE_PER_THREAD && U_SUCCESS(*status); i++) {
+            UResourceBundle *r = ures_open(NULL, locales[i % UPRV_LENGTHOF(locales)], status);
+            ures_close(r);
+        }
+    }
+    virtual long getOperationsPerIteration() {
+        return (long)mNumThreads * OPEN_CLOSE_PER_THREAD;
+    }
+};
+
+class CnvOpen : public UPerfThreadedFunction {
+public:
+    CnvOpen(int32_t numThreads) : UPerfThreadedFunction(numThreads) {}
+    virtual void threadCall(UErrorCode* status) {
+        static const char* const names[] = { "UTF-8", "Shift-JIS", "ISO-8859-1", "GB18030" };
+        for (int32_t i = 0; i < OPEN_CLOSE_PER_THREAD && U_SUCCESS(*status); i++) {
+            UConverter *cnv = ucnv_open(names[i % UPRV_LENGTHOF(names)], status);
+            ucnv_close(cnv);
+        }
+    }
+    virtual long getOperationsPerIteration() {
+        return (long)mNumThreads * OPEN_CLOSE_PER_THREAD;
+    }
+};
+
+class CollCreate : public UPerfThreadedFunction {
+public:
+    CollCreate(int32_t numThreads) : UPerfThreadedFunction(numThreads) {}
+    virtual void threadCall(UErrorCode* status) {
+        for (int32_t i = 0; i < CREATE_PER_THREAD && U_SUCCESS(*status); i++) {
+            Collator *coll = Collator::createInstance(Locale::getGerman(), *status);
+            delete coll;
+        }
+    }
+    virtual long getOperationsPerIteration() {
+        return (long)mNumThreads * CREATE_PER_THREAD;
+    }
+};
+
+class StrcollShared : public UPerfThreadedFunction {
+public:
+    StrcollShared(int32_t numThreads, UErrorCode &status)
+            : UPerfThreadedFunction(numThreads), coll(NULL) {
+        coll = ucol_open("en", &status);
+    }
+    ~StrcollShared() {
+        if (coll != NULL) {
+            ucol_close(coll);
+        }
+    }
+    virtual void threadCall(UErrorCode* status) {
+        static const UChar left[] = { 0x63, 0x6F, 0x6C, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0 };  /* "collation" */
+        static const UChar right[] = { 0x63, 0x6F, 0x6C, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0 };       /* "collator" */
+        (void)status;
+        for (int32_t i = 0; i < STRCOLL_PER_THREAD; i++) {
+            ucol_strcoll(coll, left, -1, right, -1);
+        }
+    }
+    virtual long getOperationsPerIteration() {
+        return (long)mNumThreads * STRCOLL_PER_THREAD;
+    }
+private:
+    UCollator *coll;
+};
+
+class ThreadScalePerfTest : public UPerfTest {
+public:
+    ThreadScalePerfTest(int32_t argc, const char* argv[], UErrorCode& status)
+            : UPerfTest(argc, argv, status) {}
+
+    virtual UPerfFunction* runIndexedTest(int32_t index, UBool exec,
+                                          const char* &name, char* par = NULL);
+
+    UPerfFunction* TestResBundOpen1() { return new ResBundOpen(1); }
+    UPerfFunction* TestResBundOpen2() { return new ResBundOpen(2); }
+    UPerfFunction* TestResBundOpen4() { return new ResBundOpen(4); }
+    UPerfFunction* TestResBundOpen8() { return new ResBundOpen(8); }
+
+    UPerfFunction* TestCnvOpen1() { return new CnvOpen(1); }
+    UPerfFunction* TestCnvOpen2() { return new CnvOpen(2); }
+    UPerfFunction* TestCnvOpen4() { return new CnvOpen(4); }
+    UPerfFunction* TestCnvOpen8() { return new CnvOpen(8); }
+
+    UPerfFunction* TestCollCreate1() { return new CollCreate(1); }
+    UPerfFunction* TestCollCreate2() { return new CollCreate(2); }
+    UPerfFunction* TestCollCreate4() { return new CollCreate(4); }
+    UPerfFunction* TestCollCreate8() { return new CollCreate(8); }
+
+    UPerfFunction* TestStrcollShared1() { return newStrcollShared(1); }
+    UPerfFunction* TestStrcollShared2() { return newStrcollShared(2); }
+    UPerfFunction* TestStrcollShared4() { return newStrcollShared(4); }
+    UPerfFunction* TestStrcollShared8() { return newStrcollShared(8); }
+
+private:
+    UPerfFunction* newStrcollShared(int32_t numThreads) {
+        UErrorCode status = U_ZERO_ERROR;
+        StrcollShared *testCase = new StrcollShared(numThreads, status);
+        if (U_FAILURE(status)) {
+            delete testCase;
+            return NULL;
+        }
+        return testCase;
+    }
+};
+
+UPerfFunction* ThreadScalePerfTest::runIndexedTest(int32_t index, UBool exec,
+                                                   const char* &name, char* /*par*/) {
+    TESTCASE_AUTO_BEGIN;
+    TESTCASE_AUTO(TestResBundOpen1);
+    TESTCASE_AUTO(TestResBundOpen2);
+    TESTCASE_AUTO(TestResBundOpen4);
+    TESTCASE_AUTO(TestResBundOpen8);
+    TESTCASE_AUTO(TestCnvOpen1);
+    TESTCASE_AUTO(TestCnvOpen2);
+    TESTCASE_AUTO(TestCnvOpen4);
+    TESTCASE_AUTO(TestCnvOpen8);
+    TESTCASE_AUTO(TestCollCreate1);
+    TESTCASE_AUTO(TestCollCreate2);
+    TESTCASE_AUTO(TestCollCreate4);
+    TESTCASE_AUTO(TestCollCreate8);
+    TESTCASE_AUTO(TestStrcollShared1);
+    TESTCASE_AUTO(TestStrcollShared2);
+    TESTCASE_AUTO(TestStrcollShared4);
+    TESTCASE_AUTO(TestStrcollShared8);
+    TESTCASE_AUTO_END;
+    return NULL;
+}
+
+int main(int argc, const char *argv[]) {
+    UErrorCode status = U_ZERO_ERROR;
+    ThreadScalePerfTest test(argc, argv, status);
+    if (U_FAILURE(status)) {
+        fprintf(stderr, "FAILED to create ThreadScalePerfTest object. Error: %s\n",
+                u_errorName(status));
+        return 1;
+    }
+    if (test.run() == FALSE) {
+        fprintf(stderr, "FAILED: Tests could not be run, please check the arguments.\n");
+        return -1;
+    }
+    return 0;
+}
@@ -150,13 +150,69 @@ void doForwardTest() {
 
 #endif
 
+// Built-in corpora for the dictionary-based break engines. Real corpus
+// files are not shipped with the source tree, so a deterministic text is
+// synthesized by concatenating common words pseudo-randomly; the fixed
+// seed keeps the text identical across runs and platforms. Thai and
+// Khmer run without inter-word spaces, as in natural text; Japanese
+// mixes Han compounds with Hiragana particles and inserts an ideographic
+// full stop every few words.
+
+static const UChar gThaiWords[][10] = {
+    {0x0E01,0x0E32,0x0E23,0}, {0x0E1B,0x0E23,0x0E30,0x0E40,0x0E17,0x0E28,0},
+    {0x0E20,0x0E32,0x0E29,0x0E32,0}, {0x0E44,0x0E17,0x0E22,0},
+    {0x0E04,0x0E19,0}, {0x0E43,0x0E2B,0x0E0D,0x0E48,0},
+    {0x0E19,0x0E49,0x0E33,0}, {0x0E43,0x0E08,0},
+    {0x0E21,0x0E32,0x0E01,0}, {0x0E40,0x0E21,0x0E37,0x0E2D,0x0E07,0},
+    {0x0E2B,0x0E19,0x0E31,0x0E07,0x0E2A,0x0E37,0x0E2D,0}, {0x0E40,0x0E23,0x0E35,0x0E22,0x0E19,0}
+};
+
+static const UChar gKhmerWords[][10] = {
+    {0x1797,0x17B6,0x179F,0x17B6,0}, {0x1781,0x17D2,0x1798,0x17C2,0x179A,0},
+    {0x1794,0x17D2,0x179A,0x1791,0x17C1,0x179F,0}, {0x1798,0x1793,0x17BB,0x179F,0x17D2,0x179F,0},
+    {0x1791,0x17B9,0x1780,0}, {0x1792,0x17C6,0},
+    {0x179F,0x17C0,0x179C,0x1797,0x17C5,0}, {0x179A,0x17C0,0x1793,0}
+};
+
+static const UChar gJapaneseWords[][10] = {
+    {0x65E5,0x672C,0}, {0x8A9E,0}, {0x306E,0}, {0x306F,0}, {0x3092,0},
+    {0x52C9,0x5F37,0}, {0x3059,0x308B,0}, {0x5B66,0x751F,0}, {0x3067,0x3059,0},
+    {0x6771,0x4EAC,0}, {0x306B,0}, {0x884C,0x304D,0x307E,0x3059,0}
+};
+
+#define DICT_CORPUS_LENGTH 8000
+
+static UnicodeString generateDictCorpus(const UChar words[][10], int32_t wordCount,
+                                        UChar separator, int32_t separatorInterval) {
+    UnicodeString corpus;
+    uint32_t seed = 98765;  // fixed seed - data must not vary between runs
+    int32_t sinceSeparator = 0;
+    while (corpus.length() < DICT_CORPUS_LENGTH) {
+        seed = seed * 1103515245 + 12345;
+        corpus.append(words[(seed >> 16) % (uint32_t)wordCount]);
+        if (++sinceSeparator >= separatorInterval) {
+            corpus.append(separator);
+            sinceSeparator = 0;
+        }
+    }
+    return corpus;
+}
+
 UPerfFunction* BreakIteratorPerformanceTest::TestICUForward()
 {
+  if(m_mode_ == NULL || m_file_ == NULL) {
+    fprintf(stderr, "TestICUForward requires -m and -f\n");
+    return NULL;
+  }
   return new ICUForward(locale, m_mode_, m_file_, m_fileLen_);
 }
 
 UPerfFunction* BreakIteratorPerformanceTest::TestICUIsBound()
 {
+  if(m_mode_ == NULL || m_file_ == NULL) {
+    fprintf(stderr, "TestICUIsBound requires -m and -f\n");
+    return NULL;
+  }
   return new ICUIsBound(locale, m_mode_, m_file_, m_fileLen_);
 }
 
@@ -170,6 +226,41 @@ UPerfFunction* BreakIteratorPerformanceTest::TestDarwinIsBound()
   return NULL;
 }
 
+UPerfFunction* BreakIteratorPerformanceTest::TestThaiDictForward()
+{
+  return new ICUDictForward("th", generateDictCorpus(gThaiWords, UPRV_LENGTHOF(gThaiWords), 0x0020, 20));
+}
+
+UPerfFunction* BreakIteratorPerformanceTest::TestKhmerDictForward()
+{
+  return new ICUDictForward("km", generateDictCorpus(gKhmerWords, UPRV_LENGTHOF(gKhmerWords), 0x0020, 20));
+}
+
+UPerfFunction* BreakIteratorPerformanceTest::TestJapaneseDictForward()
+{
+  return new ICUDictForward("ja", generateDictCorpus(gJapaneseWords, UPRV_LENGTHOF(gJapaneseWords), 0x3002, 12));
+}
+
+UPerfFunction* BreakIteratorPerformanceTest::TestThaiDictRandomAccess()
+{
+  return new ICUDictRandomAccess("th", generateDictCorpus(gThaiWords, UPRV_LENGTHOF(gThaiWords), 0x0020, 20));
+}
+
+UPerfFunction* BreakIteratorPerformanceTest::TestJapaneseDictRandomAccess()
+{
+  return new ICUDictRandomAccess("ja", generateDictCorpus(gJapaneseWords, UPRV_LENGTHOF(gJapaneseWords), 0x3002, 12));
+}
+
+UPerfFunction* BreakIteratorPerformanceTest::TestThaiWordCreate()
+{
+  return new ICUCreateWordInstance("th");
+}
+
+UPerfFunction* BreakIteratorPerformanceTest::TestThaiWordClone()
+{
+  return new ICUCloneWordInstance("th");
+}
+
 UPerfFunction* BreakIteratorPerformanceTest::runIndexedTest(int32_t index, UBool exec,
 												   const char *&name, 
 												   char* par) 
@@ -179,6 +270,13 @@ UPerfFunction* BreakIteratorPerformanceTest::runIndexedTest(int32_t index, UBool
 		TESTCASE(1, TestICUIsBound);
 		TESTCASE(2, TestDarwinForward);
 		TESTCASE(3, TestDarwinIsBound);
+		TESTCASE(4, TestThaiDictForward);
+		TESTCASE(5, TestKhmerDictForward);
+		TESTCASE(6, TestJapaneseDictForward);
+		TESTCASE(7, TestThaiDictRandomAccess);
+		TESTCASE(8, TestJapaneseDictRandomAccess);
+		TESTCASE(9, TestThaiWordCreate);
+		TESTCASE(10, TestThaiWordClone);
         default: 
             name = ""; 
             return NULL;
@@ -204,7 +302,7 @@ m_fileLen_(0)
     if(options[0].doesOccur) {
       m_mode_ = options[0].value;
       switch(options[0].value[0]) {
-      case 'w' : 
+      case 'w' :
       case 'c' :
       case 's' :
       case 'l' :
@@ -213,15 +311,17 @@ m_fileLen_(0)
         status = U_ILLEGAL_ARGUMENT_ERROR;
         break;
       }
-    } else {
-      status = U_ILLEGAL_ARGUMENT_ERROR;
     }
 
-    m_file_ = getBuffer(m_fileLen_, status);
+    // -m and -f drive the file-based tests only; the built-in
+    // dictionary-corpus tests (TestThaiDictForward etc.) need neither.
+    if(fileName != NULL) {
+      m_file_ = getBuffer(m_fileLen_, status);
+    }
 
     if(status== U_ILLEGAL_ARGUMENT_ERROR){
        fprintf(stderr, gUsageString, "ubrkperf");
-       fprintf(stderr, "\t-m or --mode        Required mode for breakiterator: char, word, line or sentence\n");
+       fprintf(stderr, "\t-m or --mode        Mode for the file-based tests: char, word, line or sentence\n");
 
        return;
     }
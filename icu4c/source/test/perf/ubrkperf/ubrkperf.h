@@ -112,6 +112,131 @@ public:
   virtual void call(UErrorCode *status) {};
 };
 
+// Forward word iteration over a built-in dictionary-language corpus.
+// setText() is called inside call() so that every iteration pays the
+// full dictionary segmentation cost instead of replaying the cached
+// break positions of the previous pass.
+class ICUDictForward : public UPerfFunction {
+protected:
+  BreakIterator *m_brkIt_;
+  UnicodeString m_corpus_;
+  int32_t m_noBreaks_;
+  UErrorCode m_status_;
+public:
+  ICUDictForward(const char *locale, const UnicodeString &corpus) :
+      m_brkIt_(NULL),
+      m_corpus_(corpus),
+      m_noBreaks_(-1),
+      m_status_(U_ZERO_ERROR)
+  {
+    m_brkIt_ = BreakIterator::createWordInstance(locale, m_status_);
+  }
+  ~ICUDictForward() { delete m_brkIt_; }
+  virtual void call(UErrorCode *status)
+  {
+    m_noBreaks_ = 0;
+    m_brkIt_->setText(m_corpus_);
+    m_brkIt_->first();
+    while(m_brkIt_->next() != BreakIterator::DONE) {
+      m_noBreaks_++;
+    }
+  }
+  virtual long getOperationsPerIteration() { return m_corpus_.length(); }
+  virtual long getEventsPerIteration() { return m_noBreaks_; }
+};
+
+// Random-access boundary queries over a dictionary-language corpus.
+// The text is set once; call() then probes pseudo-random positions with
+// isBoundary()/following(), which drives the break cache through its
+// hit/miss/rebuild paths instead of the pure sequential fill that
+// forward iteration exercises. The probe sequence is identical on every
+// call (fixed seed).
+class ICUDictRandomAccess : public UPerfFunction {
+protected:
+  BreakIterator *m_brkIt_;
+  UnicodeString m_corpus_;
+  int32_t m_noBreaks_;
+  UErrorCode m_status_;
+public:
+  enum { PROBES_PER_CALL = 2000 };
+  ICUDictRandomAccess(const char *locale, const UnicodeString &corpus) :
+      m_brkIt_(NULL),
+      m_corpus_(corpus),
+      m_noBreaks_(-1),
+      m_status_(U_ZERO_ERROR)
+  {
+    m_brkIt_ = BreakIterator::createWordInstance(locale, m_status_);
+    if(U_SUCCESS(m_status_)) {
+      m_brkIt_->setText(m_corpus_);
+    }
+  }
+  ~ICUDictRandomAccess() { delete m_brkIt_; }
+  virtual void call(UErrorCode *status)
+  {
+    uint32_t seed = 54321;  // fixed seed - the probe sequence must not vary
+    int32_t len = m_corpus_.length();
+    m_noBreaks_ = 0;
+    for(int32_t i = 0; i < PROBES_PER_CALL; i++) {
+      seed = seed * 1103515245 + 12345;
+      int32_t pos = (int32_t)((seed >> 16) % (uint32_t)len);
+      if(i & 1) {
+        if(m_brkIt_->following(pos) != BreakIterator::DONE) {
+          m_noBreaks_++;
+        }
+      } else {
+        if(m_brkIt_->isBoundary(pos)) {
+          m_noBreaks_++;
+        }
+      }
+    }
+  }
+  virtual long getOperationsPerIteration() { return PROBES_PER_CALL; }
+  virtual long getEventsPerIteration() { return m_noBreaks_; }
+};
+
+// Cost of creating a word BreakIterator from scratch, including rule and
+// dictionary data lookup.
+class ICUCreateWordInstance : public UPerfFunction {
+protected:
+  const char *m_locale_;
+public:
+  enum { CREATES_PER_CALL = 100 };
+  ICUCreateWordInstance(const char *locale) : m_locale_(locale) {}
+  virtual void call(UErrorCode *status)
+  {
+    for(int32_t i = 0; i < CREATES_PER_CALL; i++) {
+      BreakIterator *b = BreakIterator::createWordInstance(m_locale_, *status);
+      delete b;
+    }
+  }
+  virtual long getOperationsPerIteration() { return CREATES_PER_CALL; }
+};
+
+// Cost of cloning an existing word BreakIterator; compare against
+// ICUCreateWordInstance to see what a per-use clone saves.
+class ICUCloneWordInstance : public UPerfFunction {
+protected:
+  BreakIterator *m_proto_;
+  UErrorCode m_status_;
+public:
+  enum { CLONES_PER_CALL = 100 };
+  ICUCloneWordInstance(const char *locale) :
+      m_proto_(NULL),
+      m_status_(U_ZERO_ERROR)
+  {
+    m_proto_ = BreakIterator::createWordInstance(locale, m_status_);
+  }
+  ~ICUCloneWordInstance() { delete m_proto_; }
+  virtual void call(UErrorCode *status)
+  {
+    for(int32_t i = 0; i < CLONES_PER_CALL; i++) {
+      BreakIterator *b = m_proto_->clone();
+      delete b;
+    }
+  }
+  virtual long getOperationsPerIteration() { return CLONES_PER_CALL; }
+};
+
 class BreakIteratorPerformanceTest : public UPerfTest {
 private:
   const char* m_mode_;
@@ -131,6 +256,14 @@ public:
   UPerfFunction* TestDarwinForward();
   UPerfFunction* TestDarwinIsBound();
 
+  UPerfFunction* TestThaiDictForward();
+  UPerfFunction* TestKhmerDictForward();
+  UPerfFunction* TestJapaneseDictForward();
+  UPerfFunction* TestThaiDictRandomAccess();
+  UPerfFunction* TestJapaneseDictRandomAccess();
+  UPerfFunction* TestThaiWordCreate();
+  UPerfFunction* TestThaiWordClone();
+
 };
 
 #endif // UBRKPERF_H
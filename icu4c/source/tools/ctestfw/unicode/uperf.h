@@ -17,6 +17,9 @@
 #include "unicode/utimer.h"
 #include "ucbuf.h"
 
+#include <stdio.h>
+#include <thread>
+
 // Forward declarations from uoptions.h.
 struct UOption;
 typedef struct UOption UOption;
@@ -129,6 +132,58 @@ public:
 
 };
 
+/**
+ * Base class for thread-scaling tests. call() runs threadCall() once in
+ * each of numThreads concurrent threads and joins them; running the same
+ * test at 1, 2, 4, ... threads and comparing the driver's per-operation
+ * figures yields a throughput-vs-threads curve for the shared path that
+ * threadCall() exercises.
+ *
+ * Header-only on purpose: only targets that instantiate it need to link
+ * with $(LIB_THREAD), the ctestfw library itself is unchanged.
+ */
+class UPerfThreadedFunction : public UPerfFunction {
+public:
+    enum { MAX_PERF_THREADS = 32 };
+
+    UPerfThreadedFunction(int32_t numThreads)
+            : mNumThreads(numThreads) {
+        if (mNumThreads < 1) {
+            mNumThreads = 1;
+        } else if (mNumThreads > MAX_PERF_THREADS) {
+            mNumThreads = MAX_PERF_THREADS;
+        }
+    }
+
+    /**
+     * The per-thread workload; runs concurrently in every thread.
+     * Each thread gets its own UErrorCode.
+     */
+    virtual void threadCall(UErrorCode* status) = 0;
+
+    virtual void call(UErrorCode* status) {
+        std::thread threads[MAX_PERF_THREADS];
+        UErrorCode statuses[MAX_PERF_THREADS];
+        for (int32_t i = 0; i < mNumThreads; i++) {
+            statuses[i] = U_ZERO_ERROR;
+            UErrorCode *threadStatus = &statuses[i];
+            threads[i] = std::thread([this, threadStatus]() {
+                threadCall(threadStatus);
+            });
+        }
+        for (int32_t i = 0; i < mNumThreads; i++) {
+            threads[i].join();
+            if (U_FAILURE(statuses[i]) && U_SUCCESS(*status)) {
+                *status = statuses[i];
+            }
+        }
+    }
+
+    int32_t getNumThreads() const { return mNumThreads; }
+
+protected:
+    int32_t mNumThreads;
+};
 
 class T_CTEST_EXPORT_API UPerfTest {
 public:
@@ -185,6 +240,11 @@ protected:
     int32_t      iterations;
     int32_t      time;
     const char*  locale;
+    UBool        countAllocs;
+    const char*  baselineFile;
+    FILE*        dumpFP;
+    int32_t      dumpCount;
+    UBool        hwCounters;
 private:
     UPerfTest*   caller;
     char*        path;           // specifies subtests
@@ -15,6 +15,21 @@
 #include "cmemory.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#if U_PLATFORM != U_PF_WINDOWS && U_PLATFORM != U_PF_CYGWIN
+#include <sys/time.h>
+#include <sys/resource.h>
+#endif
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
 
 #if !UCONFIG_NO_CONVERSION
 
@@ -43,7 +58,16 @@ const char UPerfTest::gUsageString[] =
     "\t-l or --line-mode    The data file should be processed in line mode\n"
     "\t-b or --bulk-mode    The data file should be processed in file based.\n"
     "\t                     Cannot be used with --line-mode\n"
-    "\t-L or --locale       Locale for the test\n";
+    "\t-L or --locale       Locale for the test\n"
+    "\t-a or --count-allocations  report ICU heap activity (calls, bytes,\n"
+    "\t                     live-bytes high-water mark, peak RSS) for one\n"
+    "\t                     steady-state iteration of each test\n"
+    "\t-D or --dump-json    write per-test statistics as JSON to the given file\n"
+    "\t-B or --baseline     compare medians against a JSON file previously written\n"
+    "\t                     by --dump-json\n"
+    "\t-C or --hw-counters  report hardware counters (cycles, instructions,\n"
+    "\t                     branch misses, LLC misses) for one steady-state\n"
+    "\t                     iteration of each test (Linux perf_event only)\n";
 
 enum
 {
@@ -60,6 +84,10 @@ enum
     LINE_MODE,
     BULK_MODE,
     LOCALE,
+    ALLOC_COUNT,
+    DUMP_JSON,
+    BASELINE,
+    HW_COUNTERS,
     OPTIONS_COUNT
 };
 
@@ -77,9 +105,170 @@ static UOption options[OPTIONS_COUNT+20]={
     UOPTION_DEF( "time",          't', UOPT_REQUIRES_ARG),
     UOPTION_DEF( "line-mode",     'l', UOPT_NO_ARG),
     UOPTION_DEF( "bulk-mode",     'b', UOPT_NO_ARG),
-    UOPTION_DEF( "locale",        'L', UOPT_REQUIRES_ARG)
+    UOPTION_DEF( "locale",        'L', UOPT_REQUIRES_ARG),
+    UOPTION_DEF( "count-allocations", 'a', UOPT_NO_ARG),
+    UOPTION_DEF( "dump-json",     'D', UOPT_REQUIRES_ARG),
+    UOPTION_DEF( "baseline",      'B', UOPT_REQUIRES_ARG),
+    UOPTION_DEF( "hw-counters",   'C', UOPT_NO_ARG)
 };
 
+/* Counting allocator, pushed around a single iteration when
+   --count-allocations is given. Delegates to the system heap, like
+   ICU's default allocation functions, but prefixes each block with its
+   size so that free/realloc can maintain a live-bytes figure and its
+   high-water mark. The header is a UAlignedMemory multiple so the
+   returned pointer keeps maximal alignment. */
+static long countAllocCalls = 0;
+static long countAllocBytes = 0;
+static long countFreeCalls = 0;
+static long countLiveBytes = 0;
+static long countHighWater = 0;
+
+#define PERF_ALLOC_HEADER (((sizeof(size_t) + sizeof(UAlignedMemory) - 1) / sizeof(UAlignedMemory)) * sizeof(UAlignedMemory))
+
+static void * U_CALLCONV perf_countingAlloc(const void * /*context*/, size_t size) {
+    char *block = (char *)malloc(PERF_ALLOC_HEADER + size);
+    if (block == NULL) {
+        return NULL;
+    }
+    *(size_t *)block = size;
+    countAllocCalls++;
+    countAllocBytes += (long)size;
+    countLiveBytes += (long)size;
+    if (countLiveBytes > countHighWater) {
+        countHighWater = countLiveBytes;
+    }
+    return block + PERF_ALLOC_HEADER;
+}
+
+static void * U_CALLCONV perf_countingRealloc(const void * /*context*/, void *mem, size_t size) {
+    char *block = (char *)mem;
+    if (block != NULL) {
+        block -= PERF_ALLOC_HEADER;
+        countLiveBytes -= (long)*(size_t *)block;
+    }
+    block = (char *)realloc(block, PERF_ALLOC_HEADER + size);
+    if (block == NULL) {
+        return NULL;
+    }
+    *(size_t *)block = size;
+    countAllocCalls++;
+    countAllocBytes += (long)size;
+    countLiveBytes += (long)size;
+    if (countLiveBytes > countHighWater) {
+        countHighWater = countLiveBytes;
+    }
+    return block + PERF_ALLOC_HEADER;
+}
+
+static void U_CALLCONV perf_countingFree(const void * /*context*/, void *mem) {
+    if (mem != NULL) {
+        char *block = (char *)mem - PERF_ALLOC_HEADER;
+        countLiveBytes -= (long)*(size_t *)block;
+        countFreeCalls++;
+        free(block);
+    }
+}
+
+/* Peak resident set size of the process in kilobytes, or -1 where the
+   platform does not report it. */
+static long perf_peakRSSKilobytes() {
+#if U_PLATFORM == U_PF_WINDOWS || U_PLATFORM == U_PF_CYGWIN
+    return -1;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return -1;
+    }
+#if U_PLATFORM_IS_DARWIN_BASED
+    return (long)(usage.ru_maxrss / 1024);  /* reported in bytes */
+#else
+    return (long)usage.ru_maxrss;           /* reported in kilobytes */
+#endif
+#endif
+}
+
+/* Hardware counter sampling for --hw-counters, Linux perf_event only.
+   The counters wrap the same single steady-state iteration that the
+   allocation report uses, so cycle/miss figures line up with the A=
+   numbers. Counting is restricted to user space; in containers and CIs
+   where perf_event_paranoid forbids even that, the C= line says so
+   instead of reporting zeros. */
+#if defined(__linux__)
+
+enum {
+    PERF_HW_CYCLES,
+    PERF_HW_INSTRUCTIONS,
+    PERF_HW_BRANCH_MISSES,
+    PERF_HW_LLC_MISSES,
+    PERF_HW_COUNT
+};
+
+static const uint64_t perf_hwConfigs[PERF_HW_COUNT] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_BRANCH_MISSES,
+    PERF_COUNT_HW_CACHE_MISSES
+};
+
+static int perf_openHWCounter(uint64_t config) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+#endif
+
+static int U_CALLCONV perf_compareDoubles(const void *a, const void *b) {
+    double diff = *(const double *)a - *(const double *)b;
+    return diff < 0 ? -1 : diff > 0 ? 1 : 0;
+}
+
+/* Looks up the median recorded for testName in a JSON file written by
+   --dump-json. Scans the text for the name rather than fully parsing;
+   the dump format is flat and the names are unique. */
+static UBool perf_readBaselineMedian(const char *fileName, const char *testName, double *median) {
+    FILE *f;
+    char *contents, *p;
+    char pattern[256];
+    long size;
+    UBool found = FALSE;
+
+    f = fopen(fileName, "r");
+    if (f == NULL) {
+        return FALSE;
+    }
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    contents = (char *)uprv_malloc(size + 1);
+    if (contents == NULL) {
+        fclose(f);
+        return FALSE;
+    }
+    size = (long)fread(contents, 1, size, f);
+    contents[size] = 0;
+    fclose(f);
+
+    sprintf(pattern, "\"name\":\"%.200s\"", testName);
+    p = strstr(contents, pattern);
+    if (p != NULL) {
+        p = strstr(p, "\"median\":");
+        if (p != NULL) {
+            *median = atof(p + 9);
+            found = TRUE;
+        }
+    }
+    uprv_free(contents);
+    return found;
+}
+
 UPerfTest::UPerfTest(int32_t argc, const char* argv[], UErrorCode& status)
         : _argc(argc), _argv(argv), _addUsage(NULL),
           ucharBuf(NULL), encoding(""),
@@ -89,7 +278,10 @@ UPerfTest::UPerfTest(int32_t argc, const char* argv[], UErrorCode& status)
           buffer(NULL), bufferLen(0),
           verbose(FALSE), bulk_mode(FALSE),
           passes(1), iterations(0), time(0),
-          locale(NULL) {
+          locale(NULL),
+          countAllocs(FALSE), baselineFile(NULL),
+          dumpFP(NULL), dumpCount(0),
+          hwCounters(FALSE) {
     init(NULL, 0, status);
 }
 
@@ -105,7 +297,10 @@ UPerfTest::UPerfTest(int32_t argc, const char* argv[],
           buffer(NULL), bufferLen(0),
           verbose(FALSE), bulk_mode(FALSE),
           passes(1), iterations(0), time(0),
-          locale(NULL) {
+          locale(NULL),
+          countAllocs(FALSE), baselineFile(NULL),
+          dumpFP(NULL), dumpCount(0),
+          hwCounters(FALSE) {
     init(addOptions, addOptionsCount, status);
 }
 
@@ -186,6 +381,28 @@ void UPerfTest::init(UOption addOptions[], int32_t addOptionsCount,
         locale = options[LOCALE].value;
     }
 
+    if(options[ALLOC_COUNT].doesOccur) {
+        countAllocs = TRUE;
+    }
+
+    if(options[HW_COUNTERS].doesOccur) {
+        hwCounters = TRUE;
+    }
+
+    if(options[BASELINE].doesOccur) {
+        baselineFile = options[BASELINE].value;
+    }
+
+    if(options[DUMP_JSON].doesOccur) {
+        dumpFP = fopen(options[DUMP_JSON].value, "w");
+        if(dumpFP == NULL) {
+            printf("Could not open the dump file %s for writing.\n", options[DUMP_JSON].value);
+            status = U_FILE_ACCESS_ERROR;
+            return;
+        }
+        fprintf(dumpFP, "{\"tests\":[");
+    }
+
     int32_t len = 0;
     if(fileName!=NULL){
         //pre-flight
@@ -410,6 +627,8 @@ UBool UPerfTest::runTestLoop( char* testname, char* par )
 
             double min_t=1000000.0, sum_t=0.0;
             long events = -1;
+            double *passTimes = new double[passes];
+            int32_t validPasses = 0;
 
             for(int32_t ps =0; ps < passes; ps++){
                 fprintf(stdout,"= %s begin " ,name);
@@ -431,6 +650,7 @@ UBool UPerfTest::runTestLoop( char* testname, char* par )
                 if(t<min_t) {
                     min_t=t;
                 }
+                passTimes[validPasses++] = t;
                 events = testFunction->getEventsPerIteration();
                 //print info only in verbose mode
                 if(verbose==TRUE){
@@ -465,6 +685,131 @@ UBool UPerfTest::runTestLoop( char* testname, char* par )
                             name, min_t, (int)loops, (min_t*1E9)/(loops*ops), (min_t*1E9)/(loops*events));
                 }
             }
+            if(validPasses > 0 && loops > 0 && ops > 0 && U_SUCCESS(status)) {
+                // Statistics over the passes. The per-pass prints above are
+                // unchanged for existing log scrapers; these summary lines
+                // use their own prefixes.
+                qsort(passTimes, validPasses, sizeof(passTimes[0]), perf_compareDoubles);
+                double median = (validPasses & 1) != 0 ?
+                        passTimes[validPasses / 2] :
+                        (passTimes[validPasses / 2 - 1] + passTimes[validPasses / 2]) / 2.0;
+                double mean = sum_t / validPasses;
+                double sumSq = 0.0;
+                for(int32_t ps = 0; ps < validPasses; ps++) {
+                    double d = passTimes[ps] - mean;
+                    sumSq += d * d;
+                }
+                // Sample standard deviation and a normal-approximation 95%
+                // confidence interval of the mean; crude for few passes, but
+                // passes are cheap and -p 10 or more is the intended use.
+                double stddev = validPasses > 1 ? sqrt(sumSq / (validPasses - 1)) : 0.0;
+                double ci95 = validPasses > 1 ? 1.96 * stddev / sqrt((double)validPasses) : 0.0;
+                fprintf(stdout, "S= %s median: %.4g mean: %.4g stddev: %.4g ci95: %.4g passes: %i median/op: %.4g ns\n",
+                        name, median, mean, stddev, ci95, (int)validPasses,
+                        (median*1E9)/(loops*ops));
+                if(countAllocs) {
+                    // One more un-timed iteration with the counting allocator
+                    // pushed; after the timed passes the caches are warm, so
+                    // this is the steady-state allocation cost.
+                    UErrorCode subStatus = U_ZERO_ERROR;
+                    countAllocCalls = countAllocBytes = countFreeCalls = 0;
+                    countLiveBytes = countHighWater = 0;
+                    uprv_pushThreadMemoryFunctions(NULL, perf_countingAlloc,
+                                                   perf_countingRealloc, perf_countingFree,
+                                                   &subStatus);
+                    if(U_SUCCESS(subStatus)) {
+                        testFunction->call(&subStatus);
+                        uprv_popThreadMemoryFunctions();
+                        long peakRSS = perf_peakRSSKilobytes();
+                        fprintf(stdout, "A= %s allocs: %li bytes: %li frees: %li highWater: %li per iteration (%li ops)",
+                                name, countAllocCalls, countAllocBytes, countFreeCalls,
+                                countHighWater, ops);
+                        if(peakRSS >= 0) {
+                            fprintf(stdout, " maxRSS: %li KB", peakRSS);
+                        }
+                        fprintf(stdout, "\n");
+                    }
+                }
+                if(hwCounters) {
+#if defined(__linux__)
+                    int fds[PERF_HW_COUNT];
+                    UBool anyOpen = FALSE;
+                    for(int32_t c = 0; c < PERF_HW_COUNT; c++) {
+                        fds[c] = perf_openHWCounter(perf_hwConfigs[c]);
+                        if(fds[c] >= 0) {
+                            anyOpen = TRUE;
+                        }
+                    }
+                    if(anyOpen) {
+                        // Same single steady-state iteration as the A= report.
+                        UErrorCode subStatus = U_ZERO_ERROR;
+                        uint64_t values[PERF_HW_COUNT];
+                        for(int32_t c = 0; c < PERF_HW_COUNT; c++) {
+                            if(fds[c] >= 0) {
+                                ioctl(fds[c], PERF_EVENT_IOC_RESET, 0);
+                                ioctl(fds[c], PERF_EVENT_IOC_ENABLE, 0);
+                            }
+                        }
+                        testFunction->call(&subStatus);
+                        for(int32_t c = 0; c < PERF_HW_COUNT; c++) {
+                            if(fds[c] >= 0) {
+                                ioctl(fds[c], PERF_EVENT_IOC_DISABLE, 0);
+                                if(read(fds[c], &values[c], sizeof(values[c])) != sizeof(values[c])) {
+                                    close(fds[c]);
+                                    fds[c] = -1;
+                                }
+                            }
+                        }
+                        fprintf(stdout, "C= %s", name);
+                        static const char *const counterNames[PERF_HW_COUNT] = {
+                            "cycles", "instructions", "branch-misses", "llc-misses"
+                        };
+                        for(int32_t c = 0; c < PERF_HW_COUNT; c++) {
+                            if(fds[c] >= 0) {
+                                fprintf(stdout, " %s: %llu", counterNames[c],
+                                        (unsigned long long)values[c]);
+                            } else {
+                                fprintf(stdout, " %s: -", counterNames[c]);
+                            }
+                        }
+                        if(fds[PERF_HW_CYCLES] >= 0 && fds[PERF_HW_INSTRUCTIONS] >= 0 &&
+                                values[PERF_HW_CYCLES] > 0) {
+                            fprintf(stdout, " ipc: %.2f",
+                                    (double)values[PERF_HW_INSTRUCTIONS]/(double)values[PERF_HW_CYCLES]);
+                        }
+                        fprintf(stdout, " per iteration (%li ops)\n", ops);
+                        for(int32_t c = 0; c < PERF_HW_COUNT; c++) {
+                            if(fds[c] >= 0) {
+                                close(fds[c]);
+                            }
+                        }
+                    } else {
+                        fprintf(stdout, "C= %s hardware counters unavailable: %s\n",
+                                name, strerror(errno));
+                    }
+#else
+                    fprintf(stdout, "C= %s hardware counters not supported on this platform\n",
+                            name);
+#endif
+                }
+                if(dumpFP != NULL) {
+                    fprintf(dumpFP, "%s\n  {\"name\":\"%s\",\"median\":%.9g,\"mean\":%.9g,\"stddev\":%.9g,\"loops\":%i,\"ops\":%li}",
+                            dumpCount > 0 ? "," : "", name, median, mean, stddev, (int)loops, ops);
+                    dumpCount++;
+                }
+                if(baselineFile != NULL) {
+                    double baseMedian = 0.0;
+                    if(perf_readBaselineMedian(baselineFile, name, &baseMedian) && baseMedian > 0.0) {
+                        double deltaPct = (median - baseMedian) / baseMedian * 100.0;
+                        fprintf(stdout, "D= %s baseline: %.4g current: %.4g delta: %+.2f%%%s\n",
+                                name, baseMedian, median, deltaPct,
+                                fabs(median - baseMedian) > ci95 ? " (exceeds ci95)" : "");
+                    } else {
+                        fprintf(stdout, "D= %s not found in baseline %s\n", name, baselineFile);
+                    }
+                }
+            }
+            delete[] passTimes;
             delete testFunction;
         }
         index++;
@@ -530,6 +875,10 @@ UPerfTest::~UPerfTest(){
         uprv_free(resolvedFileName);
     }
     ucbuf_close(ucharBuf);
+    if(dumpFP!=NULL){
+        fprintf(dumpFP, "\n]}\n");
+        fclose(dumpFP);
+    }
 }
 
 #endif
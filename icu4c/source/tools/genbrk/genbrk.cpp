@@ -41,6 +41,7 @@
 #include "ucmndata.h"
 #include "rbbidata.h"
 #include "cmemory.h"
+#include "phasetiming.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -198,9 +199,12 @@ int  main(int argc, char **argv) {
     }
     status = U_ZERO_ERROR;
 
+    phaseTimingStart("genbrk");
+
     //
     //  Read in the rule source file
     //
+    phaseTimingBegin("parse");
     long        result;
     long        ruleFileSize;
     FILE        *file;
@@ -277,6 +281,7 @@ int  main(int argc, char **argv) {
         exit(status);
     };
     ucnv_close(conv);
+    phaseTimingEnd("parse");
 
 
     //
@@ -291,17 +296,20 @@ int  main(int argc, char **argv) {
     UParseError parseError;
     parseError.line = 0;
     parseError.offset = 0;
+    phaseTimingBegin("build");
     RuleBasedBreakIterator *bi = new RuleBasedBreakIterator(ruleSourceS, parseError, status);
     if (U_FAILURE(status)) {
         fprintf(stderr, "createRuleBasedBreakIterator: ICU Error \"%s\"  at line %d, column %d\n",
                 u_errorName(status), (int)parseError.line, (int)parseError.offset);
         exit(status);
     };
+    phaseTimingEnd("build");
 
 
     //
     //  Get the compiled rule data from the break iterator.
     //
+    phaseTimingBegin("serialize");
     uint32_t        outDataSize;
     const uint8_t  *outData;
     outData = bi->getBinaryRules(outDataSize);
@@ -335,6 +343,8 @@ int  main(int argc, char **argv) {
         fprintf(stderr, "Error writing to output file \"%s\"\n", outFileName);
         exit(-1);
     }
+    phaseTimingEnd("serialize");
+    phaseTimingDone();
 
     delete bi;
     delete[] ruleSourceU;
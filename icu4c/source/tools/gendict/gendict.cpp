@@ -122,6 +122,7 @@ private:
     UCharsTrieBuilder *ut;
     UChar32 transformConstant;
     int32_t transformType;
+    CharString transformBuffer;  // scratch for transform(), reused across words
 public:
     // constructs a new data dictionary. if there is an error, 
     // it will be returned in status
@@ -194,9 +195,9 @@ public:
     // add a word to the trie
     void addWord(const UnicodeString &word, int32_t value, UErrorCode &status) {
         if (bt) {
-            CharString buf;
-            transform(word, buf, status);
-            bt->add(buf.toStringPiece(), value, status);
+            transformBuffer.clear();
+            transform(word, transformBuffer, status);
+            bt->add(transformBuffer.toStringPiece(), value, status);
         }
         if (ut) { ut->add(word, value, status); }
     }
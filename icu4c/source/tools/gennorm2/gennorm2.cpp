@@ -34,6 +34,7 @@
 #include "unicode/unistr.h"
 #include "charstr.h"
 #include "normalizer2impl.h"
+#include "phasetiming.h"
 #include "toolutil.h"
 #include "uoptions.h"
 #include "uparse.h"
@@ -153,6 +154,8 @@ main(int argc, char* argv[]) {
 
 #else
 
+    phaseTimingStart("gennorm2");
+
     LocalPointer<Normalizer2DataBuilder> b1(new Normalizer2DataBuilder(errorCode), errorCode);
     LocalPointer<Normalizer2DataBuilder> b2;
     LocalPointer<Normalizer2DataBuilder> diff;
@@ -208,7 +211,9 @@ main(int argc, char* argv[]) {
             exit(U_FILE_ACCESS_ERROR);
         }
         builder->setOverrideHandling(Normalizer2DataBuilder::OVERRIDE_PREVIOUS);
+        phaseTimingBegin("parse");
         parseFile(f, *builder);
+        phaseTimingEnd("parse");
         filename.truncate(pathLength);
     }
 
@@ -223,6 +228,8 @@ main(int argc, char* argv[]) {
         builder->writeBinaryFile(options[OUTPUT_FILENAME].value);
     }
 
+    phaseTimingDone();
+
     return errorCode.get();
 
 #endif
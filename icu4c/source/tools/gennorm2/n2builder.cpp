@@ -41,6 +41,7 @@
 #include "hash.h"
 #include "normalizer2impl.h"
 #include "norms.h"
+#include "phasetiming.h"
 #include "toolutil.h"
 #include "unewdata.h"
 #include "uvectr32.h"
@@ -776,8 +777,11 @@ LocalUCPTriePointer Normalizer2DataBuilder::processData() {
 }
 
 void Normalizer2DataBuilder::writeBinaryFile(const char *filename) {
+    phaseTimingBegin("build");
     processData();
+    phaseTimingEnd("build");
 
+    phaseTimingBegin("serialize");
     IcuToolErrorCode errorCode("gennorm2/writeBinaryFile()");
     UNewDataMemory *pData=
         udata_create(NULL, NULL, filename, &dataInfo,
@@ -802,6 +806,7 @@ void Normalizer2DataBuilder::writeBinaryFile(const char *filename) {
             (long)writtenSize, (long)totalSize);
         exit(U_INTERNAL_PROGRAM_ERROR);
     }
+    phaseTimingEnd("serialize");
 }
 
 void
@@ -31,6 +31,7 @@
 #include "charstr.h"
 #include "cmemory.h"
 #include "filterrb.h"
+#include "filetools.h"
 #include "reslist.h"
 #include "ucmndata.h"  /* TODO: for reading the pool bundle */
 
@@ -43,6 +44,8 @@ void  processFile(const char *filename, const char* cp,
                   SRBRoot *newPoolBundle, UBool omitBinaryCollation, UErrorCode &status);
 static char *make_res_filename(const char *filename, const char *outputDir,
                                const char *packageName, UErrorCode &status);
+static UBool outputIsUpToDate(const char *inputPath, const char *filename,
+                              const char *outputDir, UErrorCode &status);
 
 /* File suffixes */
 #define RES_SUFFIX ".res"
@@ -84,7 +87,8 @@ enum
     WRITE_POOL_BUNDLE,
     USE_POOL_BUNDLE,
     INCLUDE_UNIHAN_COLL,
-    FILTERDIR
+    FILTERDIR,
+    INCREMENTAL
 };
 
 UOption options[]={
@@ -111,6 +115,7 @@ UOption options[]={
                       UOPTION_DEF("usePoolBundle", '\x01', UOPT_OPTIONAL_ARG),/* 20 */
                       UOPTION_DEF("includeUnihanColl", '\x01', UOPT_NO_ARG),/* 21 */ /* temporary, don't display in usage info */
                       UOPTION_DEF("filterDir", '\x01', UOPT_OPTIONAL_ARG), /* 22 */
+                      UOPTION_DEF("incremental", '\x01', UOPT_NO_ARG), /* 23 */
                   };
 
 static     UBool       write_java = FALSE;
@@ -241,6 +246,10 @@ main(int argc,
         fprintf(stderr,
                 "\t      --filterDir          Input directory where filter files are available.\n"
                 "\t                           For more on filter files, see Python buildtool.\n");
+        fprintf(stderr,
+                "\t      --incremental        skip input files whose .res file in the destination\n"
+                "\t                           directory is newer than the input; the .res file name\n"
+                "\t                           is assumed to match the input file name\n");
 
         return illegalArg ? U_ILLEGAL_ARGUMENT_ERROR : U_ZERO_ERROR;
     }
@@ -523,6 +532,17 @@ main(int argc,
     if((argc-1)!=1) {
         printf("genrb number of files: %d\n", argc - 1);
     }
+
+    UBool incremental = options[INCREMENTAL].doesOccur;
+    if (incremental &&
+            (options[WRITE_POOL_BUNDLE].doesOccur || write_java || write_xliff)) {
+        /* These modes accumulate output across all input files,
+           so every input has to be processed. */
+        fprintf(stderr, "%s: --incremental ignored with "
+                "--writePoolBundle, --write-java or --write-xliff\n", argv[0]);
+        incremental = FALSE;
+    }
+
     /* generate the binary files */
     for(i = 1; i < argc; ++i) {
         status = U_ZERO_ERROR;
@@ -538,6 +558,12 @@ main(int argc,
         }
 
         gCurrentFileName = theCurrentFileName.data();
+        if (incremental && outputIsUpToDate(theCurrentFileName.data(), arg, outputDir, status)) {
+            if (isVerbose()) {
+                printf("Skipping unchanged file \"%s\"\n", theCurrentFileName.data());
+            }
+            continue;
+        }
         if (isVerbose()) {
             printf("Processing file \"%s\"\n", theCurrentFileName.data());
         }
@@ -572,6 +598,32 @@ main(int argc,
     return status;
 }
 
+/* Returns TRUE if the .res file corresponding to the input file already
+   exists in the output directory and is newer than the input. The .res name
+   is derived from the input file name; when the bundle is named differently
+   inside the file, the check simply fails and the file is recompiled. */
+static UBool
+outputIsUpToDate(const char *inputPath, const char *filename,
+                 const char *outputDir, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+    const char *base = findBasename(filename);
+    const char *dot = uprv_strrchr(base, '.');
+    int32_t baseLength = dot != NULL ? (int32_t)(dot - base) : (int32_t)uprv_strlen(base);
+    CharString resFileName;
+    if (outputDir != NULL) {
+        resFileName.append(outputDir, status);
+    }
+    resFileName.appendPathPart(StringPiece(base, baseLength), status);
+    resFileName.append(RES_SUFFIX, status);
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+    return (UBool)(T_FileStream_file_exists(resFileName.data()) &&
+            isFileModTimeLater(resFileName.data(), inputPath));
+}
+
 /* Process a file */
 void
 processFile(const char *filename, const char *cp,
@@ -0,0 +1,232 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+ * icumemusage: per-subsystem heap attribution report.
+ *
+ * Answers "what does an open ja collator / NFC normalizer / GB18030
+ * converter actually cost?" by interposing a counting allocator over all
+ * ICU heap traffic (uprv_pushThreadMemoryFunctions) and opening the
+ * major subsystems one at a time in a fresh process. For each subsystem
+ * the tool reports:
+ *
+ *   retained   live ICU heap bytes added by the open, i.e. the cost of
+ *              keeping the object open (caches and singletons it pulled
+ *              in are attributed to the first opener)
+ *   peak       additional transient bytes while opening
+ *   allocs     allocation calls during the open
+ *
+ * Heap numbers exclude memory-mapped data files, which are shared
+ * between processes; the process peak RSS printed at the end includes
+ * them. The scenarios run in a fixed order, so numbers are comparable
+ * across versions but each line depends on what earlier lines already
+ * loaded; the first line pays for mapping-side allocation of the common
+ * data.
+ *
+ * The allocator override must wrap the entire ICU lifetime: every block
+ * carries a size header, so it is pushed before the first ICU call and
+ * popped only after u_cleanup() has released everything.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "unicode/utypes.h"
+#include "unicode/uclean.h"
+#include "unicode/ures.h"
+#include "unicode/ucnv.h"
+#include "unicode/unorm2.h"
+#include "unicode/ubrk.h"
+#include "unicode/ucol.h"
+#include "cmemory.h"
+#include "uoptions.h"
+
+#if U_PLATFORM != U_PF_WINDOWS && U_PLATFORM != U_PF_CYGWIN
+#include <sys/time.h>
+#include <sys/resource.h>
+#endif
+
+static long liveBytes = 0;
+static long highWater = 0;
+static long allocCalls = 0;
+
+#define USAGE_ALLOC_HEADER (((sizeof(size_t) + sizeof(UAlignedMemory) - 1) / sizeof(UAlignedMemory)) * sizeof(UAlignedMemory))
+
+static void * U_CALLCONV countingAlloc(const void * /*context*/, size_t size) {
+    char *block = (char *)malloc(USAGE_ALLOC_HEADER + size);
+    if (block == NULL) {
+        return NULL;
+    }
+    *(size_t *)block = size;
+    allocCalls++;
+    liveBytes += (long)size;
+    if (liveBytes > highWater) {
+        highWater = liveBytes;
+    }
+    return block + USAGE_ALLOC_HEADER;
+}
+
+static void * U_CALLCONV countingRealloc(const void * /*context*/, void *mem, size_t size) {
+    char *block = (char *)mem;
+    if (block != NULL) {
+        block -= USAGE_ALLOC_HEADER;
+        liveBytes -= (long)*(size_t *)block;
+    }
+    block = (char *)realloc(block, USAGE_ALLOC_HEADER + size);
+    if (block == NULL) {
+        return NULL;
+    }
+    *(size_t *)block = size;
+    allocCalls++;
+    liveBytes += (long)size;
+    if (liveBytes > highWater) {
+        highWater = liveBytes;
+    }
+    return block + USAGE_ALLOC_HEADER;
+}
+
+static void U_CALLCONV countingFree(const void * /*context*/, void *mem) {
+    if (mem != NULL) {
+        char *block = (char *)mem - USAGE_ALLOC_HEADER;
+        liveBytes -= (long)*(size_t *)block;
+        free(block);
+    }
+}
+
+/* Scenario open functions return a handle passed to the close function
+   at the end of the run; singletons return NULL and close is NULL. */
+
+static void *openResBundle(const char *arg, UErrorCode *status) {
+    return ures_open(NULL, arg, status);
+}
+static void closeResBundle(void *handle) {
+    ures_close((UResourceBundle *)handle);
+}
+
+static void *openConverter(const char *arg, UErrorCode *status) {
+    return ucnv_open(arg, status);
+}
+static void closeConverter(void *handle) {
+    ucnv_close((UConverter *)handle);
+}
+
+static void *openNFC(const char * /*arg*/, UErrorCode *status) {
+    unorm2_getNFCInstance(status);
+    return NULL;
+}
+static void *openNFKC(const char * /*arg*/, UErrorCode *status) {
+    unorm2_getNFKCInstance(status);
+    return NULL;
+}
+
+static void *openWordBreak(const char *arg, UErrorCode *status) {
+    return ubrk_open(UBRK_WORD, arg, NULL, 0, status);
+}
+static void closeWordBreak(void *handle) {
+    ubrk_close((UBreakIterator *)handle);
+}
+
+static void *openCollator(const char *arg, UErrorCode *status) {
+    return ucol_open(arg, status);
+}
+static void closeCollator(void *handle) {
+    ucol_close((UCollator *)handle);
+}
+
+static const struct {
+    const char *name;
+    void *(*open)(const char *arg, UErrorCode *status);
+    void (*close)(void *handle);
+    const char *arg;
+} scenarios[] = {
+    { "resbund root",        openResBundle, closeResBundle, "" },
+    { "resbund ja",          openResBundle, closeResBundle, "ja" },
+    { "converter UTF-8",     openConverter, closeConverter, "UTF-8" },
+    { "converter Shift-JIS", openConverter, closeConverter, "Shift-JIS" },
+    { "converter GB18030",   openConverter, closeConverter, "GB18030" },
+    { "normalizer NFC",      openNFC,       NULL,           "" },
+    { "normalizer NFKC",     openNFKC,      NULL,           "" },
+    { "break word root",     openWordBreak, closeWordBreak, "root" },
+    { "break word th",       openWordBreak, closeWordBreak, "th" },
+    { "break word ja",       openWordBreak, closeWordBreak, "ja" },
+    { "collator root",       openCollator,  closeCollator,  "" },
+    { "collator ja",         openCollator,  closeCollator,  "ja" }
+};
+
+static UOption options[] = {
+    UOPTION_HELP_H,             /* 0 */
+    UOPTION_HELP_QUESTION_MARK  /* 1 */
+};
+
+int main(int argc, char *argv[]) {
+    const char *pname = argv[0];
+    UErrorCode status = U_ZERO_ERROR;
+    void *handles[UPRV_LENGTHOF(scenarios)];
+
+    argc = u_parseArgs(argc, argv, UPRV_LENGTHOF(options), options);
+    if (argc < 0 || options[0].doesOccur || options[1].doesOccur) {
+        fprintf(stderr,
+                "Usage: %s\n"
+                "\tPrints per-subsystem ICU heap usage: bytes retained by opening\n"
+                "\teach major object, transient peak while opening, and allocation\n"
+                "\tcounts. Heap only; memory-mapped data is visible in the final\n"
+                "\tpeak-RSS line, not in the per-subsystem rows.\n",
+                pname);
+        return argc < 0 ? 1 : 0;
+    }
+
+    uprv_pushThreadMemoryFunctions(NULL, countingAlloc, countingRealloc, countingFree, &status);
+    if (U_FAILURE(status)) {
+        fprintf(stderr, "%s: could not install counting allocator: %s\n",
+                pname, u_errorName(status));
+        return 2;
+    }
+
+    printf("%-22s %12s %12s %10s\n", "subsystem", "retained B", "peak extra B", "allocs");
+    for (int32_t i = 0; i < UPRV_LENGTHOF(scenarios); i++) {
+        long liveBefore = liveBytes;
+        long allocsBefore = allocCalls;
+        UErrorCode subStatus = U_ZERO_ERROR;
+
+        highWater = liveBytes;
+        handles[i] = scenarios[i].open(scenarios[i].arg, &subStatus);
+        if (U_FAILURE(subStatus)) {
+            printf("%-22s open failed: %s\n", scenarios[i].name, u_errorName(subStatus));
+            handles[i] = NULL;
+            continue;
+        }
+        printf("%-22s %12li %12li %10li\n", scenarios[i].name,
+               liveBytes - liveBefore, highWater - liveBytes,
+               allocCalls - allocsBefore);
+    }
+
+    long liveBeforeClose = liveBytes;
+    for (int32_t i = UPRV_LENGTHOF(scenarios) - 1; i >= 0; i--) {
+        if (handles[i] != NULL && scenarios[i].close != NULL) {
+            scenarios[i].close(handles[i]);
+        }
+    }
+    printf("%-22s %12li\n", "released by close", liveBeforeClose - liveBytes);
+    printf("%-22s %12li   (caches, singletons; freed by u_cleanup)\n",
+           "still live", liveBytes);
+
+    u_cleanup();
+    printf("%-22s %12li   (should be 0)\n", "live after u_cleanup", liveBytes);
+    uprv_popThreadMemoryFunctions();
+
+#if U_PLATFORM != U_PF_WINDOWS && U_PLATFORM != U_PF_CYGWIN
+    {
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#if U_PLATFORM_IS_DARWIN_BASED
+            printf("%-22s %12li KB (includes mapped data)\n", "process peak RSS",
+                   (long)(usage.ru_maxrss / 1024));
+#else
+            printf("%-22s %12li KB (includes mapped data)\n", "process peak RSS",
+                   (long)usage.ru_maxrss);
+#endif
+        }
+    }
+#endif
+    return 0;
+}
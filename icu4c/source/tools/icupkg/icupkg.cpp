@@ -57,7 +57,7 @@ printUsage(const char *pname, UBool isHelp) {
 
     fprintf(where,
             "%csage: %s [-h|-?|--help ] [-tl|-tb|-te] [-c] [-C comment]\n"
-            "\t[-a list] [-r list] [-x list] [-l [-o outputListFileName]]\n"
+            "\t[-a list] [-r list] [-k list] [-x list] [-l [-o outputListFileName]]\n"
             "\t[-s path] [-d path] [-w] [-m mode]\n"
             "\t[--auto_toc_prefix] [--auto_toc_prefix_with_type] [--toc_prefix]\n"
             "\tinfilename [outfilename]\n",
@@ -106,6 +106,10 @@ printUsage(const char *pname, UBool isHelp) {
             "\n"
             "\t-a list or --add list      add items to the package\n"
             "\t-r list or --remove list   remove items from the package\n"
+            "\t-k list or --keep list     retain only the listed items (and the items\n"
+            "\t                           they transitively depend on) and remove all\n"
+            "\t                           others, slicing the package down to the\n"
+            "\t                           data that the listed services use\n"
             "\t-x list or --extract list  extract items from the package\n"
             "\tThe list can be a single item's filename,\n"
             "\tor a .txt filename with a list of item filenames,\n"
@@ -200,6 +204,7 @@ static UOption options[]={
 
     UOPTION_DEF("add", 'a', UOPT_REQUIRES_ARG),
     UOPTION_DEF("remove", 'r', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("keep", 'k', UOPT_REQUIRES_ARG),
     UOPTION_DEF("extract", 'x', UOPT_REQUIRES_ARG),
 
     UOPTION_DEF("list", 'l', UOPT_NO_ARG),
@@ -227,6 +232,7 @@ enum {
 
     OPT_ADD_LIST,
     OPT_REMOVE_LIST,
+    OPT_KEEP_LIST,
     OPT_EXTRACT_LIST,
 
     OPT_LIST_ITEMS,
@@ -389,6 +395,7 @@ main(int argc, char *argv[]) {
             options[OPT_COPYRIGHT].doesOccur ||
             options[OPT_MATCHMODE].doesOccur ||
             options[OPT_REMOVE_LIST].doesOccur ||
+            options[OPT_KEEP_LIST].doesOccur ||
             options[OPT_ADD_LIST].doesOccur ||
             options[OPT_EXTRACT_LIST].doesOccur ||
             options[OPT_LIST_ITEMS].doesOccur
@@ -440,6 +447,23 @@ main(int argc, char *argv[]) {
         }
     }
 
+    /* retain only the listed items plus their transitive dependencies */
+    if(options[OPT_KEEP_LIST].doesOccur) {
+        listPkg=new Package();
+        if(listPkg==NULL) {
+            fprintf(stderr, "icupkg: not enough memory\n");
+            exit(U_MEMORY_ALLOCATION_ERROR);
+        }
+        if(readList(NULL, options[OPT_KEEP_LIST].value, FALSE, listPkg)) {
+            pkg->retainItems(*listPkg);
+            delete listPkg;
+            isModified=TRUE;
+        } else {
+            printUsage(pname, FALSE);
+            return U_ILLEGAL_ARGUMENT_ERROR;
+        }
+    }
+
     /*
      * add items
      * use a separate Package so that its memory and items stay around
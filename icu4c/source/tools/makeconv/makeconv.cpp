@@ -39,19 +39,21 @@
 
 #define DEBUG 0
 
+/*
+ * Trivially copyable so that the base cache can snapshot it with memcpy;
+ * in particular no UConverterSharedData, which embeds a UInitOnce and
+ * which makeconv never used anyway.
+ */
 typedef struct ConvData {
     UCMFile *ucm;
     NewConverter *cnvData, *extData;
-    UConverterSharedData sharedData;
     UConverterStaticData staticData;
 } ConvData;
 
 static void
 initConvData(ConvData *data) {
     uprv_memset(data, 0, sizeof(ConvData));
-    data->sharedData.structSize=sizeof(UConverterSharedData);
     data->staticData.structSize=sizeof(UConverterStaticData);
-    data->sharedData.staticData=&data->staticData;
 }
 
 static void
@@ -70,6 +72,26 @@ cleanupConvData(ConvData *data) {
     }
 }
 
+/*
+ * Cache for the most recently read base table file.
+ * Extension-only .ucm files in one invocation often share a base,
+ * and cloning the parsed tables is much cheaper than re-parsing the file.
+ * The base tables are modified during extension generation
+ * (mappings may be moved to the extension table),
+ * so each use gets its own clone.
+ */
+static ConvData gCachedBase;
+static char gCachedBaseFilename[500];
+static UBool gCachedBaseIsValid=FALSE;
+
+static void
+cleanupBaseCache(void) {
+    if(gCachedBaseIsValid) {
+        cleanupConvData(&gCachedBase);
+        gCachedBaseIsValid=FALSE;
+    }
+}
+
 /*
  * from ucnvstat.c - static prototypes of data-based converters
  */
@@ -412,6 +434,8 @@ int main(int argc, char* argv[])
         cleanupConvData(&data);
     }
 
+    cleanupBaseCache();
+
     return err;
 }
 
@@ -635,6 +659,37 @@ readFile(ConvData *data, const char* converterName,
     return dataIsBase;
 }
 
+/*
+ * Read a base table file for an extension-only file,
+ * via the cache of the most recently used base.
+ * Returns the same as readFile().
+ */
+static UBool
+readBaseFile(ConvData *baseData, const char *baseFilename, UErrorCode *pErrorCode) {
+    UBool dataIsBase;
+
+    if(gCachedBaseIsValid && 0==uprv_strcmp(baseFilename, gCachedBaseFilename)) {
+        /* only base table files are cached */
+        uprv_memcpy(baseData, &gCachedBase, sizeof(ConvData));
+        baseData->ucm=ucm_clone(gCachedBase.ucm);
+        return TRUE;
+    }
+
+    dataIsBase=readFile(baseData, baseFilename, pErrorCode);
+    if(U_FAILURE(*pErrorCode) || !dataIsBase ||
+            (int32_t)uprv_strlen(baseFilename)>=(int32_t)sizeof(gCachedBaseFilename)) {
+        return dataIsBase;
+    }
+
+    /* cache a clone of this base for subsequent extension files */
+    cleanupBaseCache();
+    uprv_memcpy(&gCachedBase, baseData, sizeof(ConvData));
+    gCachedBase.ucm=ucm_clone(baseData->ucm);
+    uprv_strcpy(gCachedBaseFilename, baseFilename);
+    gCachedBaseIsValid=TRUE;
+    return TRUE;
+}
+
 static void
 createConverter(ConvData *data, const char *converterName, UErrorCode *pErrorCode) {
     ConvData baseData;
@@ -734,7 +789,7 @@ createConverter(ConvData *data, const char *converterName, UErrorCode *pErrorCod
         uprv_strcat(basename, ".ucm");
 
         /* read the base table */
-        dataIsBase=readFile(&baseData, baseFilename, pErrorCode);
+        dataIsBase=readBaseFile(&baseData, baseFilename, pErrorCode);
         if(U_FAILURE(*pErrorCode)) {
             return;
         } else if(!dataIsBase) {
@@ -34,14 +34,31 @@
 #include "toolutil.h"
 #include "package.h"
 #include "cmemory.h"
+#include "umapfile.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#if MAP_IMPLEMENTATION==MAP_POSIX
+#   include <unistd.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <fcntl.h>
+#   ifndef MAP_FAILED
+#       define MAP_FAILED ((void*)-1)
+#   endif
+#endif
+
 
 static const int32_t kItemsChunk = 256; /* How much to increase the filesarray by each time */
 
+/* Pad the first item to this boundary so that, with the archive mapped at a
+   page-aligned base, the table of contents and item names do not share pages
+   with item data. Item lengths are multiples of 16, so all items remain
+   16-aligned as before. */
+static const int32_t kItemDataAlignment = 0x1000;
+
 // general definitions ----------------------------------------------------- ***
 
 /* UDataInfo cf. udata.h */
@@ -366,6 +383,75 @@ readFile(const char *path, const char *name, int32_t &length, char &type) {
     return data.orphan();
 }
 
+/*
+ * Map a package file copy-on-write where the platform supports it.
+ * Unmodified item bytes then stay file-backed and shared between processes;
+ * pages are copied privately only when they are written to
+ * (for example, by byte swapping for a different output type).
+ * Returns NULL if mapping is unavailable or unsuitable;
+ * the caller falls back to readFile().
+ */
+static uint8_t *
+mapPackageFile(const char *filename, int32_t &length, char &type) {
+#if MAP_IMPLEMENTATION==MAP_POSIX
+    int fd;
+    struct stat mystat;
+    void *data;
+    int32_t typeEnum;
+    UErrorCode errorCode;
+
+    fd=open(filename, O_RDONLY);
+    if(fd==-1) {
+        return NULL;
+    }
+    if(fstat(fd, &mystat)!=0 || mystat.st_size<=0 || mystat.st_size>0x7ffffff0 ||
+            (mystat.st_size&0xf)!=0) {
+        /* let readFile() deal with empty/huge files and pad odd lengths */
+        close(fd);
+        return NULL;
+    }
+    length=(int32_t)mystat.st_size;
+
+    data=mmap(0, length, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(data==MAP_FAILED) {
+        return NULL;
+    }
+
+    /* minimum check for ICU-format data, same as in readFile() */
+    errorCode=U_ZERO_ERROR;
+    typeEnum=getTypeEnumForInputData((const uint8_t *)data, length, &errorCode);
+    if(typeEnum<0 || U_FAILURE(errorCode)) {
+        munmap(data, length);
+        fprintf(stderr, "icupkg: not an ICU data file: \"%s\"\n", filename);
+#if !UCONFIG_NO_LEGACY_CONVERSION
+        exit(U_INVALID_FORMAT_ERROR);
+#else
+        fprintf(stderr, "U_INVALID_FORMAT_ERROR occurred but UCONFIG_NO_LEGACY_CONVERSION is on so this is expected.\n");
+        exit(0);
+#endif
+    }
+    type=makeTypeLetter(typeEnum);
+
+    return (uint8_t *)data;
+#else
+    (void)filename;
+    (void)length;
+    (void)type;
+    return NULL;
+#endif
+}
+
+static void
+unmapPackageFile(uint8_t *data, int32_t length) {
+#if MAP_IMPLEMENTATION==MAP_POSIX
+    munmap(data, length);
+#else
+    (void)data;
+    (void)length;
+#endif
+}
+
 // .dat package file representation ---------------------------------------- ***
 
 U_CDECL_BEGIN
@@ -386,6 +472,8 @@ Package::Package()
     inPkgName[0]=0;
     pkgPrefix[0]=0;
     inData=NULL;
+    inIsMapped=FALSE;
+    inMappedLength=0;
     inLength=0;
     inCharset=U_CHARSET_FAMILY;
     inIsBigEndian=U_IS_BIG_ENDIAN;
@@ -420,7 +508,11 @@ Package::Package()
 Package::~Package() {
     int32_t idx;
 
-    uprv_free(inData);
+    if(inIsMapped) {
+        unmapPackageFile(inData, inMappedLength);
+    } else {
+        uprv_free(inData);
+    }
 
     for(idx=0; idx<itemCount; ++idx) {
         if(items[idx].isDataOwned) {
@@ -456,8 +548,14 @@ Package::readPackage(const char *filename) {
 
     extractPackageName(filename, inPkgName, (int32_t)sizeof(inPkgName));
 
-    /* read the file */
-    inData=readFile(NULL, filename, inLength, type);
+    /* map the file copy-on-write, or read it into memory */
+    inData=mapPackageFile(filename, inLength, type);
+    if(inData!=NULL) {
+        inIsMapped=TRUE;
+        inMappedLength=inLength;
+    } else {
+        inData=readFile(NULL, filename, inLength, type);
+    }
     length=inLength;
 
     /*
@@ -804,12 +902,13 @@ Package::writePackage(const char *filename, char outType, const char *comment) {
         items[i].name=name;
     }
 
-    // calculate offsets for item names and items, pad to 16-align items
-    // align only the first item; each item's length is a multiple of 16
+    // calculate offsets for item names and items, pad to align the items
+    // align only the first item, relative to the start of the file;
+    // each item's length is a multiple of 16, which keeps the rest 16-aligned
     basenameOffset=4+8*itemCount;
     offset=basenameOffset+outStringTop;
-    if((length=(offset&15))!=0) {
-        length=16-length;
+    if((length=((headerLength+offset)&(kItemDataAlignment-1)))!=0) {
+        length=kItemDataAlignment-length;
         memset(allocString(FALSE, length-1), 0xaa, length);
         offset+=length;
     }
@@ -1123,6 +1222,59 @@ Package::removeItems(const Package &listPkg) {
     }
 }
 
+/* context for retainItems()/retainDependency() */
+struct RetainDependenciesContext {
+    Package *pkg;
+    UBool *keep;
+    UBool changed;
+};
+
+void
+Package::retainItems(const Package &listPkg) {
+    const Item *pItem;
+    int32_t i, idx;
+
+    if(itemCount==0) {
+        return;
+    }
+    UBool *keep=(UBool *)uprv_malloc(itemCount*sizeof(UBool));
+    if(keep==NULL) {
+        fprintf(stderr, "icupkg: not enough memory for the keep list\n");
+        exit(U_MEMORY_ALLOCATION_ERROR);
+    }
+    memset(keep, 0, itemCount*sizeof(UBool));
+    for(pItem=listPkg.items, i=0; i<listPkg.itemCount; ++pItem, ++i) {
+        findItems(pItem->name);
+        while((idx=findNextItem())>=0) {
+            keep[idx]=TRUE;
+        }
+    }
+
+    /*
+     * Transitively retain the dependencies of retained items so that
+     * slicing by a manifest of directly used items cannot produce a
+     * package that fails the dependency check.
+     */
+    RetainDependenciesContext context;
+    context.pkg=this;
+    context.keep=keep;
+    do {
+        context.changed=FALSE;
+        for(i=0; i<itemCount; ++i) {
+            if(keep[i]) {
+                enumDependencies(items+i, &context, retainDependency);
+            }
+        }
+    } while(context.changed);
+
+    for(idx=itemCount-1; idx>=0; --idx) {
+        if(!keep[idx]) {
+            removeItem(idx);
+        }
+    }
+    uprv_free(keep);
+}
+
 void
 Package::extractItem(const char *filesPath, const char *outName, int32_t idx, char outType) {
     char filename[1024];
@@ -1236,6 +1388,17 @@ Package::checkDependencies() {
     return (UBool)!isMissingItems;
 }
 
+/* assume that the dependency target is in the same package as the item */
+void
+Package::retainDependency(void *context, const char * /*itemName*/, const char *targetName) {
+    RetainDependenciesContext *me=(RetainDependenciesContext *)context;
+    int32_t idx=me->pkg->findItem(targetName);
+    if(idx>=0 && !me->keep[idx]) {
+        me->keep[idx]=TRUE;
+        me->changed=TRUE;
+    }
+}
+
 void
 Package::enumDependencies(void *context, CheckDependency check) {
     int32_t i;
@@ -27,7 +27,7 @@
 
 // .dat package file representation ---------------------------------------- ***
 
-#define STRING_STORE_SIZE 100000
+#define STRING_STORE_SIZE 110000
 #define MAX_PKG_NAME_LENGTH 64
 
 typedef void CheckDependency(void *context, const char *itemName, const char *targetName);
@@ -116,6 +116,13 @@ public:
     void removeItems(const char *pattern);
     void removeItems(const Package &listPkg);
 
+    /*
+     * Remove all items that do not match any pattern in listPkg and are not
+     * (transitively) depended upon by a matching item. Used for slicing a
+     * package down to a manifest of directly used items.
+     */
+    void retainItems(const Package &listPkg);
+
     /* The extractItem() functions accept outputType=0 to mean "don't swap the item". */
     void extractItem(const char *filesPath, int32_t itemIndex, char outType);
     void extractItems(const char *filesPath, const char *pattern, char outType);
@@ -147,6 +154,12 @@ private:
      */
     static void checkDependency(void *context, const char *itemName, const char *targetName);
 
+    /**
+     * CheckDependency function used by retainItems() to pull the
+     * dependencies of retained items into the retained set.
+     */
+    static void retainDependency(void *context, const char *itemName, const char *targetName);
+
     /*
      * Allocate a string in inStrings or outStrings.
      * The length does not include the terminating NUL.
@@ -160,6 +173,8 @@ private:
     char pkgPrefix[MAX_PKG_NAME_LENGTH];
 
     uint8_t *inData;
+    UBool inIsMapped;       // inData is a copy-on-write mapping, not heap memory
+    int32_t inMappedLength; // original mapping length, for unmapping
     uint8_t header[1024];
     int32_t inLength, headerLength;
     uint8_t inCharset;
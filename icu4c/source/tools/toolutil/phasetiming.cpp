@@ -0,0 +1,122 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// phasetiming.cpp
+// see phasetiming.h
+
+#include "unicode/utypes.h"
+#include "unicode/putil.h"
+#include "putilimp.h"
+#include "cstring.h"
+#include "phasetiming.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define MAX_PHASES 32
+
+namespace {
+
+struct Phase {
+    const char *name;
+    double millis;
+    int32_t count;
+};
+
+const char *gToolName = NULL;
+double gToolStart = 0.;
+Phase gPhases[MAX_PHASES];
+int32_t gPhaseCount = 0;
+int32_t gOpenPhase = -1;
+double gOpenStart = 0.;
+FILE *gOut = NULL;
+UBool gEnabled = FALSE;
+
+}  // namespace
+
+U_CAPI void U_EXPORT2
+phaseTimingStart(const char *toolName) {
+    const char *dest = getenv("ICU_TOOL_PHASE_TIMING");
+    gEnabled = FALSE;
+    if (dest == NULL || *dest == 0) {
+        return;
+    }
+    if (uprv_strcmp(dest, "-") == 0) {
+        gOut = stderr;
+    } else {
+        gOut = fopen(dest, "a");
+        if (gOut == NULL) {
+            fprintf(stderr, "%s: unable to open timing output file \"%s\"\n", toolName, dest);
+            return;
+        }
+    }
+    gToolName = toolName;
+    gToolStart = uprv_getRawUTCtime();
+    gPhaseCount = 0;
+    gOpenPhase = -1;
+    gEnabled = TRUE;
+}
+
+U_CAPI void U_EXPORT2
+phaseTimingBegin(const char *phaseName) {
+    int32_t i;
+
+    if (!gEnabled) {
+        return;
+    }
+    if (gOpenPhase >= 0) {
+        phaseTimingEnd(gPhases[gOpenPhase].name);
+    }
+    for (i = 0; i < gPhaseCount; ++i) {
+        if (uprv_strcmp(gPhases[i].name, phaseName) == 0) {
+            break;
+        }
+    }
+    if (i == gPhaseCount) {
+        if (gPhaseCount == MAX_PHASES) {
+            return;  /* too many distinct phases; ignore the extras */
+        }
+        gPhases[i].name = phaseName;
+        gPhases[i].millis = 0.;
+        gPhases[i].count = 0;
+        ++gPhaseCount;
+    }
+    gOpenPhase = i;
+    gOpenStart = uprv_getRawUTCtime();
+}
+
+U_CAPI void U_EXPORT2
+phaseTimingEnd(const char *phaseName) {
+    if (!gEnabled || gOpenPhase < 0 ||
+            uprv_strcmp(gPhases[gOpenPhase].name, phaseName) != 0) {
+        return;
+    }
+    gPhases[gOpenPhase].millis += uprv_getRawUTCtime() - gOpenStart;
+    ++gPhases[gOpenPhase].count;
+    gOpenPhase = -1;
+}
+
+U_CAPI void U_EXPORT2
+phaseTimingDone() {
+    int32_t i;
+
+    if (!gEnabled) {
+        return;
+    }
+    if (gOpenPhase >= 0) {
+        phaseTimingEnd(gPhases[gOpenPhase].name);
+    }
+    fprintf(gOut, "{\"tool\":\"%s\",\"total_ms\":%.3f,\"phases\":[",
+            gToolName, uprv_getRawUTCtime() - gToolStart);
+    for (i = 0; i < gPhaseCount; ++i) {
+        fprintf(gOut, "%s{\"name\":\"%s\",\"ms\":%.3f,\"count\":%d}",
+                i == 0 ? "" : ",",
+                gPhases[i].name, gPhases[i].millis, (int)gPhases[i].count);
+    }
+    fprintf(gOut, "]}\n");
+    if (gOut != stderr) {
+        fclose(gOut);
+    }
+    gOut = NULL;
+    gEnabled = FALSE;
+}
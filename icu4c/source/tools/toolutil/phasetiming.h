@@ -0,0 +1,41 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// phasetiming.h
+//
+// Phase timing for the data-generation tools.
+//
+// Timing is off by default. It is enabled by setting the environment
+// variable ICU_TOOL_PHASE_TIMING to "-" (report on stderr) or to the
+// name of a file to append to. When enabled, phaseTimingDone() emits one
+// JSON object per tool run, for example
+//   {"tool":"genbrk","total_ms":12.345,
+//    "phases":[{"name":"parse","ms":1.2,"count":1}, ...]}
+// so that build logs can be aggregated across the whole data build.
+//
+// Repeated phases with the same name (per-input-file loops) are
+// accumulated into one entry with a count.
+// Not suitable for production use. Not supported.
+
+#ifndef __PHASETIMING_H__
+#define __PHASETIMING_H__
+
+#include "unicode/utypes.h"
+
+/* Check the environment and remember the tool name and start time. */
+U_CAPI void U_EXPORT2
+phaseTimingStart(const char *toolName);
+
+/* Begin a phase; ends any phase that is still open. */
+U_CAPI void U_EXPORT2
+phaseTimingBegin(const char *phaseName);
+
+/* End the named phase and add its elapsed time to its entry. */
+U_CAPI void U_EXPORT2
+phaseTimingEnd(const char *phaseName);
+
+/* Emit the JSON report and release the output file, if timing is enabled. */
+U_CAPI void U_EXPORT2
+phaseTimingDone(void);
+
+#endif
@@ -902,6 +902,64 @@ ucm_closeTable(UCMTable *table) {
     }
 }
 
+U_CAPI UCMTable * U_EXPORT2
+ucm_cloneTable(const UCMTable *other) {
+    UCMTable *table;
+
+    table=ucm_openTable();
+    if(other->mappingsLength>0) {
+        table->mappings=(UCMapping *)uprv_malloc(other->mappingsLength*sizeof(UCMapping));
+        if(table->mappings==NULL) {
+            fprintf(stderr, "ucm error: unable to allocate %d UCMappings\n",
+                            (int)other->mappingsLength);
+            exit(U_MEMORY_ALLOCATION_ERROR);
+        }
+        uprv_memcpy(table->mappings, other->mappings, other->mappingsLength*sizeof(UCMapping));
+        table->mappingsCapacity=table->mappingsLength=other->mappingsLength;
+    }
+    if(other->codePointsLength>0) {
+        table->codePoints=(UChar32 *)uprv_malloc(other->codePointsLength*4);
+        if(table->codePoints==NULL) {
+            fprintf(stderr, "ucm error: unable to allocate %d UChar32s\n",
+                            (int)other->codePointsLength);
+            exit(U_MEMORY_ALLOCATION_ERROR);
+        }
+        uprv_memcpy(table->codePoints, other->codePoints, (size_t)other->codePointsLength*4);
+        table->codePointsCapacity=table->codePointsLength=other->codePointsLength;
+    }
+    if(other->bytesLength>0) {
+        table->bytes=(uint8_t *)uprv_malloc(other->bytesLength);
+        if(table->bytes==NULL) {
+            fprintf(stderr, "ucm error: unable to allocate %d bytes\n",
+                            (int)other->bytesLength);
+            exit(U_MEMORY_ALLOCATION_ERROR);
+        }
+        uprv_memcpy(table->bytes, other->bytes, other->bytesLength);
+        table->bytesCapacity=table->bytesLength=other->bytesLength;
+    }
+    table->unicodeMask=other->unicodeMask;
+    table->flagsType=other->flagsType;
+    /* no reverseMap; the clone is sorted again when needed */
+    return table;
+}
+
+U_CAPI UCMFile * U_EXPORT2
+ucm_clone(const UCMFile *other) {
+    UCMFile *ucm=(UCMFile *)uprv_malloc(sizeof(UCMFile));
+    if(ucm==NULL) {
+        fprintf(stderr, "ucm error: unable to allocate a UCMFile\n");
+        exit(U_MEMORY_ALLOCATION_ERROR);
+    }
+
+    memset(ucm, 0, sizeof(UCMFile));
+
+    ucm->base=ucm_cloneTable(other->base);
+    ucm->ext=ucm_cloneTable(other->ext);
+    ucm->states=other->states;
+    uprv_strcpy(ucm->baseName, other->baseName);
+    return ucm;
+}
+
 U_CAPI void U_EXPORT2
 ucm_resetTable(UCMTable *table) {
     if(table!=NULL) {
@@ -124,6 +124,10 @@ ucm_open(void);
 U_CAPI void U_EXPORT2
 ucm_close(UCMFile *ucm);
 
+/* deep copy of a parsed file, so that the copy can be modified independently */
+U_CAPI UCMFile * U_EXPORT2
+ucm_clone(const UCMFile *other);
+
 U_CAPI UBool U_EXPORT2
 ucm_parseHeaderLine(UCMFile *ucm,
                     char *line, char **pKey, char **pValue);
@@ -152,6 +156,10 @@ ucm_openTable(void);
 U_CAPI void U_EXPORT2
 ucm_closeTable(UCMTable *table);
 
+/* deep copy without the reverseMap; the clone is sorted again when needed */
+U_CAPI UCMTable * U_EXPORT2
+ucm_cloneTable(const UCMTable *other);
+
 U_CAPI void U_EXPORT2
 ucm_resetTable(UCMTable *table);
 